@@ -0,0 +1,716 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sbenchmark.h"
+#include "s9sbenchfixtures.h"
+
+#include "S9sOptions"
+#include "S9sRpcReply"
+#include "S9sVariant"
+#include "S9sGraph"
+#include "S9sSpreadsheet"
+#include "S9sConfigFile"
+#include "S9sDateTime"
+#include "S9sJsonWriter"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The spreadsheet looks up every visible cell by scanning all the cells, the
+ * bigger fixtures would run for minutes.
+ */
+#define MAX_SPREADSHEET_CELLS 10000
+
+#define ALL_SIZES 1000000000
+
+/**
+ * The benchmarks of the s9s library: JSon parsing and serializing, variant
+ * copy and compare, the list printers, graphs, spreadsheets, configuration
+ * files and date parsing.
+ */
+class S9sBench : public S9sBenchmark
+{
+    protected:
+        virtual bool runBenchmarks();
+
+        bool benchJsonParse(int size);
+        bool benchJsonSerialize(int size);
+        bool benchReplyRefresh(int size);
+        bool benchEventStream(int size);
+        bool benchJsonWriter(int size);
+        bool benchVariantMapLookup(int size);
+        bool benchVariantMapInsert(int size);
+        bool benchVariantCopy(int size);
+        bool benchVariantCompare(int size);
+        bool benchClusterListLong(int size);
+        bool benchNodeListBrief(int size);
+        bool benchNodeListFiltered(int size);
+        bool benchClusterListFiltered(int size);
+        bool benchOptionAccess(int size);
+        bool benchJobLog(int size);
+        bool benchGraphRealize(int size);
+        bool benchSpreadsheetPrint(int size);
+        bool benchConfigParse(int size);
+        bool benchConfigLookup(int size);
+        bool benchDateTimeParse(int size);
+        bool benchLogTimestampParse(int size);
+        bool benchDateTimeFormat(int size);
+        bool benchHtml2Ansi(int size);
+
+    private:
+        bool setCommandLine(const char **argv);
+};
+
+bool
+S9sBench::runBenchmarks()
+{
+    PERFORM_BENCHMARK(benchJsonParse,        ALL_SIZES);
+    PERFORM_BENCHMARK(benchJsonSerialize,    ALL_SIZES);
+    PERFORM_BENCHMARK(benchReplyRefresh,     ALL_SIZES);
+    PERFORM_BENCHMARK(benchEventStream,      ALL_SIZES);
+    PERFORM_BENCHMARK(benchJsonWriter,       ALL_SIZES);
+    PERFORM_BENCHMARK(benchVariantMapLookup, ALL_SIZES);
+    PERFORM_BENCHMARK(benchVariantMapInsert, ALL_SIZES);
+    PERFORM_BENCHMARK(benchVariantCopy,      ALL_SIZES);
+    PERFORM_BENCHMARK(benchVariantCompare,   ALL_SIZES);
+    PERFORM_BENCHMARK(benchClusterListLong,  ALL_SIZES);
+    PERFORM_BENCHMARK(benchNodeListBrief,    ALL_SIZES);
+    PERFORM_BENCHMARK(benchNodeListFiltered, ALL_SIZES);
+    PERFORM_BENCHMARK(benchClusterListFiltered, ALL_SIZES);
+    PERFORM_BENCHMARK(benchOptionAccess,     ALL_SIZES);
+    PERFORM_BENCHMARK(benchJobLog,           ALL_SIZES);
+    PERFORM_BENCHMARK(benchGraphRealize,     ALL_SIZES);
+    PERFORM_BENCHMARK(benchSpreadsheetPrint, MAX_SPREADSHEET_CELLS);
+    PERFORM_BENCHMARK(benchConfigParse,      ALL_SIZES);
+    PERFORM_BENCHMARK(benchConfigLookup,     ALL_SIZES);
+    PERFORM_BENCHMARK(benchDateTimeParse,    ALL_SIZES);
+    PERFORM_BENCHMARK(benchLogTimestampParse, ALL_SIZES);
+    PERFORM_BENCHMARK(benchDateTimeFormat,   ALL_SIZES);
+    PERFORM_BENCHMARK(benchHtml2Ansi,        ALL_SIZES);
+
+    return true;
+}
+
+/**
+ * S9sVariantMap::parse() on a "getAllClusterInfo" reply.
+ */
+bool
+S9sBench::benchJsonParse(
+        int size)
+{
+    S9sString json = S9sBenchFixtures::clusterReply(size).toString();
+    bool      success = true;
+
+    setBytesProcessed(json.length());
+    
+    // The heap the parsed reply holds.
+    {
+        ulonglong     heapBefore = heapUsage();
+        S9sVariantMap reply;
+
+        success &= reply.parse(STR(json));
+        setMemoryUsed(heapUsage() - heapBefore);
+    }
+
+    for (begin(); running(); )
+    {
+        S9sVariantMap reply;
+
+        success &= reply.parse(STR(json));
+    }
+
+    return success;
+}
+
+/**
+ * The refresh loop of "node --list --wait" and "top": the reply of the 
+ * previous round is dropped, the new one is parsed into the same object (as
+ * S9sRpcClient::doExecuteRequest() does) and printed.
+ */
+bool
+S9sBench::benchReplyRefresh(
+        int size)
+{
+    const char  *argv[] = { "s9s", "node", "--list", NULL };
+    S9sString    json = S9sBenchFixtures::clusterReply(size).toString();
+    S9sRpcReply  reply;
+    bool         success = true;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    setBytesProcessed(json.length());
+
+    for (begin(); running(); )
+    {
+        reply.clear();
+        success &= reply.parse(STR(json));
+        reply.printNodeList();
+    }
+
+    return success;
+}
+
+/**
+ * Parsing the event stream one event at a time, as "event --list" does.
+ */
+bool
+S9sBench::benchEventStream(
+        int size)
+{
+    S9sVector<S9sString> events = S9sBenchFixtures::hostEvents(size);
+    bool                 success = true;
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < events.size(); ++idx)
+        {
+            S9sVariantMap record;
+
+            success &= record.parse(STR(events[idx]));
+        }
+    }
+
+    return success;
+}
+
+/**
+ * S9sVariantMap::toJsonString() with indentation (the --print-json output).
+ */
+bool
+S9sBench::benchJsonSerialize(
+        int size)
+{
+    S9sVariantMap reply = S9sBenchFixtures::clusterReply(size);
+    S9sString     json;
+
+    for (begin(); running(); )
+        json = reply.toJsonString(S9sFormatIndent);
+
+    setBytesProcessed(json.length());
+    return !json.empty();
+}
+
+/**
+ * S9sJsonWriter serializing the request format (what S9sRpcClient sends)
+ * into the same buffer again and again.
+ */
+bool
+S9sBench::benchJsonWriter(
+        int size)
+{
+    S9sVariantMap reply = S9sBenchFixtures::clusterReply(size);
+    S9sString     buffer;
+
+    for (begin(); running(); )
+    {
+        S9sJsonWriter writer(buffer);
+
+        buffer.clear();
+        writer.writeToString(reply);
+    }
+
+    setBytesProcessed(buffer.length());
+    return !buffer.empty();
+}
+
+/**
+ * Looking up the properties the printers use in every cluster and host of a
+ * parsed reply.
+ */
+bool
+S9sBench::benchVariantMapLookup(
+        int size)
+{
+    S9sVariantMap reply;
+    ulonglong     total = 0ull;
+
+    if (!reply.parse(STR(S9sBenchFixtures::clusterReply(size).toString())))
+        return false;
+
+    const S9sVariantList &clusters = reply["clusters"].toVariantList();
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < clusters.size(); ++idx)
+        {
+            const S9sVariantMap  &cluster = clusters[idx].toVariantMap();
+            const S9sVariantList &hosts   = cluster.at("hosts").toVariantList();
+
+            total += cluster.at("cluster_id").toInt();
+            total += cluster.at("cluster_name").isString();
+            total += cluster.contains("maintenance_mode_active");
+
+            for (uint idx2 = 0u; idx2 < hosts.size(); ++idx2)
+            {
+                const S9sVariantMap &host = hosts[idx2].toVariantMap();
+
+                total += host.at("hostname").isString();
+                total += host.at("port").toInt();
+                total += host.at("hoststatus").isString();
+                total += host.at("maintenance_mode_active").toBoolean();
+                total += host.contains("hostname");
+                total += host.contains("datadir");
+            }
+        }
+    }
+
+    return total > 0ull;
+}
+
+/**
+ * Building a map with the given number of keys added in mixed order, then
+ * iterating it and erasing every second key.
+ */
+bool
+S9sBench::benchVariantMapInsert(
+        int size)
+{
+    S9sVector<S9sInternedString> keys;
+    S9sString                    key;
+    ulonglong                    total = 0ull;
+
+    for (int idx = 0; idx < size; ++idx)
+    {
+        key.sprintf("key%08d", (int) (idx * 7919ll % size));
+        keys.push_back(S9sInternedString::intern(key));
+    }
+
+    for (begin(); running(); )
+    {
+        S9sVariantMap theMap;
+
+        for (uint idx = 0u; idx < keys.size(); ++idx)
+            theMap[keys[idx]] = (int) idx;
+
+        for (S9sVariantMap::const_iterator it = theMap.begin();
+                it != theMap.end(); ++it)
+        {
+            total += it->second.toInt();
+        }
+
+        for (uint idx = 0u; idx < keys.size(); idx += 2)
+            total += theMap.erase(keys[idx]);
+    }
+
+    return total > 0ull || size < 2;
+}
+
+/**
+ * Copying a variant that holds a whole reply (a deep copy).
+ */
+bool
+S9sBench::benchVariantCopy(
+        int size)
+{
+    S9sVariant original = S9sBenchFixtures::clusterReply(size);
+    S9sVariant copy;
+
+    for (begin(); running(); )
+        copy = original;
+
+    return copy.isVariantMap();
+}
+
+/**
+ * Comparing two variants with the same reply in them.
+ */
+bool
+S9sBench::benchVariantCompare(
+        int size)
+{
+    S9sVariant first  = S9sBenchFixtures::clusterReply(size);
+    S9sVariant second = S9sBenchFixtures::clusterReply(size);
+    bool       equal = true;
+
+    for (begin(); running(); )
+        equal &= first == second;
+
+    return equal;
+}
+
+/**
+ * "s9s cluster --list --long"
+ */
+bool
+S9sBench::benchClusterListLong(
+        int size)
+{
+    const char  *argv[] = { "s9s", "cluster", "--list", "--long", NULL };
+    S9sRpcReply  reply;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    reply = S9sBenchFixtures::clusterReply(size);
+    for (begin(); running(); )
+        reply.printClusterList();
+
+    return true;
+}
+
+/**
+ * "s9s node --list"
+ */
+bool
+S9sBench::benchNodeListBrief(
+        int size)
+{
+    const char  *argv[] = { "s9s", "node", "--list", NULL };
+    S9sRpcReply  reply;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    reply = S9sBenchFixtures::clusterReply(size);
+    for (begin(); running(); )
+        reply.printNodeList();
+
+    return true;
+}
+
+/**
+ * "s9s node --list --long" with name patterns, every host is matched against
+ * the extra arguments and the lines are fit to the terminal width.
+ */
+bool
+S9sBench::benchNodeListFiltered(
+        int size)
+{
+    const char  *argv[] = { 
+        "s9s", "node", "--list", "--long", "10.0.*", "10.1.*", "10.2.0.1",
+        NULL };
+    S9sRpcReply  reply;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    reply = S9sBenchFixtures::clusterReply(size);
+    for (begin(); running(); )
+        reply.printNodeList();
+
+    return true;
+}
+
+/**
+ * "s9s cluster --list --cluster-id=1", the cluster ID option is checked for
+ * every cluster of the list.
+ */
+bool
+S9sBench::benchClusterListFiltered(
+        int size)
+{
+    const char  *argv[] = { 
+        "s9s", "cluster", "--list", "--cluster-id=1", NULL };
+    S9sRpcReply  reply;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    reply = S9sBenchFixtures::clusterReply(size);
+    for (begin(); running(); )
+        reply.printClusterList();
+
+    return true;
+}
+
+/**
+ * The options the list printers read for every row: the cluster ID filter,
+ * the name patterns, the terminal width and the output flags.
+ */
+bool
+S9sBench::benchOptionAccess(
+        int size)
+{
+    const char  *argv[] = { 
+        "s9s", "node", "--list", "--long", "--cluster-id=1", 
+        "10.0.*", "10.2.0.1", NULL };
+    S9sOptions  *options;
+    S9sVector<S9sString> names;
+    ulonglong    nMatched = 0ull;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    options = S9sOptions::instance();
+    for (int idx = 0; idx < size; ++idx)
+    {
+        S9sString name;
+
+        name.sprintf("10.%d.%d.%d", idx % 4, idx / 256 % 256, idx % 256);
+        names << name;
+    }
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < names.size(); ++idx)
+        {
+            if (options->clusterId() != 1 || 
+                    !options->isStringMatchExtraArguments(names[idx]))
+            {
+                continue;
+            }
+
+            if (options->terminalWidth() > 0 &&
+                    !options->useSyntaxHighlight() &&
+                    options->isLongRequested())
+            {
+                ++nMatched;
+            }
+        }
+    }
+
+    return nMatched > 0ull;
+}
+
+/**
+ * "s9s job --log"
+ */
+bool
+S9sBench::benchJobLog(
+        int size)
+{
+    const char  *argv[] = { "s9s", "job", "--log", "--job-id=21", NULL };
+    S9sRpcReply  reply;
+
+    if (!setCommandLine(argv))
+        return false;
+
+    reply = S9sBenchFixtures::jobLogReply(size);
+    for (begin(); running(); )
+        reply.printJobLog();
+
+    return true;
+}
+
+/**
+ * S9sGraph::realize() with the given number of values.
+ */
+bool
+S9sBench::benchGraphRealize(
+        int size)
+{
+    S9sGraph graph;
+
+    for (int idx = 0; idx < size; ++idx)
+        graph.appendValue((idx * 7919) % 1000 / 10.0);
+
+    for (begin(); running(); )
+        graph.realize();
+
+    return graph.nRows() > 0;
+}
+
+/**
+ * S9sSpreadsheet::print() on a sheet with the given number of cells.
+ */
+bool
+S9sBench::benchSpreadsheetPrint(
+        int size)
+{
+    S9sSpreadsheet spreadsheet;
+
+    spreadsheet = S9sBenchFixtures::spreadsheet(size);
+    spreadsheet.setScreenSize(160, 50);
+
+    for (begin(); running(); )
+        spreadsheet.print();
+
+    return true;
+}
+
+/**
+ * S9sConfigFile::parse() on a file with the given number of variables.
+ */
+bool
+S9sBench::benchConfigParse(
+        int size)
+{
+    S9sString content = S9sBenchFixtures::configFile(size);
+    bool      success = true;
+
+    setBytesProcessed(content.length());
+
+    for (begin(); running(); )
+    {
+        S9sConfigFile config;
+
+        success &= config.parse(STR(content));
+    }
+
+    return success;
+}
+
+/**
+ * Looking up every variable of a parsed configuration file once.
+ */
+bool
+S9sBench::benchConfigLookup(
+        int size)
+{
+    S9sConfigFile  config;
+    S9sVariantList names;
+    bool           success = true;
+
+    if (!config.parse(STR(S9sBenchFixtures::configFile(size))))
+        return false;
+
+    for (int idx = 0; idx < size; ++idx)
+        names << S9sBenchFixtures::variableName(idx);
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < names.size(); ++idx)
+            success &= !config.variableValue(names[idx].toString()).empty();
+    }
+
+    return success;
+}
+
+/**
+ * S9sDateTime::parse() on the given number of date and time strings.
+ */
+bool
+S9sBench::benchDateTimeParse(
+        int size)
+{
+    S9sVariantList dates = S9sBenchFixtures::dateStrings(size);
+    bool           success = true;
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < dates.size(); ++idx)
+        {
+            S9sDateTime dateTime;
+
+            success &= dateTime.parse(dates[idx].toString());
+        }
+    }
+
+    return success;
+}
+
+/**
+ * S9sDateTime::parse() on the timestamps of log lines in all the supported
+ * formats. Use "--sizes=1000000" to parse a million timestamps.
+ */
+bool
+S9sBench::benchLogTimestampParse(
+        int size)
+{
+    S9sVector<S9sString> timestamps = S9sBenchFixtures::logTimestamps(size);
+    bool                 success = true;
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < timestamps.size(); ++idx)
+        {
+            S9sDateTime dateTime;
+
+            success &= dateTime.parse(timestamps[idx]);
+        }
+    }
+
+    return success;
+}
+
+/**
+ * S9sDateTime::toString() in the formats the printers use, a few times for
+ * every second as in a job log.
+ */
+bool
+S9sBench::benchDateTimeFormat(
+        int size)
+{
+    S9sDateTime dateTime(1781000000);
+    ulonglong   length = 0ull;
+
+    for (begin(); running(); )
+    {
+        for (int idx = 0; idx < size; ++idx)
+        {
+            S9sDateTime current = dateTime + idx / 4;
+
+            length += current.toString(S9sDateTime::TzDateTimeFormat).length();
+            length += current.toString(
+                    S9sDateTime::MySqlLogFileFormat).length();
+        }
+    }
+
+    return length > 0ull;
+}
+
+/**
+ * S9sString::html2ansi() on the texts of a job log.
+ */
+bool
+S9sBench::benchHtml2Ansi(
+        int size)
+{
+    S9sVariantMap        reply    = S9sBenchFixtures::jobLogReply(size);
+    S9sVariantList       messages = reply["messages"].toVariantList();
+    S9sVector<S9sString> texts;
+    ulonglong            bytes    = 0ull;
+    ulonglong            length   = 0ull;
+
+    for (uint idx = 0u; idx < messages.size(); ++idx)
+    {
+        texts << messages[idx]["message_text"].toString();
+        bytes += texts.back().length();
+    }
+
+    setBytesProcessed(bytes);
+
+    for (begin(); running(); )
+    {
+        for (uint idx = 0u; idx < texts.size(); ++idx)
+            length += S9sString::html2ansi(texts[idx]).length();
+    }
+
+    return length > 0ull;
+}
+
+/**
+ * Sets up the S9sOptions singleton as if the program was started with the
+ * given command line, the printing functions depend on it.
+ */
+bool
+S9sBench::setCommandLine(
+        const char **argv)
+{
+    int argc = 0;
+
+    while (argv[argc] != NULL)
+        ++argc;
+
+    S9sOptions::uninit();
+    return S9sOptions::instance()->readOptions(&argc, (char **) argv);
+}
+
+int
+main(
+        int   argc,
+        char *argv[])
+{
+    S9sBench bench;
+
+    return bench.execute(argc, argv);
+}
@@ -0,0 +1,450 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sbenchfixtures.h"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The number of hosts every cluster has in the cluster fixtures. With the
+ * cluster object itself this makes 5 objects per cluster.
+ */
+#define HOSTS_PER_CLUSTER 4
+
+/**
+ * The number of columns in the spreadsheet fixture.
+ */
+#define SPREADSHEET_COLUMNS 10
+
+uint S9sBenchFixtures::sm_seed = 1u;
+
+static const char *hostClasses[] = 
+{
+    "CmonMySqlHost", "CmonPostgreSqlHost", "CmonProxySqlHost", "CmonHost"
+};
+
+static const char *hostStatuses[] =
+{
+    "CmonHostOnline", "CmonHostOnline", "CmonHostOffline", "CmonHostFailed"
+};
+
+static const char *hostMessages[] =
+{
+    "Up and running.", 
+    "",
+    "Node is not responding, it might be down, the last error was "
+        "'Connection refused' while connecting to the database."
+};
+
+static const char *clusterTypes[] = 
+{
+    "GALERA", "POSTGRESQL_SINGLE", "REPLICATION", "MONGODB"
+};
+
+static const char *clusterStates[] = 
+{
+    "STARTED", "STARTED", "DEGRADED", "FAILED"
+};
+
+static const char *messageStatuses[] =
+{
+    "JOB_SUCCESS", "JOB_SUCCESS", "JOB_WARNING", "JOB_FAILED", "JOB_DEBUG"
+};
+
+static const char *messageTexts[] =
+{
+    "Using default SSH credentials.",
+    "The username is '<strong style='color: #59a449;'>pipas</strong>'.",
+    "<em style='color: #c66211;'>10.0.1.12</em>: Checking the "
+        "<strong style='color: #59a449;'>mysqld</strong> process.",
+    "Verifying the SSH connection to "
+        "<em style='color: #c66211;'>10.0.1.13</em>.",
+    "RUNNING  pipas    testgroup asterisk                 192.168.0.36     "
+};
+
+/**
+ * \returns A reply for the "getAllClusterInfo" request with clusters and their
+ *   hosts, the format the "cluster --list" and "node --list" prints.
+ */
+S9sVariantMap
+S9sBenchFixtures::clusterReply(
+        int nObjects)
+{
+    S9sVariantMap  reply;
+    S9sVariantList clusters;
+    int            nClusters = nObjects / (HOSTS_PER_CLUSTER + 1);
+
+    resetRandom();
+
+    if (nClusters < 1)
+        nClusters = 1;
+
+    for (int clusterId = 1; clusterId <= nClusters; ++clusterId)
+    {
+        S9sVariantMap  cluster;
+        S9sVariantMap  owner, groupOwner, alarms;
+        S9sVariantList hosts;
+        S9sString      name;
+
+        for (int idx = 0; idx < HOSTS_PER_CLUSTER; ++idx)
+            hosts << host(clusterId, idx);
+
+        name.sprintf("cluster_%06d", clusterId);
+        owner["class_name"]      = "CmonUser";
+        owner["user_name"]       = "pipas";
+        owner["user_id"]         = 3;
+        groupOwner["class_name"] = "CmonGroup";
+        groupOwner["group_name"] = "admins";
+        groupOwner["group_id"]   = 1;
+        alarms["critical"]       = (int) (random() % 3);
+        alarms["warning"]        = (int) (random() % 5);
+
+        cluster["class_name"]       = "CmonClusterInfo";
+        cluster["cluster_id"]       = clusterId;
+        cluster["cluster_name"]     = name;
+        cluster["cluster_type"]     = choose(clusterTypes, 4);
+        cluster["state"]            = choose(clusterStates, 4);
+        cluster["status_text"]      = "All nodes are operational.";
+        cluster["vendor"]           = "percona";
+        cluster["version"]          = "8.0";
+        cluster["owner"]            = owner;
+        cluster["group_owner"]      = groupOwner;
+        cluster["alarm_statistics"] = alarms;
+        cluster["hosts"]            = hosts;
+
+        clusters << cluster;
+    }
+
+    reply["request_status"] = "Ok";
+    reply["total"]          = nClusters;
+    reply["clusters"]       = clusters;
+
+    return reply;
+}
+
+/**
+ * \returns A reply for the "getJobLog" request.
+ */
+S9sVariantMap
+S9sBenchFixtures::jobLogReply(
+        int nMessages)
+{
+    S9sVariantMap  reply;
+    S9sVariantList messages;
+
+    resetRandom();
+
+    for (int idx = 0; idx < nMessages; ++idx)
+    {
+        S9sVariantMap message;
+        S9sString     created;
+
+        created.sprintf(
+                "2026-10-18T%02d:%02d:%02d.000Z", 
+                idx / 3600 % 24, idx / 60 % 60, idx % 60);
+
+        message["class_name"]     = "CmonJobMessage";
+        message["created"]        = created;
+        message["file_name"]      = "CmonCommandHandlerWorker.cpp";
+        message["job_id"]         = 21;
+        message["line_number"]    = (int) (random() % 2000);
+        message["message_id"]     = idx + 1;
+        message["message_status"] = choose(messageStatuses, 5);
+        message["message_text"]   = choose(messageTexts, 5);
+
+        messages << message;
+    }
+
+    reply["request_status"] = "Ok";
+    reply["total"]          = nMessages;
+    reply["messages"]       = messages;
+
+    return reply;
+}
+
+/**
+ * \returns The JSon documents of the host change events, the way the 
+ *   controller sends them in the event stream ("event --list").
+ */
+S9sVector<S9sString>
+S9sBenchFixtures::hostEvents(
+        int nEvents)
+{
+    S9sVector<S9sString> retval;
+
+    resetRandom();
+
+    for (int idx = 0; idx < nEvents; ++idx)
+    {
+        S9sVariantMap event, specifics, origins;
+        int           clusterId = idx / HOSTS_PER_CLUSTER + 1;
+
+        specifics["host"]         = host(clusterId, idx % HOSTS_PER_CLUSTER);
+        origins["sender_file"]    = "CmonHostManager.cpp";
+        origins["sender_line"]    = (int) (random() % 2000);
+        origins["sender_pid"]     = 5187;
+        origins["tv_sec"]         = 1760000000 + idx;
+        origins["tv_nsec"]        = (int) (random() % 1000000000);
+
+        event["class_name"]       = "CmonEvent";
+        event["event_class"]      = "EventHost";
+        event["event_name"]       = "Changed";
+        event["event_specifics"]  = specifics;
+        event["event_origins"]    = origins;
+
+        retval << event.toString();
+    }
+
+    return retval;
+}
+
+/**
+ * \returns A spreadsheet with the given number of cells in 
+ *   SPREADSHEET_COLUMNS columns.
+ */
+S9sVariantMap
+S9sBenchFixtures::spreadsheet(
+        int nCells)
+{
+    S9sVariantMap  retval;
+    S9sVariantList cells;
+
+    resetRandom();
+
+    for (int idx = 0; idx < nCells; ++idx)
+    {
+        S9sVariantMap cell;
+        int           value = random() % 100000;
+
+        cell["sheetIndex"]    = 0;
+        cell["rowIndex"]      = idx / SPREADSHEET_COLUMNS;
+        cell["columnIndex"]   = idx % SPREADSHEET_COLUMNS;
+        cell["value"]         = value;
+        cell["contentString"] = S9sVariant(value).toString();
+        cell["valuetype"]     = "Int";
+
+        cells << cell;
+    }
+
+    retval["class_name"] = "CmonSpreadsheet";
+    retval["name"]       = "benchmark";
+    retval["cells"]      = cells;
+
+    return retval;
+}
+
+/**
+ * \returns A MySQL style configuration file with the given number of
+ *   variables in a few sections.
+ */
+S9sString
+S9sBenchFixtures::configFile(
+        int nVariables)
+{
+    S9sString retval;
+    S9sString line;
+
+    resetRandom();
+
+    for (int idx = 0; idx < nVariables; ++idx)
+    {
+        if (idx % 100 == 0)
+        {
+            line.sprintf("\n[section_%d]\n", idx / 100);
+            retval += line;
+        }
+
+        if (idx % 10 == 0)
+            retval += "# A comment line before the variable.\n";
+
+        line.sprintf("%s = %u\n", STR(variableName(idx)), random() % 100000);
+        retval += line;
+    }
+
+    return retval;
+}
+
+/**
+ * \returns The name of the variable with the given index in the
+ *   configFile() fixture.
+ */
+S9sString
+S9sBenchFixtures::variableName(
+        int index)
+{
+    S9sString retval;
+
+    retval.sprintf("variable_%06d", index);
+    return retval;
+}
+
+/**
+ * \returns Date and time strings in the formats the controller uses.
+ */
+S9sVariantList
+S9sBenchFixtures::dateStrings(
+        int nDates)
+{
+    S9sVariantList retval;
+
+    resetRandom();
+
+    for (int idx = 0; idx < nDates; ++idx)
+    {
+        S9sString date;
+        uint      seconds = random() % (24 * 3600);
+
+        if (idx % 2 == 0)
+        {
+            date.sprintf("2026-%02d-%02dT%02d:%02d:%02d.%03dZ",
+                    1 + idx % 12, 1 + idx % 28, 
+                    seconds / 3600, seconds / 60 % 60, seconds % 60,
+                    idx % 1000);
+        } else {
+            date.sprintf("2026-%02d-%02d %02d:%02d:%02d",
+                    1 + idx % 12, 1 + idx % 28, 
+                    seconds / 3600, seconds / 60 % 60, seconds % 60);
+        }
+
+        retval << date;
+    }
+
+    return retval;
+}
+
+/**
+ * \returns Timestamps as they appear in the log lines: syslog, MySQL error log
+ *   (long and short) and the controller's UTC format mixed.
+ */
+S9sVector<S9sString>
+S9sBenchFixtures::logTimestamps(
+        int nTimestamps)
+{
+    static const char *monthNames[] = 
+    {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun", 
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+    S9sVector<S9sString> retval;
+    uint                 seconds = 0u;
+
+    resetRandom();
+    retval.reserve(nTimestamps);
+
+    for (int idx = 0; idx < nTimestamps; ++idx)
+    {
+        S9sString timestamp;
+        uint      month, day, hour, minute, second;
+
+        // The log lines are in order, a few lines every second.
+        seconds += random() % 4;
+        month    = 1 + seconds / (28 * 24 * 3600) % 12;
+        day      = 1 + seconds / (24 * 3600) % 28;
+        hour     = seconds / 3600 % 24;
+        minute   = seconds / 60 % 60;
+        second   = seconds % 60;
+
+        switch (idx % 4)
+        {
+            case 0:
+                timestamp.sprintf("%s %2u %02u:%02u:%02u",
+                        monthNames[month - 1], day, hour, minute, second);
+                break;
+
+            case 1:
+                timestamp.sprintf("2026-%02u-%02u %02u:%02u:%02u",
+                        month, day, hour, minute, second);
+                break;
+            
+            case 2:
+                timestamp.sprintf("26%02u%02u %2u:%02u:%02u",
+                        month, day, hour, minute, second);
+                break;
+
+            case 3:
+                timestamp.sprintf("2026-%02u-%02uT%02u:%02u:%02u.%03uZ",
+                        month, day, hour, minute, second, random() % 1000);
+                break;
+        }
+
+        retval.push_back(timestamp);
+    }
+
+    return retval;
+}
+
+S9sVariantMap
+S9sBenchFixtures::host(
+        int clusterId,
+        int index)
+{
+    S9sVariantMap host;
+    S9sString     address;
+
+    address.sprintf("10.%d.%d.%d", 
+            clusterId / 62500 % 250, clusterId / 250 % 250, 
+            (clusterId % 250) + index);
+
+    host["class_name"]              = index == 0 ? 
+        "CmonHost" : choose(hostClasses, 4);
+    host["hostname"]                = address;
+    host["ip"]                      = address;
+    host["port"]                    = index == 0 ? 9500 : 3306;
+    host["clusterid"]               = clusterId;
+    host["hostId"]                  = clusterId * 10 + index;
+    host["hoststatus"]              = choose(hostStatuses, 4);
+    host["message"]                 = choose(hostMessages, 3);
+    host["nodetype"]                = index == 0 ? "controller" : "galera";
+    host["role"]                    = index == 1 ? "master" : "slave";
+    host["version"]                 = "8.0.30";
+    host["connected"]               = true;
+    host["maintenance_mode_active"] = random() % 10 == 0;
+    host["timestamp"]               = 1760000000 + (int) (random() % 3600);
+    host["uptime"]                  = (int) (random() % 1000000);
+    host["pid"]                     = (int) (1000 + random() % 30000);
+
+    return host;
+}
+
+/**
+ * A simple linear congruential generator, the fixtures should be the same on
+ * every platform.
+ */
+uint
+S9sBenchFixtures::random()
+{
+    sm_seed = sm_seed * 1103515245u + 12345u;
+    return (sm_seed >> 16) & 0x7fff;
+}
+
+const char *
+S9sBenchFixtures::choose(
+        const char **values,
+        uint         nValues)
+{
+    return values[random() % nValues];
+}
+
+void
+S9sBenchFixtures::resetRandom()
+{
+    sm_seed = 1u;
+}
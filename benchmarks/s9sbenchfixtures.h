@@ -0,0 +1,53 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sVector"
+
+/**
+ * Synthetic controller replies and other inputs for the benchmarks. The
+ * content is generated with a fixed seed, so every run measures the same
+ * data. The size is the number of objects (clusters and hosts, messages, 
+ * cells, variables...) in the fixture.
+ */
+class S9sBenchFixtures
+{
+    public:
+        static S9sVariantMap clusterReply(int nObjects);
+        static S9sVariantMap jobLogReply(int nMessages);
+        static S9sVector<S9sString> hostEvents(int nEvents);
+        static S9sVariantMap spreadsheet(int nCells);
+        static S9sString configFile(int nVariables);
+        static S9sString variableName(int index);
+        static S9sVariantList dateStrings(int nDates);
+        static S9sVector<S9sString> logTimestamps(int nTimestamps);
+
+    private:
+        static S9sVariantMap host(int clusterId, int index);
+        static uint random();
+        static const char *choose(const char **values, uint nValues);
+        static void resetRandom();
+
+    private:
+        static uint sm_seed;
+};
@@ -0,0 +1,397 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sbenchmark.h"
+
+#include "config.h"
+#include "S9sOutput"
+#include "S9sDateTime"
+#include "S9sFile"
+
+#include <getopt.h>
+#include <malloc.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <time.h>
+#include <new>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The minimum time (in milliseconds) every benchmark is repeated for.
+ */
+#define DEFAULT_MIN_TIME 300.0
+
+/*
+ * The operator new of the benchmark program counts the allocations, so the
+ * results show how many allocations one iteration needs. The benchmarks are 
+ * running in one thread.
+ */
+static ulonglong allocation_counter = 0ull;
+
+void *
+operator new(
+        size_t size)
+{
+    void *retval;
+
+    ++allocation_counter;
+
+    retval = malloc(size == 0 ? 1 : size);
+    if (retval == NULL)
+        throw std::bad_alloc();
+
+    return retval;
+}
+
+void 
+operator delete(
+        void *pointer) noexcept
+{
+    free(pointer);
+}
+
+S9sBenchmark::S9sBenchmark() :
+    m_minTime(DEFAULT_MIN_TIME),
+    m_size(0),
+    m_started(0.0),
+    m_iterations(0ull),
+    m_bytes(0ull),
+    m_memory(0ull),
+    m_allocations(0ull),
+    m_nFailed(0),
+    m_output(NULL)
+{
+    m_sizes << 1000 << 10000 << 100000;
+}
+
+S9sBenchmark::~S9sBenchmark()
+{
+}
+
+/**
+ * \returns The exit code of the program.
+ *
+ * Processes the command line, runs the benchmarks and writes the results. The
+ * standard output is sent to /dev/null while the benchmarks are running (the
+ * printing functions are measured too), the results go to the original
+ * standard output or to the file set by the --output command line option.
+ */
+int
+S9sBenchmark::execute(
+        int   argc,
+        char *argv[])
+{
+    int nullFd;
+    int originalFd;
+
+    if (!parseArguments(argc, argv))
+        return 6;
+
+    fflush(stdout);
+    originalFd = dup(STDOUT_FILENO);
+    nullFd     = open("/dev/null", O_WRONLY);
+
+    if (originalFd < 0 || nullFd < 0)
+    {
+        fprintf(stderr, "Could not redirect the standard output: %m\n");
+        return 1;
+    }
+
+    dup2(nullFd, STDOUT_FILENO);
+    ::close(nullFd);
+
+    if (m_outputFile.empty())
+        m_output = fdopen(originalFd, "w");
+    else
+        m_output = fopen(STR(m_outputFile), "w");
+
+    if (m_output == NULL)
+    {
+        fprintf(stderr, "Could not open '%s': %m\n", STR(m_outputFile));
+        return 1;
+    }
+
+    runBenchmarks();
+    S9sOutput::flush();
+
+    if (!writeResults())
+        return 1;
+
+    return m_nFailed > 0 ? 1 : 0;
+}
+
+bool
+S9sBenchmark::parseArguments(
+        int   argc,
+        char *argv[])
+{
+    struct option long_options[] =
+    {
+        { "help",     no_argument,       0, 'h' },
+        { "output",   required_argument, 0, 'o' },
+        { "sizes",    required_argument, 0, 's' },
+        { "min-time", required_argument, 0, 't' },
+        { 0, 0, 0, 0 }
+    };
+
+    m_programName = argv[0];
+
+    for (;;)
+    {
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "ho:s:t:", long_options, &option_index);
+
+        if (c == -1)
+            break;
+
+        switch (c)
+        {
+            case 'h':
+                printHelp();
+                exit(0);
+
+            case 'o':
+                m_outputFile = optarg;
+                break;
+
+            case 's':
+                {
+                    S9sVariantList list = S9sString(optarg).split(",");
+
+                    m_sizes.clear();
+                    for (uint idx = 0u; idx < list.size(); ++idx)
+                        m_sizes << list[idx].toInt();
+                }
+                break;
+
+            case 't':
+                m_minTime = atof(optarg);
+                break;
+
+            default:
+                printHelp();
+                return false;
+        }
+    }
+
+    while (optind < argc)
+        m_filters[argv[optind++]] = true;
+
+    return true;
+}
+
+void
+S9sBenchmark::printHelp() const
+{
+    fprintf(stderr,
+"Usage:\n"
+"  %s [OPTION]... [BENCHMARK]...\n"
+"\n"
+" -h, --help                 Print this help.\n"
+" -o, --output=FILE          Write the JSon results into the file.\n"
+" -s, --sizes=N[,N]...       The number of objects in the fixtures.\n"
+" -t, --min-time=MS          Repeat every benchmark at least this long.\n"
+"\n",
+    STR(m_programName));
+}
+
+/**
+ * \returns True if the benchmark should run, by default all of them run, but
+ *   the names on the command line select only some.
+ */
+bool
+S9sBenchmark::isSelected(
+        const char *name) const
+{
+    return m_filters.empty() || m_filters.contains(name);
+}
+
+const S9sVector<int> &
+S9sBenchmark::sizes() const
+{
+    return m_sizes;
+}
+
+void
+S9sBenchmark::setRunningBenchmark(
+        const char *name,
+        int         size)
+{
+    m_name       = name;
+    m_size       = size;
+    m_iterations = 0ull;
+    m_bytes      = 0ull;
+    m_memory     = 0ull;
+
+    fprintf(stderr, "  %-28s %7d ", name, size);
+}
+
+/**
+ * Starts the measurement, the preparation of the fixtures should be done
+ * before this.
+ */
+void
+S9sBenchmark::begin()
+{
+    S9sOutput::flush();
+
+    m_iterations  = 0ull;
+    m_allocations = nAllocations();
+    m_started     = monotonicMs();
+}
+
+/**
+ * \returns True if the measured code should run once more.
+ */
+bool
+S9sBenchmark::running()
+{
+    if (m_iterations > 0ull && monotonicMs() - m_started >= m_minTime)
+    {
+        S9sOutput::flush();
+        addResult(nAllocations() - m_allocations);
+        return false;
+    }
+
+    ++m_iterations;
+    return true;
+}
+
+/**
+ * Sets how many bytes one iteration processes, so the throughput can also be
+ * reported.
+ */
+void
+S9sBenchmark::setBytesProcessed(
+        ulonglong bytes)
+{
+    m_bytes = bytes;
+}
+
+/**
+ * Sets how many bytes of heap the data structure measured by the benchmark
+ * holds, so the memory footprint is also reported.
+ */
+void
+S9sBenchmark::setMemoryUsed(
+        ulonglong bytes)
+{
+    m_memory = bytes;
+}
+
+/**
+ * \returns How many times the operator new was called so far.
+ */
+ulonglong
+S9sBenchmark::nAllocations()
+{
+    return allocation_counter;
+}
+
+/**
+ * \returns The number of bytes allocated by malloc() and not yet freed.
+ */
+ulonglong
+S9sBenchmark::heapUsage()
+{
+    return mallinfo2().uordblks;
+}
+
+void
+S9sBenchmark::failed()
+{
+    fprintf(stderr, "FAILED\n");
+    ++m_nFailed;
+}
+
+void
+S9sBenchmark::addResult(
+        ulonglong allocationCount)
+{
+    double        totalMs = monotonicMs() - m_started;
+    double        perIteration = totalMs / m_iterations;
+    double        allocations = (double) allocationCount / m_iterations;
+    S9sVariantMap result;
+
+    result["name"]             = m_name;
+    result["size"]             = m_size;
+    result["iterations"]       = m_iterations;
+    result["total_ms"]         = totalMs;
+    result["ms_per_iteration"] = perIteration;
+    result["allocations_per_iteration"] = allocations;
+
+    if (m_bytes > 0ull)
+    {
+        result["bytes"]          = m_bytes;
+        result["mb_per_second"]  = 
+            m_bytes / (1024.0 * 1024.0) / (perIteration / 1000.0);
+    }
+
+    if (m_memory > 0ull)
+        result["memory_bytes"]   = m_memory;
+
+    m_results << result;
+    
+    fprintf(stderr, "%12.3f ms %11.0f allocs", perIteration, allocations);
+
+    if (m_memory > 0ull)
+        fprintf(stderr, " %10.1f KiB", m_memory / 1024.0);
+
+    fprintf(stderr, "\n");
+}
+
+bool
+S9sBenchmark::writeResults() const
+{
+    S9sVariantMap document;
+    S9sString     created;
+
+    created = S9sDateTime::currentDateTime().toString(
+            S9sDateTime::TzDateTimeFormat);
+
+    document["program"]     = S9sFile::basename(m_programName);
+    document["version"]     = BUILD_VERSION;
+    document["git_version"] = GIT_VERSION;
+    document["created"]     = created;
+    document["min_time_ms"] = m_minTime;
+    document["results"]     = m_results;
+
+    if (fprintf(m_output, "%s\n", 
+                STR(document.toJsonString(S9sFormatIndent))) < 0)
+    {
+        fprintf(stderr, "Error writing the results: %m\n");
+        return false;
+    }
+
+    fclose(m_output);
+    return true;
+}
+
+double
+S9sBenchmark::monotonicMs()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
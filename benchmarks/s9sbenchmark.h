@@ -0,0 +1,108 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+
+#include <stdio.h>
+
+/**
+ * Runs a benchmark function once for every fixture size that is not bigger
+ * than maxSize. The function gets the size as its argument.
+ */
+#define PERFORM_BENCHMARK(functionName,maxSize) \
+{ \
+    if (isSelected(#functionName)) \
+    { \
+        for (uint idx = 0u; idx < sizes().size(); ++idx) \
+        { \
+            if (sizes()[idx] > (maxSize)) \
+                continue; \
+            \
+            setRunningBenchmark(#functionName, sizes()[idx]); \
+            if (!functionName(sizes()[idx])) \
+                failed(); \
+        } \
+    } \
+}
+
+/**
+ * Base class for the benchmark programs. The benchmark functions are measured
+ * in the way of
+ *
+ * \code
+ * for (begin(); running(); )
+ *     doTheWork();
+ * \endcode
+ *
+ * the loop is repeated until the minimum measuring time is reached. The
+ * results are collected and written as a JSon document, so they can be
+ * compared between the releases.
+ */
+class S9sBenchmark
+{
+    public:
+        S9sBenchmark();
+        virtual ~S9sBenchmark();
+
+        int execute(int argc, char *argv[]);
+        
+    protected:
+        virtual bool runBenchmarks() = 0;
+
+        bool isSelected(const char *name) const;
+        const S9sVector<int> &sizes() const;
+
+        void setRunningBenchmark(const char *name, int size);
+        void begin();
+        bool running();
+        void setBytesProcessed(ulonglong bytes);
+        void setMemoryUsed(ulonglong bytes);
+        static ulonglong heapUsage();
+        static ulonglong nAllocations();
+        void failed();
+
+    private:
+        bool parseArguments(int argc, char *argv[]);
+        void printHelp() const;
+        void addResult(ulonglong allocationCount);
+        bool writeResults() const;
+        static double monotonicMs();
+
+    private:
+        S9sString          m_programName;
+        S9sString          m_outputFile;
+        S9sVariantMap      m_filters;
+        S9sVector<int>     m_sizes;
+        double             m_minTime;
+        S9sString          m_name;
+        int                m_size;
+        double             m_started;
+        ulonglong          m_iterations;
+        ulonglong          m_bytes;
+        ulonglong          m_memory;
+        ulonglong          m_allocations;
+        int                m_nFailed;
+        S9sVariantList     m_results;
+        FILE              *m_output;
+};
@@ -29,10 +29,11 @@ int json_error(S9sJsonParseContext &context, const char *c);
     S9sVariant     *vval;
     S9sVariantMap  *mval;
     S9sVariantList *lval;
+    S9sString      *sval;
 }
 
 %token <vval> JSON_INTEGER
-%token <vval> JSON_STRING
+%token <sval> JSON_STRING
 %token <vval> JSON_NULL
 %token <vval> JSON_DOUBLE
 %token <vval> JSON_BOOLEAN
@@ -44,15 +45,16 @@ int json_error(S9sJsonParseContext &context, const char *c);
 %type <mval> json_object
 %type <lval> json_literal_list
 
-%destructor { delete $$; } <vval>
-%destructor { delete $$; } <mval>
-%destructor { delete $$; } <lval>
+%destructor { context.release($$); } <vval>
+%destructor { context.release($$); } <mval>
+%destructor { context.release($$); } <lval>
+%destructor { context.release($$); } <sval>
 
 %%
 json_string
     : json_object { 
             context.setValues($1);
-            delete $1;
+            context.release($1);
         }
     ;
 
@@ -67,47 +69,58 @@ json_map
     ;
 
 json_opt_value_list
-    :                  { $$ = new S9sVariantMap; }
+    :                  { $$ = context.newMap(); }
     | json_value_list  { $$ = $1; }
     ;
 
 json_value_list
     : JSON_STRING ':' literal {
-            $$ = new S9sVariantMap;
-            (*$$)[$1->toString()] = *$3;
-            delete $1;
-            delete $3;
+            $$ = context.newMap();
+            (*$$)[S9sInternedString::intern(*$1)] = std::move(*$3);
+            context.release($1);
+            context.release($3);
         }
     | json_value_list ',' JSON_STRING ':' literal {
             $$ = $1;
-            (*$$)[$3->toString()] = *$5;
-            delete $3;
-            delete $5;
+            (*$$)[S9sInternedString::intern(*$3)] = std::move(*$5);
+            context.release($3);
+            context.release($5);
         }
     ;
 
 literal
-    : JSON_STRING
+    : JSON_STRING {
+            $$ = context.newVariant(S9sVariant(std::move(*$1)));
+            context.release($1);
+        }
     | JSON_NULL
     | JSON_INTEGER
     | JSON_BOOLEAN
     | JSON_DOUBLE
     | json_map {
-            $$ = new S9sVariant((S9sVariantMap &) *$1);
-            delete $1;
+            $$ = context.newVariant(S9sVariant(std::move(*$1)));
+            context.release($1);
         }
     | '[' json_literal_list ']' {
-            $$ = new S9sVariant((S9sVariantList &) *$2);
-            delete $2;
+            $$ = context.newVariant(S9sVariant(std::move(*$2)));
+            context.release($2);
         }
     | '[' ']' {
-            $$ = new S9sVariant(S9sVariantList());
+            $$ = context.newVariant(S9sVariant(S9sVariantList()));
         }
     ;
 
 json_literal_list
-    : literal { $$ = new S9sVariantList; $$->push_back(*$1); delete $1; }
-    | json_literal_list ',' literal {$$ = $1; $$->push_back(*$3); delete $3; }
+    : literal { 
+            $$ = context.newList(); 
+            $$->push_back(std::move(*$1)); 
+            context.release($1); 
+        }
+    | json_literal_list ',' literal {
+            $$ = $1; 
+            $$->push_back(std::move(*$3)); 
+            context.release($3); 
+        }
     ;
 %%
 
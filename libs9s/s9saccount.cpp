@@ -162,9 +162,14 @@ S9sAccount::setWithDatabase(
         bool value)
 {
     if (value)
-        m_properties["own_database"] = m_properties["user_name"];
-    else
+    {
+        // A copy, the insertion may move the elements of the map.
+        S9sVariant userName = m_properties["user_name"];
+
+        m_properties["own_database"] = userName;
+    } else {
         m_properties.erase("own_database");
+    }
 }
 
 void
@@ -0,0 +1,177 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sarena.h"
+
+#include <cstdlib>
+#include <new>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * Every chunk is aligned to this many bytes and its size is rounded up to
+ * the multiple of it.
+ */
+#define ARENA_ALIGNMENT       16
+
+/**
+ * Chunks up to this size are recycled through the free lists, the bigger 
+ * ones are only released with the arena.
+ */
+#define ARENA_MAX_RECYCLED    (8 * ARENA_ALIGNMENT)
+
+/**
+ * The size of the first block, the consecutive blocks are twice as big
+ * up to ARENA_MAX_BLOCK_SIZE, so a small reply needs only one block and a
+ * big one needs only a few.
+ */
+#define ARENA_MIN_BLOCK_SIZE  (4 * 1024)
+#define ARENA_MAX_BLOCK_SIZE  (256 * 1024)
+
+S9sArena::S9sArena() :
+    m_next(NULL),
+    m_left(0),
+    m_blockSize(ARENA_MIN_BLOCK_SIZE),
+    m_memoryUsage(0ull)
+{
+    for (uint idx = 0u; idx < sizeof(m_freeLists) / sizeof(void *); ++idx)
+        m_freeLists[idx] = NULL;
+}
+
+S9sArena::~S9sArena()
+{
+    for (uint idx = 0u; idx < m_blocks.size(); ++idx)
+        free(m_blocks[idx]);
+}
+
+/**
+ * \param size The size of the chunk in bytes.
+ * \returns A chunk of memory aligned to ARENA_ALIGNMENT bytes. Throws 
+ *   std::bad_alloc the same way the operator new does.
+ */
+void *
+S9sArena::allocate(
+        size_t size)
+{
+    void *retval;
+
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+    if (size == 0)
+        size = ARENA_ALIGNMENT;
+
+    if (size <= ARENA_MAX_RECYCLED)
+    {
+        void **freeList = &m_freeLists[size / ARENA_ALIGNMENT - 1];
+
+        if (*freeList != NULL)
+        {
+            retval    = *freeList;
+            *freeList = *(void **) retval;
+            return retval;
+        }
+    }
+
+    if (size > m_left)
+        return allocateBlock(size);
+
+    retval  = m_next;
+    m_next += size;
+    m_left -= size;
+
+    return retval;
+}
+
+/**
+ * \param chunk The chunk returned by allocate(), may be NULL.
+ * \param size The same size that was passed to allocate().
+ *
+ * Puts the chunk on the free list, so the next allocation of the same size
+ * can reuse it.
+ */
+void
+S9sArena::release(
+        void   *chunk,
+        size_t  size)
+{
+    if (chunk == NULL)
+        return;
+
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+    if (size == 0)
+        size = ARENA_ALIGNMENT;
+
+    if (size <= ARENA_MAX_RECYCLED)
+    {
+        void **freeList = &m_freeLists[size / ARENA_ALIGNMENT - 1];
+
+        *(void **) chunk = *freeList;
+        *freeList        = chunk;
+    }
+}
+
+/**
+ * \returns How many blocks the arena allocated from the heap.
+ */
+uint
+S9sArena::nBlocks() const
+{
+    return m_blocks.size();
+}
+
+/**
+ * \returns How many bytes the arena allocated from the heap.
+ */
+ulonglong
+S9sArena::memoryUsage() const
+{
+    return m_memoryUsage;
+}
+
+/**
+ * Allocates a new block and returns the first chunk of it. The unused end of
+ * the previous block is abandoned.
+ */
+void *
+S9sArena::allocateBlock(
+        size_t size)
+{
+    size_t  blockSize = m_blockSize;
+    char   *block;
+
+    if (blockSize < size)
+        blockSize = size;
+
+    block = (char *) malloc(blockSize);
+    if (block == NULL)
+        throw std::bad_alloc();
+
+    m_blocks.push_back(block);
+    m_memoryUsage += blockSize;
+
+    m_next = block + size;
+    m_left = blockSize - size;
+
+    if (m_blockSize < ARENA_MAX_BLOCK_SIZE)
+        m_blockSize *= 2;
+
+    S9S_DEBUG("New block of %lu bytes.", (ulong) blockSize);
+    return block;
+}
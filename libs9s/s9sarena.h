@@ -0,0 +1,63 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sGlobal"
+#include "S9sVector"
+
+#include <cstddef>
+
+/**
+ * A memory arena for short lived objects that are created in great numbers,
+ * like the tokens and the partial results of the JSon parser. The memory is
+ * cut from big blocks by simply moving a pointer, the released chunks are 
+ * kept on a free list per size and reused by the next allocation of the
+ * same size. All the blocks are freed together when the arena is destroyed.
+ *
+ * The arena does not know about the objects stored in it, the owner has to
+ * call the destructors before releasing the memory.
+ */
+class S9sArena
+{
+    public:
+        S9sArena();
+        ~S9sArena();
+
+        void *allocate(size_t size);
+        void release(void *chunk, size_t size);
+
+        uint nBlocks() const;
+        ulonglong memoryUsage() const;
+
+    private:
+        S9sArena(const S9sArena &orig);
+        S9sArena &operator=(const S9sArena &orig);
+
+        void *allocateBlock(size_t size);
+
+    private:
+        S9sVector<char *>  m_blocks;
+        char              *m_next;
+        size_t             m_left;
+        size_t             m_blockSize;
+        // The free lists for the chunks of 16, 32, ... 128 bytes.
+        void              *m_freeLists[8];
+        ulonglong          m_memoryUsage;
+};
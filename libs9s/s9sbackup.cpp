@@ -24,6 +24,7 @@
 #include <S9sRpcReply>
 #include <S9sOptions>
 #include <S9sDateTime>
+#include <S9sFormatTemplate>
 
 //#define DEBUG
 //#define WARNING
@@ -611,295 +612,233 @@ S9sBackup::toString(
         const int        fileIndex,
         const bool       syntaxHighlight,
         const S9sString &formatString) const
+{
+    return toString(
+            backupIndex, fileIndex, syntaxHighlight, 
+            S9sFormatTemplate::compiled(formatString, "c"));
+}
+
+/**
+ * Converts the object to a string using a format template that is already
+ * compiled, see the other toString() for the format string itself.
+ */
+S9sString
+S9sBackup::toString(
+        const int                backupIndex,
+        const int                fileIndex,
+        const bool               syntaxHighlight,
+        const S9sFormatTemplate &format) const
 {
     S9sString    retval;
     S9sString    tmp;
-    char         c;
     S9sString    partFormat;
-    bool         percent        = false;
-    bool         escaped        = false;
-    bool         modifierConfig = false;
+    bool         modifierConfig;
 
     S9S_WARNING("syntaxHighlight : %s", syntaxHighlight ? "true" : "false");
-    for (uint n = 0; n < formatString.size(); ++n)
+
+    for (uint idx = 0; idx < format.size(); ++idx)
     {
-        c = formatString[n];
-       
-        if (c == '%' && !percent)
-        {
-            percent    = true;
-            partFormat = "%";
-            continue;
-        } else if (percent && c == 'c')
-        {
-            modifierConfig = true;
-            continue;
-        } else if (c == '\\' && !escaped)
+        const S9sFormatTemplate::Part &part = format.part(idx);
+
+        if (part.isLiteral())
         {
-            escaped = true;
+            retval += part.literal;
             continue;
         }
 
-        // FIXME: just to avoid unused veriable message.
-        if (modifierConfig)
-            modifierConfig = modifierConfig;
+        partFormat = part.prefix;
+        modifierConfig = part.modifier == 'c';
 
-        if (escaped)
-        {
-            switch (c)
-            {
-                case '\"':
-                    retval += '\"';
-                    break;
-
-                case '\\':
-                    retval += '\\';
-                    break;
-       
-                case 'a':
-                    retval += '\a';
-                    break;
-
-                case 'b':
-                    retval += '\b';
-                    break;
-
-                case 'e':
-                    retval += '\027';
-                    break;
-
-                case 'n':
-                    retval += '\n';
-                    break;
-
-                case 'r':
-                    retval += '\r';
-                    break;
-
-                case 't':
-                    retval += '\t';
-                    break;
-            }
-        } else if (percent)
+        switch (part.directive)
         {
-            switch (c)
-            {
-                case 'B':
-                    // The time when the backup creation was started.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(beginAsString()));
-                    retval += tmp;
-                    break;
-
-                case 'C':
-                    // The file creation date and time.
-                    partFormat += 's';
-
-                    tmp.sprintf(
-                            STR(partFormat), 
-                            STR(fileCreatedString(backupIndex, fileIndex)));
-
-                    retval += tmp;
-                    break;
-               
-                case 'd':
-                    // The list of databases.
-                    partFormat += 's';
-                    tmp.sprintf(
-                            STR(partFormat), 
-                            STR(databaseNamesAsString(backupIndex)));
-
-                    retval += tmp;
-                    break;
-                    
-                case 'D':
-                    // The description.
-                    partFormat += 's';
-
-                    if (modifierConfig)
-                        tmp.sprintf(STR(partFormat), STR(configDescription()));
-                    else
-                        tmp.sprintf(STR(partFormat), STR(description()));
-
-                    retval += tmp;
-                    break;
-                
-                case 'e':
-                    // The encryption status.
-                    partFormat += 's';
-
-                    tmp.sprintf(STR(partFormat), 
-                            encrypted() ? "ENCRYPTED" : "UNENCRYPTED");
-                    
-                    retval += tmp;
-                    break;
-
-                case 'E':
-                    // The time when the backup creation was finished.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(endAsString()));
-                    retval += tmp;
-                    break;
-                
-                case 'F':
-                    // The file name.
-                    partFormat += 's';
-
-                    if (syntaxHighlight)
-                    {
-                        retval += S9sRpcReply::fileColorBegin(
-                                fileName(backupIndex, fileIndex));
-                    }
-
-                    tmp.sprintf(
-                            STR(partFormat), 
-                            STR(fileName(backupIndex, fileIndex)));
-                    
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
-                    
-                    break;
-
-                case 'H':
-                    // The backup host.
-                    partFormat += 's';
-
-                    if (modifierConfig)
-                        tmp.sprintf(STR(partFormat), STR(configBackupHost()));
-                    else
-                        tmp.sprintf(STR(partFormat), STR(backupHost()));
-
-                    retval += tmp;
-                    break;
-                
-                case 'I':
-                    // The numerical ID of the backup.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), id());
-                    retval += tmp;
-                    break;
-                
-                case 'i':
-                    // The cluster ID of the backup.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), clusterId());
-                    retval += tmp;
-                    break;
-               
-                case 'J':
-                    // The ID of the job.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), jobId());
-                    retval += tmp;
-                    break;
-
-                case 'M':
-                    // The backup method.
-                    partFormat += 's';
-
-                    if (modifierConfig)
-                        tmp.sprintf(STR(partFormat), STR(configMethod()));
-                    else
-                        tmp.sprintf(STR(partFormat), STR(method()));
-
-                    retval += tmp;
-                    break;
+            case 'B':
+                // The time when the backup creation was started.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(beginAsString()));
+                retval += tmp;
+                break;
+
+            case 'C':
+                // The file creation date and time.
+                partFormat += 's';
+
+                tmp.sprintf(
+                        STR(partFormat), 
+                        STR(fileCreatedString(backupIndex, fileIndex)));
+
+                retval += tmp;
+                break;
+           
+            case 'd':
+                // The list of databases.
+                partFormat += 's';
+                tmp.sprintf(
+                        STR(partFormat), 
+                        STR(databaseNamesAsString(backupIndex)));
+
+                retval += tmp;
+                break;
                 
-                case 'O':
-                    // The owner.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(configOwner()));
-                    retval += tmp;
-                    break;
-
-                case 'P':
-                    // The file name.
-                    partFormat += 's';
-
-                    if (syntaxHighlight)
-                    {
-                        retval += S9sRpcReply::fileColorBegin(
-                                fileName(backupIndex, fileIndex));
-                    }
-
-                    tmp.sprintf(
-                            STR(partFormat), 
-                            STR(filePath(backupIndex, fileIndex)));
-                    
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
-                    
-                    break;
+            case 'D':
+                // The description.
+                partFormat += 's';
+
+                if (modifierConfig)
+                    tmp.sprintf(STR(partFormat), STR(configDescription()));
+                else
+                    tmp.sprintf(STR(partFormat), STR(description()));
+
+                retval += tmp;
+                break;
+            
+            case 'e':
+                // The encryption status.
+                partFormat += 's';
+
+                tmp.sprintf(STR(partFormat), 
+                        encrypted() ? "ENCRYPTED" : "UNENCRYPTED");
                 
-                case 'R':
-                    // The root directory of the backup.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(rootDir()));
-                    retval += tmp;
-                    break;
+                retval += tmp;
+                break;
+
+            case 'E':
+                // The time when the backup creation was finished.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(endAsString()));
+                retval += tmp;
+                break;
+            
+            case 'F':
+                // The file name.
+                partFormat += 's';
+
+                if (syntaxHighlight)
+                {
+                    retval += S9sRpcReply::fileColorBegin(
+                            fileName(backupIndex, fileIndex));
+                }
+
+                tmp.sprintf(
+                        STR(partFormat), 
+                        STR(fileName(backupIndex, fileIndex)));
                 
-                case 'S':
-                    // The storage host. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(storageHost()));
-                    retval += tmp;
-                    break;
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
                 
-                case 's':
-                    // The storage host. 
-                    partFormat += "llu";
-                    tmp.sprintf(
-                            STR(partFormat), 
-                            fileSize(backupIndex, fileIndex).toULongLong());
-                    retval += tmp;
-                    break;
+                break;
+
+            case 'H':
+                // The backup host.
+                partFormat += 's';
+
+                if (modifierConfig)
+                    tmp.sprintf(STR(partFormat), STR(configBackupHost()));
+                else
+                    tmp.sprintf(STR(partFormat), STR(backupHost()));
+
+                retval += tmp;
+                break;
             
-                case 't':
-                    // The storage host. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(title()));
-                    retval += tmp;
-                    break;
+            case 'I':
+                // The numerical ID of the backup.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), id());
+                retval += tmp;
+                break;
+            
+            case 'i':
+                // The cluster ID of the backup.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), clusterId());
+                retval += tmp;
+                break;
+           
+            case 'J':
+                // The ID of the job.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), jobId());
+                retval += tmp;
+                break;
+
+            case 'M':
+                // The backup method.
+                partFormat += 's';
+
+                if (modifierConfig)
+                    tmp.sprintf(STR(partFormat), STR(configMethod()));
+                else
+                    tmp.sprintf(STR(partFormat), STR(method()));
+
+                retval += tmp;
+                break;
+            
+            case 'O':
+                // The owner.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(configOwner()));
+                retval += tmp;
+                break;
+
+            case 'P':
+                // The file name.
+                partFormat += 's';
+
+                if (syntaxHighlight)
+                {
+                    retval += S9sRpcReply::fileColorBegin(
+                            fileName(backupIndex, fileIndex));
+                }
+
+                tmp.sprintf(
+                        STR(partFormat), 
+                        STR(filePath(backupIndex, fileIndex)));
                 
-                case 'v':
-                    // The verification status.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(verificationStatus()));
-                    retval += tmp;
-                    break;
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
                 
-                case '%':
-                    retval += '%';
-                    break;
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '-':
-                case '+':
-                case '.':
-                case '\'':
-                    partFormat += c;
-                    continue;
-            }
-        } else {
-            retval += c;
+                break;
+            
+            case 'R':
+                // The root directory of the backup.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(rootDir()));
+                retval += tmp;
+                break;
+            
+            case 'S':
+                // The storage host. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(storageHost()));
+                retval += tmp;
+                break;
+            
+            case 's':
+                // The storage host. 
+                partFormat += "llu";
+                tmp.sprintf(
+                        STR(partFormat), 
+                        fileSize(backupIndex, fileIndex).toULongLong());
+                retval += tmp;
+                break;
+        
+            case 't':
+                // The storage host. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(title()));
+                retval += tmp;
+                break;
+            
+            case 'v':
+                // The verification status.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(verificationStatus()));
+                retval += tmp;
+                break;
         }
-
-        percent        = false;
-        escaped        = false;
-        modifierConfig = false;
     }
 
     return retval;
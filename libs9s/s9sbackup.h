@@ -21,6 +21,8 @@
 
 #include "S9sVariantMap"
 
+class S9sFormatTemplate;
+
 /**
  * A class that represents a backup. 
  */
@@ -121,6 +123,12 @@ class S9sBackup
                 const bool       syntaxHighlight,
                 const S9sString &formatString) const;
 
+        S9sString toString(
+                const int                backupIndex,
+                const int                fileIndex,
+                const bool               syntaxHighlight,
+                const S9sFormatTemplate &format) const;
+
     private:
         S9sVariant configValue(const S9sString &key) const;
         S9sVariant config() const;
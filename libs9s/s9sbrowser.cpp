@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sbrowser.h"
+#include "S9sOutput"
 #include "S9sFormat"
 #include "S9sDisplay"
 
@@ -40,11 +41,19 @@ S9sBrowser::~S9sBrowser()
 {
 }
 
+/**
+ * \param node The root node of the tree to show.
+ *
+ * Sets the tree the browser shows. If the current path still exists the
+ * browser stays there and keeps the selected item selected even if other items
+ * were added or removed before it in the list.
+ */
 void
 S9sBrowser::setCdt(
         const S9sTreeNode &node)
 {
-    bool success;
+    S9sString selectedName = selectedNode().name();
+    bool      success;
 
     m_rootNode = node;
     
@@ -56,6 +65,20 @@ S9sBrowser::setCdt(
     }
 
     setNumberOfItems(m_subTree.nChildren());
+
+    if (success && !selectedName.empty())
+    {
+        const S9sVector<S9sTreeNode> &childNodes = m_subTree.childNodes();
+
+        for (uint idx = 0u; idx < childNodes.size(); ++idx)
+        {
+            if (childNodes[idx].name() == selectedName)
+            {
+                setSelectionIndex(idx);
+                break;
+            }
+        }
+    }
 }
 
 S9sString 
@@ -245,7 +268,7 @@ S9sBrowser::printLine(
     column3 = column2 + 10;
 
     m_nChars = 0;
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", normal);
     if (lineIndex == 0)
     {
         printChar("╔");
@@ -256,9 +279,9 @@ S9sBrowser::printLine(
         {
             if (m_nChars == column1 || 
                     m_nChars == column2 || m_nChars == column3)
-                ::printf("╤"); 
+                S9sOutput::printf("╤"); 
             else
-                ::printf("═");
+                S9sOutput::printf("═");
 
             ++m_nChars;
         }
@@ -266,20 +289,20 @@ S9sBrowser::printLine(
         printChar("╗");
     } else if (lineIndex == 1) 
     {
-        ::printf("║");
+        S9sOutput::printf("║");
    
         header1Format.printf("Name");
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         header2Format.printf("User");
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         header3Format.printf("Group");
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         header4Format.printf("Mode");
 
-        ::printf("║");
+        S9sOutput::printf("║");
     } else if (lineIndex == height() - 1)
     {
         // Last line, frame.
@@ -296,9 +319,9 @@ S9sBrowser::printLine(
                     m_nChars == column2 || 
                     m_nChars == column3)
             {
-                ::printf("┴"); 
+                S9sOutput::printf("┴"); 
             } else {
-                ::printf("─");
+                S9sOutput::printf("─");
             }
 
             ++m_nChars;
@@ -357,48 +380,48 @@ S9sBrowser::printLine(
         }
 
 
-        ::printf("║");
+        S9sOutput::printf("║");
 
         if (selected)
-            ::printf("%s", selection);
+            S9sOutput::printf("%s", selection);
         else if (node.isFolder())
-            ::printf("%s", folder);
+            S9sOutput::printf("%s", folder);
         else if (node.isDevice())
-            ::printf("%s", deviceColor);
+            S9sOutput::printf("%s", deviceColor);
         else if (node.isFile() && node.isExecutable())
-            ::printf("%s", execColor);
+            S9sOutput::printf("%s", execColor);
         else if (false && node.isUser())
-            ::printf("%s", user);
+            S9sOutput::printf("%s", user);
         else if (false && node.isGroup())
-            ::printf("%s", groupColor);
+            S9sOutput::printf("%s", groupColor);
         else if (false && node.isFile())
-            ::printf("%s", file);
+            S9sOutput::printf("%s", file);
         else if (false && node.isCluster())
-            ::printf("%s", cluster);
+            S9sOutput::printf("%s", cluster);
         else if (false && node.isNode())
-            ::printf("%s", hostColor);
+            S9sOutput::printf("%s", hostColor);
 
         column1Format.printf(name);
         
         if (selected)
-            ::printf("%s%s", TERM_NORMAL, selection);
+            S9sOutput::printf("%s%s", TERM_NORMAL, selection);
         else
-            ::printf("%s%s", TERM_NORMAL, normal);
+            S9sOutput::printf("%s%s", TERM_NORMAL, normal);
 
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         column2Format.printf(owner);
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         column3Format.printf(group);
-        ::printf("│"); 
+        S9sOutput::printf("│"); 
         
         column4Format.printf(mode);
         
         //if (selected)
-        ::printf("%s%s", TERM_NORMAL, normal);
+        S9sOutput::printf("%s%s", TERM_NORMAL, normal);
 
-        ::printf("║");
+        S9sOutput::printf("║");
     }
 }
 
@@ -415,7 +438,7 @@ S9sBrowser::printString(
     if ((int)theString.length() > availableChars)
         myString.resize(availableChars);
 
-    ::printf("%s", STR(myString));
+    S9sOutput::printf("%s", STR(myString));
     m_nChars += myString.length();
 }
 
@@ -423,7 +446,7 @@ void
 S9sBrowser::printChar(
         int c)
 {
-    ::printf("%c", c);
+    S9sOutput::printf("%c", c);
     ++m_nChars;
 }
 
@@ -431,7 +454,7 @@ void
 S9sBrowser::printChar(
         const char *c)
 {
-    ::printf("%s", c);
+    S9sOutput::printf("%s", c);
     ++m_nChars;
 }
 
@@ -442,7 +465,7 @@ S9sBrowser::printChar(
 {
     while (m_nChars < lastColumn)
     {
-        ::printf("%s", c);
+        S9sOutput::printf("%s", c);
         ++m_nChars;
     }
 }
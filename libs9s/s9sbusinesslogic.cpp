@@ -19,6 +19,7 @@
  */
 #include "iostream"
 #include "s9sbusinesslogic.h"
+#include "S9sOutput"
 
 #include "S9sStringList"
 #include "S9sRpcReply"
@@ -36,6 +37,9 @@
 #include "S9sMonitor"
 #include "S9sCalc"
 #include "S9sCommander"
+#include "S9sConfigPuller"
+#include "S9sCompletionCache"
+#include "S9sMultiController"
 
 #include <stdio.h>
 #include <unistd.h>
@@ -56,11 +60,37 @@ S9sBusinessLogic::execute()
     S9sString    controller = options->controllerHostName();
     int          port       = options->controllerPort();
     S9sString    path       = options->controllerPath();
-    int          clusterId  = options->clusterId();
     bool         useTls     = options->useTls();
     S9sRpcClient client(controller, port, path, useTls);
+
+    execute(client);
+}
+
+/**
+ * \param client The client to send the requests with.
+ *
+ * Executes the command line using an existing client. If the client is already
+ * authenticated (e.g. by a previous command in the --shell mode) the session is
+ * used and the authentication is not repeated.
+ */
+void 
+S9sBusinessLogic::execute(
+        S9sRpcClient &client)
+{
+    S9sOptions  *options    = S9sOptions::instance();
+    int          clusterId  = options->clusterId();
     bool         success;
 
+    /*
+     * The --controllers is handled separately, the request goes to all the
+     * controllers and not to the one this client is connected to.
+     */
+    if (options->hasControllers())
+    {
+        executeMultiController();
+        return;
+    }
+
     /*
      * Authenticating... maybe.
      */
@@ -78,7 +108,8 @@ S9sBusinessLogic::execute()
         // We do not authenticate for password reset, the user forgot the 
         // password.
         //
-    } else {
+    } else if (!client.isAuthenticated())
+    {
         success = client.maybeAuthenticate();
         if (!success && !options->isWatchRequested())
         {
@@ -460,6 +491,9 @@ S9sBusinessLogic::execute()
             client.getTree();
             reply = client.reply();
             reply.printObjectList();
+
+            if (options->nExtraArguments() == 0u)
+                S9sCompletionCache::treeReceived(reply);
         } else if (options->isTreeRequested())
         {
             S9sRpcReply reply;
@@ -1233,6 +1267,12 @@ S9sBusinessLogic::execute()
             client.setExitStatus();
             reply = client.reply();
             reply.printReportTemplateList();
+
+            if (!options->hasClusterIdOption() && 
+                    !options->hasClusterNameOption())
+            {
+                S9sCompletionCache::reportTemplatesReceived(reply);
+            }
         } else if (options->isCreateRequested())
         {
             S9sRpcReply reply;
@@ -1456,6 +1496,7 @@ S9sBusinessLogic::executeClusterList(
     {
         reply = client.reply();
         reply.printClusterList();
+        S9sCompletionCache::clustersReceived(reply);
     } else {
         if (options->isJsonRequested())
             reply.printJsonFormat();
@@ -1464,6 +1505,66 @@ S9sBusinessLogic::executeClusterList(
     }
 }
 
+/**
+ * Executes the list request (cluster, alarm or backup list) on all the
+ * controllers of the --controllers command line option (or the "controllers"
+ * configuration variable) in parallel and prints the merged list. The
+ * controllers that failed are reported at the end.
+ */
+void 
+S9sBusinessLogic::executeMultiController()
+{
+    S9sOptions     *options = S9sOptions::instance();
+    S9sVariantList  controllers = options->controllers();
+    S9sRpcReply     reply;
+    bool            success;
+
+    if (!S9sMultiController::isSupported())
+    {
+        PRINT_ERROR(
+                "The --controllers option is only supported with "
+                "'cluster --list', 'alarm --list' and 'backup --list'.");
+
+        options->setExitStatus(S9sOptions::BadOptions);
+        return;
+    }
+
+    if (controllers.empty())
+    {
+        PRINT_ERROR(
+                "No controllers are set. Use the --controllers=LIST command "
+                "line option or the 'controllers' configuration variable.");
+
+        options->setExitStatus(S9sOptions::BadOptions);
+        return;
+    }
+
+    S9sMultiController multi(controllers);
+
+    if (options->hasParallellism())
+        multi.setParallelism(options->parallellism());
+
+    success = multi.execute();
+    reply   = multi.reply();
+
+    if (options->isClusterOperation())
+        reply.printClusterList();
+    else if (options->isAlarmOperation())
+        reply.printAlarmList();
+    else
+        reply.printBackupList();
+
+    // With JSON the per controller results are in the reply.
+    if (!options->isJsonRequested())
+    {
+        S9sOutput::flush();
+        multi.printErrors();
+    }
+
+    if (!success)
+        options->setExitStatus(S9sOptions::Failed);
+}
+
 /**
  *
  */
@@ -1583,11 +1684,12 @@ void
 S9sBusinessLogic::executePullConfig(
         S9sRpcClient &client)
 {
-    S9sOptions  *options   = S9sOptions::instance();
-    S9sString    outputDir = options->outputDir();
-    S9sRpcReply  reply;
-    S9sDir       dir;
-    bool         success;
+    S9sOptions     *options   = S9sOptions::instance();
+    S9sString       outputDir = options->outputDir();
+    S9sVariantList  hosts     = options->nodes();
+    S9sConfigPuller puller(client, outputDir);
+    S9sDir          dir;
+    bool            success;
 
     /*
      * 
@@ -1618,28 +1720,33 @@ S9sBusinessLogic::executePullConfig(
     }
 
     /*
-     *
+     * Pulling the config from all the hosts, more of them in parallel.
      */
-    success = client.getConfig(options->nodes());
-    if (!success)
-    {
-        PRINT_ERROR("%s", STR(client.errorString()));
-        return;
-    }
+    if (options->hasParallellism())
+        puller.setParallelism(options->parallellism());
 
-    reply   = client.reply();
-    success = reply.isOk();
-    if (!success)
+    success = puller.pull(hosts);
+
+    if (hosts.size() > 1u)
     {
-        if (options->isJsonRequested())
-            reply.printJsonFormat();
-        else
-            PRINT_ERROR("%s", STR(reply.errorString()));
+        puller.printSummary();
+    } else if (!success && !puller.results().empty())
+    {
+        S9sVariantMap result = puller.results()[0].toVariantMap();
 
-        return;
+        if (options->isJsonRequested() && result.contains("reply"))
+        {
+            S9sRpcReply reply;
+
+            reply = result["reply"].toVariantMap();
+            reply.printJsonFormat();
+        } else {
+            PRINT_ERROR("%s", STR(result["error_string"].toString()));
+        }
     }
 
-    reply.saveConfig(outputDir);
+    if (!success)
+        options->setExitStatus(S9sOptions::Failed);
 }
 
 void 
@@ -2011,6 +2118,7 @@ S9sBusinessLogic::executeUserList(
     {
         reply = client.reply();
         reply.printUserList();
+        S9sCompletionCache::usersReceived(reply);
     } else {
         PRINT_ERROR("%s", STR(client.errorString()));
     }
@@ -2262,7 +2370,7 @@ S9sBusinessLogic::waitForJobWithProgress(
     int            nAuthentications = 0;
 
     if (syntaxHighlight)
-        printf("\033[?25l"); 
+        S9sOutput::printf("\033[?25l"); 
 
     for (;;)
     {
@@ -2307,7 +2415,7 @@ S9sBusinessLogic::waitForJobWithProgress(
             reply     = client.reply();
             reply.printJsonFormat();
         
-            fflush(stdout); 
+            S9sOutput::flush(); 
             finished = reply.progressLine(progressLine, syntaxHighlight);
 
             if (finished)
@@ -2330,7 +2438,7 @@ S9sBusinessLogic::waitForJobWithProgress(
                 titleEnd   = TERM_NORMAL;
             }
 
-            printf("%s%s%s\n", 
+            S9sOutput::printf("%s%s%s\n", 
                     titleBegin,
                     STR(reply.jobTitle()),
                     titleEnd);
@@ -2353,17 +2461,17 @@ S9sBusinessLogic::waitForJobWithProgress(
                 !previousProgressLine.empty() &&
                 progressLine != previousProgressLine)
         {
-            printf("\n");
+            S9sOutput::printf("\n");
         }
 
-        printf("%s %s\033[K\r", rotate[rotateCycle], STR(progressLine));
+        S9sOutput::printf("%s %s\033[K\r", rotate[rotateCycle], STR(progressLine));
 
         previousProgressLine = progressLine;
 
         if (reply.isJobFailed())
             options->setExitStatus(S9sOptions::JobFailed);
 
-        fflush(stdout);
+        S9sOutput::flush();
         sleep(1);
 
         ++rotateCycle;
@@ -2375,9 +2483,9 @@ end_of_loop:
     }
 
     if (syntaxHighlight)
-        printf("\033[?25h");
+        S9sOutput::printf("\033[?25h");
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -2481,14 +2589,14 @@ S9sBusinessLogic::waitForJobWithLog(
             job["status"] == "FINISHED"  ||
             job["status"] == "FAILED";
         
-        fflush(stdout);
+        S9sOutput::flush();
         if (finished)
             break;
         
         sleep(1);
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -2774,7 +2882,7 @@ S9sBusinessLogic::executeCreateUserThroughPipe(
             escapedJson = request.toString().escape();
 
             if (options->isJsonRequested())
-                printf("Request: %s\n", STR(request.toString()));
+                S9sOutput::printf("Request: %s\n", STR(request.toString()));
             
             PRINT_VERBOSE("escapedJson: \n%s", STR(escapedJson));
 
@@ -2820,6 +2928,7 @@ S9sBusinessLogic::executeCreateUserThroughPipe(
                     "Tried to grant on %s:%s, exitCode=%d.",
                     STR(controller), STR(path), exitCode);
 
+            S9sOutput::flush();
             exitCode    = ::system(STR(sshCommand));
             oneSucceed |= (exitCode == 0);
 
@@ -2968,7 +3077,7 @@ S9sBusinessLogic::executeMaintenanceCreate(
             reply.printJsonFormat();
         } else if (!options->isBatchRequested()) 
         {
-            printf("%s\n", STR(reply.uuid()));
+            S9sOutput::printf("%s\n", STR(reply.uuid()));
         }
     } else {
         if (options->isJsonRequested())
@@ -30,6 +30,7 @@ class S9sBusinessLogic
 {
     public:
         void execute();
+        void execute(S9sRpcClient &client);
 
         void waitForJob(
                 const int     clusterId,
@@ -74,6 +75,7 @@ class S9sBusinessLogic
 
         void executeClusterList(S9sRpcClient &client);
         void executeClusterPing(S9sRpcClient &client);
+        void executeMultiController();
         void executeControllerPing(S9sRpcClient &client);
 
         void executeNodeList(S9sRpcClient &client);
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sbutton.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 
@@ -47,6 +48,6 @@ S9sButton::~S9sButton()
 void 
 S9sButton::print() const
 {
-    ::printf("[%s]", STR(m_labelText));
+    S9sOutput::printf("[%s]", STR(m_labelText));
 }
 
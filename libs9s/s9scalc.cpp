@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9scalc.h"
+#include "S9sOutput"
 
 #include "S9sDateTime"
 #include "S9sMutexLocker"
@@ -202,7 +203,7 @@ S9sCalc::processButton(
 bool
 S9sCalc::refreshScreen()
 {
-    printf("%s", TERM_CURSOR_OFF);
+    S9sOutput::printf("%s", TERM_CURSOR_OFF);
 
     startScreen();
     printHeader();
@@ -235,10 +236,10 @@ S9sCalc::printHeader()
     if (!spreadsheetName().empty())
         title = spreadsheetName();
 
-    ::printf("%s%s%s ", bold, STR(title), normal);
-    ::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
-    ::printf("0x%08x ",      lastKeyCode());
-    ::printf("%02dx%02d ",   width(), height());
+    S9sOutput::printf("%s%s%s ", bold, STR(title), normal);
+    S9sOutput::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
+    S9sOutput::printf("0x%08x ",      lastKeyCode());
+    S9sOutput::printf("%02dx%02d ",   width(), height());
 
     printNewLine();
     
@@ -254,22 +255,22 @@ S9sCalc::printFooter()
     //const char *bold   = TERM_SCREEN_TITLE_BOLD;
     const char *normal = TERM_SCREEN_TITLE;
 
-    ::printf("%s ", normal);
+    S9sOutput::printf("%s ", normal);
 
     if (!m_errorString.empty())
     {
-        ::printf("%s", STR(m_errorString));
+        S9sOutput::printf("%s", STR(m_errorString));
     } else if (!warning.empty()) 
     {
-        ::printf("%s", STR(warning));
+        S9sOutput::printf("%s", STR(warning));
     } else {
-        ::printf("ok");
+        S9sOutput::printf("ok");
     }
         
     // No new-line at the end, this is the last line.
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", TERM_NORMAL);
-    fflush(stdout);    
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::flush();    
 }
 
 /**
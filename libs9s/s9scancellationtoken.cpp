@@ -0,0 +1,132 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9scancellationtoken.h"
+
+#include "S9sMutex"
+#include "S9sMutexLocker"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The data shared by the copies of the S9sCancellationToken.
+ */
+class S9sCancellationTokenPrivate
+{
+    public:
+        S9sCancellationTokenPrivate() :
+            m_referenceCounter(1),
+            m_cancelled(false)
+        {
+        }
+
+        void 
+        ref()
+        {
+            S9sMutexLocker locker(m_mutex);
+
+            ++m_referenceCounter;
+        }
+
+        int 
+        unRef()
+        {
+            S9sMutexLocker locker(m_mutex);
+
+            return --m_referenceCounter;
+        }
+
+        int         m_referenceCounter;
+        bool        m_cancelled;
+        S9sMutex    m_mutex;
+};
+
+S9sCancellationToken::S9sCancellationToken() :
+    m_priv(new S9sCancellationTokenPrivate)
+{
+}
+
+S9sCancellationToken::S9sCancellationToken(
+        const S9sCancellationToken &orig)
+{
+    m_priv = orig.m_priv;
+    m_priv->ref();
+}
+
+S9sCancellationToken::~S9sCancellationToken()
+{
+    if (m_priv->unRef() == 0)
+        delete m_priv;
+
+    m_priv = 0;
+}
+
+/**
+ * Assignment operator to utilize the implicit sharing.
+ */
+S9sCancellationToken &
+S9sCancellationToken::operator=(
+        const S9sCancellationToken &rhs)
+{
+    if (this == &rhs || m_priv == rhs.m_priv)
+        return *this;
+
+    if (m_priv->unRef() == 0)
+        delete m_priv;
+
+    m_priv = rhs.m_priv;
+    m_priv->ref();
+
+    return *this;
+}
+
+/**
+ * Asks the job that checks this token (or any copy of it) to stop.
+ */
+void
+S9sCancellationToken::cancel()
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    m_priv->m_cancelled = true;
+}
+
+/**
+ * \returns True if cancel() was called on this token or on any copy of it.
+ */
+bool
+S9sCancellationToken::isCancelled() const
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    return m_priv->m_cancelled;
+}
+
+/**
+ * Clears the flag, so the token can be used for the next job.
+ */
+void
+S9sCancellationToken::reset()
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    m_priv->m_cancelled = false;
+}
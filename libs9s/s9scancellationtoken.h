@@ -0,0 +1,45 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+class S9sCancellationTokenPrivate;
+
+/**
+ * A flag shared between threads that is used to ask a running job (e.g. a
+ * series of RPC requests) to stop early. The copies of the token share the
+ * same flag, so one thread may keep a copy and cancel() it while an other
+ * thread checks isCancelled() between the steps of its work.
+ */
+class S9sCancellationToken
+{
+    public:
+        S9sCancellationToken();
+        S9sCancellationToken(const S9sCancellationToken &orig);
+        ~S9sCancellationToken();
+
+        S9sCancellationToken &operator=(const S9sCancellationToken &rhs);
+
+        void cancel();
+        bool isCancelled() const;
+        void reset();
+
+    private:
+        S9sCancellationTokenPrivate *m_priv;
+};
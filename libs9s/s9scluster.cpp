@@ -21,6 +21,7 @@
 #include "S9sRpcReply"
 
 #include "S9sNode"
+#include "S9sFormatTemplate"
 
 //#define DEBUG
 //#define WARNING
@@ -949,362 +950,301 @@ S9sString
 S9sCluster::toString(
         const bool       syntaxHighlight,
         const S9sString &formatString) const
+{
+    return toString(
+            syntaxHighlight, S9sFormatTemplate::compiled(formatString, "f"));
+}
+
+/**
+ * Converts the object to a string using a format template that is already
+ * compiled, see the other toString() for the format string itself.
+ */
+S9sString
+S9sCluster::toString(
+        const bool               syntaxHighlight,
+        const S9sFormatTemplate &format) const
 {
     S9sFormatter formatter;    
     S9sString    retval;
     S9sString    tmp;
-    char         c;
     S9sString    partFormat;
-    bool         percent      = false;
-    bool         escaped      = false;
-    bool         modifierFree = false;
+    bool         modifierFree;
 
-    for (uint n = 0; n < formatString.size(); ++n)
+    for (uint idx = 0; idx < format.size(); ++idx)
     {
-        c = formatString[n];
-        
-        if (c == '%' && !percent)
-        {
-            percent    = true;
-            partFormat = "%";
-            continue;
-        } else if (percent && c == 'f')
-        {
-            modifierFree = true;
-            continue;
-        } else if (c == '\\' && !escaped)
+        const S9sFormatTemplate::Part &part = format.part(idx);
+
+        if (part.isLiteral())
         {
-            escaped = true;
+            retval += part.literal;
             continue;
         }
 
-        if (escaped)
-        {
-            switch (c)
-            {
-                case '\"':
-                    retval += '\"';
-                    break;
-
-                case '\\':
-                    retval += '\\';
-                    break;
-       
-                case 'a':
-                    retval += '\a';
-                    break;
-
-                case 'b':
-                    retval += '\b';
-                    break;
-
-                case 'e':
-                    retval += '\027';
-                    break;
-
-                case 'n':
-                    retval += '\n';
-                    break;
-
-                case 'r':
-                    retval += '\r';
-                    break;
-
-                case 't':
-                    retval += '\t';
-                    break;
-            }
-        } else if (percent)
+        partFormat = part.prefix;
+        modifierFree = part.modifier == 'f';
+
+        switch (part.directive)
         {
-            switch (c)
-            {
-                case 'a':
-                    // The number of active alarms on the cluster.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), 
-                            alarmsCritical() + alarmsWarning());
-
-                    retval += tmp;
-                    break;
-
-                case 'C':
-                    // The configuration file for the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(configFile()));
-                    
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(configFile());
-                    
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
-                    break;
+            case 'a':
+                // The number of active alarms on the cluster.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), 
+                        alarmsCritical() + alarmsWarning());
+
+                retval += tmp;
+                break;
+
+            case 'C':
+                // The configuration file for the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(configFile()));
                 
-                case 'c':
-                    // The total number of CPU cores in the cluster.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nCpuCores().toInt());
-                    retval += tmp;
-                    break;
-
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(configFile());
                 
-                case 'D':
-                    // The controller domain name for the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(controllerDomainName()));
-                    
-                    retval += tmp;
-
-                    break;
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
+                break;
+            
+            case 'c':
+                // The total number of CPU cores in the cluster.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nCpuCores().toInt());
+                retval += tmp;
+                break;
+
+            
+            case 'D':
+                // The controller domain name for the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(controllerDomainName()));
+                
+                retval += tmp;
 
-                case 'G':
-                    // The name of the group owner.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(groupOwnerName()));
+                break;
 
-                    if (syntaxHighlight)
-                    {
-                        retval += S9sRpcReply::groupColorBegin(
-                                groupOwnerName());
-                    }
+            case 'G':
+                // The name of the group owner.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(groupOwnerName()));
 
-                    retval += tmp;
+                if (syntaxHighlight)
+                {
+                    retval += S9sRpcReply::groupColorBegin(
+                            groupOwnerName());
+                }
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::groupColorEnd();
+                retval += tmp;
 
-                    break;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::groupColorEnd();
 
-                case 'H':
-                    // The controller host name for the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(controllerName()));
-                    
-                    retval += tmp;
+                break;
 
-                    break;
+            case 'H':
+                // The controller host name for the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(controllerName()));
                 
-                case 'h':
-                    // The number of the hosts in the cluster.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nHosts());
-
-                    retval += tmp;
-                    break;
-
-                case 'I':
-                    // The ID of the cluster.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), clusterId());
-
-                    retval += tmp;
-                    break;
+                retval += tmp;
+
+                break;
+            
+            case 'h':
+                // The number of the hosts in the cluster.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nHosts());
+
+                retval += tmp;
+                break;
+
+            case 'I':
+                // The ID of the cluster.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), clusterId());
+
+                retval += tmp;
+                break;
+            
+            case 'i':
+                // The total number of monitored disk devices.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nDevices().toInt());
+
+                retval += tmp;
+                break;
+             
+            case 'k':
+                // The total disk size found in the cluster.
+                partFormat += 'f';
+
+                if (modifierFree)
+                {
+                    tmp.sprintf(
+                            STR(partFormat), 
+                            freeDiskBytes().toTBytes());
+                } else {
+                    tmp.sprintf(
+                            STR(partFormat), 
+                            totalDiskBytes().toTBytes());
+                }
+
+                retval += tmp;
+                break;
+
+            case 'L':
+                // The log file for the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(logFile()));
                 
-                case 'i':
-                    // The total number of monitored disk devices.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nDevices().toInt());
-
-                    retval += tmp;
-                    break;
-                 
-                case 'k':
-                    // The total disk size found in the cluster.
-                    partFormat += 'f';
-
-                    if (modifierFree)
-                    {
-                        tmp.sprintf(
-                                STR(partFormat), 
-                                freeDiskBytes().toTBytes());
-                    } else {
-                        tmp.sprintf(
-                                STR(partFormat), 
-                                totalDiskBytes().toTBytes());
-                    }
-
-                    retval += tmp;
-                    break;
-
-                case 'L':
-                    // The log file for the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(logFile()));
-                    
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(logFile());
-                    
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
-
-                    break;
-
-                case 'M':
-                    // The status text of the cluster.
-                    partFormat += 's';
-                    
-                    tmp.sprintf(STR(partFormat), STR(statusText()));
-
-                    retval += tmp;
-                    break;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(logFile());
                 
-                case 'm':
-                    // The total memory size found in the cluster.
-                    partFormat += 'f';
-                    if (modifierFree)
-                        tmp.sprintf(STR(partFormat), memFree().toGBytes());
-                    else
-                        tmp.sprintf(STR(partFormat), memTotal().toGBytes());
-
-                    retval += tmp;
-                    break;
+                retval += tmp;
 
-                case 'N':
-                    // The name of the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(name()));
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
 
-                    if (syntaxHighlight)
-                        retval += XTERM_COLOR_BLUE;
+                break;
 
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += TERM_NORMAL;
-
-                    break;
-                
-                case 'n':
-                    // The total number of monitored network interfaces.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nNics().toInt());
-
-                    retval += tmp;
-                    break;
+            case 'M':
+                // The status text of the cluster.
+                partFormat += 's';
                 
-                case 'O':
-                    // The name of the owner.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(ownerName()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorBegin();
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorEnd();
-
-                    break;
-
-                case 'P':
-                    // The CDT path 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(cdtPath()));
-
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorBegin();
-
-                    retval += tmp;
+                tmp.sprintf(STR(partFormat), STR(statusText()));
 
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorEnd();
-
-                    break;
-
-                case 'S':
-                    // The state of the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(state()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::clusterStateColorBegin(state());
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::clusterStateColorEnd();
-
-                    break;
-                
-                case 'T':
-                    // The type of the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(clusterType()));
-                    retval += tmp;
-                    break;
-
-                case 't':
-                    // The total network traffic found in the cluster.
-                    partFormat += 'f';
-                    tmp.sprintf(STR(partFormat), 
-                            netBytesPerSecond().toMBytes());
-
-                    retval += tmp;
-                    break;
-
-                case 'V':
-                    // The vendor and version of the cluster.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(vendorAndVersion()));
-                    retval += tmp;
-                    break;
-               
-                case 'U':
-                    // The number of CPUs.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nCpus().toInt());
-                    retval += tmp;
-                    break;
-
-                case 'u':
-                    // The CPU usage percent. 
-                    partFormat += 'f';
-                    tmp.sprintf(STR(partFormat), cpuUsagePercent().toDouble());
-                    retval += tmp;
-                    break;
-                
-                case 'w':
-                    // The total swap space size found in the cluster.
-                    partFormat += 'f';
-                    if (modifierFree)
-                        tmp.sprintf(STR(partFormat), swapFree().toGBytes());
-                    else
-                        tmp.sprintf(STR(partFormat), swapTotal().toGBytes());
-
-                    retval += tmp;
-                    break;
-                
-                case '%':
-                    retval += '%';
-                    break;
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '-':
-                case '+':
-                case '.':
-                    partFormat += c;
-                    continue;
-            }
-        } else {
-            retval += c;
+                retval += tmp;
+                break;
+            
+            case 'm':
+                // The total memory size found in the cluster.
+                partFormat += 'f';
+                if (modifierFree)
+                    tmp.sprintf(STR(partFormat), memFree().toGBytes());
+                else
+                    tmp.sprintf(STR(partFormat), memTotal().toGBytes());
+
+                retval += tmp;
+                break;
+
+            case 'N':
+                // The name of the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(name()));
+
+                if (syntaxHighlight)
+                    retval += XTERM_COLOR_BLUE;
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += TERM_NORMAL;
+
+                break;
+            
+            case 'n':
+                // The total number of monitored network interfaces.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nNics().toInt());
+
+                retval += tmp;
+                break;
+            
+            case 'O':
+                // The name of the owner.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(ownerName()));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorEnd();
+
+                break;
+
+            case 'P':
+                // The CDT path 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(cdtPath()));
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorEnd();
+
+                break;
+
+            case 'S':
+                // The state of the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(state()));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::clusterStateColorBegin(state());
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::clusterStateColorEnd();
+
+                break;
+            
+            case 'T':
+                // The type of the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(clusterType()));
+                retval += tmp;
+                break;
+
+            case 't':
+                // The total network traffic found in the cluster.
+                partFormat += 'f';
+                tmp.sprintf(STR(partFormat), 
+                        netBytesPerSecond().toMBytes());
+
+                retval += tmp;
+                break;
+
+            case 'V':
+                // The vendor and version of the cluster.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(vendorAndVersion()));
+                retval += tmp;
+                break;
+           
+            case 'U':
+                // The number of CPUs.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nCpus().toInt());
+                retval += tmp;
+                break;
+
+            case 'u':
+                // The CPU usage percent. 
+                partFormat += 'f';
+                tmp.sprintf(STR(partFormat), cpuUsagePercent().toDouble());
+                retval += tmp;
+                break;
+            
+            case 'w':
+                // The total swap space size found in the cluster.
+                partFormat += 'f';
+                if (modifierFree)
+                    tmp.sprintf(STR(partFormat), swapFree().toGBytes());
+                else
+                    tmp.sprintf(STR(partFormat), swapTotal().toGBytes());
+
+                retval += tmp;
+                break;
         }
-
-        percent      = false;
-        escaped      = false;
-        modifierFree = false;
     }
 
     return retval;
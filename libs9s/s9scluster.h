@@ -23,6 +23,7 @@
 #include <S9sObject>
 
 class S9sNode;
+class S9sFormatTemplate;
 
 #define S9S_INVALID_CLUSTER_ID -1
 #define S9S_CLUSTER_ID_IS_VALID(_id) (_id > 0)
@@ -127,6 +128,10 @@ class S9sCluster : public S9sObject
                 const bool       syntaxHighlight,
                 const S9sString &formatString) const;
 
+        S9sString toString(
+                const bool               syntaxHighlight,
+                const S9sFormatTemplate &format) const;
+
     private:
         S9sVariantMap jobStatistics() const;
         S9sVariant sheetInfo(const S9sString &key) const;
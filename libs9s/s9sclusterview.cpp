@@ -0,0 +1,114 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sclusterview.h"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sClusterView::S9sClusterView() :
+    S9sObjectView(),
+    m_cached(0)
+{
+}
+
+S9sClusterView::S9sClusterView(
+        const S9sVariantMap &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+S9sClusterView::S9sClusterView(
+        const S9sVariant &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+int
+S9sClusterView::clusterId() const
+{
+    if (!(m_cached & ClusterIdCached))
+    {
+        m_clusterId = property("cluster_id").toInt();
+        m_cached   |= ClusterIdCached;
+    }
+
+    return m_clusterId;
+}
+
+const S9sString &
+S9sClusterView::name() const
+{
+    if (!(m_cached & NameCached))
+    {
+        m_name    = property("cluster_name").toString();
+        m_cached |= NameCached;
+    }
+
+    return m_name;
+}
+
+/**
+ * \returns The state of the cluster as "STARTED", "FAILURE", "DEGRADED"...
+ */
+const S9sString &
+S9sClusterView::state() const
+{
+    if (!(m_cached & StateCached))
+    {
+        m_state   = property("state").toString();
+        m_cached |= StateCached;
+    }
+
+    return m_state;
+}
+
+const S9sString &
+S9sClusterView::clusterType() const
+{
+    if (!(m_cached & ClusterTypeCached))
+    {
+        m_clusterType = property("cluster_type").toString();
+        m_cached     |= ClusterTypeCached;
+    }
+
+    return m_clusterType;
+}
+
+/**
+ * \returns The list of the hosts of the cluster as it is in the reply, without
+ *   copying it.
+ */
+const S9sVariantList &
+S9sClusterView::hosts() const
+{
+    return property("hosts").toVariantList();
+}
+
+/**
+ * \returns A cluster object with a copy of all the properties.
+ */
+S9sCluster
+S9sClusterView::toCluster() const
+{
+    return S9sCluster(*m_properties);
+}
@@ -0,0 +1,58 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sObjectView"
+#include "S9sCluster"
+
+/**
+ * A read-only view of a cluster in a parsed reply (see S9sObjectView). The
+ * frequently used fields are converted only once, on the first access.
+ */
+class S9sClusterView : public S9sObjectView
+{
+    public:
+        S9sClusterView();
+        S9sClusterView(const S9sVariantMap &properties);
+        S9sClusterView(const S9sVariant &properties);
+
+        int clusterId() const;
+        const S9sString &name() const;
+        const S9sString &state() const;
+        const S9sString &clusterType() const;
+        const S9sVariantList &hosts() const;
+
+        S9sCluster toCluster() const;
+
+    private:
+        enum CachedField
+        {
+            ClusterIdCached   = 0x01,
+            NameCached        = 0x02,
+            StateCached       = 0x04,
+            ClusterTypeCached = 0x08
+        };
+
+        mutable int        m_cached;
+        mutable int        m_clusterId;
+        mutable S9sString  m_name;
+        mutable S9sString  m_state;
+        mutable S9sString  m_clusterType;
+};
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9scommander.h"
+#include "S9sOutput"
 #include "S9sDateTime"
 #include "S9sMutexLocker"
 #include "S9sDialog"
@@ -168,33 +169,123 @@ S9sCommander::main()
 }
 
 /**
- * Reloads the tree from the controller and pushes it into the widgets.
+ * \returns The paths of the branches that are shown in the browsers. Only
+ *   these branches need to be refreshed; if one is inside the other only the
+ *   outer one is returned. Before the first download this is only the root.
+ */
+S9sStringList
+S9sCommander::visiblePaths() const
+{
+    S9sStringList retval;
+    S9sString     leftPath  = m_leftBrowser.path();
+    S9sString     rightPath = m_rightBrowser.path();
+
+    if (m_rootNodeRecevied == 0 || leftPath.empty())
+    {
+        retval << "/";
+        return retval;
+    }
+
+    if (!m_rightBrowser.isVisible() || isInside(rightPath, leftPath))
+    {
+        retval << leftPath;
+    } else if (isInside(leftPath, rightPath))
+    {
+        retval << rightPath;
+    } else {
+        retval << leftPath;
+        retval << rightPath;
+    }
+
+    return retval;
+}
+
+/**
+ * \returns True if the path is the parent path itself or it is somewhere
+ *   under the parent path.
+ */
+bool
+S9sCommander::isInside(
+        const S9sString &path,
+        const S9sString &parentPath)
+{
+    if (parentPath == "/" || path == parentPath)
+        return true;
+
+    return path.startsWith(STR(parentPath + "/"));
+}
+
+/**
+ * \param path The path of the branch to download.
+ * \returns False if the branch was downloaded, but it could not be put into
+ *   the tree we have (e.g. because some of its parents were removed meanwhile),
+ *   true otherwise.
+ *
+ * Downloads one branch of the tree and puts it into the tree we already have
+ * in m_rootNode.
+ */
+bool
+S9sCommander::updateSubTree(
+        const S9sString &path)
+{
+    S9sRpcReply      getTreeReply;
+    bool             retval = true;
+
+    m_networkMutex.lock();
+    m_client.getTree(path, true);
+    getTreeReply = m_client.reply();
+    m_networkMutex.unlock();
+    
+    m_mutex.lock();
+    m_rightInfo.setInfoLastReply(getTreeReply);
+    m_leftInfo.setInfoLastReply(getTreeReply);
+
+    if (getTreeReply.isOk())
+    {
+        retval = m_rootNode.replaceSubTree(path, getTreeReply.tree());
+        if (retval)
+            m_rootNodeRecevied = time(NULL);
+    }
+
+    m_mutex.unlock(); 
+
+    return retval;
+}
+
+/**
+ * Reloads the tree from the controller and pushes it into the widgets. Only
+ * the branches that are visible in the browsers are downloaded, the rest of
+ * the tree is kept as it was received earlier.
  */
 void
 S9sCommander::updateTree()
 {
-    S9sRpcReply      getTreeReply;
+    S9sStringList    paths;
 
     // Updating the screen.
     m_mutex.lock();
     m_rightInfo.setInfoRequestName("getTree");
     m_leftInfo.setInfoRequestName("getTree");
+    paths = visiblePaths();
     m_mutex.unlock();
 
     m_communicating   = true;
     m_reloadRequested = false;
 
-    m_networkMutex.lock();
-    m_client.getTree(true);
-    getTreeReply = m_client.reply();
-    m_networkMutex.unlock();
+    for (uint idx = 0u; idx < paths.size(); ++idx)
+    {
+        if (!updateSubTree(paths[idx]) && paths[idx] != "/")
+        {
+            PRINT_LOG("Branch '%s' is gone, reloading.", STR(paths[idx]));
+            updateSubTree("/");
+            break;
+        }
+    }
     
     // Updating the screen.
     m_mutex.lock();
     m_rightInfo.setInfoRequestName("");
     m_leftInfo.setInfoRequestName("");
-    m_rightInfo.setInfoLastReply(getTreeReply);
-    m_leftInfo.setInfoLastReply(getTreeReply);
     
     m_leftInfo.setInfoController(
             m_client.hostName(), m_client.port(), m_client.useTls());
@@ -202,13 +293,8 @@ S9sCommander::updateTree()
     m_rightInfo.setInfoController(
             m_client.hostName(), m_client.port(), m_client.useTls());
 
-    if (getTreeReply.isOk())
-    {
-        m_rootNode = getTreeReply.tree();
-        m_leftBrowser.setCdt(m_rootNode);
-        m_rightBrowser.setCdt(m_rootNode);
-        m_rootNodeRecevied = time(NULL);
-    }
+    m_leftBrowser.setCdt(m_rootNode);
+    m_rightBrowser.setCdt(m_rootNode);
 
     m_communicating = false;
 
@@ -965,25 +1051,25 @@ S9sCommander::printHeader()
     S9sDateTime dt = S9sDateTime::currentDateTime();
     S9sString   title = "S9S";
 
-    ::printf("%s%-12s%s ", 
+    S9sOutput::printf("%s%-12s%s ", 
             TERM_SCREEN_TITLE_BOLD, 
             STR(title), 
             TERM_SCREEN_TITLE);
 
-    ::printf("%c ", rotatingCharacter());
-    ::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
+    S9sOutput::printf("%c ", rotatingCharacter());
+    S9sOutput::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
 
     // Printing the network activity character.
     if (m_communicating || m_reloadRequested)
-        ::printf("❌ ");
+        S9sOutput::printf("❌ ");
     else
-        ::printf("⟳ ");
+        S9sOutput::printf("⟳ ");
 
     if (m_viewDebug)
     {
-        ::printf("0x%02x ",      lastKeyCode());
-        ::printf("%02dx%02d ",   width(), height());
-        ::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
+        S9sOutput::printf("0x%02x ",      lastKeyCode());
+        S9sOutput::printf("%02dx%02d ",   width(), height());
+        S9sOutput::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
     }
 
     printNewLine();
@@ -1000,9 +1086,9 @@ S9sCommander::printFooter()
 
     for (;m_lineCounter < height() - 1; ++m_lineCounter)
     {
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\n\r");
-        ::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
     } 
 
     fieldSize = (width() / 10) - 2;
@@ -1034,14 +1120,14 @@ S9sCommander::printFooter()
 
     for (uint idx = 0u; idx < labels.size(); ++idx)
     {
-        ::printf(STR(format), 
+        S9sOutput::printf(STR(format), 
                 normal, idx + 1, inverse, 
                 STR(labels[idx].toString()), normal);
     }
 
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", TERM_NORMAL);
-    ::fflush(stdout);
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::flush();
 }
 
 void 
@@ -1092,8 +1178,8 @@ S9sCommander::entryActivated(
         //sleep(10);
         //setConioTerminalMode(true, true);
         m_waitingForKeyPress = true;
-        ::printf("\n*** Press any key to continue. ***\n");
-        fflush(stdout);
+        S9sOutput::printf("\n*** Press any key to continue. ***\n");
+        S9sOutput::flush();
     }
 }
 
@@ -1190,13 +1276,13 @@ S9sCommander::waitForJobWithLog(
             job["status"] == "FINISHED"  ||
             job["status"] == "FAILED";
         
-        fflush(stdout);
+        S9sOutput::flush();
         if (finished)
             break;
         
         sleep(1);
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
@@ -22,6 +22,7 @@
 #include "S9sDisplay"
 #include "S9sRpcClient"
 #include "S9sTreeNode"
+#include "S9sStringList"
 #include "S9sBrowser"
 #include "S9sInfoPanel"
 #include "S9sEditor"
@@ -50,6 +51,11 @@ class S9sCommander :
         virtual void printFooter();
 
         void updateTree();
+        bool updateSubTree(const S9sString &path);
+        S9sStringList visiblePaths() const;
+        static bool isInside(
+                const S9sString &path,
+                const S9sString &parentPath);
 
         void entryActivated(
                 const S9sString   &path,
@@ -0,0 +1,488 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9scompletioncache.h"
+
+#include "S9sOptions"
+#include "S9sRpcClient"
+#include "S9sRpcReply"
+#include "S9sOutput"
+#include "S9sFile"
+#include "S9sTreeNode"
+#include "S9sUser"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/*
+ * The items older than this (in seconds) are refreshed in the background.
+ */
+#define COMPLETION_CACHE_TTL 60
+
+static const char *completionContexts[] =
+{
+    "cluster-ids",
+    "cluster-names",
+    "users",
+    "tree",
+    "tree-paths",
+    "report-templates",
+    NULL
+};
+
+/**
+ * \returns The items joined into one string, so that two lists can be compared.
+ */
+static S9sString
+joinedItems(
+        const S9sVariantList &items)
+{
+    S9sString retval;
+
+    for (uint idx = 0u; idx < items.size(); ++idx)
+    {
+        retval += items[idx].toString();
+        retval += "\n";
+    }
+
+    return retval;
+}
+
+/**
+ * Collects the full path of every entry in the sub-tree.
+ */
+static void
+collectPaths(
+        const S9sTreeNode &node,
+        S9sVariantList    &paths)
+{
+    const S9sVector<S9sTreeNode> &children = node.childNodes();
+
+    for (uint idx = 0u; idx < children.size(); ++idx)
+    {
+        if (children[idx].name() == "..")
+            continue;
+
+        paths << children[idx].fullPath();
+        collectPaths(children[idx], paths);
+    }
+}
+
+/**
+ * \param context The context of the completion, what kind of items the bash
+ *   completion needs.
+ * \returns The exit code of the program.
+ *
+ * The hidden "s9s __complete CONTEXT" entry point: prints the cached items one
+ * per line. When there are no items for the context yet they are fetched from
+ * the controller now, when the items are old they are printed and refreshed in
+ * the background for the next TAB.
+ */
+int
+S9sCompletionCache::complete(
+        const S9sString &context)
+{
+    S9sVariantMap  cache;
+    S9sVariantMap  entries;
+    S9sVariantMap  entry;
+    S9sString      key = cacheKey();
+
+    if (!isValidContext(context))
+        return S9sOptions::BadOptions;
+
+    load(cache);
+    entries = cache[key].toVariantMap();
+
+    if (!entries.contains(context))
+    {
+        if (!refresh(context))
+            return S9sOptions::Failed;
+
+        load(cache);
+        entries = cache[key].toVariantMap();
+    } else {
+        entry = entries[context].toVariantMap();
+        if (time(NULL) - entry["updated"].toULongLong() > COMPLETION_CACHE_TTL)
+            refreshInBackground(context);
+    }
+
+    entry = entries[context].toVariantMap();
+    S9sOutput::write(joinedItems(entry["items"].toVariantList()));
+
+    return S9sOptions::ExitOk;
+}
+
+/**
+ * \param reply The reply of the getAllClusterInfo request.
+ *
+ * Updates the cluster IDs and names in the cache. The reply for one cluster
+ * (getClusterInfo) is not used, it is not the full list.
+ */
+void
+S9sCompletionCache::clustersReceived(
+        S9sRpcReply &reply)
+{
+    S9sVariantList clusters;
+    S9sVariantList ids, names;
+    S9sVariantMap  contexts;
+
+    if (!S9sFile::fileExists(fileName()) || !reply.isOk() ||
+            !reply.contains("clusters"))
+    {
+        return;
+    }
+
+    clusters = reply["clusters"].toVariantList();
+    for (uint idx = 0u; idx < clusters.size(); ++idx)
+    {
+        S9sVariantMap cluster = clusters[idx].toVariantMap();
+
+        ids   << cluster["cluster_id"].toString();
+        names << cluster["cluster_name"].toString();
+    }
+
+    contexts["cluster-ids"]   = ids;
+    contexts["cluster-names"] = names;
+    store(contexts);
+}
+
+/**
+ * \param reply The reply of the getUsers request.
+ */
+void
+S9sCompletionCache::usersReceived(
+        S9sRpcReply &reply)
+{
+    S9sVariantList users;
+    S9sVariantList names;
+    S9sVariantMap  contexts;
+
+    if (!S9sFile::fileExists(fileName()) || !reply.isOk() ||
+            !reply.contains("users"))
+    {
+        return;
+    }
+
+    users = reply["users"].toVariantList();
+    for (uint idx = 0u; idx < users.size(); ++idx)
+    {
+        S9sUser user(users[idx].toVariantMap());
+
+        names << user.userName();
+    }
+
+    contexts["users"] = names;
+    store(contexts);
+}
+
+/**
+ * \param reply The reply of the getTree request for the whole tree (without a
+ *   path), the caller checks this.
+ */
+void
+S9sCompletionCache::treeReceived(
+        S9sRpcReply &reply)
+{
+    S9sTreeNode    root;
+    S9sVariantList names, paths;
+    S9sVariantMap  contexts;
+
+    if (!S9sFile::fileExists(fileName()) || !reply.isOk() ||
+            !reply.contains("cdt"))
+    {
+        return;
+    }
+
+    root = reply.tree();
+    for (uint idx = 0u; idx < root.childNodes().size(); ++idx)
+    {
+        const S9sTreeNode &child = root.childNodes()[idx];
+
+        if (child.name() != "..")
+            names << child.name();
+    }
+
+    collectPaths(root, paths);
+
+    contexts["tree"]       = names;
+    contexts["tree-paths"] = paths;
+    store(contexts);
+}
+
+/**
+ * \param reply The reply of the getReportTemplates request sent without a
+ *   cluster, the caller checks this.
+ */
+void
+S9sCompletionCache::reportTemplatesReceived(
+        S9sRpcReply &reply)
+{
+    S9sVariantList reports;
+    S9sVariantList types;
+    S9sVariantMap  contexts;
+
+    if (!S9sFile::fileExists(fileName()) || !reply.isOk() ||
+            !reply.contains("reports"))
+    {
+        return;
+    }
+
+    reports = reply["reports"].toVariantList();
+    for (uint idx = 0u; idx < reports.size(); ++idx)
+    {
+        S9sVariantMap report = reports[idx].toVariantMap();
+
+        types << report["report_type"].toString();
+    }
+
+    contexts["report-templates"] = types;
+    store(contexts);
+}
+
+/**
+ * \returns True if the context is one of the supported completion contexts.
+ */
+bool
+S9sCompletionCache::isValidContext(
+        const S9sString &context)
+{
+    for (int idx = 0; completionContexts[idx] != NULL; ++idx)
+    {
+        if (context == completionContexts[idx])
+            return true;
+    }
+
+    return false;
+}
+
+S9sString
+S9sCompletionCache::fileName()
+{
+    return S9sFile("~/.s9s/completion.cache").path();
+}
+
+/**
+ * \returns The key under which the items of the current controller and user
+ *   are stored, the different controllers have different clusters and the
+ *   different users see different objects.
+ */
+S9sString
+S9sCompletionCache::cacheKey()
+{
+    S9sOptions *options = S9sOptions::instance();
+    S9sString   retval;
+
+    retval.sprintf("%s@%s:%d%s",
+            STR(options->userName()), 
+            STR(options->controllerHostName()), 
+            options->controllerPort(),
+            STR(options->controllerPath()));
+
+    return retval;
+}
+
+bool
+S9sCompletionCache::load(
+        S9sVariantMap &cache)
+{
+    S9sFile   file(fileName());
+    S9sString content;
+
+    cache.clear();
+    if (!file.exists() || !file.readTxtFile(content))
+        return false;
+
+    if (!cache.parse(STR(content)))
+    {
+        cache.clear();
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Writes the cache atomically, the other s9s processes never read a half
+ * written cache.
+ */
+bool
+S9sCompletionCache::save(
+        const S9sVariantMap &cache)
+{
+    S9sString errorString;
+
+    if (!S9sString::writeFileAtomic(fileName(), cache.toString(), errorString))
+    {
+        S9S_WARNING("%s", STR(errorString));
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * \param contexts The new items for some contexts.
+ *
+ * Stores the items of the current controller/user, the file is written only
+ * if the items changed or they became old.
+ */
+void
+S9sCompletionCache::store(
+        const S9sVariantMap &contexts)
+{
+    S9sVariantMap         cache;
+    S9sString             key     = cacheKey();
+    S9sVariantMap         entries;
+    S9sVector<S9sString>  names   = contexts.keys();
+    ulonglong             now     = time(NULL);
+    bool                  changed = false;
+
+    load(cache);
+    entries = cache[key].toVariantMap();
+
+    for (uint idx = 0u; idx < names.size(); ++idx)
+    {
+        S9sVariantMap  entry = entries[names[idx]].toVariantMap();
+        S9sVariantList items = contexts.at(names[idx]).toVariantList();
+
+        if (joinedItems(entry["items"].toVariantList()) == joinedItems(items) &&
+                now - entry["updated"].toULongLong() < COMPLETION_CACHE_TTL / 2)
+        {
+            continue;
+        }
+
+        entry["items"]   = items;
+        entry["updated"] = now;
+        entries[names[idx]] = entry;
+        changed = true;
+    }
+
+    if (changed)
+    {
+        cache[key] = entries;
+        save(cache);
+    }
+}
+
+/**
+ * \returns True if the items were fetched and stored.
+ *
+ * Fetches the objects for the given context from the controller now, the
+ * received reply then goes into the cache just like when the user lists
+ * these objects.
+ */
+bool
+S9sCompletionCache::refresh(
+        const S9sString &context)
+{
+    S9sOptions    *options = S9sOptions::instance();
+    S9sRpcClient   client(
+            options->controllerHostName(), options->controllerPort(),
+            options->controllerPath(), options->useTls());
+    S9sRpcReply    reply;
+    S9sVariantMap  cache;
+
+    // The hooks only update an existing cache.
+    if (!S9sFile::fileExists(fileName()))
+        save(cache);
+
+    if (!client.maybeAuthenticate())
+        return false;
+
+    if (context.startsWith("cluster-"))
+    {
+        if (!client.getClusters(false, false))
+            return false;
+
+        reply = client.reply();
+        clustersReceived(reply);
+    } else if (context == "users")
+    {
+        if (!client.getUsers())
+            return false;
+
+        reply = client.reply();
+        usersReceived(reply);
+    } else if (context.startsWith("tree"))
+    {
+        if (!client.getTree("", false))
+            return false;
+
+        reply = client.reply();
+        treeReceived(reply);
+    } else if (context == "report-templates")
+    {
+        if (!client.getReportTemplates())
+            return false;
+
+        reply = client.reply();
+        reportTemplatesReceived(reply);
+    }
+
+    return reply.isOk();
+}
+
+/**
+ * Refreshes the items in a child process, so the TAB that found them old does
+ * not have to wait for the controller. The child closes the standard output
+ * first, the bash is waiting for that, and it only runs if no other refresh is
+ * running at the moment.
+ */
+void
+S9sCompletionCache::refreshInBackground(
+        const S9sString &context)
+{
+    S9sString lockName;
+    pid_t     pid;
+    int       nullFd, lockFd;
+
+    S9sOutput::flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    pid = fork();
+    if (pid != 0)
+        return;
+
+    // The child process.
+    setsid();
+    nullFd = open("/dev/null", O_RDWR);
+    if (nullFd >= 0)
+    {
+        dup2(nullFd, STDIN_FILENO);
+        dup2(nullFd, STDOUT_FILENO);
+        dup2(nullFd, STDERR_FILENO);
+        close(nullFd);
+    }
+
+    lockName = fileName() + ".lock";
+    lockFd   = open(STR(lockName), O_RDWR | O_CREAT, 0600);
+    if (lockFd >= 0 && flock(lockFd, LOCK_EX | LOCK_NB) == 0)
+        refresh(context);
+
+    _exit(0);
+}
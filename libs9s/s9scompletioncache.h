@@ -0,0 +1,60 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVariantMap"
+
+class S9sRpcReply;
+
+/**
+ * The on-disk cache the bash completion (doc/s9s_completion) uses through the
+ * hidden "s9s __complete CONTEXT" command instead of listing the objects from
+ * the controller on every TAB. The cache is stored in ~/.s9s/completion.cache,
+ * separately for every controller and user, and it holds the items for these
+ * contexts: cluster-ids, cluster-names, users, tree (the top level of the
+ * Cmon Directory Tree), tree-paths and report-templates.
+ *
+ * The stale items are printed anyway and refreshed in the background. The
+ * cache is also updated every time the program lists these objects for the
+ * user (e.g. "s9s cluster --list"), but only if the cache file already exists,
+ * so nothing is written for the users who do not use the completion.
+ */
+class S9sCompletionCache
+{
+    public:
+        static int complete(const S9sString &context);
+
+        static void clustersReceived(S9sRpcReply &reply);
+        static void usersReceived(S9sRpcReply &reply);
+        static void treeReceived(S9sRpcReply &reply);
+        static void reportTemplatesReceived(S9sRpcReply &reply);
+
+        static bool isValidContext(const S9sString &context);
+
+    private:
+        static S9sString fileName();
+        static S9sString cacheKey();
+        static bool load(S9sVariantMap &cache);
+        static bool save(const S9sVariantMap &cache);
+        static void store(const S9sVariantMap &contexts);
+        static bool refresh(const S9sString &context);
+        static void refreshInBackground(const S9sString &context);
+};
@@ -18,6 +18,7 @@
  * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sconfigfile.h"
+#include "S9sOutput"
 #include "s9sconfigfile_p.h"
 
 #include <cstring>
@@ -443,23 +444,23 @@ S9sConfigAstNode::printDebug(
 
     if (recursionLevel == 0)
     {
-        printf("%04d:%03d %-14s ", 
+        S9sOutput::printf("%04d:%03d %-14s ", 
                 m_lineNumber, 
                 indent(),
                 nodeTypeToString(m_nodeType));
     } else {
-        printf("%04d:%03d ", 
+        S9sOutput::printf("%04d:%03d ", 
                 m_lineNumber,
                 indent());
 
         for (int n = 0; n < recursionLevel; ++n)
-            printf("     ");
+            S9sOutput::printf("     ");
 
-        printf("%-14s ", nodeTypeToString(m_nodeType));
+        S9sOutput::printf("%-14s ", nodeTypeToString(m_nodeType));
     }
 
-    printf("'%s'", STR(codePiece));
-    printf("\n");
+    S9sOutput::printf("'%s'", STR(codePiece));
+    S9sOutput::printf("\n");
 
     if (m_child1)
         m_child1->printDebug(recursionLevel + 1);
@@ -563,6 +564,7 @@ S9sClusterConfigParseContext::reset()
         delete m_ast[idx];
 
     m_ast.clear();
+    rebuildIndex();
 }
 
 /**
@@ -636,25 +638,40 @@ S9sClusterConfigParseContext::collectVariables(
     S9sVariantList retval;
     S9sString      sectionName;
     
-    for (uint idx = 0; idx < m_ast.size(); ++idx)
+    if (!variableName.empty())
     {
-        bool       isEqual;
-        S9sString  thisName;
+        const S9sVector<IndexEntry> *entries = indexEntries(variableName);
+
+        for (uint idx = 0u; entries != NULL && idx < entries->size(); ++idx)
+        {
+            const IndexEntry &entry = entries->at(idx);
+
+            if (!entry.node->isAssignment())
+                continue;
+
+            S9sVariantMap theMap;
+            theMap["variablename"] = variableName;
+            theMap["linenumber"]   = entry.node->lineNumber();
+            theMap["value"]        = entry.node->rightValue();
+            theMap["filepath"]     = filePath;
+            theMap["section"]      = entry.section;
+
+            retval << S9sVariant(theMap);
+        }
+
+        return retval;
+    }
 
+    for (uint idx = 0; idx < m_ast.size(); ++idx)
+    {
         if (m_ast[idx]->isSection())
             sectionName = m_ast[idx]->sectionName();
 
         if (!m_ast[idx]->isAssignment())
             continue;
 
-        thisName = m_ast[idx]->leftValue();
-        isEqual  = nameEqual(m_ast[idx]->leftValue(), variableName);
-
-        if (!variableName.empty() && !isEqual)
-            continue;
-
         S9sVariantMap theMap;
-        theMap["variablename"] = thisName;
+        theMap["variablename"] = m_ast[idx]->leftValue();
         theMap["linenumber"]   = m_ast[idx]->lineNumber();
         theMap["value"]        = m_ast[idx]->rightValue();
         theMap["filepath"]     = filePath;
@@ -666,6 +683,105 @@ S9sClusterConfigParseContext::collectVariables(
     return retval;
 }
 
+/**
+ * \returns The first assignment of the variable regardless of the section it
+ *   is in or NULL if the variable is not set.
+ */
+const S9sConfigAstNode *
+S9sClusterConfigParseContext::findAssignment(
+        const S9sString &variableName) const
+{
+    const S9sVector<IndexEntry> *entries = indexEntries(variableName);
+
+    for (uint idx = 0u; entries != NULL && idx < entries->size(); ++idx)
+    {
+        if (entries->at(idx).node->isAssignment())
+            return entries->at(idx).node;
+    }
+
+    return NULL;
+}
+
+/**
+ * \returns The first assignment of the variable in the given section or NULL
+ *   if the variable is not set there.
+ */
+const S9sConfigAstNode *
+S9sClusterConfigParseContext::findAssignment(
+        const S9sString &sectionName,
+        const S9sString &variableName) const
+{
+    const S9sVector<IndexEntry> *entries = indexEntries(variableName);
+
+    for (uint idx = 0u; entries != NULL && idx < entries->size(); ++idx)
+    {
+        const IndexEntry &entry = entries->at(idx);
+
+        if (entry.node->isAssignment() && 
+                sectionEqual(entry.section, sectionName))
+        {
+            return entry.node;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * \returns The assignments and commented-out assignments of the given variable
+ *   in the order they are in the file, NULL if there is none.
+ *
+ * The index is kept up to date by the functions that change the AST, so the
+ * lookups do not modify the context and they can be called from more than
+ * one thread at the same time.
+ */
+const S9sVector<S9sClusterConfigParseContext::IndexEntry> *
+S9sClusterConfigParseContext::indexEntries(
+        const S9sString &variableName) const
+{
+    S9sMap<S9sString, S9sVector<IndexEntry> >::const_iterator it;
+
+    it = m_index.find(variableName);
+    if (it == m_index.end())
+        return NULL;
+
+    return &it->second;
+}
+
+/**
+ * Adds one node to the end of the index, called while the AST is built by
+ * the parser.
+ */
+void
+S9sClusterConfigParseContext::indexNode(
+        S9sConfigAstNode *node)
+{
+    if (node->isSection())
+        m_indexSection = node->sectionName();
+
+    if (!node->isAssignment() && !node->isCommented())
+        return;
+
+    IndexEntry entry;
+    entry.section = m_indexSection;
+    entry.node    = node;
+
+    m_index[node->leftValue()].push_back(entry);
+}
+
+/**
+ * Needs to be called when nodes are inserted into or removed from the AST.
+ */
+void
+S9sClusterConfigParseContext::rebuildIndex()
+{
+    m_index.clear();
+    m_indexSection.clear();
+
+    for (uint idx = 0u; idx < m_ast.size(); ++idx)
+        indexNode(m_ast[idx]);
+}
+
 /**
  * \param sectionName the name of the section where we change the value or an
  *   empty string to change the value only in the global section
@@ -841,6 +957,7 @@ S9sClusterConfigParseContext::removeVariable(
     {
         delete m_ast[index];
         m_ast.erase (m_ast.begin() + index);
+        rebuildIndex();
     }
 
     return true;
@@ -887,6 +1004,7 @@ S9sClusterConfigParseContext::removeSection(
 
         m_ast.erase (m_ast.begin() + startFrom,
                 m_ast.begin() + (startFrom + deleteCnt));
+        rebuildIndex();
     }
 
     return true;
@@ -967,6 +1085,7 @@ S9sClusterConfigParseContext::addVariable(
                 S9sConfigAstNode::newLine());
     }
 
+    rebuildIndex();
     return true;
 }
 
@@ -984,72 +1103,22 @@ S9sClusterConfigParseContext::hasVariable(
         const S9sString &variableName,
         bool              includingDisabled)
 {
-    S9sMap<int, S9sVariantList> pathToIndent;
-    S9sVariantList  path;
-    int            currentIndent = 0;
-    S9sString      currentSection;
-    bool           retval = false;
+    const S9sVector<IndexEntry> *entries = indexEntries(variableName);
 
-    for (uint idx = 0; idx < m_ast.size(); ++idx)
+    for (uint idx = 0u; entries != NULL && idx < entries->size(); ++idx)
     {
-        S9sConfigAstNode *node = m_ast[idx];
-        bool isEqual;
+        const IndexEntry &entry = entries->at(idx);
 
-        if (node->isNewLine())
-        {
+        if (!sectionEqual(entry.section, sectionName))
             continue;
-        } if (node->isSection())
-        {
-            currentSection = node->sectionName();
-
-            if (path.empty() || node->indent() > currentIndent)
-            {
-                currentIndent = node->indent();
-                pathToIndent[currentIndent] = path;
-                path << currentSection;
-            } else if (node->indent() < currentIndent)
-            {
-                path = pathToIndent[node->indent()];
-                currentIndent = node->indent();
-            }
-        
-            S9S_DEBUG("-----------");
-            S9S_DEBUG("SECTION");
-            S9S_DEBUG("  node     : '%s'", STR(node->origString()));
-            S9S_DEBUG("  indent   : %d", node->indent());
-            S9S_DEBUG("  path     : '%s'", STR(path.toString('.')));
-        } else if (node->isAssignment()) 
-        {
-            S9sVariantList fullPath = path;
 
-            fullPath << node->leftValue();
-
-            S9S_DEBUG("-----------");
-            S9S_DEBUG("ASSIGNMENT");
-            S9S_DEBUG("  name     : '%s'", STR(node->leftValue()));
-            S9S_DEBUG("  fullPath : %s", STR(fullPath.toString('.')));
-            S9S_DEBUG("  indent   : %d", node->indent());
-            S9S_DEBUG("  path     : '%s'", STR(path.toString('.')));
-        }
-        
-
-        if (!sectionEqual(currentSection, sectionName))
-            continue;
-
-        isEqual = nameEqual(node->leftValue(), variableName);
-        if (node->isAssignment() && isEqual)
-        {
-            retval = true;
-            break;
-        } else if (includingDisabled &&
-                node->isCommented() && isEqual)
-        {
-            retval = true;
-            break;
-        }
+        if (entry.node->isAssignment())
+            return true;
+        else if (includingDisabled && entry.node->isCommented())
+            return true;
     }
 
-    return retval;
+    return false;
 }
 
 /**
@@ -1090,6 +1159,7 @@ S9sClusterConfigParseContext::append(
         incrementLineNumber();
 
     m_ast << node;
+    indexNode(node);
 }
 
 /**
@@ -1407,36 +1477,26 @@ S9sString
 S9sConfigFile::variableValue(
         const S9sString &variableName) const
 {
-    S9sVariantList variables;
-    S9sString      retval;
+    const S9sClusterConfigParseContext *context = m_priv->m_parseContext;
+    const S9sConfigAstNode             *node;
+    S9sString                           retval;
+
+    if (context == NULL)
+        return retval;
 
-    variables = collectVariables(variableName);
     if (m_priv->m_searchGroups.empty())
     {
-        for (uint idx = 0; idx < variables.size(); ++idx)
-        {
-            S9sString group = variables[idx]["section"].toString();
-    
-            //if (!hasSearchGroup(group))
-            //    continue;
-
-            retval = variables[idx]["value"].toString();
-            break;
-        }
+        node = context->findAssignment(variableName);
+        if (node != NULL)
+            retval = node->rightValue();
     } else {
         for (uint idx = 0u; idx < m_priv->m_searchGroups.size(); ++idx)
         {
             S9sString searchGroup = m_priv->m_searchGroups[idx].toString();
 
-            for (uint idx = 0; idx < variables.size(); ++idx)
-            {
-                S9sString group = variables[idx]["section"].toString();
-    
-                if (searchGroup != group)
-                    continue;
-
-                return variables[idx]["value"].toString();
-            }
+            node = context->findAssignment(searchGroup, variableName);
+            if (node != NULL)
+                return node->rightValue();
         }
     }
 
@@ -1455,22 +1515,15 @@ S9sConfigFile::variableValue(
         const S9sString &sectionName,
         const S9sString &variableName) const
 {
-    S9sVariantList variables;
-    S9sString      retval;
+    const S9sConfigAstNode *node = NULL;
 
-    variables = collectVariables(variableName);
-    for (uint idx = 0; idx < variables.size(); ++idx)
+    if (m_priv->m_parseContext != NULL)
     {
-        S9sString group = variables[idx]["section"].toString();
-
-        if (group != sectionName)
-            continue;
-
-        retval = variables[idx]["value"].toString();
-        break;
+        node = m_priv->m_parseContext->findAssignment(
+                sectionName, variableName);
     }
 
-    return retval;
+    return node != NULL ? node->rightValue() : S9sString();
 }
 
 /**
@@ -1932,11 +1985,11 @@ S9sConfigFile::build(
 void
 S9sConfigFile::printDebug() const
 {
-    printf("\n");
-    printf("--- S9sConfigFile ------\n");
+    S9sOutput::printf("\n");
+    S9sOutput::printf("--- S9sConfigFile ------\n");
     if (m_priv->m_parseContext)
         m_priv->m_parseContext->printDebug();
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
 /******************************************************************************
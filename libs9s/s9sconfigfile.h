@@ -146,6 +146,13 @@ class S9sClusterConfigParseContext : public S9sParseContext
                 const S9sString &variableName,
                 const S9sString &filePath) const;
         
+        const S9sConfigAstNode *findAssignment(
+                const S9sString &variableName) const;
+
+        const S9sConfigAstNode *findAssignment(
+                const S9sString &sectionName,
+                const S9sString &variableName) const;
+
         bool changeVariable(
                 const S9sString &sectionName,
                 const S9sString &variableName,
@@ -192,9 +199,32 @@ class S9sClusterConfigParseContext : public S9sParseContext
                 const S9sString &str1,
                 const S9sString &str2) const;
 
+    private:
+        /**
+         * One assignment (or commented-out assignment) in the index with the
+         * name of the section it is in.
+         */
+        class IndexEntry
+        {
+            public:
+                S9sString          section;
+                S9sConfigAstNode  *node;
+        };
+
+        const S9sVector<IndexEntry> *indexEntries(
+                const S9sString &variableName) const;
+
+        void indexNode(S9sConfigAstNode *node);
+        void rebuildIndex();
+
     private:
         S9s::Syntax                    m_syntax;
         S9sVector<S9sConfigAstNode *>  m_ast;
+        
+        /** Variable name -> assignments in the order they are in the file. */
+        S9sMap<S9sString, S9sVector<IndexEntry> >  m_index;
+        /** The section of the last node added to the index. */
+        S9sString                      m_indexSection;
 };
         
 inline bool 
@@ -0,0 +1,350 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sconfigpuller.h"
+
+#include "S9sOptions"
+#include "S9sRpcReply"
+#include "S9sFormat"
+#include "S9sOutput"
+#include "S9sDir"
+#include "S9sFile"
+#include "S9sMutexLocker"
+#include "S9sThreadPool"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The number of hosts handled in parallel when the --parallellism command line
+ * option is not provided.
+ */
+#define DEFAULT_PULL_PARALLELISM 8
+
+/**
+ * The task of the S9sConfigPuller executed by the thread pool, pulls the
+ * configuration of one host through its own copy of the session.
+ */
+class S9sConfigPullerTask : public S9sRunnable
+{
+    public:
+        S9sConfigPullerTask(
+                S9sConfigPuller    *puller,
+                const S9sRpcClient &client,
+                uint                index) :
+            S9sRunnable(),
+            m_puller(puller),
+            m_client(client.sessionCopy()),
+            m_index(index)
+        {
+        }
+
+        virtual void
+        run()
+        {
+            m_puller->pullHost(m_client, m_index);
+        }
+
+    private:
+        S9sConfigPuller *m_puller;
+        S9sRpcClient     m_client;
+        uint             m_index;
+};
+
+/**
+ * \param client The client that is already connected and authenticated. The
+ *   worker threads will use copies of the session this client has.
+ * \param outputDir The directory where the files are saved. When more than one
+ *   hosts are pulled the files of every host go into a subdirectory named
+ *   after the host.
+ */
+S9sConfigPuller::S9sConfigPuller(
+        const S9sRpcClient &client,
+        const S9sString    &outputDir) :
+    m_client(client),
+    m_outputDir(outputDir),
+    m_parallelism(DEFAULT_PULL_PARALLELISM)
+{
+}
+
+void
+S9sConfigPuller::setParallelism(
+        int parallelism)
+{
+    m_parallelism = parallelism > 0 ? parallelism : 1;
+}
+
+int
+S9sConfigPuller::parallelism() const
+{
+    return m_parallelism;
+}
+
+/**
+ * \param hosts The list of the hosts (S9sNode objects) to pull.
+ * \returns True if the configuration of all the hosts was saved.
+ *
+ * Pulls the configuration files of all the hosts, returns when all of them are
+ * done.
+ */
+bool
+S9sConfigPuller::pull(
+        const S9sVariantList &hosts)
+{
+    int  nThreads;
+    bool retval = true;
+
+    m_hosts = hosts;
+    m_results.clear();
+
+    for (uint idx = 0u; idx < m_hosts.size(); ++idx)
+    {
+        S9sVariantMap result;
+
+        result["hostname"] = m_hosts[idx].toNode().hostName();
+        result["success"]  = false;
+        m_results << result;
+    }
+
+    /*
+     * The options are resolved on the first use, we do it here so the threads
+     * only read them.
+     */
+    S9sOptions::instance()->isBatchRequested();
+
+    nThreads = m_parallelism;
+    if (nThreads > (int) m_hosts.size())
+        nThreads = m_hosts.size();
+
+    if (nThreads <= 1)
+    {
+        for (uint idx = 0u; idx < m_hosts.size(); ++idx)
+            pullHost(m_client, idx);
+    } else {
+        S9sThreadPool pool(nThreads);
+
+        // If the pool has no threads we do the job ourselves.
+        for (uint idx = 0u; idx < m_hosts.size(); ++idx)
+        {
+            if (!pool.submit(new S9sConfigPullerTask(this, m_client, idx)))
+                pullHost(m_client, idx);
+        }
+
+        pool.waitForDone();
+    }
+
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+    {
+        if (!m_results[idx]["success"].toBoolean())
+            retval = false;
+    }
+
+    return retval;
+}
+
+/**
+ * \returns The per host results of the last pull() call, one map for every
+ *   host with the "hostname", "success", "n_files", "n_written",
+ *   "n_unchanged" and "error_string" keys. When the controller replied with
+ *   an error the "reply" key holds the reply.
+ */
+S9sVariantList
+S9sConfigPuller::results() const
+{
+    S9sVariantList retval;
+
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+        retval << m_results[idx];
+
+    return retval;
+}
+
+/**
+ * Prints one line for every host showing how many files were written and how
+ * many were found unchanged on the disk.
+ */
+void
+S9sConfigPuller::printSummary() const
+{
+    S9sOptions *options = S9sOptions::instance();
+    bool        syntaxHighlight = options->useSyntaxHighlight();
+    S9sFormat   hostFormat;
+    S9sFormat   statusFormat;
+    S9sFormat   filesFormat;
+    S9sFormat   writtenFormat;
+    S9sFormat   unchangedFormat;
+    int         nFailed = 0;
+
+    filesFormat.setRightJustify();
+    writtenFormat.setRightJustify();
+    unchangedFormat.setRightJustify();
+
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+    {
+        const S9sVariantMap &result = m_results[idx];
+
+        hostFormat.widen(result.value("hostname").toString());
+        statusFormat.widen(
+                result.value("success").toBoolean() ? "OK" : "FAILED");
+        filesFormat.widen(result.value("n_files").toInt());
+        writtenFormat.widen(result.value("n_written").toInt());
+        unchangedFormat.widen(result.value("n_unchanged").toInt());
+    }
+
+    if (!options->isNoHeaderRequested())
+    {
+        S9sOutput::printf("%s", syntaxHighlight ? TERM_BOLD : "");
+        hostFormat.printHeader("HOST");
+        statusFormat.printHeader("STATUS");
+        filesFormat.printHeader("FILES");
+        writtenFormat.printHeader("WRITTEN");
+        unchangedFormat.printHeader("UNCHANGED");
+        S9sOutput::printf("MESSAGE");
+        S9sOutput::printf("%s\n", syntaxHighlight ? TERM_NORMAL : "");
+    }
+
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+    {
+        const S9sVariantMap &result = m_results[idx];
+        bool                 success = result.value("success").toBoolean();
+
+        if (!success)
+            ++nFailed;
+
+        hostFormat.printf(result.value("hostname").toString());
+
+        if (syntaxHighlight)
+        {
+            S9sOutput::printf("%s", 
+                    success ? XTERM_COLOR_GREEN : XTERM_COLOR_RED);
+        }
+
+        statusFormat.printf(success ? "OK" : "FAILED");
+        
+        if (syntaxHighlight)
+            S9sOutput::printf("%s", TERM_NORMAL);
+
+        filesFormat.printf(result.value("n_files").toInt());
+        writtenFormat.printf(result.value("n_written").toInt());
+        unchangedFormat.printf(result.value("n_unchanged").toInt());
+        S9sOutput::printf("%s\n", 
+                STR(result.value("error_string").toString()));
+    }
+
+    if (!options->isBatchRequested())
+    {
+        S9sOutput::printf("Total: %u hosts, %d failed.\n", 
+                (uint) m_results.size(), nFailed);
+    }
+}
+
+/**
+ * \param client The client to use, every task has its own.
+ * \param index The index of the host in the list.
+ *
+ * Pulls the configuration of one host and saves the files. Called from the
+ * tasks of the thread pool, so it does not print anything, the result is
+ * stored and printed in the summary.
+ */
+void
+S9sConfigPuller::pullHost(
+        S9sRpcClient &client,
+        uint          index)
+{
+    S9sNode        node = m_hosts[index].toNode();
+    S9sString      outputDir = hostOutputDir(node);
+    S9sVariantList oneHost;
+    S9sRpcReply    reply;
+    S9sVariantMap  failedReply;
+    S9sString      errorString;
+    int            nFiles     = 0;
+    int            nWritten   = 0;
+    int            nUnchanged = 0;
+    bool           success;
+
+    oneHost << m_hosts[index];
+
+    success = client.getConfig(oneHost);
+    if (!success)
+    {
+        errorString = client.errorString();
+    } else {
+        reply   = client.reply();
+        success = reply.isOk();
+
+        if (!success)
+        {
+            errorString = reply.errorString();
+            failedReply = reply;
+        }
+    }
+
+    if (success && !S9sDir::exists(outputDir))
+    {
+        S9sDir dir(outputDir);
+
+        success = dir.mkdir();
+        if (!success)
+            errorString = dir.errorString();
+    }
+
+    if (success)
+    {
+        nFiles  = reply["files"].toVariantList().size();
+        success = reply.saveConfig(
+                outputDir, nWritten, nUnchanged, errorString);
+    }
+
+    S9sMutexLocker locker(m_mutex);
+    S9sVariantMap &result = m_results[index];
+
+    result["success"]      = success;
+    result["n_files"]      = nFiles;
+    result["n_written"]    = nWritten;
+    result["n_unchanged"]  = nUnchanged;
+    result["error_string"] = errorString;
+
+    if (!failedReply.empty())
+        result["reply"] = failedReply;
+}
+
+/**
+ * \returns The directory where the files of the given host are saved.
+ */
+S9sString
+S9sConfigPuller::hostOutputDir(
+        const S9sNode &node) const
+{
+    S9sString subDir = node.hostName();
+
+    // A single host goes where the user said, just like before.
+    if (m_hosts.size() <= 1u)
+        return m_outputDir;
+
+    if (node.hasPort())
+    {
+        S9sString portString;
+
+        portString.sprintf("_%d", node.port());
+        subDir += portString;
+    }
+
+    return S9sFile::buildPath(m_outputDir, subDir);
+}
@@ -0,0 +1,70 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sNode"
+#include "S9sVector"
+#include "S9sMutex"
+#include "S9sRpcClient"
+
+class S9sConfigPullerTask;
+
+/**
+ * Pulls the configuration files of many nodes (the "node --pull-config"
+ * function) using a bounded number of parallel connections to the controller.
+ * Every host is handled by a task in an S9sThreadPool, the files that are
+ * already on the disk with the same content are not written again,
+ * the others are written atomically (temporary file and rename).
+ *
+ * The results are collected per host so that a summary can be printed when
+ * all the hosts are done.
+ */
+class S9sConfigPuller
+{
+    public:
+        S9sConfigPuller(
+                const S9sRpcClient &client,
+                const S9sString    &outputDir);
+
+        void setParallelism(int parallelism);
+        int parallelism() const;
+
+        bool pull(const S9sVariantList &hosts);
+
+        S9sVariantList results() const;
+        void printSummary() const;
+
+    private:
+        void pullHost(S9sRpcClient &client, uint index);
+        S9sString hostOutputDir(const S9sNode &node) const;
+
+    private:
+        S9sRpcClient              m_client;
+        S9sString                 m_outputDir;
+        int                       m_parallelism;
+        S9sVariantList            m_hosts;
+        S9sVector<S9sVariantMap>  m_results;
+        S9sMutex                  m_mutex;
+
+    friend class S9sConfigPullerTask;
+};
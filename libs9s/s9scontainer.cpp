@@ -23,6 +23,7 @@
 #include <S9sVariantMap>
 #include <S9sRpcReply>
 #include <S9sOptions>
+#include <S9sFormatTemplate>
 
 //#define DEBUG
 //#define WARNING
@@ -197,331 +198,268 @@ S9sString
 S9sContainer::toString(
         const bool       syntaxHighlight,
         const S9sString &formatString) const
+{
+    return toString(
+            syntaxHighlight, S9sFormatTemplate::compiled(formatString, "f"));
+}
+
+/**
+ * Converts the object to a string using a format template that is already
+ * compiled, see the other toString() for the format string itself.
+ */
+S9sString
+S9sContainer::toString(
+        const bool               syntaxHighlight,
+        const S9sFormatTemplate &format) const
 {
     S9sFormatter   formatter;    
     S9sString      retval;
     S9sString      tmp, value;
-    char           c;
     S9sString      partFormat;
-    bool           percent      = false;
-    bool           escaped      = false;
     S9sOptions    *options = S9sOptions::instance();
     //bool         modifierFree = false;
 
-    for (uint n = 0; n < formatString.size(); ++n)
+    for (uint idx = 0; idx < format.size(); ++idx)
     {
-        c = formatString[n];
-       
-        if (c == '%' && !percent)
-        {
-            percent    = true;
-            partFormat = "%";
-            continue;
-        } else if (percent && c == 'f')
-        {
-            //modifierFree = true;
-            continue;
-        } else if (c == '\\' && !escaped)
+        const S9sFormatTemplate::Part &part = format.part(idx);
+
+        if (part.isLiteral())
         {
-            escaped = true;
+            retval += part.literal;
             continue;
         }
 
-        if (escaped)
-        {
-            switch (c)
-            {
-                case '\"':
-                    retval += '\"';
-                    break;
-
-                case '\\':
-                    retval += '\\';
-                    break;
-       
-                case 'a':
-                    retval += '\a';
-                    break;
-
-                case 'b':
-                    retval += '\b';
-                    break;
-
-                case 'e':
-                    retval += '\027';
-                    break;
-
-                case 'n':
-                    retval += '\n';
-                    break;
-
-                case 'r':
-                    retval += '\r';
-                    break;
-
-                case 't':
-                    retval += '\t';
-                    break;
-            }
-        } else if (percent)
+        partFormat = part.prefix;
+
+        switch (part.directive)
         {
-            switch (c)
-            {
-                case 'A':
-                    // The ip address of the node.
-                    partFormat += 's';
-                    value = ipAddress(options->addressType(), "-");
-
-                    tmp.sprintf(STR(partFormat), STR(value));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::ipColorBegin(value);
-
-                    retval += tmp;
-                    
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::ipColorEnd();
-                    break;
+            case 'A':
+                // The ip address of the node.
+                partFormat += 's';
+                value = ipAddress(options->addressType(), "-");
+
+                tmp.sprintf(STR(partFormat), STR(value));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::ipColorBegin(value);
+
+                retval += tmp;
                 
-                case 'a':
-                    // The private ip address of the node.
-                    partFormat += 's';
-                    value = ipAddress(S9s::PrivateIpv4Address, "-");
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::ipColorEnd();
+                break;
+            
+            case 'a':
+                // The private ip address of the node.
+                partFormat += 's';
+                value = ipAddress(S9s::PrivateIpv4Address, "-");
 
-                    tmp.sprintf(STR(partFormat), STR(value));
+                tmp.sprintf(STR(partFormat), STR(value));
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::ipColorBegin(value);
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::ipColorBegin(value);
 
-                    retval += tmp;
-                    
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::ipColorEnd();
-                    break;
+                retval += tmp;
+                
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::ipColorEnd();
+                break;
 
-                case 'C':
-                    // The configuration file. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(configFile()));
+            case 'C':
+                // The configuration file. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(configFile()));
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(configFile());
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(configFile());
 
-                    retval += tmp;
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
 
-                    break;
-                
-                case 'c':
-                    // The cloud/provider.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(provider()));
-                    retval += tmp;
-                    break;
-
-                case 'F':
-                    // The first firewall.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(firewall()));
-                    retval += tmp;
-                    break;
-
-                case 'G':
-                    // The name of the group owner.
-                    partFormat += 's';
-                    tmp.sprintf(
-                            STR(partFormat),
-                            STR(groupOwnerName()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::groupColorBegin();
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::groupColorEnd();
-
-                    break;
-
-                case 'I':
-                    // The ID of the node.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(id("-")));
-                    retval += tmp;
-                    break;
-                
-                case 'i':
-                    // The Image.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(image("-")));
-                    retval += tmp;
-                    break;
-                
-                case 'l':
-                    // 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(aclShortString()));
-                    retval += tmp;
-                    break;
-
-                case 'N':
-                    // The name of the container.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(alias()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::containerColorBegin(
-                                stateAsChar());
-
-                    retval += tmp;
-                    
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::containerColorEnd();
-                    
-                    break;
-
-                case 'O':
-                    // The name of the owner.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(ownerName()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorBegin();
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorEnd();
-
-                    break;
-                
-                case 'P':
-                    // The name of the parent server.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(parentServerName()));
-                    retval += tmp;
-                    break;
+                break;
+            
+            case 'c':
+                // The cloud/provider.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(provider()));
+                retval += tmp;
+                break;
 
-                case 'p':
-                    // The CDT path 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(cdtPath()));
+            case 'F':
+                // The first firewall.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(firewall()));
+                retval += tmp;
+                break;
+
+            case 'G':
+                // The name of the group owner.
+                partFormat += 's';
+                tmp.sprintf(
+                        STR(partFormat),
+                        STR(groupOwnerName()));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::groupColorBegin();
+
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorBegin();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::groupColorEnd();
+
+                break;
+
+            case 'I':
+                // The ID of the node.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(id("-")));
+                retval += tmp;
+                break;
+            
+            case 'i':
+                // The Image.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(image("-")));
+                retval += tmp;
+                break;
+            
+            case 'l':
+                // 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(aclShortString()));
+                retval += tmp;
+                break;
 
-                    retval += tmp;
+            case 'N':
+                // The name of the container.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(alias()));
 
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorEnd();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::containerColorBegin(
+                            stateAsChar());
 
-                    break;
+                retval += tmp;
                 
-                case 'R':
-                    // Region.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(region("-")));
-                    retval += tmp;
-                    break;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::containerColorEnd();
                 
-                case 'r':
-                    // Subnet CIDR.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(subnetCidr("-")));
-                    retval += tmp;
-                    break;
-
-                case 'S':
-                    // The state of the container.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(state()));
-
-                    if (syntaxHighlight)
-                    {
-                        retval += 
-                            S9sRpcReply::clusterStateColorBegin(state());
-                    }
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::clusterStateColorEnd();
-
-                    break;
-                    
-                case 'T':
-                    // The type of the container.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(type()));
-                    retval += tmp;
-                    break;
+                break;
+
+            case 'O':
+                // The name of the owner.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(ownerName()));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorEnd();
+
+                break;
+            
+            case 'P':
+                // The name of the parent server.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(parentServerName()));
+                retval += tmp;
+                break;
+
+            case 'p':
+                // The CDT path 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(cdtPath()));
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorEnd();
+
+                break;
+            
+            case 'R':
+                // Region.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(region("-")));
+                retval += tmp;
+                break;
+            
+            case 'r':
+                // Subnet CIDR.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(subnetCidr("-")));
+                retval += tmp;
+                break;
+
+            case 'S':
+                // The state of the container.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(state()));
+
+                if (syntaxHighlight)
+                {
+                    retval += 
+                        S9sRpcReply::clusterStateColorBegin(state());
+                }
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::clusterStateColorEnd();
+
+                break;
                 
-                case 't':
-                    // Template.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(templateName("-")));
-                    retval += tmp;
-                    break;
+            case 'T':
+                // The type of the container.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(type()));
+                retval += tmp;
+                break;
+            
+            case 't':
+                // Template.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(templateName("-")));
+                retval += tmp;
+                break;
+            
+            case 'U':
+                // Subnet ID.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(subnetId()));
+                retval += tmp;
+                break;
+            
+            case 'V':
+                // The type of the container.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(subnetVpcId()));
+                retval += tmp;
+                break;
+
+            case 'z':
+                // The class name.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(className()));
                 
-                case 'U':
-                    // Subnet ID.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(subnetId()));
-                    retval += tmp;
-                    break;
+                if (syntaxHighlight)
+                    retval += XTERM_COLOR_GREEN;
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += TERM_NORMAL;
                 
-                case 'V':
-                    // The type of the container.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(subnetVpcId()));
-                    retval += tmp;
-                    break;
-
-                case 'z':
-                    // The class name.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(className()));
-                    
-                    if (syntaxHighlight)
-                        retval += XTERM_COLOR_GREEN;
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += TERM_NORMAL;
-                    
-                    break;
-
-                case '%':
-                    retval += '%';
-                    break;
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '-':
-                case '+':
-                case '.':
-                case '\'':
-                    partFormat += c;
-                    continue;
-            }
-        } else {
-            retval += c;
+                break;
         }
-
-        percent      = false;
-        escaped      = false;
-        //modifierFree = false;
     }
 
     return retval;
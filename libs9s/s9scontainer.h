@@ -24,6 +24,8 @@
 #include "S9sUrl"
 #include "S9sCluster"
 
+class S9sFormatTemplate;
+
 /**
  * A class that represents a node/host/server. 
  */
@@ -54,6 +56,11 @@ class S9sContainer : public S9sObject
                     const bool       syntaxHighlight,
                     const S9sString &formatString) const;
 
+        S9sString 
+            toString(
+                    const bool               syntaxHighlight,
+                    const S9sFormatTemplate &format) const;
+
         S9sString hostname() const;
 
         S9sString ipAddress(
@@ -21,6 +21,8 @@
 #include "S9sVariant"
 
 #include <stdio.h>
+#include <string.h>
+#include <ctype.h>
 
 //#define DEBUG
 //#define WARNING
@@ -36,6 +38,209 @@ static const char *shortMonthNames[] =
     "Oct", "Nov", "Dec", NULL
 };
 
+/*
+ * How long the cached current year is used by parseLogFileFormat().
+ */
+#define CURRENT_YEAR_CACHE_SECONDS 60
+
+#define IS_DIGIT(_c) ((_c) >= '0' && (_c) <= '9')
+#define DIGIT(_c) ((_c) - '0')
+#define TWO_DIGITS(_s) (10 * DIGIT((_s)[0]) + DIGIT((_s)[1]))
+
+/**
+ * \returns The number of days between 1970-01-01 and the given date of the
+ *   proleptic Gregorian calendar, so UTC times can be computed without calling
+ *   mktime() and modifying the time zone. Months out of the 1-12 range are
+ *   normalized the way mktime() does.
+ */
+static longlong
+daysFromCivil(
+        longlong year,
+        int      month,
+        int      day)
+{
+    longlong era;
+    longlong yearOfEra, dayOfYear, dayOfEra;
+
+    year  += (month - 1) >= 0 ? (month - 1) / 12 : (month - 12) / 12;
+    month  = ((month - 1) % 12 + 12) % 12 + 1;
+
+    year  -= month <= 2;
+    era    = (year >= 0 ? year : year - 399) / 400;
+
+    yearOfEra = year - era * 400;
+    dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    dayOfEra  = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**
+ * \returns The time_t of the given local date and time or -1 if it is not
+ *   valid.
+ *
+ * The local time is converted by mktime() only once for every hour of local
+ * time, the result is cached (per thread) and the minutes and seconds are
+ * simply added. The parsers receive thousands of timestamps from the same few
+ * hours, so this saves almost all the mktime() calls that are expensive because
+ * they check the time zone every time. The hours in which the offset from UTC
+ * changes (daylight saving time changes by half an hour in some zones) are not
+ * cached.
+ */
+static time_t
+localTimeT(
+        int year,
+        int month,
+        int monthDay,
+        int hour,
+        int minute,
+        int second)
+{
+    static __thread longlong cachedHour = -1ll;
+    static __thread time_t   cachedHourStart;
+    longlong                 theHour;
+
+    theHour = daysFromCivil(year, month, monthDay) * 24 + hour;
+    if (theHour != cachedHour)
+    {
+        struct tm builtTime;
+        time_t    hourStart, hourEnd;
+
+        memset(&builtTime, 0, sizeof(builtTime));
+        builtTime.tm_year  = year - 1900;
+        builtTime.tm_mon   = month - 1;
+        builtTime.tm_mday  = monthDay;
+        builtTime.tm_hour  = hour;
+        builtTime.tm_isdst = -1;
+        hourStart = mktime(&builtTime);
+
+        builtTime.tm_year  = year - 1900;
+        builtTime.tm_mon   = month - 1;
+        builtTime.tm_mday  = monthDay;
+        builtTime.tm_hour  = hour;
+        builtTime.tm_min   = 59;
+        builtTime.tm_sec   = 59;
+        builtTime.tm_isdst = -1;
+        hourEnd = mktime(&builtTime);
+
+        if (hourStart < 0 || hourEnd - hourStart != SECONDS_IN_ONE_HOUR - 1)
+        {
+            builtTime.tm_year  = year - 1900;
+            builtTime.tm_mon   = month - 1;
+            builtTime.tm_mday  = monthDay;
+            builtTime.tm_hour  = hour;
+            builtTime.tm_min   = minute;
+            builtTime.tm_sec   = second;
+            builtTime.tm_isdst = -1;
+
+            return mktime(&builtTime);
+        }
+
+        cachedHour      = theHour;
+        cachedHourStart = hourStart;
+    }
+
+    return cachedHourStart + minute * SECONDS_IN_ONE_MINUTE + second;
+}
+
+/**
+ * Converts the time to local time, the result of the previous call is cached
+ * (per thread) because the same second is usually printed many times.
+ */
+static void
+localTime(
+        time_t     theTime,
+        struct tm *result)
+{
+    static __thread bool      cacheValid = false;
+    static __thread time_t    cachedTime;
+    static __thread struct tm cachedResult;
+
+    if (!cacheValid || theTime != cachedTime)
+    {
+        localtime_r(&theTime, &cachedResult);
+        cachedTime = theTime;
+        cacheValid = true;
+    }
+
+    *result = cachedResult;
+}
+
+/**
+ * \returns The time in the TzDateTimeFormat, e.g. "2015-11-19T04:46:01.000Z".
+ *
+ * The date and time part of the previous call is cached (per thread), only the
+ * milliseconds are re-formatted when the same second is printed again.
+ */
+static S9sString
+tzString(
+        const struct timespec &timeSpec)
+{
+    static __thread bool   cacheValid = false;
+    static __thread time_t cachedTime;
+    static __thread char   cachedString[32];
+    char                   buffer[40];
+    int                    milliseconds = timeSpec.tv_nsec / 1000000;
+
+    if (!cacheValid || timeSpec.tv_sec != cachedTime)
+    {
+        struct tm gmt;
+
+        gmtime_r(&timeSpec.tv_sec, &gmt);
+        strftime(cachedString, sizeof(cachedString), "%Y-%m-%dT%H:%M:%S", &gmt);
+
+        cachedTime = timeSpec.tv_sec;
+        cacheValid = true;
+    }
+
+    snprintf(buffer, sizeof(buffer), "%s.%03dZ", cachedString, milliseconds);
+    return buffer;
+}
+
+/**
+ * \returns The current year, checked once in every minute.
+ */
+static int
+currentYear()
+{
+    static __thread time_t validUntil = 0;
+    static __thread int    theYear;
+    time_t                 now = time(NULL);
+
+    if (now >= validUntil)
+    {
+        struct tm lt;
+
+        localtime_r(&now, &lt);
+        theYear    = lt.tm_year + 1900;
+        validUntil = now + CURRENT_YEAR_CACHE_SECONDS;
+    }
+
+    return theYear;
+}
+
+/**
+ * \returns The month (0-11) from the case insensitive short month name or -1.
+ */
+static int
+monthFromName(
+        const char *name)
+{
+    for (int idx = 0; shortMonthNames[idx] != NULL; ++idx)
+    {
+        const char *monthName = shortMonthNames[idx];
+
+        if (tolower(name[0]) == tolower(monthName[0]) &&
+                tolower(name[1]) == monthName[1] &&
+                tolower(name[2]) == monthName[2])
+        {
+            return idx;
+        }
+    }
+
+    return -1;
+}
+
 /**
  * This constructor will create an object that holds no date or time, that is
  * invalid.
@@ -285,17 +490,21 @@ S9sDateTime::ellapsedSeconds() const
 int
 S9sDateTime::second() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
 
-    return lt->tm_sec;
+    localTime(m_timeSpec.tv_sec, &lt);
+
+    return lt.tm_sec;
 }
 
 int
 S9sDateTime::minute() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
 
-    return lt->tm_min;
+    return lt.tm_min;
 }
 
 int
@@ -308,8 +517,10 @@ S9sDateTime::hour(
         return gmtTime->tm_hour;
     }
 
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
-    return lt->tm_hour;
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
+    return lt.tm_hour;
 }
 
 /**
@@ -319,11 +530,12 @@ S9sDateTime::hour(
 int
 S9sDateTime::weekNumber() const
 {
-    struct tm    *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm     lt;
     char          buffer[80];
     S9sString     tmp;
 
-    strftime(buffer, sizeof(buffer), "%V", lt);
+    localTime(m_timeSpec.tv_sec, &lt);
+    strftime(buffer, sizeof(buffer), "%V", &lt);
     tmp = buffer;
     return tmp.toInt();
 }
@@ -335,9 +547,11 @@ S9sDateTime::weekNumber() const
 int
 S9sDateTime::month() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
 
-    return lt->tm_mon + 1;
+    localTime(m_timeSpec.tv_sec, &lt);
+
+    return lt.tm_mon + 1;
 }
 
 /**
@@ -347,9 +561,11 @@ S9sDateTime::month() const
 int
 S9sDateTime::day() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
 
-    return lt->tm_mday;
+    return lt.tm_mday;
 }
 
 /**
@@ -359,9 +575,11 @@ S9sDateTime::day() const
 int
 S9sDateTime::year() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
 
-    return 1900 + lt->tm_year;
+    return 1900 + lt.tm_year;
 }
 
 /**
@@ -370,10 +588,12 @@ S9sDateTime::year() const
 int
 S9sDateTime::weekday() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
 
     // tm_wday: Sunday = 0, Monday = 1... Saturday = 6
-    return lt->tm_wday + 1;
+    return lt.tm_wday + 1;
 }
 
 /**
@@ -382,21 +602,24 @@ S9sDateTime::weekday() const
 int
 S9sDateTime::yearday() const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
     
     // tm_wday: Sunday = 0, Monday = 1... Saturday = 6
-    return lt->tm_yday + 1;
+    return lt.tm_yday + 1;
 }
 
 int
 S9sDateTime::currentWeekNumber()
 {
     S9sDateTime  dt = currentDateTime();
-    struct tm    *lt = ::localtime(&dt.m_timeSpec.tv_sec);
+    struct tm     lt;
     char          buffer[80];
     S9sString    tmp;
 
-    strftime(buffer, sizeof(buffer), "%V", lt);
+    localTime(dt.m_timeSpec.tv_sec, &lt);
+    strftime(buffer, sizeof(buffer), "%V", &lt);
     tmp = buffer;
 
     return tmp.toInt();
@@ -406,11 +629,12 @@ int
 S9sDateTime::previousWeekNumber()
 {
     S9sDateTime  dt = time(NULL) - WEEKS_TO_SECONDS(1);
-    struct tm    *lt = ::localtime(&dt.m_timeSpec.tv_sec);
+    struct tm     lt;
     char          buffer[80];
     S9sString    tmp;
 
-    strftime(buffer, sizeof(buffer), "%V", lt);
+    localTime(dt.m_timeSpec.tv_sec, &lt);
+    strftime(buffer, sizeof(buffer), "%V", &lt);
     tmp = buffer;
 
     return tmp.toInt();
@@ -465,27 +689,33 @@ S9sString
 S9sDateTime::toString(
         S9sDateTime::DateTimeFormat format) const
 {
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm lt;
     S9sString retval;
 
+    // This is in UTC, we don't need the local time.
+    if (format == TzDateTimeFormat)
+        return tzString(m_timeSpec);
+
+    localTime(m_timeSpec.tv_sec, &lt);
+
     switch (format)
     {
         case FileNameFormat:
             retval.sprintf("%04d-%02d-%02d_%02d%02d%02d",
-                    lt->tm_year + 1900, lt->tm_mon + 1, lt->tm_mday,
-                    lt->tm_hour, lt->tm_min, lt->tm_sec);
+                    lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday,
+                    lt.tm_hour, lt.tm_min, lt.tm_sec);
             break;
 
         case ShortDayFormat:
 
             retval.sprintf("%d%02d%02d",
-                    lt->tm_year - 100, lt->tm_mon + 1, lt->tm_mday);
+                    lt.tm_year - 100, lt.tm_mon + 1, lt.tm_mday);
             break;
 
         case ShortDateFormat:
             {
                 char buffer[80];
-                strftime(buffer, sizeof(buffer), "%x", lt);
+                strftime(buffer, sizeof(buffer), "%x", &lt);
                 retval = buffer;
             }
             break;
@@ -493,15 +723,15 @@ S9sDateTime::toString(
         case LogFileFormat:
             {
                 char buffer[80];
-                strftime(buffer, sizeof(buffer), "%b %d %H:%M:%S", lt);
+                strftime(buffer, sizeof(buffer), "%b %d %H:%M:%S", &lt);
                 retval = buffer;
             }
             break;
 
         case MySqlLogFileFormat:
             retval.sprintf("%04d-%02d-%02d %02d:%02d:%02d",
-                    lt->tm_year + 1900, lt->tm_mon + 1, lt->tm_mday,
-                    lt->tm_hour, lt->tm_min, lt->tm_sec);
+                    lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday,
+                    lt.tm_hour, lt.tm_min, lt.tm_sec);
             break;
 
         case CompactFormat:
@@ -509,36 +739,36 @@ S9sDateTime::toString(
             {
                 char buffer[80];
 
-                strftime(buffer, sizeof(buffer), "%H:%M:%S", lt);
+                strftime(buffer, sizeof(buffer), "%H:%M:%S", &lt);
                 retval = buffer;
             } else {
                 retval.sprintf("%04d-%02d-%02d %02d:%02d:%02d",
-                        lt->tm_year + 1900, lt->tm_mon + 1, lt->tm_mday,
-                        lt->tm_hour, lt->tm_min, lt->tm_sec);
+                        lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday,
+                        lt.tm_hour, lt.tm_min, lt.tm_sec);
             }
             break;
 
         case MySqlShortLogFormat:
             retval.sprintf("%2d%02d%02d %2d:%02d:%02d",
-                    lt->tm_year - 100, lt->tm_mon + 1, lt->tm_mday,
-                    lt->tm_hour, lt->tm_min, lt->tm_sec);
+                    lt.tm_year - 100, lt.tm_mon + 1, lt.tm_mday,
+                    lt.tm_hour, lt.tm_min, lt.tm_sec);
             break;
 
         case MySqlLogFileDateFormat:
             retval.sprintf("%04d-%02d-%02d",
-                   lt->tm_year + 1900, lt->tm_mon + 1, lt->tm_mday);
+                   lt.tm_year + 1900, lt.tm_mon + 1, lt.tm_mday);
 
             break;
 
         case MySqlShortLogDateFormat:
             retval.sprintf("%2d%02d%02d",
-                    lt->tm_year - 100, lt->tm_mon + 1, lt->tm_mday);
+                    lt.tm_year - 100, lt.tm_mon + 1, lt.tm_mday);
             break;
 
         case ShortTimeFormat:
             {
                 char buffer[80];
-                strftime(buffer, sizeof(buffer), "%H:%M", lt);
+                strftime(buffer, sizeof(buffer), "%H:%M", &lt);
                 retval = buffer;
             }
             break;
@@ -546,7 +776,7 @@ S9sDateTime::toString(
         case LongTimeFormat:
             {
                 char buffer[80];
-                strftime(buffer, sizeof(buffer), "%H:%M:%S", lt);
+                strftime(buffer, sizeof(buffer), "%H:%M:%S", &lt);
                 retval = buffer;
             }
             break;
@@ -554,7 +784,7 @@ S9sDateTime::toString(
         case LocalDateTimeFormat:
             {
                 char buffer[80];
-                strftime(buffer, sizeof(buffer), "%c", lt);
+                strftime(buffer, sizeof(buffer), "%c", &lt);
                 retval = buffer;
             }
             break;
@@ -563,30 +793,14 @@ S9sDateTime::toString(
             {
                 char buffer[120];
                 strftime(buffer, sizeof(buffer), 
-                        "%a, %d %b %Y %H:%M:%S %z", lt);
+                        "%a, %d %b %Y %H:%M:%S %z", &lt);
 
                 retval = buffer;
             }
             break;
 
         case TzDateTimeFormat:
-            {
-                char       buffer[120];
-                size_t     size = sizeof(buffer);
-                S9sString millisecs;
-
-                // 
-                // Here we change to GTMT and format that.
-                // 
-                struct tm *lt = ::gmtime(&m_timeSpec.tv_sec);
-                    
-                strftime(buffer, size, "%Y-%m-%dT%H:%M:%S", lt);
-                millisecs.sprintf(".%03d", m_timeSpec.tv_nsec / 1000000);
-
-                retval  = buffer;
-                retval += millisecs;
-                retval += "Z";
-            }
+            // Handled above.
             break;
 
     }
@@ -605,9 +819,11 @@ S9sDateTime::toString(
     // FIXME: finite buffer size!
     size_t     bufferSize = 1024;
     char       buffer[bufferSize];
-    struct tm *lt = ::localtime(&m_timeSpec.tv_sec);
+    struct tm  lt;
+
+    localTime(m_timeSpec.tv_sec, &lt);
 
-    ::strftime(buffer, bufferSize, STR(formatString), lt);
+    ::strftime(buffer, bufferSize, STR(formatString), &lt);
     return S9sString(buffer);
 }
 
@@ -658,17 +874,32 @@ S9sDateTime::parse(
         const S9sString &input,
         int              *length)
 {
-    bool retval = false;
-    if (parseLogFileFormat(input, length))
-        retval = true;
-    else if (parseMySqlLogFileFormat(input, length))
-        retval = true;
-    else if (parseMySqlShortLogFormat(input, length))
-        retval = true;
-    else if (parseMySqlShortLogFormatNoLeadZero(input, length))
-        retval = true;
-    else if (parseTzFormat(input, length))
-        retval = true;
+    const char *s = STR(input);
+    bool        retval = false;
+
+    /*
+     * The format is detected from the first characters so only one parser
+     * runs: "May 14 14:59:21", "2014-03-17 10:15:12",
+     * "2016-06-06T11:47:39.500Z" or "140415  0:44:42".
+     */
+    if (isalpha((unsigned char) s[0]))
+    {
+        retval = parseLogFileFormat(input, length);
+    } else if (input.length() > 10 &&
+            IS_DIGIT(s[0]) && IS_DIGIT(s[1]) && 
+            IS_DIGIT(s[2]) && IS_DIGIT(s[3]) &&
+            (s[4] == '-' || s[4] == '/'))
+    {
+        if (s[10] == 'T')
+            retval = parseTzFormat(input, length);
+        else
+            retval = parseMySqlLogFileFormat(input, length);
+    } else if (IS_DIGIT(s[0]))
+    {
+        retval = 
+            parseMySqlShortLogFormat(input, length) ||
+            parseMySqlShortLogFormatNoLeadZero(input, length);
+    }
 
     S9S_DEBUG("***  input : %s", STR(input));
     S9S_DEBUG("*** retval : %s", retval ? "true" : "false");
@@ -817,18 +1048,8 @@ S9sDateTime::parseMySqlLogFileFormat(
     //
     // Transforming and checking.
     //
-    struct tm builtTime;
-    time_t    theTime;
+    time_t theTime = localTimeT(year, month, monthDay, hour, minute, second);
 
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month - 1;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
-
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
@@ -917,18 +1138,8 @@ S9sDateTime::parseMySqlShortLogFormat(
     //
     // Transforming and checking.
     //
-    struct tm builtTime;
-    time_t    theTime;
-
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month - 1;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
+    time_t theTime = localTimeT(year, month, monthDay, hour, minute, second);
 
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
@@ -1004,18 +1215,8 @@ S9sDateTime::parseMySqlShortLogFormatNoLeadZero(
     //
     // Transforming and checking.
     //
-    struct tm builtTime;
-    time_t    theTime;
-
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month - 1;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
+    time_t theTime = localTimeT(year, month, monthDay, hour, minute, second);
 
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
@@ -1031,86 +1232,102 @@ S9sDateTime::parseMySqlShortLogFormatNoLeadZero(
 
 /**
  * Example: "2016-06-06T11:47:39.500Z"
- * FIXME: The time zone information is not parsed here (except Z). There could
- * be +hh:mm or -hh:mm for example.
+ *
+ * The fraction of the second is optional and may have any number of digits,
+ * the time zone is either "Z" or an offset like "+02:00" or "-0530".
  */
 bool
 S9sDateTime::parseTzFormat(
         const S9sString &input,
         int              *length)
 {
-    bool retval = false;
-    int  year;
-    int  month;
-    int  monthDay;
-    int  hour;
-    int  minute;
-    int  second;
-    int  fields;
-    int  timezone = 0;
-    int  milliseconds;
-
-    fields = sscanf(STR(input), "%4d-%02d-%02dT%02d:%02d:%02d.%dZ", 
-            &year, &month, &monthDay,
-            &hour, &minute, &second,
-            &milliseconds);
+    const char *s = STR(input);
+    int         n;
+    longlong    days;
+    time_t      theTime;
+    long        nanoseconds = 0l;
+    long        scale = 100000000l;
+    int         offset = 0;
+
+    if (input.length() < 20)
+        return false;
 
-    if (fields != 7)
+    if (!IS_DIGIT(s[0]) || !IS_DIGIT(s[1]) || !IS_DIGIT(s[2]) || 
+            !IS_DIGIT(s[3]) || s[4] != '-' ||
+            !IS_DIGIT(s[5]) || !IS_DIGIT(s[6]) || s[7] != '-' ||
+            !IS_DIGIT(s[8]) || !IS_DIGIT(s[9]) || s[10] != 'T' ||
+            !IS_DIGIT(s[11]) || !IS_DIGIT(s[12]) || s[13] != ':' ||
+            !IS_DIGIT(s[14]) || !IS_DIGIT(s[15]) || s[16] != ':' ||
+            !IS_DIGIT(s[17]) || !IS_DIGIT(s[18]))
     {
         return false;
     }
 
-    S9S_WARNING("*** fields       : %d", fields);
-    S9S_WARNING("*** year         : %d", year);
-    S9S_WARNING("*** month        : %d", month);
-    S9S_WARNING("*** monthDay     : %d", monthDay);
-    S9S_WARNING("*** hour         : %d", hour);
-    S9S_WARNING("*** minute       : %d", minute);
-    S9S_WARNING("*** second       : %d", second);
-    S9S_WARNING("*** milliseconds : %d", milliseconds);
-    S9S_WARNING("*** timezone     : %d", timezone);
+    n = 19;
 
-    //
-    // Transforming and checking.
-    //
-    struct tm builtTime;
-    time_t    theTime;
+    // The optional fraction of the second.
+    if (s[n] == '.')
+    {
+        ++n;
+        if (!IS_DIGIT(s[n]))
+            return false;
 
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month - 1;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
+        for (; IS_DIGIT(s[n]); ++n)
+        {
+            nanoseconds += DIGIT(s[n]) * scale;
+            scale       /= 10;
+        }
+    }
 
-    theTime = mktime(&builtTime);
-    if (theTime >= 0)
+    // The time zone: "Z", "+hh:mm", "-hh:mm" or "+hhmm".
+    if (s[n] == 'Z')
     {
-        m_timeSpec.tv_sec  = theTime;
-        m_timeSpec.tv_nsec = milliseconds * 1000000;
-        retval = true;
-    
-        timezone /= 100;
-        timezone *= 60 * 60;
+        ++n;
+    } else if ((s[n] == '+' || s[n] == '-') && 
+            IS_DIGIT(s[n + 1]) && IS_DIGIT(s[n + 2]))
+    {
+        int sign = s[n] == '-' ? -1 : 1;
         
-        S9S_WARNING("*** timezone     : %d", timezone);
-        S9S_WARNING("*** timeZone()   : %d", timeZone());
-        S9S_WARNING("*** dayLight()   : %d", dayLight());
-        S9S_WARNING("*** mktime()     : %s", S9S_TIME_T(m_timeSpec.tv_sec));
+        offset = TWO_DIGITS(s + n + 1) * SECONDS_IN_ONE_HOUR;
+        n     += 3;
 
-        m_timeSpec.tv_sec += timezone;
-        m_timeSpec.tv_sec -= timeZone();
+        if (s[n] == ':')
+            ++n;
 
-        
-        if (builtTime.tm_isdst)
-            m_timeSpec.tv_sec += dayLight();
+        if (IS_DIGIT(s[n]) && IS_DIGIT(s[n + 1]))
+        {
+            offset += TWO_DIGITS(s + n) * SECONDS_IN_ONE_MINUTE;
+            n      += 2;
+        }
+
+        offset *= sign;
+    } else {
+        return false;
     }
 
-    if (retval && length != NULL)
-        *length = 26;
+    //
+    // The time is in UTC, no need to call mktime().
+    //
+    days    = daysFromCivil(
+            100 * TWO_DIGITS(s) + TWO_DIGITS(s + 2), 
+            TWO_DIGITS(s + 5), TWO_DIGITS(s + 8));
 
-    return retval;
+    theTime = 
+        days * SECONDS_IN_ONE_DAY + 
+        TWO_DIGITS(s + 11) * SECONDS_IN_ONE_HOUR + 
+        TWO_DIGITS(s + 14) * SECONDS_IN_ONE_MINUTE + 
+        TWO_DIGITS(s + 17) - offset;
+
+    if (theTime < 0)
+        return false;
+
+    m_timeSpec.tv_sec  = theTime;
+    m_timeSpec.tv_nsec = nanoseconds;
+
+    if (length != NULL)
+        *length = n;
+
+    return true;
 }
 
 /**
@@ -1240,18 +1457,8 @@ S9sDateTime::parseDateFormat(
     //
     // Transforming and checking.
     //
-    struct tm builtTime;
-    time_t    theTime;
-
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month - 1;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = 0;
-    builtTime.tm_min   = 0;
-    builtTime.tm_sec   = 0;
-    builtTime.tm_isdst = -1;
+    time_t theTime = localTimeT(year, month, monthDay, 0, 0, 0);
 
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
@@ -1279,93 +1486,62 @@ S9sDateTime::parseDbGrowthDataFormat(
         const S9sString &input,
         int             *length)
 {
-    S9sString s = input.toLower();
-    bool       retval = false;
-
-    int        month    = -1;
-    int        monthDay = -1;
-    int        hour     = -1;
-    int        minute   = -1;
-    int        second   = -1;
-    int        year     = -1;
-
-    if (s.length() < 20)
+    const char *s = STR(input);
+    bool        retval = false;
+    int         month;
+    int         monthDay;
+    int         hour;
+    int         minute;
+    int         second;
+    int         year;
+
+    if (input.length() < 20)
         return retval;
 
     // Parsing the month name.
-    for (int idx = 0; shortMonthNames[idx] != NULL; ++idx)
-    {
-        S9sString monthName = shortMonthNames[idx];
-
-        if (s.startsWith(STR(monthName.toLower())))
-        {
-            month = idx;
-            break;
-        }
-    }
-
-    if (month < 0)
-        return retval;
-
-    if (s[3] != ' ')
+    month = monthFromName(s);
+    if (month < 0 || s[3] != ' ')
         return retval;
 
     // The day of the month: one or two digit decimal number.
-    if (
-            (!isdigit(s[4]) && s[4] != ' ') ||
-            !isdigit(s[5]) || s[6] != ' ')
+    if ((!IS_DIGIT(s[4]) && s[4] != ' ') || !IS_DIGIT(s[5]) || s[6] != ' ')
         return retval;
 
-    monthDay = (s[5] - '0');
+    monthDay = DIGIT(s[5]);
     if (s[4] != ' ')
-        monthDay += 10 * (s[4] - '0');
+        monthDay += 10 * DIGIT(s[4]);
 
     // The hour
-    if (!isdigit(s[7]) || !isdigit(s[8]) || s[9] != ':')
+    if (!IS_DIGIT(s[7]) || !IS_DIGIT(s[8]) || s[9] != ':')
         return retval;
 
-    hour = 10 * (s[7] - '0') + (s[8] - '0');
+    hour = TWO_DIGITS(s + 7);
 
     // The minute
-    if (!isdigit(s[10]) || !isdigit(s[11]) || s[12] != ':')
+    if (!IS_DIGIT(s[10]) || !IS_DIGIT(s[11]) || s[12] != ':')
         return retval;
 
-    minute = 10 * (s[10] - '0') + (s[11] - '0');
+    minute = TWO_DIGITS(s + 10);
 
     // The second
-    if (!isdigit(s[13]) || !isdigit(s[14]) || input[15] != ' ')
+    if (!IS_DIGIT(s[13]) || !IS_DIGIT(s[14]) || s[15] != ' ')
         return retval;
 
-    second = 10 * (s[13] - '0') + (s[14] - '0');
+    second = TWO_DIGITS(s + 13);
 
     // parsing the year
-    if (!isdigit(input[16]) ||
-        !isdigit(input[17]) ||
-        !isdigit(input[18]) ||
-        !isdigit(input[19]))
+    if (!IS_DIGIT(s[16]) || !IS_DIGIT(s[17]) || 
+            !IS_DIGIT(s[18]) || !IS_DIGIT(s[19]))
         return retval;
 
-    year = 1000 * (input[16] - '0') +
-           100 * (input[17] - '0') +
-           10 * (input[18] - '0') +
-           (input[19] - '0');
+    year = 100 * TWO_DIGITS(s + 16) + TWO_DIGITS(s + 18);
 
     //
     // Transforming and checking
     //
-    S9sDateTime now = S9sDateTime::currentDateTime();
-    struct tm builtTime;
-    time_t    theTime;
+    time_t theTime = localTimeT(
+            year, month + 1, monthDay, hour, minute, second);
 
-    builtTime.tm_year  = year - 1900;
-    builtTime.tm_mon   = month;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
-
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
@@ -1397,80 +1573,54 @@ S9sDateTime::parseLogFileFormat(
         const S9sString &input,
         int              *length)
 {
-    S9sString s = input.toLower();
-    bool       retval = false;
+    const char *s = STR(input);
+    bool        retval = false;
+    int         month;
+    int         monthDay;
+    int         hour;
+    int         minute;
+    int         second;
 
-    int        month    = -1;
-    int        monthDay = -1;
-    int        hour     = -1;
-    int        minute   = -1;
-    int        second   = -1;
-
-    if (s.length() < 15)
+    if (input.length() < 15)
         return retval;
 
     // Parsing the month name.
-    for (int idx = 0; shortMonthNames[idx] != NULL; ++idx)
-    {
-        S9sString monthName = shortMonthNames[idx];
-
-        if (s.startsWith(STR(monthName.toLower())))
-        {
-            month = idx;
-            break;
-        }
-    }
-
-    if (month < 0)
-        return retval;
-
-    if (s[3] != ' ')
+    month = monthFromName(s);
+    if (month < 0 || s[3] != ' ')
         return retval;
 
     // The day of the month: one or two digit decimal number.
-    if (
-        (!isdigit(s[4]) && s[4] != ' ') ||
-        !isdigit(s[5]) || s[6] != ' ')
+    if ((!IS_DIGIT(s[4]) && s[4] != ' ') || !IS_DIGIT(s[5]) || s[6] != ' ')
         return retval;
 
-    monthDay = (s[5] - '0');
+    monthDay = DIGIT(s[5]);
     if (s[4] != ' ')
-        monthDay += 10 * (s[4] - '0');
+        monthDay += 10 * DIGIT(s[4]);
 
     // The hour
-    if (!isdigit(s[7]) || !isdigit(s[8]) || s[9] != ':')
+    if (!IS_DIGIT(s[7]) || !IS_DIGIT(s[8]) || s[9] != ':')
         return retval;
 
-    hour = 10 * (s[7] - '0') + (s[8] - '0');
+    hour = TWO_DIGITS(s + 7);
 
     // The minute
-    if (!isdigit(s[10]) || !isdigit(s[11]) || s[12] != ':')
+    if (!IS_DIGIT(s[10]) || !IS_DIGIT(s[11]) || s[12] != ':')
         return retval;
 
-    minute = 10 * (s[10] - '0') + (s[11] - '0');
+    minute = TWO_DIGITS(s + 10);
 
     // The second
-    if (!isdigit(s[13]) || !isdigit(s[14]))
+    if (!IS_DIGIT(s[13]) || !IS_DIGIT(s[14]))
         return retval;
 
-    second = 10 * (s[13] - '0') + (s[14] - '0');
+    second = TWO_DIGITS(s + 13);
 
     //
-    // Transforming and checking
+    // Transforming and checking, the year is not in the string.
     //
-    S9sDateTime now = S9sDateTime::currentDateTime();
-    struct tm builtTime;
-    time_t    theTime;
-
-    builtTime.tm_year  = now.year() - 1900;
-    builtTime.tm_mon   = month;
-    builtTime.tm_mday  = monthDay;
-    builtTime.tm_hour  = hour;
-    builtTime.tm_min   = minute;
-    builtTime.tm_sec   = second;
-    builtTime.tm_isdst = -1;
+    time_t theTime = localTimeT(
+            currentYear(), month + 1, monthDay, hour, minute, second);
 
-    theTime = mktime(&builtTime);
     if (theTime >= 0)
     {
         m_timeSpec.tv_sec  = theTime;
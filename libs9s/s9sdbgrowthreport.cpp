@@ -1,6 +1,6 @@
 /*
  * Severalnines Tools
- * Copyright (C) 2017-2018 Severalnines AB
+ * Copyright (C) 2016  Severalnines AB
  *
  * This file is part of s9s-tools.
  *
@@ -18,10 +18,28 @@
  * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sdbgrowthreport.h"
+#include "s9soutput.h"
 #include "s9soptions.h"
 #include "s9sdatetime.h"
 #include "s9sdebug.h"
 
+#include <strings.h>
+#include <algorithm>
+
+/**
+ * Returns the value for the key without copying the map or adding the key to
+ * it, an empty variant if the key is not there.
+ */
+static const S9sVariant &
+valueOf(const S9sVariantMap &map, 
+        const char          *key)
+{
+    static const S9sVariant empty;
+    S9sVariantMap::const_iterator it = map.find(key);
+
+    return it == map.end() ? empty : it->second;
+}
+
 /**
  * Report's constructor.
  */
@@ -58,9 +76,32 @@ void S9sDbGrowthReport::initialize()
     const S9sDateTime
             &currentDateTime       = S9sDateTime::currentDateTime();
     m_dateTimeDaysAgo              = S9sDateTime((currentDateTime - secondsAgoFor31Days)/1000);
-    if(m_hasDate)
-        m_dateOption.parseDateFormat(m_options->dBSchemaDate());
-    m_dataReportList.clear();
+    /*
+     * The date filter as a YYYYMMDD number, -1 never matches.
+     */
+    m_dateOptionKey                = -1;
+    if(m_hasDate && !m_options->dBSchemaDate().empty())
+    {
+        S9sDateTime dateOption;
+
+        if (dateOption.parseDateFormat(m_options->dBSchemaDate()))
+        {
+            m_dateOptionKey = dateOption.year() * 10000 +
+                dateOption.month() * 100 + dateOption.day();
+        }
+    }
+
+    m_rowDate.clear();
+    m_rowDbName.clear();
+    m_rowTableName.clear();
+    m_rowTablesRows.clear();
+    m_rowDataSize.clear();
+    m_rowIndexSize.clear();
+    m_dates.clear();
+    m_dateRanks.clear();
+    m_names.clear();
+    m_nameIndex.clear();
+    m_groups.clear();
 }
 
 /**
@@ -76,17 +117,55 @@ void S9sDbGrowthReport::printReport(const S9sVariant &data)
     S9sFormat            dataSizeFormat;
     S9sFormat            indexSizeFormat;
     S9sFormat            totalSizeFormat;
+    S9sVector<uint>      order;
+    uint                 nPrinted;
+    int                  limit = m_options->limit();
 
     /*
-     * Preparing the data for the report: flattening and sorting the list of data source.
+     * Preparing the data for the report: flattening and grouping the list of
+     * data source.
      */
     prepareData(dataList);
+    rankDates();
+
+    /*
+     * Sorting the report by total size in descending order. If the size is
+     * the same for two results, the sorting is made by date in descending
+     * order within the size group. With --limit only the first rows are
+     * sorted.
+     */
+    order.reserve(m_nLines);
+    for (uint idx = 0u; idx < m_nLines; ++idx)
+        order.push_back(idx);
+
+    nPrinted = m_nLines;
+    if (limit >= 0 && (uint) limit < m_nLines)
+    {
+        nPrinted = limit;
+        std::partial_sort(order.begin(), order.begin() + nPrinted, 
+                order.end(), RowOrder(*this));
+    } else {
+        std::sort(order.begin(), order.end(), RowOrder(*this));
+    }
+
+    for (uint idx = 0u; idx < nPrinted; ++idx)
+    {
+        uint row = order[idx];
+
+        m_dateFormat.widen(m_dates[m_rowDate[row]]);
+        if (!m_groupByDate)
+            m_dbNameFormat.widen(name(m_rowDbName[row]));
+
+        if (!m_groupByDate && !m_groupByDbName)
+            m_tableNameFormat.widen(name(m_rowTableName[row]));
+    }
+
     /*
      * Printing the header.
      */
     if (!m_options->isNoHeaderRequested() && m_nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         m_dateFormat.printHeader("DATE");
         if(!m_groupByDate)
         {
@@ -100,19 +179,11 @@ void S9sDbGrowthReport::printReport(const S9sVariant &data)
         dataSizeFormat.printHeader("DATA_SIZE");
         indexSizeFormat.printHeader("INDEX_SIZE");
         totalSizeFormat.printHeader("TOTAL_SIZE");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
-    /*
-     * Sorting the report data list by total size in descending order.
-     * If the size is the same for two results, the sorting is made
-     * by date in descending order within the size group.
-     */
-    sort(m_dataReportList.begin(), m_dataReportList.end(),
-         compareDataByTotalSizeAndDate);
-
     /*
      * Setting up the colors highlighting
      */
@@ -132,143 +203,97 @@ void S9sDbGrowthReport::printReport(const S9sVariant &data)
     /*
      * Printing the data
      */
-    for (uint idxData = 0; idxData < m_dataReportList.size(); ++idxData)
+    for (uint idx = 0; idx < nPrinted; ++idx)
     {
-        S9sVariantMap dataMap = m_dataReportList[idxData].toVariantMap();
+        uint row = order[idx];
 
-        printf("%s", groupColorBegin);
-        m_dateFormat.printf(dataMap["date"].toString());
-        printf("%s", groupColorEnd);
+        S9sOutput::printf("%s", groupColorBegin);
+        m_dateFormat.printf(m_dates[m_rowDate[row]]);
+        S9sOutput::printf("%s", groupColorEnd);
 
         if(!m_groupByDate)
         {
-            printf("%s", colorBegin);
-            m_dbNameFormat.printf(dataMap["db_name"].toString());
-            printf("%s", colorEnd);
+            S9sOutput::printf("%s", colorBegin);
+            m_dbNameFormat.printf(name(m_rowDbName[row]));
+            S9sOutput::printf("%s", colorEnd);
 
-            printf("%s", colorBegin);
+            S9sOutput::printf("%s", colorBegin);
             if (!m_groupByDbName)
             {
-                m_tableNameFormat.printf(dataMap["table_name"].toString());
+                m_tableNameFormat.printf(name(m_rowTableName[row]));
             }
-            tablesRowsFormat.printf(dataMap["tables_rows"].toULongLong());
+            tablesRowsFormat.printf(m_rowTablesRows[row]);
         }
-        printf("%s", colorEnd);
+        S9sOutput::printf("%s", colorEnd);
 
-        printf("%s", groupColorBegin);
-        dataSizeFormat.printf(dataMap["data_size"].toULongLong());
-        indexSizeFormat.printf(dataMap["index_size"].toULongLong());
-        totalSizeFormat.printf(dataMap["total_size"].toULongLong());
-        printf("%s", groupColorEnd);
+        S9sOutput::printf("%s", groupColorBegin);
+        dataSizeFormat.printf(m_rowDataSize[row]);
+        indexSizeFormat.printf(m_rowIndexSize[row]);
+        totalSizeFormat.printf(m_rowDataSize[row] + m_rowIndexSize[row]);
+        S9sOutput::printf("%s", groupColorEnd);
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
-
 }
 
 /**
- * Compares the results by total_size and date in sorting
+ * Compares two rows by total_size and date in sorting. The row index is the
+ * last resort so the order is always the same.
  * @param a
  * @param b
  * @return
  */
-bool S9sDbGrowthReport::compareDataByTotalSizeAndDate(const S9sVariant &a,
-                                                      const S9sVariant &b)
+bool 
+S9sDbGrowthReport::RowOrder::operator()(uint a, uint b) const
 {
-    S9sVariantMap aMap = a.toVariantMap();
-    S9sVariantMap bMap = b.toVariantMap();
-
-    bool result = false;
-    if(aMap["total_size"].toULongLong() > bMap["total_size"].toULongLong())
-    {
-        result = true;
-    }
-    else if(aMap["total_size"].toULongLong() == bMap["total_size"].toULongLong())
-    {
-        result = aMap["date"].toString() > bMap["date"].toString();
-    }
-    return result;
-}
+    ulonglong aTotal = m_report.m_rowDataSize[a] + m_report.m_rowIndexSize[a];
+    ulonglong bTotal = m_report.m_rowDataSize[b] + m_report.m_rowIndexSize[b];
+    uint      aRank;
+    uint      bRank;
 
-/**
- * Method prepares data for the DbGrowthReport: sorts by name and date and provides grouping.
- * @param dataList
- * @return
- */
-void
-S9sDbGrowthReport::prepareData(const S9sVariantList &dataList)
-{
-    S9sVariantMap dataGroupMap;
-    filterDataWithGrouping(dataList, dataGroupMap);
+    if (aTotal != bTotal)
+        return aTotal > bTotal;
 
-    if (m_groupByDate)
-    {
-        for (auto it = dataGroupMap.begin(); it != dataGroupMap.end(); ++it)
-        {
-            S9sVariantMap  dataMap = it->second.toVariantMap();
-            S9sString dateCreated = dataMap["date_created"].toString();
-            ulonglong dataSize = dataMap["data_size"].toULongLong();
-            ulonglong indexSize = dataMap["index_size"].toULongLong();
-
-            setDataMap(dataMap, dateCreated, "", "", 0, dataSize, indexSize);
-            m_dataReportList << dataMap;
-            m_nLines++;
-        }
-    }
+    aRank = m_report.m_dateRanks[m_report.m_rowDate[a]];
+    bRank = m_report.m_dateRanks[m_report.m_rowDate[b]];
+    if (aRank != bRank)
+        return aRank < bRank;
 
-    if (m_groupByDbName)
-    {
-        for (auto it = dataGroupMap.begin(); it != dataGroupMap.end(); ++it)
-        {
-            S9sVariantMap dbMap = it->second.toVariantMap();
-            for (auto dbIt = dbMap.begin(); dbIt != dbMap.end(); ++dbIt)
-            {
-                S9sVariantMap dataMap = dbIt->second.toVariantMap();
-                S9sString dateCreated = dataMap["date_created"].toString();
-                ulonglong dataSize = dataMap["data_size"].toULongLong();
-                ulonglong indexSize = dataMap["index_size"].toULongLong();
-                ulonglong rowCount = dataMap["row_count"].toULongLong();
-
-                setDataMap(dataMap, dateCreated, dbIt->first, "", rowCount, dataSize, indexSize);
-                m_dataReportList << dataMap;
-                m_nLines++;
-            }
-        }
-    }
+    return a < b;
 }
 
 /**
- * Filters data with given criteria and groups the results
+ * Method prepares data for the DbGrowthReport: filters, flattens and groups
+ * the records.
  * @param dataList
- * @param dataListFlatten
- * @param dataGroupMap
+ * @return
  */
 void
-S9sDbGrowthReport::filterDataWithGrouping(const S9sVariantList &dataList,
-                                          S9sVariantMap        &dataGroupMap)
+S9sDbGrowthReport::prepareData(const S9sVariantList &dataList)
 {
-
     for (uint idxData = 0; idxData < dataList.size(); ++idxData)
     {
-        S9sVariantMap     dbGrowthMap  = dataList[idxData].toVariantMap();
-        const S9sVariantList &dbsList  = dbGrowthMap["dbs"].toVariantList();
-        const S9sString &dateCreated   = dbGrowthMap["created"].toString();
+        const S9sVariantMap  &dbGrowthMap = dataList[idxData].toVariantMap();
+        const S9sVariantList &dbsList     = 
+            valueOf(dbGrowthMap, "dbs").toVariantList();
+        S9sString             dateCreated = 
+            valueOf(dbGrowthMap, "created").toString();
+        S9sDateTime           dataDate;
+        int                   dateKey;
+        uint                  dateIndex;
 
-        S9sDateTime dataDate;
         dataDate.parseDbGrowthDataFormat(
                 dateCreated + " " +
-                 dbGrowthMap["year"].toString());
+                valueOf(dbGrowthMap, "year").toString());
 
-        m_dataDateWithoutTime.setDate(dataDate.year(),
-                                    dataDate.yearday(),
-                                    dataDate.month(),
-                                    dataDate.day());
+        dateKey = dataDate.year() * 10000 + dataDate.month() * 100 + 
+            dataDate.day();
 
         bool dateFilterIsValid = false;
 
-        if(m_options->hasDbSchemaDate() && !m_options->dBSchemaDate().empty())
+        if(m_hasDate && !m_options->dBSchemaDate().empty())
         {
-            dateFilterIsValid = m_dataDateWithoutTime == m_dateOption;
+            dateFilterIsValid = dateKey == m_dateOptionKey;
         }
         else
         {
@@ -278,9 +303,11 @@ S9sDbGrowthReport::filterDataWithGrouping(const S9sVariantList &dataList,
         if(!dateFilterIsValid)
             continue;
 
+        dateIndex = m_dates.size();
+        m_dates << dateCreated;
 
         m_dbNameFilterDataFound = false;
-        applyFiltersAndGroups(dbsList, dataGroupMap, dateCreated);
+        applyFiltersAndGroups(dbsList, dateKey, dateIndex);
         /*
          * In case if the DB name filter was set and no data found, the record
          * that contains the whole dbs array should be skipped from the report.
@@ -293,212 +320,202 @@ S9sDbGrowthReport::filterDataWithGrouping(const S9sVariantList &dataList,
          * a date and empty db information should be added to the report.
          */
         if(dbsList.empty())
-        {
-            S9sVariantMap  dataMap;
-            setDataMap(dataMap, dateCreated, "", "");
-            m_dataReportList << dataMap;
-            m_nLines++;
-        }
-        m_dateFormat.widen(dateCreated);
+            addRow(dateIndex, -1, -1);
     }
 }
 
 /**
- * Iterates through the db data, filters the results by date, by db name
- * and saves the output to the flattened list
+ * Iterates through the db data, filters the results by db name and either
+ * adds them to the groups or adds the rows.
  * @param dbsList
- * @param dataGroupMap
+ * @param dateKey
+ * @param dateIndex
  */
 void
 S9sDbGrowthReport::applyFiltersAndGroups(const S9sVariantList &dbsList,
-                                         S9sVariantMap        &dataGroupMap,
-                                         const S9sString      &dateCreated)
+                                         int                   dateKey,
+                                         uint                  dateIndex)
 {
-    /*
-     * The flag for filtering pre-conditions with DB name.
-     */
     for(uint idxDbs = 0; idxDbs < dbsList.size(); ++idxDbs)
     {
-        S9sVariantMap   dbsMap  = dbsList[idxDbs].toVariantMap();
-        m_dbName = dbsMap["db_name"].toString();
+        const S9sVariantMap &dbsMap = dbsList[idxDbs].toVariantMap();
+        S9sString            dbName = valueOf(dbsMap, "db_name").toString();
+        GroupKey             key;
 
-        if ( m_dbNameFilterPreConditions &&
-             !m_dbName.toUpper().startsWith(m_dbNameOption.toUpper().c_str()))
+        /*
+         * The filter on the DB name is a case insensitive prefix.
+         */
+        if (m_dbNameFilterPreConditions &&
+             strncasecmp(STR(dbName), STR(m_dbNameOption), 
+                 m_dbNameOption.length()) != 0)
         {
             continue;
         }
+
         m_dbNameFilterDataFound = true;
 
+        key.date      = dateKey;
+        key.dbName    = -1;
+        key.tableName = -1;
+
         if(m_groupByDate)
         {
-            calculateGroupByDate(dataGroupMap, dbsMap, dateCreated);
+            addToGroup(key, dateIndex, 0ull,
+                       valueOf(dbsMap, "data_size").toULongLong(),
+                       valueOf(dbsMap, "index_size").toULongLong());
             continue;
         }
 
-        m_dbNameFormat.widen(m_dbName);
+        key.dbName = internName(dbName);
 
         if(m_groupByDbName)
         {
-            calculateGroupByDbName(dataGroupMap, dbsMap, dateCreated);
+            addToGroup(key, dateIndex,
+                       valueOf(dbsMap, "row_count").toULongLong(),
+                       valueOf(dbsMap, "data_size").toULongLong(),
+                       valueOf(dbsMap, "index_size").toULongLong());
             continue;
         }
 
-        const S9sVariantList &tablesList = dbsMap["tables"].toVariantList();
+        const S9sVariantList &tablesList = 
+            valueOf(dbsMap, "tables").toVariantList();
         /*
          * If tables were not found, adding the upper-level information
          */
         if(tablesList.empty())
         {
-            S9sVariantMap dataMap;
-            setDataMap(dataMap, dateCreated, m_dbName, "",
-                       dbsMap["row_count"].toULongLong(),
-                       dbsMap["data_size"].toULongLong(),
-                       dbsMap["index_size"].toULongLong());
-            m_dataReportList << dataMap;
-            m_nLines++;
+            addRow(dateIndex, key.dbName, -1,
+                   valueOf(dbsMap, "row_count").toULongLong(),
+                   valueOf(dbsMap, "data_size").toULongLong(),
+                   valueOf(dbsMap, "index_size").toULongLong());
         }
         /*
          * Filling up the detailed report, which includes tables' names and their data
          */
-        collectTablesData(tablesList, dateCreated);
+        collectTablesData(tablesList, dateKey, dateIndex, key.dbName);
     }
 }
 
 /**
- * Collects tables data and puts them to the flattened list.
+ * Collects tables data and adds them as rows.
  * @param tablesList
  */
 void
 S9sDbGrowthReport::collectTablesData(const S9sVariantList &tablesList,
-                                     const S9sString      &dateCreated)
+                                     int                   dateKey,
+                                     uint                  dateIndex,
+                                     int                   dbName)
 {
-    for(uint idxTables = 0; idxTables < tablesList.size(); ++idxTables) {
-        S9sVariantMap   tableMap   = tablesList[idxTables].toVariantMap();
-        const S9sString &tableName = tableMap["table_name"].toString();
-
-        m_tableNameFormat.widen(tableName);
-
-        S9sVariantMap  dataMap;
-        setDataMap(dataMap, dateCreated, m_dbName,
-                   tableName,
-                   tableMap["row_count"].toULongLong(),
-                   tableMap["data_size"].toULongLong(),
-                   tableMap["index_size"].toULongLong());
-        m_dataReportList << dataMap;
-        m_nLines++;
+    for(uint idxTables = 0; idxTables < tablesList.size(); ++idxTables) 
+    {
+        const S9sVariantMap &tableMap = tablesList[idxTables].toVariantMap();
+
+        addRow(dateIndex, dbName,
+               internName(valueOf(tableMap, "table_name").toString()),
+               valueOf(tableMap, "row_count").toULongLong(),
+               valueOf(tableMap, "data_size").toULongLong(),
+               valueOf(tableMap, "index_size").toULongLong());
     }
 }
 
 /**
- * Sets the data map that is being used in a final flattened list
- * @param map
- * @param date
- * @param dbName
- * @param tableName
- * @param tablesRows
- * @param dataSize
- * @param indexSize
+ * Adds one row to the report.
+ * @return The index of the new row.
+ */
+uint
+S9sDbGrowthReport::addRow(uint        dateIndex,
+                          int         dbName,
+                          int         tableName,
+                          ulonglong   tablesRows,
+                          ulonglong   dataSize,
+                          ulonglong   indexSize)
+{
+    m_rowDate.push_back(dateIndex);
+    m_rowDbName.push_back(dbName);
+    m_rowTableName.push_back(tableName);
+    m_rowTablesRows.push_back(tablesRows);
+    m_rowDataSize.push_back(dataSize);
+    m_rowIndexSize.push_back(indexSize);
+
+    return m_nLines++;
+}
+
+/**
+ * Adds the numbers to the row of the group, creates the row when the group is
+ * first seen. The date of the row is the date of the first record in the
+ * group.
  */
 void
-S9sDbGrowthReport::setDataMap(S9sVariantMap   &map,
-                              const S9sString &date,
-                              const S9sString &dbName,
-                              const S9sString &tableName,
+S9sDbGrowthReport::addToGroup(const GroupKey &key,
+                              uint            dateIndex,
                               ulonglong       tablesRows,
                               ulonglong       dataSize,
                               ulonglong       indexSize)
 {
-    map["date"] = date;
-    map["db_name"] = dbName;
-    map["table_name"] = tableName;
-    map["tables_rows"] = tablesRows;
-    map["data_size"] = dataSize;
-    map["index_size"] = indexSize;
-    map["total_size"] = dataSize + indexSize;
+    std::unordered_map<GroupKey, uint, GroupKeyHash>::iterator it;
+
+    it = m_groups.find(key);
+    if (it == m_groups.end())
+    {
+        m_groups[key] = addRow(dateIndex, key.dbName, key.tableName,
+                tablesRows, dataSize, indexSize);
+        return;
+    }
+
+    m_rowTablesRows[it->second] += tablesRows;
+    m_rowDataSize[it->second]   += dataSize;
+    m_rowIndexSize[it->second]  += indexSize;
 }
 
 /**
- * Groups the results by date
- * @param dataGroupMap
- * @param dbsMap
+ * @return The index of the name in the name table, the names are stored only
+ *   once.
  */
-void
-S9sDbGrowthReport::calculateGroupByDate(S9sVariantMap&    dataGroupMap,
-                                        S9sVariantMap&    dbsMap,
-                                        const S9sString   &dateCreated)
+int
+S9sDbGrowthReport::internName(const S9sString &name)
 {
-    ulonglong dataSize = 0;
-    ulonglong indexSize = 0;
-    S9sVariantMap  dataMap;
-    if(dataGroupMap.contains(m_dataDateWithoutTime.toString()))
-    {
-        dataMap = dataGroupMap[m_dataDateWithoutTime.toString()].toVariantMap();
-        dataSize = dataMap["data_size"].toULongLong();
-        indexSize = dataMap["index_size"].toULongLong();
-    }
-    else
-    {
-        dataMap["date_created"] = dateCreated;
-        dataMap["data_size"] = 0;
-        dataMap["index_size"] = 0;
-    }
-    dataSize += dbsMap["data_size"].toULongLong();
-    indexSize += dbsMap["index_size"].toULongLong();
-    dataMap["data_size"]  = dataSize;
-    dataMap["index_size"] = indexSize;
-    dataGroupMap[m_dataDateWithoutTime.toString()] = dataMap;
+    std::unordered_map<std::string, int>::iterator it;
+    int retval;
+
+    it = m_nameIndex.find(name);
+    if (it != m_nameIndex.end())
+        return it->second;
+
+    retval = m_names.size();
+    m_names << name;
+    m_nameIndex[name] = retval;
+
+    return retval;
+}
+
+const S9sString &
+S9sDbGrowthReport::name(int index) const
+{
+    static const S9sString empty;
+
+    return index < 0 ? empty : m_names[index];
 }
 
 /**
- * Groups the results by Db name
- * @param dataGroupMap
- * @param dbsMap
+ * Computes the rank of every date string (0 is the greatest), so the rows are
+ * sorted comparing integers.
  */
 void
-S9sDbGrowthReport::calculateGroupByDbName(S9sVariantMap   &dataGroupMap,
-                                          S9sVariantMap   &dbsMap,
-                                          const S9sString &dateCreated)
+S9sDbGrowthReport::rankDates()
 {
-    ulonglong dataSize = 0;
-    ulonglong indexSize = 0;
-    ulonglong rowCount = 0;
-    S9sVariantMap  dbMap;
-    S9sVariantMap  dataMap;
-    if(dataGroupMap.contains(m_dataDateWithoutTime.toString()))
-    {
-        dbMap = dataGroupMap[m_dataDateWithoutTime.toString()].toVariantMap();
-        if(dbMap.contains(m_dbName))
-        {
-            dataMap = dbMap[m_dbName].toVariantMap();
-        }
-        else
-        {
-            dataMap["date_created"] = dateCreated;
-            dataMap["data_size"] = 0;
-            dataMap["index_size"] = 0;
-            dataMap["row_count"] = 0;
-            dbMap[m_dbName] = dataMap;
-        }
-        dataSize = dataMap["data_size"].toULongLong();
-        indexSize = dataMap["index_size"].toULongLong();
-        rowCount = dataMap["row_count"].toULongLong();
-    }
-    else
+    S9sVector<S9sString> sorted = m_dates;
+
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    m_dateRanks.resize(m_dates.size());
+    for (uint idx = 0u; idx < m_dates.size(); ++idx)
     {
-        dataMap["date_created"] = dateCreated;
-        dataMap["data_size"] = 0;
-        dataMap["index_size"] = 0;
-        dataMap["row_count"] = 0;
-        dbMap[m_dbName] = dataMap;
+        S9sVector<S9sString>::iterator it = std::lower_bound(
+                sorted.begin(), sorted.end(), m_dates[idx]);
+
+        m_dateRanks[idx] = sorted.end() - it - 1;
     }
-    dataSize += dbsMap["data_size"].toULongLong();
-    indexSize += dbsMap["index_size"].toULongLong();
-    rowCount += dbsMap["row_count"].toULongLong();
-    dataMap["data_size"]  = dataSize;
-    dataMap["index_size"] = indexSize;
-    dataMap["row_count"]  = rowCount;
-    dbMap[m_dbName] = dataMap;
-    dataGroupMap[m_dataDateWithoutTime.toString()] = dbMap;
 }
 
 /**
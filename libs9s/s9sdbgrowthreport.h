@@ -19,7 +19,11 @@
  */
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "S9sVariantMap"
+#include "S9sVector"
 #include "S9sFormat"
 #include "S9sObject"
 #include "S9sFormatter"
@@ -31,6 +35,11 @@ class S9sDateTime;
 
 /**
  * A dedicated class for building and printing the detailed DbGrowth report.
+ *
+ * The rows of the report are stored as parallel arrays of plain numbers (one
+ * element per row in every array), the dates and the names are stored as
+ * indices. The grouping by date and by database name goes through a hash
+ * keyed by (date, database, table) so the sums are updated in place.
  */
 class S9sDbGrowthReport
 {
@@ -40,38 +49,81 @@ class S9sDbGrowthReport
         void printReport(const S9sVariant &data);
 
     private:
-        void initialize();
+        /**
+         * The key of the group-by hash: the date as a YYYYMMDD integer and the
+         * index of the database and table names, -1 where the level is
+         * summed up.
+         */
+        struct GroupKey
+        {
+            int date;
+            int dbName;
+            int tableName;
 
-        void prepareData(const S9sVariantList &dataList);
+            bool operator==(const GroupKey &rhs) const
+            {
+                return date == rhs.date && dbName == rhs.dbName &&
+                    tableName == rhs.tableName;
+            }
+        };
 
-        void filterDataWithGrouping(const S9sVariantList &dataList,
-                                    S9sVariantMap &dataGroupMap);
+        struct GroupKeyHash
+        {
+            size_t operator()(const GroupKey &key) const
+            {
+                size_t retval = (size_t) key.date;
 
-        void setDataMap(S9sVariantMap& map,
-                        const S9sString& date,
-                        const S9sString& dbName,
-                        const S9sString& tableName,
-                        ulonglong   tablesRows = 0,
-                        ulonglong   dataSize   = 0,
-                        ulonglong   indexSize  = 0);
+                retval = retval * 1000003u + (size_t) key.dbName;
+                retval = retval * 1000003u + (size_t) key.tableName;
+                return retval;
+            }
+        };
 
-        void calculateGroupByDate(S9sVariantMap&    dataGroupMap,
-                                  S9sVariantMap&    dbsMap,
-                                  const S9sString   &dateCreated);
+        /**
+         * Orders the row indices by total size and date, both descending.
+         */
+        class RowOrder
+        {
+            public:
+                RowOrder(const S9sDbGrowthReport &report) : 
+                    m_report(report) {}
 
-        void calculateGroupByDbName(S9sVariantMap&    dataGroupMap,
-                                    S9sVariantMap&    dbsMap,
-                                    const S9sString   &dateCreated);
+                bool operator()(uint a, uint b) const;
 
-        static bool compareDataByTotalSizeAndDate(const S9sVariant &a,
-                                                  const S9sVariant &b);
+            private:
+                const S9sDbGrowthReport &m_report;
+        };
+
+        void initialize();
+
+        void prepareData(const S9sVariantList &dataList);
 
         void applyFiltersAndGroups(const S9sVariantList &dbsList,
-                                   S9sVariantMap        &dataGroupMap,
-                                   const S9sString      &dateCreated);
+                                   int                   dateKey,
+                                   uint                  dateIndex);
 
         void collectTablesData(const S9sVariantList &tablesList,
-                               const S9sString      &dateCreated);
+                               int                   dateKey,
+                               uint                  dateIndex,
+                               int                   dbName);
+
+        uint addRow(uint        dateIndex,
+                    int         dbName,
+                    int         tableName,
+                    ulonglong   tablesRows = 0,
+                    ulonglong   dataSize   = 0,
+                    ulonglong   indexSize  = 0);
+
+        void addToGroup(const GroupKey &key,
+                        uint            dateIndex,
+                        ulonglong       tablesRows,
+                        ulonglong       dataSize,
+                        ulonglong       indexSize);
+
+        int internName(const S9sString &name);
+        const S9sString &name(int index) const;
+
+        void rankDates();
 
         const char *headerColorBegin() const;
         const char *headerColorEnd() const;
@@ -79,14 +131,11 @@ class S9sDbGrowthReport
     private:
         S9sOptions    *m_options;
         S9sString      m_dbNameOption;
-        S9sDateTime    m_dateOption;
+        int            m_dateOptionKey;
         S9sDateTime    m_dateTimeDaysAgo;
-        S9sDateTime    m_dataDateWithoutTime;
-        S9sString      m_dbName;
         S9sFormat      m_dateFormat;
         S9sFormat      m_dbNameFormat;
         S9sFormat      m_tableNameFormat;
-        S9sVariantList m_dataReportList;
         uint           m_nLines;
         bool           m_syntaxHighlight;
         bool           m_hasDbName;
@@ -95,4 +144,32 @@ class S9sDbGrowthReport
         bool           m_groupByDbName;
         bool           m_dbNameFilterPreConditions;
         bool           m_dbNameFilterDataFound;
-};
\ No newline at end of file
+
+        /*
+         * The rows of the report, one element for every row in each.
+         */
+        S9sVector<uint>       m_rowDate;
+        S9sVector<int>        m_rowDbName;
+        S9sVector<int>        m_rowTableName;
+        S9sVector<ulonglong>  m_rowTablesRows;
+        S9sVector<ulonglong>  m_rowDataSize;
+        S9sVector<ulonglong>  m_rowIndexSize;
+
+        /*
+         * The "created" strings of the source records and their rank in
+         * descending order used for sorting.
+         */
+        S9sVector<S9sString>  m_dates;
+        S9sVector<uint>       m_dateRanks;
+
+        /*
+         * The interned database and table names.
+         */
+        S9sVector<S9sString>                  m_names;
+        std::unordered_map<std::string, int>  m_nameIndex;
+
+        /*
+         * The group-by hash, the key is mapped to the row index.
+         */
+        std::unordered_map<GroupKey, uint, GroupKeyHash> m_groups;
+};
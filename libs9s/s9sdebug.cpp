@@ -1,7 +1,6 @@
 #include "s9sdebug.h"
 
-#include "S9sOptions"
-#include "S9sDateTime"
+#include "S9sLogger"
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -47,33 +46,15 @@ s9s_print_message (
 
 void
 s9s_log(
-        const char    *file,
-        const int      line,
-        const char    *formatstring,
+        S9sLogSeverity  severity,
+        const char     *file,
+        const int       line,
+        const char     *formatstring,
         ...)
 {
-    S9sOptions *options = S9sOptions::instance();
-    S9sString   fileName = options->logFile();
-    S9sString   logLine;
-    time_t      now = time(NULL);
+    va_list  args;
 
-    if (!fileName.empty())
-    {
-        FILE    *stream;
-        va_list  args;
-
-        stream = fopen(STR(fileName), "a");
-        if (stream == NULL)
-            return;
-
-        va_start(args, formatstring);
-        logLine.vsprintf(formatstring, args);
-        fprintf(stream, "%s %20s:%5d DEBUG %s\n", 
-                S9S_TIME_T(now), file, line, STR(logLine));
-        fflush(stream);
-        va_end(args);
-        
-        fclose(stream);
-    }
+    va_start(args, formatstring);
+    S9sLogger::instance()->log(severity, file, line, formatstring, args);
+    va_end(args);
 }
-
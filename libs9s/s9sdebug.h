@@ -30,16 +30,6 @@
 #  define CRITICAL
 #endif
 
-/**
- * Enum to be used as a severity level for debug messages.
- */
-typedef enum S9sMessageLevel
-{
-    DebugMsg,
-    SystemMsg,
-    WarningMsg
-} S9sMessageLevel;
-
 #undef S9S_DEBUG
 #ifdef DEBUG
 /**
@@ -80,6 +70,16 @@ typedef enum S9sMessageLevel
 /** Protector macro, dosygen complains about it if there is no documentation. */
 #define S9SDEBUG_H
 
+/**
+ * Enum to be used as a severity level for debug messages.
+ */
+typedef enum S9sMessageLevel
+{
+    DebugMsg,
+    SystemMsg,
+    WarningMsg
+} S9sMessageLevel;
+
 
 /** Clear until the end of line.*/
 #define TERM_ERASE_EOL "\033[K"
@@ -194,8 +194,35 @@ s9s_print_message (
         const char       *formatstring,
         ...);
 
+/**
+ * The severity of the messages in the s9s log file.
+ */
+typedef enum S9sLogSeverity
+{
+    LogDebug,
+    LogInfo,
+    LogWarning,
+    LogError,
+    /** Used as a threshold, nothing is logged. */
+    LogOff
+} S9sLogSeverity;
+
+/**
+ * The lowest severity that goes into the log file, LogOff while there is no log
+ * file. The macros check this before evaluating the arguments.
+ */
+extern int s9s_log_threshold;
+
+#ifdef S9S_NO_LOG
+#  define S9S_LOG(_severity, ...) ((void) 0)
+#else
+#  define S9S_LOG(_severity, ...) \
+    ((_severity) >= s9s_log_threshold ? \
+        s9s_log((_severity), __FILE__, __LINE__, __VA_ARGS__) : (void) 0)
+#endif
+
 #define PRINT_LOG(...) \
-    s9s_log(__FILE__, __LINE__, __VA_ARGS__)
+    S9S_LOG(LogDebug, __VA_ARGS__)
 
 /**
  * Printf messages to the s9s log file. This file is for debugging the s9s
@@ -203,9 +230,10 @@ s9s_print_message (
  */
 void
 s9s_log(
-        const char    *file,
-        const int      line,
-        const char    *formatstring,
+        S9sLogSeverity  severity,
+        const char     *file,
+        const int       line,
+        const char     *formatstring,
         ...);
 
 
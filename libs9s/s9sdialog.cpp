@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sdialog.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 
@@ -137,7 +138,7 @@ S9sDialog::refreshScreen()
         printLine(row - y());
     }
 
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
 void
@@ -147,7 +148,7 @@ S9sDialog::printLine(
     const char *normal     = m_normalColor; 
 
     m_nChars = 0;
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", normal);
 
     if (lineIndex == 0)
     {
@@ -217,14 +218,14 @@ S9sDialog::printLine(
         printChar("║");
     }
     
-    ::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("%s", TERM_NORMAL);
 }
 
 void
 S9sDialog::printChar(
         const char *c)
 {
-    ::printf("%s", c);
+    S9sOutput::printf("%s", c);
     ++m_nChars;
 ;}
 
@@ -235,7 +236,7 @@ S9sDialog::printChar(
 {
     while (m_nChars < lastColumn)
     {
-        ::printf("%s", c);
+        S9sOutput::printf("%s", c);
         ++m_nChars;
     }
 }
@@ -253,7 +254,7 @@ S9sDialog::printString(
     if ((int)theString.length() > availableChars)
         myString.resize(availableChars);
 
-    ::printf("%s", STR(myString));
+    S9sOutput::printf("%s", STR(myString));
     m_nChars += myString.length();
 }
 
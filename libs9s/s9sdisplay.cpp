@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sdisplay.h"
+#include "S9sOutput"
 
 #include "S9sOptions"
 #include "S9sCluster"
@@ -42,14 +43,15 @@ struct termios orig_termios1;
 void reset_terminal_mode()
 {
     tcsetattr(0, TCSANOW, &orig_termios1);
-    ::printf("%s", TERM_CURSOR_ON);
-    ::printf("%s", TERM_AUTOWRAP_ON);
+    S9sOutput::printf("%s", TERM_CURSOR_ON);
+    S9sOutput::printf("%s", TERM_AUTOWRAP_ON);
 
     // Disabling mouse tracking.
-    ::printf("%s", "\e[?9l");
+    S9sOutput::printf("%s", "\e[?9l");
 
     // Switch to the original buffer screen.
-    ::printf("%s", "\e[?47l");
+    S9sOutput::printf("%s", "\e[?47l");
+    S9sOutput::flush();
 }
 
 /**
@@ -166,7 +168,7 @@ S9sDisplay::gotoXy(
     S9sString sequence;
 
     sequence.sprintf("\033[%d;%dH", y, x);
-    ::printf("%s", STR(sequence));
+    S9sOutput::printf("%s", STR(sequence));
 }
 
 int 
@@ -200,10 +202,10 @@ S9sDisplay::exec()
                 uint y   = m_lastKeyCode.inputBuffer[5] - 32;
                 processButton(btn, x, y);
                 #if 0
-                ::printf ("\n\rbutton:%u\n\rx:%u\n\ry:%u\n\n\r", btn, x, y);
+                S9sOutput::printf ("\n\rbutton:%u\n\rx:%u\n\ry:%u\n\n\r", btn, x, y);
                 for (int idx = 0; idx < 6; ++idx)
                 {
-                    printf("[%d] 0x%x\n\r", 
+                    S9sOutput::printf("[%d] 0x%x\n\r", 
                             idx,
                             (int)m_lastKeyCode.inputBuffer[idx]);
                 }
@@ -215,6 +217,7 @@ S9sDisplay::exec()
             }
 
             refreshOk = refreshScreen();
+            S9sOutput::flush();
             refreshed = true;
             m_mutex.unlock();
         }
@@ -224,6 +227,7 @@ S9sDisplay::exec()
         {
             m_mutex.lock();
             refreshOk = refreshScreen();
+            S9sOutput::flush();
             m_mutex.unlock();
         }
             
@@ -264,8 +268,8 @@ S9sDisplay::printHeader()
 
     title = "S9S                ";
 
-    ::printf("%s%s%s ", bold, STR(title), normal);
-    ::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
+    S9sOutput::printf("%s%s%s ", bold, STR(title), normal);
+    S9sOutput::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
     printNewLine();
 }
 
@@ -280,16 +284,16 @@ S9sDisplay::printFooter()
 
     for (;m_lineCounter < height() - 1; ++m_lineCounter)
     {
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\n\r");
-        ::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
     } 
 
-    ::printf("%sQ%s-Quit ", bold, normal);
+    S9sOutput::printf("%sQ%s-Quit ", bold, normal);
 
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", TERM_NORMAL);
-    ::fflush(stdout);
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::flush();
 }
 
 void
@@ -372,7 +376,7 @@ S9sDisplay::startScreen()
 
     m_lineCounter = 0;
         
-    ::printf("%s", TERM_HOME);
+    S9sOutput::printf("%s", TERM_HOME);
 }
 
 /**
@@ -386,18 +390,18 @@ S9sDisplay::printMiddle(
 
     for (;m_lineCounter < height() / 2;)
     {
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\r\n");
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\r\n");
         ++m_lineCounter;
     }
 
     nSpaces = (width() - text.length()) / 2;
     for (;nSpaces > 0; --nSpaces)
-        ::printf(" ");
+        S9sOutput::printf(" ");
 
-    ::printf("%s", STR(text));
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("\r\n");
+    S9sOutput::printf("%s", STR(text));
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("\r\n");
     ++m_lineCounter;
 }
 
@@ -406,11 +410,11 @@ S9sDisplay::printNewLine()
 {
     if (m_rawTerminal)
     {
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\n\r");
-        ::printf("%s", TERM_NORMAL);
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_NORMAL);
     } else {
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
 
     ++m_lineCounter;
@@ -440,14 +444,18 @@ S9sDisplay::setConioTerminalMode(
 
     if (interactive)
     {
-        ::printf("%s", TERM_CURSOR_OFF);
-        ::printf("%s", TERM_AUTOWRAP_OFF);
+        S9sOutput::printf("%s", TERM_CURSOR_OFF);
+        S9sOutput::printf("%s", TERM_AUTOWRAP_OFF);
     
         // Switch to the alternate buffer screen
-        ::printf("%s", "\e[?47h");
+        S9sOutput::printf("%s", "\e[?47h");
 
         // Enable mouse tracking
-        ::printf("%s", "\e[?9h");
+        S9sOutput::printf("%s", "\e[?9h");
+
+        // The screen is flushed at once when it is fully printed.
+        S9sOutput::setLineBuffered(false);
+        S9sOutput::flush();
     }
 }
 
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sdisplayentry.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 
@@ -135,12 +136,12 @@ S9sDisplayEntry::print() const
     
     nChars = m_content.size();
 
-    ::printf("%s", selection);
-    ::printf("%s", STR(m_content));
+    S9sOutput::printf("%s", selection);
+    S9sOutput::printf("%s", STR(m_content));
 
     while (nChars < width())
     {
-        ::printf(" ");
+        S9sOutput::printf(" ");
         ++nChars;
     }
 }
@@ -156,9 +157,9 @@ S9sDisplayEntry::showCursor()
         return;
 
     sequence.sprintf("\033[%d;%dH", row, col);
-    ::printf("%s", STR(sequence));
-    ::printf("%s", TERM_CURSOR_ON);
+    S9sOutput::printf("%s", STR(sequence));
+    S9sOutput::printf("%s", TERM_CURSOR_ON);
 
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sdisplaylist.h"
+#include "S9sOutput"
 #include "S9sDisplay"
 
 S9sDisplayList::S9sDisplayList() :
@@ -172,7 +173,7 @@ S9sDisplayList::processKey(
             break;
 
         default:
-            ::printf(" %x ", key);
+            S9sOutput::printf(" %x ", key);
             //sleep(5);
     }
 }
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9seditor.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 #include "S9sUser"
@@ -353,7 +354,7 @@ S9sEditor::printLine(
     //const char *selection = "\033[1m\033[48;5;51m" "\033[2m\033[38;5;237m";
 
     m_nChars = 0;
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", normal);
     if (lineIndex == 0)
     {
         // The top frame line.
@@ -405,10 +406,10 @@ S9sEditor::printString(
     if ((int)asciiString.length() > availableChars)
     {
         asciiString.resize(availableChars);
-        ::printf("%s", STR(asciiString));
+        S9sOutput::printf("%s", STR(asciiString));
     } else {
-        ::printf("%s", STR(colorString));
-        ::printf("%s", normal);
+        S9sOutput::printf("%s", STR(colorString));
+        S9sOutput::printf("%s", normal);
     }
 
     m_nChars += asciiString.length();
@@ -418,7 +419,7 @@ void
 S9sEditor::printChar(
         int c)
 {
-    ::printf("%c", c);
+    S9sOutput::printf("%c", c);
     ++m_nChars;
 }
 
@@ -426,7 +427,7 @@ void
 S9sEditor::printChar(
         const char *c)
 {
-    ::printf("%s", c);
+    S9sOutput::printf("%s", c);
     ++m_nChars;
 }
 
@@ -437,7 +438,7 @@ S9sEditor::printChar(
 {
     while (m_nChars < lastColumn)
     {
-        ::printf("%s", c);
+        S9sOutput::printf("%s", c);
         ++m_nChars;
     }
 }
@@ -463,9 +464,9 @@ S9sEditor::showCursor()
         return;
 
     sequence.sprintf("\033[%d;%dH", row, col);
-    ::printf("%s", STR(sequence));
-    ::printf("%s", TERM_CURSOR_ON);
+    S9sOutput::printf("%s", STR(sequence));
+    S9sOutput::printf("%s", TERM_CURSOR_ON);
 
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sentrydialog.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 
@@ -69,7 +70,7 @@ S9sEntryDialog::refreshScreen()
 
     m_entry.setHasFocus(true);
     m_entry.showCursor();
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
 void
@@ -99,18 +100,18 @@ S9sEntryDialog::printLine(
     const char *normal     = m_normalColor; 
 
     m_nChars = 0;
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", normal);
 
     if (lineIndex == 2)
     {
         printChar("║");
         m_entry.print();
-        ::printf("%s", normal);
+        S9sOutput::printf("%s", normal);
         printChar("║");
     } else {
         S9sDialog::printLine(lineIndex);
     }
     
-    ::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("%s", TERM_NORMAL);
 }
 
@@ -804,6 +804,16 @@ S9sEvent::host() const
     return host;
 }
 
+/**
+ * \returns A view of the host in the event, the properties are not copied so
+ *   the view can only be used while the event exists.
+ */
+S9sNodeView
+S9sEvent::hostView() const
+{
+    return S9sNodeView(m_properties.valueByPath("/event_specifics/host"));
+}
+
 bool
 S9sEvent::hasServer() const
 {
@@ -849,6 +859,16 @@ S9sEvent::cluster() const
     return cluster;
 }
 
+/**
+ * \returns A view of the cluster in the event, the properties are not copied so
+ *   the view can only be used while the event exists.
+ */
+S9sClusterView
+S9sEvent::clusterView() const
+{
+    return S9sClusterView(m_properties.valueByPath("/event_specifics/cluster"));
+}
+
 bool
 S9sEvent::hasJob() const
 {
@@ -863,3 +883,13 @@ S9sEvent::job() const
 
     return job;
 }
+
+/**
+ * \returns A view of the job in the event, the properties are not copied so
+ *   the view can only be used while the event exists.
+ */
+S9sJobView
+S9sEvent::jobView() const
+{
+    return S9sJobView(m_properties.valueByPath("/event_specifics/job"));
+}
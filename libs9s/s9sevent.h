@@ -21,6 +21,9 @@
 
 #include "S9sObject"
 #include "S9sFormatter"
+#include "S9sNodeView"
+#include "S9sClusterView"
+#include "S9sJobView"
 
 class S9sNode;
 class S9sServer;
@@ -122,15 +125,18 @@ class S9sEvent : public S9sObject
 
         bool hasHost() const;
         S9sNode host() const;
+        S9sNodeView hostView() const;
         
         bool hasServer() const;
         S9sServer server() const;
 
         bool hasCluster() const;
         S9sCluster cluster() const;
+        S9sClusterView clusterView() const;
 
         bool hasJob() const;
         S9sJob job() const;
+        S9sJobView jobView() const;
 
     protected:
         S9sString eventLogToOneLiner() const;
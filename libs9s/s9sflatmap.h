@@ -0,0 +1,908 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sGlobal"
+#include "S9sString"
+#include "S9sVector"
+#include "S9sMutex"
+#include "S9sMutexLocker"
+
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * The maps with at most this many elements have no hash index, they are
+ * searched by simply comparing the keys one by one.
+ */
+#define S9S_FLAT_MAP_LINEAR_LIMIT 16
+
+template <typename Key, typename T, typename Hash> class S9sFlatMap;
+
+/**
+ * The iterator of the S9sFlatMap, it holds the position of the element in the
+ * vector of the map and steps to the next element in the order of the keys.
+ * The end iterator has the position -1.
+ */
+template <typename Map, typename Value>
+class S9sFlatMapIterator
+{
+    public:
+        typedef std::forward_iterator_tag  iterator_category;
+        typedef Value                      value_type;
+        typedef ptrdiff_t                  difference_type;
+        typedef Value                     *pointer;
+        typedef Value                     &reference;
+
+        S9sFlatMapIterator() : m_map(NULL), m_position(-1) {};
+
+        S9sFlatMapIterator(Map *map, int position) :
+            m_map(map), m_position(position) {};
+
+        /** The iterators can be converted to const iterators. */
+        template <typename OtherMap, typename OtherValue>
+        S9sFlatMapIterator(
+                const S9sFlatMapIterator<OtherMap, OtherValue> &orig) :
+            m_map(orig.map()), m_position(orig.position()) {};
+
+        Value &operator*() const
+            { return m_map->m_items[m_position]; };
+
+        Value *operator->() const
+            { return &m_map->m_items[m_position]; };
+
+        S9sFlatMapIterator &operator++()
+        {
+            m_position = m_map->nextPosition(m_position);
+            return *this;
+        };
+
+        S9sFlatMapIterator operator++(int)
+        {
+            S9sFlatMapIterator retval = *this;
+
+            m_position = m_map->nextPosition(m_position);
+            return retval;
+        };
+
+        template <typename OtherMap, typename OtherValue>
+        bool operator==(
+                const S9sFlatMapIterator<OtherMap, OtherValue> &rhs) const
+            { return m_position == rhs.position(); };
+
+        template <typename OtherMap, typename OtherValue>
+        bool operator!=(
+                const S9sFlatMapIterator<OtherMap, OtherValue> &rhs) const
+            { return m_position != rhs.position(); };
+
+        Map *map() const { return m_map; };
+        int position() const { return m_position; };
+
+    private:
+        Map *m_map;
+        int  m_position;
+};
+
+/**
+ * A map that keeps the elements in one vector, an alternative of the
+ * std::map for the many objects of the controller replies.
+ *
+ * The small maps keep the elements sorted by the key and are searched by
+ * comparing the keys one by one (with the S9sInternedString keys mostly
+ * only the pointers are compared). The bigger maps append the new elements
+ * to the end of the vector and have an open addressing hash index holding
+ * the positions of the elements, so inserting is amortized O(1). The erased
+ * elements of a big map are only marked and removed from the index, the
+ * vector is compacted when the erased elements outnumber the others.
+ *
+ * The iteration is always in the order of the keys, just like with the
+ * std::map. If the elements of a big map are not in order the sorted order
+ * is created when the map is iterated and kept until the map is changed.
+ * This is done under a lock, so the const maps can be read by many threads.
+ *
+ * The iterators and the references to the elements are invalidated when the
+ * map is modified, except that erase() returns a valid iterator to the next
+ * element.
+ *
+ * The Hash type is a function object returning the hash value of a key, the
+ * keys has to be comparable with the == and the < operators.
+ */
+template <typename Key, typename T, typename Hash>
+class S9sFlatMap
+{
+    public:
+        typedef S9sFlatMap<Key, T, Hash>                         Map;
+        typedef Key                                              key_type;
+        typedef T                                                mapped_type;
+        typedef std::pair<Key, T>                                value_type;
+        typedef size_t                                           size_type;
+        typedef S9sFlatMapIterator<Map, value_type>              iterator;
+        typedef S9sFlatMapIterator<const Map, const value_type>  const_iterator;
+
+        S9sFlatMap();
+        S9sFlatMap(const Map &orig);
+        S9sFlatMap(Map &&orig) noexcept;
+        ~S9sFlatMap();
+
+        Map &operator=(const Map &rhs);
+        Map &operator=(Map &&rhs) noexcept;
+
+        iterator begin() { return iterator(this, firstPosition()); };
+        iterator end() { return iterator(this, -1); };
+        const_iterator begin() const
+            { return const_iterator(this, firstPosition()); };
+        const_iterator end() const { return const_iterator(this, -1); };
+
+        bool empty() const { return size() == 0u; };
+        size_type size() const { return m_items.size() - m_nErased; };
+        void clear();
+        void swap(Map &other);
+
+        bool contains(const Key &key) const;
+        size_type count(const Key &key) const;
+        S9sVector<Key> keys() const;
+
+        iterator find(const Key &key);
+        const_iterator find(const Key &key) const;
+
+        T &at(const Key &key);
+        const T &at(const Key &key) const;
+        T &operator[](const Key &key);
+
+        std::pair<iterator, bool> insert(const value_type &value);
+        size_type erase(const Key &key);
+        iterator erase(iterator position);
+
+        bool operator==(const Map &other) const;
+        bool operator!=(const Map &other) const;
+
+    private:
+        /**
+         * The sorted order of the elements of a big map that is not in order.
+         */
+        struct Order
+        {
+            /** The positions of the elements sorted by the keys. */
+            std::vector<int> positions;
+            /** The index in the positions for every position. */
+            std::vector<int> ranks;
+            /** Where the first not erased element is in the positions. */
+            int              first;
+        };
+
+        /** Compares the elements at two positions by their keys. */
+        struct PositionLess
+        {
+            PositionLess(const std::vector<value_type> &items) :
+                m_items(items) {};
+
+            bool operator()(int lhs, int rhs) const
+                { return m_items[lhs].first < m_items[rhs].first; };
+
+            const std::vector<value_type> &m_items;
+        };
+
+        bool isBig() const { return !m_index.empty(); };
+        inline bool isErased(int position) const;
+
+        int indexOf(const Key &key) const;
+        int lowerBound(const Key &key) const;
+        int insertNew(const value_type &value);
+        int erasePosition(int position);
+
+        int firstPosition() const;
+        int nextPosition(int position) const;
+        const Order &order() const;
+        void invalidateOrder();
+
+        void addToIndex(int position);
+        void removeFromIndex(int position);
+        void rebuildIndex();
+        void compact();
+
+        static S9sMutex &orderMutex();
+
+    private:
+        std::vector<value_type>      m_items;
+        std::vector<int>             m_index;
+        /** Marks the erased elements of the big maps, empty if there is none. */
+        std::vector<char>            m_erased;
+        uint                         m_nErased;
+        /** True if the elements are in the order of the keys in the vector. */
+        bool                         m_inOrder;
+        /** The first not erased element if the map is in order. */
+        int                          m_firstPosition;
+        mutable std::atomic<Order *> m_order;
+
+        friend class S9sFlatMapIterator<Map, value_type>;
+        friend class S9sFlatMapIterator<const Map, const value_type>;
+};
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash>::S9sFlatMap() :
+    m_nErased(0u),
+    m_inOrder(true),
+    m_firstPosition(0),
+    m_order(NULL)
+{
+}
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash>::S9sFlatMap(
+        const Map &orig) :
+    m_items(orig.m_items),
+    m_index(orig.m_index),
+    m_erased(orig.m_erased),
+    m_nErased(orig.m_nErased),
+    m_inOrder(orig.m_inOrder),
+    m_firstPosition(orig.m_firstPosition),
+    m_order(NULL)
+{
+    Order *order = orig.m_order.load(std::memory_order_acquire);
+
+    if (order != NULL)
+        m_order.store(new Order(*order), std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash>::S9sFlatMap(
+        Map &&orig) noexcept :
+    m_nErased(0u),
+    m_inOrder(true),
+    m_firstPosition(0),
+    m_order(NULL)
+{
+    swap(orig);
+}
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash>::~S9sFlatMap()
+{
+    delete m_order.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash> &
+S9sFlatMap<Key, T, Hash>::operator=(
+        const Map &rhs)
+{
+    if (this != &rhs)
+    {
+        Map copy(rhs);
+
+        swap(copy);
+    }
+
+    return *this;
+}
+
+template <typename Key, typename T, typename Hash>
+S9sFlatMap<Key, T, Hash> &
+S9sFlatMap<Key, T, Hash>::operator=(
+        Map &&rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        clear();
+        swap(rhs);
+    }
+
+    return *this;
+}
+
+template <typename Key, typename T, typename Hash>
+void
+S9sFlatMap<Key, T, Hash>::clear()
+{
+    m_items.clear();
+    m_index.clear();
+    m_erased.clear();
+    m_nErased       = 0u;
+    m_inOrder       = true;
+    m_firstPosition = 0;
+    invalidateOrder();
+}
+
+template <typename Key, typename T, typename Hash>
+void
+S9sFlatMap<Key, T, Hash>::swap(
+        Map &other)
+{
+    Order *order = m_order.load(std::memory_order_relaxed);
+
+    m_items.swap(other.m_items);
+    m_index.swap(other.m_index);
+    m_erased.swap(other.m_erased);
+    std::swap(m_nErased, other.m_nErased);
+    std::swap(m_inOrder, other.m_inOrder);
+    std::swap(m_firstPosition, other.m_firstPosition);
+
+    m_order.store(
+            other.m_order.load(std::memory_order_relaxed),
+            std::memory_order_relaxed);
+
+    other.m_order.store(order, std::memory_order_relaxed);
+}
+
+/**
+ * \returns true if the map contains an element with the given key
+ */
+template <typename Key, typename T, typename Hash>
+inline bool
+S9sFlatMap<Key, T, Hash>::contains(
+        const Key &key) const
+{
+    return indexOf(key) >= 0;
+}
+
+template <typename Key, typename T, typename Hash>
+inline typename S9sFlatMap<Key, T, Hash>::size_type
+S9sFlatMap<Key, T, Hash>::count(
+        const Key &key) const
+{
+    return indexOf(key) >= 0 ? 1u : 0u;
+}
+
+/**
+ * \returns a list that holds all the keys from the map in order
+ */
+template <typename Key, typename T, typename Hash>
+S9sVector<Key>
+S9sFlatMap<Key, T, Hash>::keys() const
+{
+    S9sVector<Key> retval;
+
+    retval.reserve(size());
+    for (const_iterator it = begin(); it != end(); ++it)
+        retval.push_back(it->first);
+
+    return retval;
+}
+
+template <typename Key, typename T, typename Hash>
+inline typename S9sFlatMap<Key, T, Hash>::iterator
+S9sFlatMap<Key, T, Hash>::find(
+        const Key &key)
+{
+    return iterator(this, indexOf(key));
+}
+
+template <typename Key, typename T, typename Hash>
+inline typename S9sFlatMap<Key, T, Hash>::const_iterator
+S9sFlatMap<Key, T, Hash>::find(
+        const Key &key) const
+{
+    return const_iterator(this, indexOf(key));
+}
+
+/**
+ * \returns The element with the given key, throws std::out_of_range if there
+ *   is no such element (as std::map::at() does).
+ */
+template <typename Key, typename T, typename Hash>
+T &
+S9sFlatMap<Key, T, Hash>::at(
+        const Key &key)
+{
+    int idx = indexOf(key);
+
+    if (idx < 0)
+        throw std::out_of_range("S9sFlatMap::at");
+
+    return m_items[idx].second;
+}
+
+template <typename Key, typename T, typename Hash>
+const T &
+S9sFlatMap<Key, T, Hash>::at(
+        const Key &key) const
+{
+    int idx = indexOf(key);
+
+    if (idx < 0)
+        throw std::out_of_range("S9sFlatMap::at");
+
+    return m_items[idx].second;
+}
+
+/**
+ * \returns The element with the given key, a default constructed element is
+ *   added if there is no such element.
+ */
+template <typename Key, typename T, typename Hash>
+T &
+S9sFlatMap<Key, T, Hash>::operator[](
+        const Key &key)
+{
+    int idx = indexOf(key);
+
+    if (idx < 0)
+        idx = insertNew(value_type(key, T()));
+
+    return m_items[idx].second;
+}
+
+template <typename Key, typename T, typename Hash>
+std::pair<typename S9sFlatMap<Key, T, Hash>::iterator, bool>
+S9sFlatMap<Key, T, Hash>::insert(
+        const value_type &value)
+{
+    int idx = indexOf(value.first);
+
+    if (idx >= 0)
+        return std::make_pair(iterator(this, idx), false);
+
+    idx = insertNew(value);
+    return std::make_pair(iterator(this, idx), true);
+}
+
+/**
+ * \returns How many elements were removed (0 or 1).
+ */
+template <typename Key, typename T, typename Hash>
+typename S9sFlatMap<Key, T, Hash>::size_type
+S9sFlatMap<Key, T, Hash>::erase(
+        const Key &key)
+{
+    int idx = indexOf(key);
+
+    if (idx < 0)
+        return 0u;
+
+    erasePosition(idx);
+    return 1u;
+}
+
+/**
+ * \returns The iterator of the element following the erased one.
+ */
+template <typename Key, typename T, typename Hash>
+typename S9sFlatMap<Key, T, Hash>::iterator
+S9sFlatMap<Key, T, Hash>::erase(
+        iterator position)
+{
+    return iterator(this, erasePosition(position.position()));
+}
+
+/**
+ * The elements are compared one by one in the order of the keys.
+ */
+template <typename Key, typename T, typename Hash>
+bool
+S9sFlatMap<Key, T, Hash>::operator==(
+        const Map &other) const
+{
+    if (size() != other.size())
+        return false;
+
+    return std::equal(begin(), end(), other.begin());
+}
+
+template <typename Key, typename T, typename Hash>
+bool
+S9sFlatMap<Key, T, Hash>::operator!=(
+        const Map &other) const
+{
+    return !(*this == other);
+}
+
+template <typename Key, typename T, typename Hash>
+inline bool
+S9sFlatMap<Key, T, Hash>::isErased(
+        int position) const
+{
+    return !m_erased.empty() && m_erased[position];
+}
+
+/**
+ * \returns The position of the element with the given key or -1 if there is
+ *   no such element.
+ */
+template <typename Key, typename T, typename Hash>
+inline int
+S9sFlatMap<Key, T, Hash>::indexOf(
+        const Key &key) const
+{
+    if (!isBig())
+    {
+        for (uint idx = 0u; idx < m_items.size(); ++idx)
+        {
+            if (m_items[idx].first == key)
+                return idx;
+        }
+
+        return -1;
+    }
+
+    const size_t mask = m_index.size() - 1;
+
+    for (size_t slot = Hash()(key) & mask; ; slot = (slot + 1) & mask)
+    {
+        int idx = m_index[slot];
+
+        if (idx < 0 || m_items[idx].first == key)
+            return idx;
+    }
+
+    return -1;
+}
+
+/**
+ * \returns The position where an element with the given key should be
+ *   inserted to keep the vector of a small map sorted.
+ */
+template <typename Key, typename T, typename Hash>
+int
+S9sFlatMap<Key, T, Hash>::lowerBound(
+        const Key &key) const
+{
+    int first = 0;
+    int last  = m_items.size();
+
+    // Appending is the most common case.
+    if (last == 0 || m_items[last - 1].first < key)
+        return last;
+
+    while (first < last)
+    {
+        int middle = first + (last - first) / 2;
+
+        if (m_items[middle].first < key)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return first;
+}
+
+/**
+ * Adds an element that is not in the map yet. A small map inserts it at its
+ * place in the order, when it grows too big it gets a hash index. A big map
+ * appends the element and adds it to the index, the index is rebuilt only
+ * when it becomes half full.
+ *
+ * \returns The position of the new element.
+ */
+template <typename Key, typename T, typename Hash>
+int
+S9sFlatMap<Key, T, Hash>::insertNew(
+        const value_type &value)
+{
+    int position;
+
+    invalidateOrder();
+
+    if (!isBig())
+    {
+        position = lowerBound(value.first);
+        m_items.insert(m_items.begin() + position, value);
+
+        if (m_items.size() > S9S_FLAT_MAP_LINEAR_LIMIT)
+            rebuildIndex();
+
+        return position;
+    }
+
+    if (m_inOrder && !(m_items.back().first < value.first))
+        m_inOrder = false;
+
+    position = m_items.size();
+    m_items.push_back(value);
+
+    if (!m_erased.empty())
+        m_erased.push_back(false);
+
+    if (size() * 2 > m_index.size())
+        rebuildIndex();
+    else
+        addToIndex(position);
+
+    return position;
+}
+
+/**
+ * Erases the element at the given position. A small map simply removes it
+ * from the vector, a big map marks it as erased and removes it from the hash
+ * index, the order of the others stays valid.
+ *
+ * \returns The position of the next element in order or -1 if it was the
+ *   last.
+ */
+template <typename Key, typename T, typename Hash>
+int
+S9sFlatMap<Key, T, Hash>::erasePosition(
+        int position)
+{
+    int next;
+
+    if (!isBig())
+    {
+        invalidateOrder();
+        m_items.erase(m_items.begin() + position);
+
+        return position < (int) m_items.size() ? position : -1;
+    }
+
+    next = nextPosition(position);
+
+    removeFromIndex(position);
+    if (m_erased.empty())
+        m_erased.assign(m_items.size(), false);
+
+    m_erased[position] = true;
+    ++m_nErased;
+
+    // Releasing the value, the key is kept for checking the order.
+    m_items[position].second = T();
+
+    if (m_inOrder)
+    {
+        if (position == m_firstPosition)
+            m_firstPosition = next < 0 ? m_items.size() : next;
+    } else {
+        Order *order = m_order.load(std::memory_order_relaxed);
+
+        if (order != NULL && order->ranks[position] == order->first)
+            order->first = next < 0 ? order->positions.size() :
+                order->ranks[next];
+    }
+
+    if (m_nErased > size())
+    {
+        Key nextKey;
+
+        if (next >= 0)
+            nextKey = m_items[next].first;
+
+        compact();
+
+        next = next < 0 ? -1 : indexOf(nextKey);
+    }
+
+    return next;
+}
+
+/**
+ * \returns The position of the first element in order, -1 if the map is
+ *   empty.
+ */
+template <typename Key, typename T, typename Hash>
+int
+S9sFlatMap<Key, T, Hash>::firstPosition() const
+{
+    if (m_inOrder)
+    {
+        for (int position = m_firstPosition;
+                position < (int) m_items.size(); ++position)
+        {
+            if (!isErased(position))
+                return position;
+        }
+
+        return -1;
+    }
+
+    const Order &theOrder = order();
+
+    for (uint rank = theOrder.first; rank < theOrder.positions.size(); ++rank)
+    {
+        if (!isErased(theOrder.positions[rank]))
+            return theOrder.positions[rank];
+    }
+
+    return -1;
+}
+
+/**
+ * \returns The position of the element following the element at the given
+ *   position in order, -1 if it was the last.
+ */
+template <typename Key, typename T, typename Hash>
+int
+S9sFlatMap<Key, T, Hash>::nextPosition(
+        int position) const
+{
+    if (m_inOrder)
+    {
+        while (++position < (int) m_items.size())
+        {
+            if (!isErased(position))
+                return position;
+        }
+
+        return -1;
+    }
+
+    const Order &theOrder = order();
+
+    for (uint rank = theOrder.ranks[position] + 1;
+            rank < theOrder.positions.size(); ++rank)
+    {
+        if (!isErased(theOrder.positions[rank]))
+            return theOrder.positions[rank];
+    }
+
+    return -1;
+}
+
+/**
+ * \returns The sorted order of the elements, created if the map changed since
+ *   it was last iterated. The order is published through an atomic pointer,
+ *   so the threads reading the same const map do not need the lock once it
+ *   is created.
+ */
+template <typename Key, typename T, typename Hash>
+const typename S9sFlatMap<Key, T, Hash>::Order &
+S9sFlatMap<Key, T, Hash>::order() const
+{
+    Order *retval = m_order.load(std::memory_order_acquire);
+
+    if (retval != NULL)
+        return *retval;
+
+    S9sMutexLocker locker(orderMutex());
+
+    retval = m_order.load(std::memory_order_relaxed);
+    if (retval != NULL)
+        return *retval;
+
+    retval = new Order;
+    retval->first = 0;
+    retval->positions.reserve(size());
+
+    for (uint position = 0u; position < m_items.size(); ++position)
+    {
+        if (!isErased(position))
+            retval->positions.push_back(position);
+    }
+
+    std::sort(
+            retval->positions.begin(), retval->positions.end(),
+            PositionLess(m_items));
+
+    retval->ranks.assign(m_items.size(), -1);
+    for (uint rank = 0u; rank < retval->positions.size(); ++rank)
+        retval->ranks[retval->positions[rank]] = rank;
+
+    m_order.store(retval, std::memory_order_release);
+    return *retval;
+}
+
+template <typename Key, typename T, typename Hash>
+inline void
+S9sFlatMap<Key, T, Hash>::invalidateOrder()
+{
+    Order *order = m_order.load(std::memory_order_relaxed);
+
+    if (order != NULL)
+    {
+        delete order;
+        m_order.store(NULL, std::memory_order_relaxed);
+    }
+}
+
+template <typename Key, typename T, typename Hash>
+inline void
+S9sFlatMap<Key, T, Hash>::addToIndex(
+        int position)
+{
+    const size_t mask = m_index.size() - 1;
+    size_t       slot = Hash()(m_items[position].first) & mask;
+
+    while (m_index[slot] >= 0)
+        slot = (slot + 1) & mask;
+
+    m_index[slot] = position;
+}
+
+/**
+ * Removes the position from the hash index moving back the elements of the
+ * probe sequence that follows it, so the index needs no deleted markers.
+ */
+template <typename Key, typename T, typename Hash>
+void
+S9sFlatMap<Key, T, Hash>::removeFromIndex(
+        int position)
+{
+    const size_t mask = m_index.size() - 1;
+    size_t       hole = Hash()(m_items[position].first) & mask;
+
+    while (m_index[hole] != position)
+        hole = (hole + 1) & mask;
+
+    for (size_t slot = (hole + 1) & mask; m_index[slot] >= 0;
+            slot = (slot + 1) & mask)
+    {
+        size_t home = Hash()(m_items[m_index[slot]].first) & mask;
+
+        // The element can be moved back if its home is not after the hole.
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            m_index[hole] = m_index[slot];
+            hole          = slot;
+        }
+    }
+
+    m_index[hole] = -1;
+}
+
+/**
+ * Creates the hash index with room for twice as many elements as the map
+ * has, so it is at most a quarter full when it is created.
+ */
+template <typename Key, typename T, typename Hash>
+void
+S9sFlatMap<Key, T, Hash>::rebuildIndex()
+{
+    size_t capacity = 64u;
+
+    while (capacity < size() * 4)
+        capacity *= 2;
+
+    m_index.assign(capacity, -1);
+
+    for (uint position = 0u; position < m_items.size(); ++position)
+    {
+        if (!isErased(position))
+            addToIndex(position);
+    }
+}
+
+/**
+ * Removes the erased elements from the vector and puts the others in order.
+ * If the map became small it drops the hash index.
+ */
+template <typename Key, typename T, typename Hash>
+void
+S9sFlatMap<Key, T, Hash>::compact()
+{
+    std::vector<value_type> items;
+
+    items.reserve(size());
+
+    for (iterator it = begin(); it != end(); ++it)
+        items.push_back(std::move(*it));
+
+    invalidateOrder();
+    m_items.swap(items);
+    m_erased.clear();
+    m_nErased       = 0u;
+    m_inOrder       = true;
+    m_firstPosition = 0;
+
+    if (m_items.size() > S9S_FLAT_MAP_LINEAR_LIMIT)
+        rebuildIndex();
+    else
+        m_index.clear();
+}
+
+template <typename Key, typename T, typename Hash>
+S9sMutex &
+S9sFlatMap<Key, T, Hash>::orderMutex()
+{
+    static S9sMutex retval;
+
+    return retval;
+}
@@ -18,6 +18,7 @@
  * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sformat.h"
+#include "S9sOutput"
 
 #include <stdio.h>
 #include "S9sOptions"
@@ -251,23 +252,12 @@ void
 S9sFormat::printf(
         const int value) const
 {
-    S9sString formatString;
+    char buffer[32];
 
-    if (m_width > 0)
-    {
-        formatString.sprintf("%%%dd", m_width);
-    } else {
-        formatString.sprintf("%%d", m_width);
-    }
-
-    if (m_withFieldSeparator)
-        formatString += " ";
-
-    ::printf(STR(formatString), value);
+    snprintf(buffer, sizeof(buffer), "%d", value);
+    printAligned(buffer, true, false);
 }
 
-
-
 /**
  * Prints the value to the standard output, then prints the field separator.
  */
@@ -275,17 +265,10 @@ void
 S9sFormat::printf(
         const ulonglong value) const
 {
-    S9sString formatString;
-
-    if (m_width > 0)
-        formatString.sprintf("%%%dllu", m_width);
-    else
-        formatString.sprintf("%%llu");
-
-    if (m_withFieldSeparator)
-        formatString += " ";
+    char buffer[32];
 
-    ::printf(STR(formatString), value);
+    snprintf(buffer, sizeof(buffer), "%llu", value);
+    printAligned(buffer, true, false);
 }
 
 void
@@ -293,24 +276,7 @@ S9sFormat::printf(
         const double value,
         bool         color) const
 {
-    S9sString myValue = toString(value);
-    S9sString formatString;
-
-    if (m_width > 0)
-        formatString.sprintf("%%%ds", m_width);
-    else
-        formatString.sprintf("%%s");
-
-    if (m_withFieldSeparator)
-        formatString += " ";
-    
-    if (color && m_colorStart != NULL)
-        ::printf("%s", m_colorStart);
-
-    ::printf(STR(formatString), STR(myValue));
-
-    if (color && m_colorEnd != NULL)
-        ::printf("%s", m_colorEnd);
+    printAligned(toString(value), true, color);
 }
 
 /**
@@ -321,61 +287,65 @@ S9sFormat::printf(
         const S9sString &value,
         bool             color) const
 {
-    S9sString formatString;
-    S9sString myValue = value;
+    if (m_width > 0 && m_ellipsize && (int) value.length() > m_width)
+    {
+        S9sString myValue = value;
 
-    if (m_width > 0)
+        myValue.resize(m_width - 1);
+        myValue += "…";
+        printAligned(myValue, m_alignment == AlignRight, color);
+    } else if (m_width > 0 && m_alignment == AlignCenter)
     {
-        if (m_ellipsize)
-        {
-            if ((int) myValue.length() > m_width)
-            {
-                myValue.resize(m_width - 1);
-                myValue += "…";
-            }
-        }
+        S9sString alignString;
 
-        switch (m_alignment)
+        if (m_width > (int) value.terminalLength())
         {
-            case AlignRight:
-                formatString.sprintf("%%%ds", m_width);
-                break;
-            
-            case AlignLeft:
-                formatString.sprintf("%%-%ds", m_width);
-                break;
-            
-            case AlignCenter:
-                {
-                    S9sString alignString;
-
-                    if (m_width > (int) myValue.terminalLength())
-                    {
-                        alignString = 
-                            S9sString(" ") * 
-                            ((m_width - myValue.terminalLength()) / 2);
-                    }
-               
-                    myValue = alignString + myValue;
-
-                    formatString.sprintf("%%-%ds", m_width);
-                }
-                break;
+            alignString = 
+                S9sString(" ") * ((m_width - value.terminalLength()) / 2);
         }
+
+        printAligned(alignString + value, false, color);
     } else {
-        formatString = "%s";
+        printAligned(value, m_alignment == AlignRight, color);
     }
+}
 
-    if (m_withFieldSeparator)
-        formatString += " ";
+/**
+ * \param value The text to print.
+ * \param alignRight True to put the padding before the text.
+ * \param color If the color sequences should be printed around the field.
+ *
+ * Pads the value with spaces to the width of the format (counting bytes, just
+ * like the printf() "%-10s" would) and sends the field to the output buffer
+ * in one piece.
+ */
+void
+S9sFormat::printAligned(
+        const S9sString &value,
+        bool             alignRight,
+        bool             color) const
+{
+    S9sString field;
+    int       nSpaces = m_width - (int) value.length();
 
     if (color && m_colorStart != NULL)
-        ::printf("%s", m_colorStart);
+        field += m_colorStart;
 
-    ::printf(STR(formatString), STR(myValue));
+    if (alignRight && nSpaces > 0)
+        field.append(nSpaces, ' ');
+
+    field += value;
+
+    if (!alignRight && nSpaces > 0)
+        field.append(nSpaces, ' ');
+
+    if (m_withFieldSeparator)
+        field += ' ';
 
     if (color && m_colorEnd != NULL)
-        ::printf("%s", m_colorEnd);
+        field += m_colorEnd;
+
+    S9sOutput::write(field);
 }
 
 void
@@ -77,6 +77,12 @@ class S9sFormat
 
         static S9sString toSizeString(const ulonglong value);
 
+    private:
+        void printAligned(
+                const S9sString &value,
+                bool             alignRight,
+                bool             color) const;
+
     private:
         Unit        m_unit;
         bool        m_humanreadable;
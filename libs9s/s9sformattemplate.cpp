@@ -0,0 +1,235 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sformattemplate.h"
+
+#include "S9sMap"
+#include "S9sMutex"
+#include "S9sMutexLocker"
+
+#include <string.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sFormatTemplate::Part::Part() :
+    directive('\0'),
+    modifier('\0')
+{
+}
+
+S9sFormatTemplate::S9sFormatTemplate()
+{
+}
+
+/**
+ * \param formatString The format string as the user provided it.
+ * \param modifiers The characters that are modifiers and not directives when
+ *   found after the '%' character (e.g. "f" for the node format where "%fm"
+ *   is the free memory).
+ */
+S9sFormatTemplate::S9sFormatTemplate(
+        const S9sString &formatString,
+        const char      *modifiers)
+{
+    compile(formatString, modifiers);
+}
+
+/**
+ * \returns How many parts (literals and fields) the template has.
+ */
+uint
+S9sFormatTemplate::size() const
+{
+    return m_parts.size();
+}
+
+const S9sFormatTemplate::Part &
+S9sFormatTemplate::part(
+        const uint index) const
+{
+    return m_parts[index];
+}
+
+/**
+ * \returns A reference to the compiled version of the format string.
+ *
+ * The compiled templates are cached for the lifetime of the process, so the
+ * format string of a command is compiled only once no matter how many objects
+ * are printed with it. The cache never drops entries, the returned reference
+ * remains valid.
+ */
+const S9sFormatTemplate &
+S9sFormatTemplate::compiled(
+        const S9sString &formatString,
+        const char      *modifiers)
+{
+    static S9sMutex  mutex;
+    static S9sMap<S9sString, S9sMap<S9sString, S9sFormatTemplate> > cache;
+    S9sMutexLocker   locker(mutex);
+    S9sMap<S9sString, S9sFormatTemplate> &templates = cache[modifiers];
+    S9sMap<S9sString, S9sFormatTemplate>::iterator it;
+
+    it = templates.find(formatString);
+    if (it == templates.end())
+    {
+        it = templates.insert(std::make_pair(
+                    formatString, 
+                    S9sFormatTemplate(formatString, modifiers))).first;
+    }
+
+    return it->second;
+}
+
+/**
+ * Splits the format string into parts, this is the same parsing the
+ * toString() methods used to do character by character for every object.
+ */
+void
+S9sFormatTemplate::compile(
+        const S9sString &formatString,
+        const char      *modifiers)
+{
+    S9sString literal;
+    S9sString prefix;
+    char      modifier = '\0';
+    bool      percent  = false;
+    bool      escaped  = false;
+    char      c;
+
+    m_parts.clear();
+
+    for (uint n = 0; n < formatString.size(); ++n)
+    {
+        c = formatString[n];
+       
+        if (c == '%' && !percent)
+        {
+            percent = true;
+            prefix  = "%";
+            continue;
+        } else if (percent && c != '\0' && strchr(modifiers, c) != NULL)
+        {
+            modifier = c;
+            continue;
+        } else if (c == '\\' && !escaped)
+        {
+            escaped = true;
+            continue;
+        }
+
+        if (escaped)
+        {
+            switch (c)
+            {
+                case '\"':
+                    literal += '\"';
+                    break;
+
+                case '\\':
+                    literal += '\\';
+                    break;
+       
+                case 'a':
+                    literal += '\a';
+                    break;
+
+                case 'b':
+                    literal += '\b';
+                    break;
+
+                case 'e':
+                    literal += '\027';
+                    break;
+
+                case 'n':
+                    literal += '\n';
+                    break;
+
+                case 'r':
+                    literal += '\r';
+                    break;
+
+                case 't':
+                    literal += '\t';
+                    break;
+            }
+        } else if (percent)
+        {
+            switch (c)
+            {
+                case '%':
+                    literal += '%';
+                    break;
+
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                case '5':
+                case '6':
+                case '7':
+                case '8':
+                case '9':
+                case '-':
+                case '+':
+                case '.':
+                case '\'':
+                    prefix += c;
+                    continue;
+
+                default:
+                    {
+                        Part field;
+
+                        addLiteral(literal);
+
+                        field.prefix    = prefix;
+                        field.directive = c;
+                        field.modifier  = modifier;
+                        m_parts << field;
+                    }
+            }
+        } else {
+            literal += c;
+        }
+
+        percent  = false;
+        escaped  = false;
+        modifier = '\0';
+    }
+
+    addLiteral(literal);
+}
+
+void
+S9sFormatTemplate::addLiteral(
+        S9sString &literal)
+{
+    Part part;
+
+    if (literal.empty())
+        return;
+
+    part.literal = literal;
+    m_parts << part;
+    literal.clear();
+}
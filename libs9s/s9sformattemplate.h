@@ -0,0 +1,74 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+
+/**
+ * A format string like the one passed in the --node-format or --cluster-format
+ * command line options, split into literal text and fields only once. The
+ * toString() methods of the objects can then walk through the parts and print
+ * the fields without parsing the format string again for every object.
+ *
+ * The literal parts have the backslash escapes and the "%%" sequences already
+ * resolved. The field parts hold the directive character (e.g. 'N' in
+ * "%-10N"), the printf() style prefix without the conversion ("%-10") and the
+ * modifier character if one was found (e.g. 'f' in "%fm").
+ */
+class S9sFormatTemplate
+{
+    public:
+        class Part
+        {
+            public:
+                Part();
+
+                bool isLiteral() const { return directive == '\0'; };
+
+                /** The text of a literal part. */
+                S9sString   literal;
+                /** The printf() prefix of a field, e.g. "%-10". */
+                S9sString   prefix;
+                /** The directive of a field, '\0' for literals. */
+                char        directive;
+                /** The modifier of a field or '\0' if there is none. */
+                char        modifier;
+        };
+
+        S9sFormatTemplate();
+        S9sFormatTemplate(
+                const S9sString &formatString,
+                const char      *modifiers = "");
+
+        uint size() const;
+        const Part &part(const uint index) const;
+
+        static const S9sFormatTemplate &compiled(
+                const S9sString &formatString,
+                const char      *modifiers = "");
+
+    private:
+        void compile(const S9sString &formatString, const char *modifiers);
+        void addLiteral(S9sString &literal);
+
+    private:
+        S9sVector<Part>  m_parts;
+};
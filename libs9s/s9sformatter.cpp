@@ -2,6 +2,7 @@
  * Copyright (C) 2016-present severalnines.com
  */
 #include "s9sformatter.h"
+#include "S9sOutput"
 
 #include "S9sOptions"
 #include "S9sFormat"
@@ -502,59 +503,59 @@ S9sFormatter::printObjectStat(
     //
     // "    Name: 192.168.0.128"
     //
-    printf("%s    Name:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s    Name:%s ", greyBegin, greyEnd);
     // FIXME: the color should depend on the class
-    printf("%s", objectColorBegin(object));
-    printf("%-32s ", STR(object.name()));
-    printf("%s", objectColorEnd());
+    S9sOutput::printf("%s", objectColorBegin(object));
+    S9sOutput::printf("%-32s ", STR(object.name()));
+    S9sOutput::printf("%s", objectColorEnd());
     
-    printf("\n");
+    S9sOutput::printf("\n");
    
     //
     // "CDT path: /ft_ndb_6776"
     //
-    printf("%sCDT path:%s ", greyBegin, greyEnd);
-    printf("%s", folderColorBegin());
-    printf("%-32s ", STR(object.cdtPath()));
-    printf("%s", folderColorEnd());
-    printf("\n");
+    S9sOutput::printf("%sCDT path:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", folderColorBegin());
+    S9sOutput::printf("%-32s ", STR(object.cdtPath()));
+    S9sOutput::printf("%s", folderColorEnd());
+    S9sOutput::printf("\n");
     
     //
     // "   Class: CmonNdbHost                          Owner: pipas/testgroup"
     //
-    printf("%s   Class:%s ", greyBegin, greyEnd);
-    printf("%s%-33s%s ", 
+    S9sOutput::printf("%s   Class:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-33s%s ", 
             typeColorBegin(), 
             STR(object.className()), 
             typeColorEnd());
     
-    printf("%s   Owner:%s ", greyBegin, greyEnd);
-    printf("%s%s%s/%s%s%s ", 
+    S9sOutput::printf("%s   Owner:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%s%s/%s%s%s ", 
             userColorBegin(), STR(object.ownerName()), userColorEnd(),
             groupColorBegin(object.groupOwnerName()), 
             STR(object.groupOwnerName()), 
             groupColorEnd());
     
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // "      ID: -                                      ACL: rwxrw----"
     //
-    printf("%s      ID:%s ", greyBegin, greyEnd);
-    printf("%-38s", STR(object.id("-")));
+    S9sOutput::printf("%s      ID:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-38s", STR(object.id("-")));
 
-    printf("%s ACL:%s ", greyBegin, greyEnd);
-    printf("%s", STR(object.aclShortString()));
+    S9sOutput::printf("%s ACL:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(object.aclShortString()));
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // The tags.
     //
-    printf("%s    Tags:%s ", greyBegin, greyEnd);
-    printf("%s", STR(object.tags(useSyntaxHighLight(), "-")));
+    S9sOutput::printf("%s    Tags:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(object.tags(useSyntaxHighLight(), "-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 void 
@@ -575,90 +576,90 @@ S9sFormatter::printUserStat(
     else
         title.sprintf("%s", STR(user.userName()));
 
-    printf("%s", TERM_INVERSE);
-    printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
     for (int n = title.length(); n < terminalWidth; ++n)
-        printf(" ");
-    printf("%s", TERM_NORMAL);
-    printf("\n");
+        S9sOutput::printf(" ");
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("\n");
    
     printObjectStat(user);
  
     //
     // "Fullname: László Pere                  Email: laszlo@severalnines.com"
     //
-    printf("%sFullname:%s ", greyBegin, greyEnd);
-    printf("%-28s ", STR(user.fullName("-")));
-    printf("\n");
+    S9sOutput::printf("%sFullname:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-28s ", STR(user.fullName("-")));
+    S9sOutput::printf("\n");
    
     //
     // "   Email: -"
     //
-    printf("%s   Email:%s ", greyBegin, greyEnd);
-    printf("%s ", STR(user.emailAddress("-")));
-    printf("\n");
+    S9sOutput::printf("%s   Email:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s ", STR(user.emailAddress("-")));
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s   DName:%s ", greyBegin, greyEnd);
-    printf("%s ", STR(user.distinguishedName("-")));
-    printf("\n");
+    S9sOutput::printf("%s   DName:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s ", STR(user.distinguishedName("-")));
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s  Origin:%s ", greyBegin, greyEnd);
-    printf("%s ", STR(user.origin("-")));
-    printf("\n");
+    S9sOutput::printf("%s  Origin:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s ", STR(user.origin("-")));
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%sDisabled:%s ", greyBegin, greyEnd);
-    printf("%s", user.isDisabled() ? "yes" : "no");
-    printf("\n");
+    S9sOutput::printf("%sDisabled:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", user.isDisabled() ? "yes" : "no");
+    S9sOutput::printf("\n");
 
     
     //
     // " Suspend: no                   Failed logins: 0"
     //
-    printf("%s Suspend:%s ", greyBegin, greyEnd);
-    printf("%-19s ", user.isSuspended() ? "yes" : "no");
+    S9sOutput::printf("%s Suspend:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-19s ", user.isSuspended() ? "yes" : "no");
     
-    printf("%s         Failed logins:%s ", greyBegin, greyEnd);
-    printf("%d", user.nFailedLogins());
-    printf("\n");
+    S9sOutput::printf("%s         Failed logins:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%d", user.nFailedLogins());
+    S9sOutput::printf("\n");
     
     //
     // "  Groups: users"
     //
-    printf("%s  Groups:%s ", greyBegin, greyEnd);
-    printf("%-30s ", STR(user.groupNames(", ")));
-    printf("\n");
+    S9sOutput::printf("%s  Groups:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-30s ", STR(user.groupNames(", ")));
+    S9sOutput::printf("\n");
 
     //
     // " Created: 2017-10-26T12:08:55.945Z"
     //
-    printf("%s Created:%s ", greyBegin, greyEnd);
-    printf("%-30s ", STR(user.createdString("-")));
-    printf("\n");
+    S9sOutput::printf("%s Created:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-30s ", STR(user.createdString("-")));
+    S9sOutput::printf("\n");
 
     //
     // "   Login: 2017-10-26T12:10:37.762Z"
     //
-    printf("%s   Login:%s ", greyBegin, greyEnd);
-    printf("%-30s ", STR(user.lastLoginString("-")));
-    printf("\n");
+    S9sOutput::printf("%s   Login:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-30s ", STR(user.lastLoginString("-")));
+    S9sOutput::printf("\n");
     
     //
     // 
     //
-    printf("%s Failure:%s ", greyBegin, greyEnd);
-    printf("%-24s ", STR(user.failedLoginString("-")));
+    S9sOutput::printf("%s Failure:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-24s ", STR(user.failedLoginString("-")));
     
     
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -686,201 +687,201 @@ S9sFormatter::printNodeStat(
     else
         title.sprintf(" %s ", STR(node.name()));
 
-    printf("%s", TERM_INVERSE/*headerColorBegin()*/);
-    printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE/*headerColorBegin()*/);
+    S9sOutput::printf("%s", STR(title));
     for (int n = title.length(); n < terminalWidth; ++n)
-        printf(" ");
-    printf("%s", TERM_NORMAL /*headerColorEnd()*/);
-    printf("\n");
+        S9sOutput::printf(" ");
+    S9sOutput::printf("%s", TERM_NORMAL /*headerColorEnd()*/);
+    S9sOutput::printf("\n");
 
     printObjectStat(node);
     
     //
     //
     //
-    ::printf("%s      IP:%s ", greyBegin, greyEnd);
-    ::printf("%s", ipColorBegin(node.ipAddress()));
-    ::printf("%-27s ", STR(node.ipAddress()));
-    ::printf("%s", ipColorEnd());
+    S9sOutput::printf("%s      IP:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", ipColorBegin(node.ipAddress()));
+    S9sOutput::printf("%-27s ", STR(node.ipAddress()));
+    S9sOutput::printf("%s", ipColorEnd());
     //printf("\n");
     
-    printf("          %sPort:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("          %sPort:%s ", greyBegin, greyEnd);
     if (node.hasPort())
-    printf("%d ", node.port());
-    printf("\n");
+    S9sOutput::printf("%d ", node.port());
+    S9sOutput::printf("\n");
     
     // 
     // 
     //
-    printf("%s   Alias:%s ", greyBegin, greyEnd);
-    printf("%-34s", STR(node.alias("-")));
+    S9sOutput::printf("%s   Alias:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-34s", STR(node.alias("-")));
     //printf("\n");
     
-    printf("%s Cluster:%s ", greyBegin, greyEnd);
-    printf("%s%s%s (%d) ", 
+    S9sOutput::printf("%s Cluster:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%s%s (%d) ", 
             clusterColorBegin(), 
             STR(cluster.name()), 
             clusterColorEnd(),
             cluster.clusterId());
-    printf("\n");
+    S9sOutput::printf("\n");
      
     #if 0
     //
     // "   Class: CmonPostgreSqlHost         Type: postgres"
     //
-    printf("%s   Class:%s ", greyBegin, greyEnd);
-    printf("%s%-35s%s ", 
+    S9sOutput::printf("%s   Class:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-35s%s ", 
             typeColorBegin(), 
             STR(node.className()), 
             typeColorEnd());
     
-    printf("%s  Type:%s ", greyBegin, greyEnd);
-    printf("%s", STR(node.nodeType()));
-    printf("\n");
+    S9sOutput::printf("%s  Type:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(node.nodeType()));
+    S9sOutput::printf("\n");
     #endif
 
     //
     //
     //
-    ::printf("%s  Status:%s ", greyBegin, greyEnd);
-    ::printf("%s", hostStateColorBegin(node.hostStatus()));
-    ::printf("%-35s", STR(node.hostStatus()));
-    ::printf("%s", hostStateColorEnd());
+    S9sOutput::printf("%s  Status:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", hostStateColorBegin(node.hostStatus()));
+    S9sOutput::printf("%-35s", STR(node.hostStatus()));
+    S9sOutput::printf("%s", hostStateColorEnd());
     
-    printf("   %sRole:%s ", greyBegin, greyEnd);
-    printf("%s", STR(node.role()));
-    printf("\n");
+    S9sOutput::printf("   %sRole:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(node.role()));
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s      OS:%s ", greyBegin, greyEnd);
-    printf("%-35s", STR(node.osVersionString()));
+    S9sOutput::printf("%s      OS:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-35s", STR(node.osVersionString()));
 
-    printf("%s Access:%s ", greyBegin, greyEnd);
-    printf("%s", node.readOnly() ? "read-only" : "read-write");
+    S9sOutput::printf("%s Access:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", node.readOnly() ? "read-only" : "read-write");
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
-    printf("%s   VM ID:%s ", greyBegin, greyEnd);
-    printf("%s", STR(node.containerId("-")));
-    printf("\n");
+    S9sOutput::printf("%s   VM ID:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(node.containerId("-")));
+    S9sOutput::printf("\n");
 
     //  Version: 1.4.7
-    printf("%s Version:%s ", greyBegin, greyEnd);
-    printf("%s", STR(node.version()));
-    printf("\n");
+    S9sOutput::printf("%s Version:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(node.version()));
+    S9sOutput::printf("\n");
 
 
     // A line for the human readable message.
     message = node.message();
     if (message.empty())
         message = "-";
-    printf("%s Message:%s ", greyBegin, greyEnd);
-    printf("%s", STR(message));
-    printf("\n");
+    S9sOutput::printf("%s Message:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(message));
+    S9sOutput::printf("\n");
    
     slavesAsString = node.slavesAsString();
     if (!slavesAsString.empty())
     {
-        printf("%s  Slaves:%s ", greyBegin, greyEnd);
-        printf("%s", STR(slavesAsString));
-        printf("\n");
+        S9sOutput::printf("%s  Slaves:%s ", greyBegin, greyEnd);
+        S9sOutput::printf("%s", STR(slavesAsString));
+        S9sOutput::printf("\n");
     }
 
     /*
      * Last seen time and SSH fail count.
      */
-    printf("%sLastSeen:%s ", greyBegin, greyEnd);
-    printf("%-38s", STR(S9sString::pastTime(node.lastSeen())));
+    S9sOutput::printf("%sLastSeen:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-38s", STR(S9sString::pastTime(node.lastSeen())));
     //printf("\n");
     
-    printf("%s SSH:%s ", greyBegin, greyEnd);
-    printf("%d ", node.sshFailCount());
-    printf("%sfail(s)%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s SSH:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%d ", node.sshFailCount());
+    S9sOutput::printf("%sfail(s)%s ", greyBegin, greyEnd);
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // A line of switches.
     //
-    printf("%s Connect:%s %c ", 
+    S9sOutput::printf("%s Connect:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.readOnly()));
 
-    printf("%sMaintenance:%s %c ", 
+    S9sOutput::printf("%sMaintenance:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.isMaintenanceActive()));
     
-    printf("%sManaged:%s %c ", 
+    S9sOutput::printf("%sManaged:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.managed()));
     
-    printf("%sRecovery:%s %c ", 
+    S9sOutput::printf("%sRecovery:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.nodeAutoRecovery()));
 
-    printf("%sSkip DNS:%s %c ", 
+    S9sOutput::printf("%sSkip DNS:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.skipNameResolve()));
     
-    printf("%sSuperReadOnly:%s %c ", 
+    S9sOutput::printf("%sSuperReadOnly:%s %c ", 
             greyBegin, greyEnd, 
             BoolToHuman(node.superReadOnly()));
 
     
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
     if (node.pid() > 0)
     {
-        printf("%s     Pid:%s %d", 
+        S9sOutput::printf("%s     Pid:%s %d", 
                 greyBegin, greyEnd, 
                 node.pid());
     } else {
-        printf("%s     PID:%s -", greyBegin, greyEnd);
+        S9sOutput::printf("%s     PID:%s -", greyBegin, greyEnd);
     }
     
-    printf("  %sUptime:%s %s", 
+    S9sOutput::printf("  %sUptime:%s %s", 
             greyBegin, greyEnd, 
             STR(S9sString::uptime(node.uptime())));
     
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // Lines of various files.
     //
-    printf("%s  Config:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s  Config:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(node.configFile()),
             STR(node.configFile()),
             fileColorEnd());
-    printf("\n");
+    S9sOutput::printf("\n");
     
-    printf("%s LogFile:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s LogFile:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(node.logFile()),
             STR(node.logFile()),
             fileColorEnd());
-    printf("\n");
+    S9sOutput::printf("\n");
 
-    printf("%s PidFile:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s PidFile:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(node.pidFile()),
             STR(node.pidFile()),
             fileColorEnd());
-    printf("\n");
+    S9sOutput::printf("\n");
     
-    printf("%s DataDir:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s DataDir:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             XTERM_COLOR_BLUE,
             STR(node.dataDir()),
             TERM_NORMAL);
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     printBackendServersSubList(node);
 }
@@ -917,83 +918,83 @@ S9sFormatter::printServerStat(
                 STR(server.hostName()), STR(server.ipAddress()));
     }
 
-    printf("%s", TERM_INVERSE);
-    printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
     for (int n = title.length(); n < terminalWidth; ++n)
-        printf(" ");
-    printf("%s", TERM_NORMAL);
-    printf("\n");
+        S9sOutput::printf(" ");
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("\n");
 
     printObjectStat(server);
 
     //
     // "      IP: 192.168.1.4"
     //
-    printf("%s      IP:%s ", greyBegin, greyEnd);
-    printf("%s%-33s%s ", 
+    S9sOutput::printf("%s      IP:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-33s%s ", 
             ipColorBegin(server.ipAddress()),
             STR(server.ipAddress()),
             ipColorEnd());
 
-    printf("%sProtocol:%s ", greyBegin, greyEnd);
-    printf("%-25s ", STR(server.protocol()));
+    S9sOutput::printf("%sProtocol:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-25s ", STR(server.protocol()));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s  Status:%s ", greyBegin, greyEnd);
-    printf("%s%-24s%s ", 
+    S9sOutput::printf("%s  Status:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-24s%s ", 
             hostStateColorBegin(server.hostStatus()),
             STR(server.hostStatus()),
             hostStateColorEnd());
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // ""
     //
-    printf("%s      OS:%s ", greyBegin, greyEnd);
-    printf("%-24s", STR(server.osVersionString("-")));
-    printf("\n");
+    S9sOutput::printf("%s      OS:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-24s", STR(server.osVersionString("-")));
+    S9sOutput::printf("\n");
     
 
     // 
     // "   Alias: ''                        Owner: pipas/users" 
     //
-    printf("%s   Alias:%s ", greyBegin, greyEnd);
-    printf("%-16s ", STR(server.alias("-")));
+    S9sOutput::printf("%s   Alias:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-16s ", STR(server.alias("-")));
     //printf("\n");
     
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // "   Model: SUN FIRE X4170 SERVER (4583256-1)"
     //
-    printf("%s   Model:%s ", greyBegin, greyEnd);
-    printf("%-16s ", STR(server.model("-")));
-    printf("\n");
+    S9sOutput::printf("%s   Model:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-16s ", STR(server.model("-")));
+    S9sOutput::printf("\n");
 
     //
     //
     //
-    printf("%s Summary:%s ", greyBegin, greyEnd);
-    printf("%2d VMs", server.nContainers());
-    printf(", %.0fGB RAM", server.totalMemoryGBytes());
-    printf(", %d CPUs", server.nCpus());
-    printf(", %d cores", server.nCores());
-    printf(", %d threads", server.nThreads());
-    printf("\n");
+    S9sOutput::printf("%s Summary:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d VMs", server.nContainers());
+    S9sOutput::printf(", %.0fGB RAM", server.totalMemoryGBytes());
+    S9sOutput::printf(", %d CPUs", server.nCpus());
+    S9sOutput::printf(", %d cores", server.nCores());
+    S9sOutput::printf(", %d threads", server.nThreads());
+    S9sOutput::printf("\n");
 
     //
     //
     //
-    printf("%s  Limits:%s ", greyBegin, greyEnd);
-    printf("%s/%s VMs", 
+    S9sOutput::printf("%s  Limits:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s/%s VMs", 
             STR(server.nContainersMaxString()),
             STR(server.nRunningContainersMaxString()));
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // "  CPU(s): 2 x Intel(R) Xeon(R) CPU L5520 @ 2.27GHz"
@@ -1002,12 +1003,12 @@ S9sFormatter::printServerStat(
     {
         if (idx == 0u)
         {
-            printf("%s  CPU(s):%s ", greyBegin, greyEnd);
+            S9sOutput::printf("%s  CPU(s):%s ", greyBegin, greyEnd);
         } else {
-            printf("          ");
+            S9sOutput::printf("          ");
         }
 
-        printf("%s\n", STR(processorNames[idx].toString()));
+        S9sOutput::printf("%s\n", STR(processorNames[idx].toString()));
     }
 
     //
@@ -1017,12 +1018,12 @@ S9sFormatter::printServerStat(
     {
         if (idx == 0u)
         {
-            printf("%s  NIC(s):%s ", greyBegin, greyEnd);
+            S9sOutput::printf("%s  NIC(s):%s ", greyBegin, greyEnd);
         } else {
-            printf("          ");
+            S9sOutput::printf("          ");
         }
 
-        printf("%s\n", STR(nicNames[idx].toString()));
+        S9sOutput::printf("%s\n", STR(nicNames[idx].toString()));
     }
     
     //
@@ -1032,12 +1033,12 @@ S9sFormatter::printServerStat(
     {
         if (idx == 0u)
         {
-            printf("%s   Banks:%s ", greyBegin, greyEnd);
+            S9sOutput::printf("%s   Banks:%s ", greyBegin, greyEnd);
         } else {
-            printf("          ");
+            S9sOutput::printf("          ");
         }
 
-        printf("%s\n", STR(bankNames[idx].toString()));
+        S9sOutput::printf("%s\n", STR(bankNames[idx].toString()));
     }
 
     //
@@ -1047,22 +1048,22 @@ S9sFormatter::printServerStat(
     {
         if (idx == 0u)
         {
-            printf("%s   Disks:%s ", greyBegin, greyEnd);
+            S9sOutput::printf("%s   Disks:%s ", greyBegin, greyEnd);
         } else {
-            printf("          ");
+            S9sOutput::printf("          ");
         }
 
-        printf("%s\n", STR(diskNames[idx].toString()));
+        S9sOutput::printf("%s\n", STR(diskNames[idx].toString()));
     }
         
     //
     //
     //
-    printf("\n");
+    S9sOutput::printf("\n");
     containers = server.containers();
     printContainersCompact(containers);
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -1092,41 +1093,41 @@ S9sFormatter::printControllerStat(
                 STR(controller.hostName()), STR(controller.ipAddress()));
     }
 
-    printf("%s", TERM_INVERSE);
-    printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
     for (int n = title.length(); n < terminalWidth; ++n)
-        printf(" ");
-    printf("%s", TERM_NORMAL);
-    printf("\n");
+        S9sOutput::printf(" ");
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("\n");
 
     printObjectStat(controller);
 
     //
     // "      IP: 192.168.1.4"
     //
-    printf("%s      IP:%s ", greyBegin, greyEnd);
-    printf("%s%-33s%s ", 
+    S9sOutput::printf("%s      IP:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-33s%s ", 
             ipColorBegin(controller.ipAddress()),
             STR(controller.ipAddress()),
             ipColorEnd());
 
-    printf("%s    Port:%s ", greyBegin, greyEnd);
-    printf("%d ", controller.port());
+    S9sOutput::printf("%s    Port:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%d ", controller.port());
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // "  Status: CmonHostOnline                        Role: follower"
     //
-    printf("%s  Status:%s ", greyBegin, greyEnd);
-    printf("%s%-35s%s ", 
+    S9sOutput::printf("%s  Status:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-35s%s ", 
             hostStateColorBegin(controller.hostStatus()),
             STR(controller.hostStatus()),
             hostStateColorEnd());
 
-    printf("  %sRole:%s ", greyBegin, greyEnd);
-    printf("%s", STR(controller.role()));
-    printf("\n");
+    S9sOutput::printf("  %sRole:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(controller.role()));
+    S9sOutput::printf("\n");
     
     //
     // ""
@@ -1138,50 +1139,50 @@ S9sFormatter::printControllerStat(
     //
     // "     PID: 51836 "
     //
-    printf("%s     PID:%s ", greyBegin, greyEnd);
-    printf("%-6d", controller.pid());
-    printf("\n");
+    S9sOutput::printf("%s     PID:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-6d", controller.pid());
+    S9sOutput::printf("\n");
 
     // 
     // "   Alias: ''                        Owner: pipas/users" 
     //
-    printf("%s   Alias:%s ", greyBegin, greyEnd);
-    printf("%-16s ", STR(controller.alias("-")));
-    printf("\n");
+    S9sOutput::printf("%s   Alias:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-16s ", STR(controller.alias("-")));
+    S9sOutput::printf("\n");
     
     //
     // "  Config: 'configs/FtFull.conf'"
     //
-    printf("%s  Config:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s  Config:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(controller.configFile()),
             STR(controller.configFile()),
             fileColorEnd());
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // " DataDir: '/tmp/cmon/controller3/var/lib/cmon'"
     //
-    printf("%s DataDir:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s DataDir:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             XTERM_COLOR_BLUE,
             STR(controller.dataDir()),
             TERM_NORMAL);
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // " LogFile: './cmon-ft-install.log'"
     //
-    printf("%s LogFile:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s LogFile:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(controller.logFile()),
             STR(controller.logFile()),
             fileColorEnd());
-    printf("\n");
+    S9sOutput::printf("\n");
 
     
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -1203,84 +1204,84 @@ S9sFormatter::printClusterStat(
     //
     title.sprintf(" %s ", STR(cluster.name()));
 
-    ::printf("%s", TERM_INVERSE);
-    ::printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
     
     for (int n = title.length(); n < terminalWidth; ++n)
-        ::printf(" ");
+        S9sOutput::printf(" ");
 
-    ::printf("\n");
-    ::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("\n");
+    S9sOutput::printf("%s", TERM_NORMAL);
    
     printObjectStat(cluster);
 
     //
     // 
     //
-    printf("%s  Status:%s ", greyBegin, greyEnd);
-    printf("%s%s%s ", 
+    S9sOutput::printf("%s  Status:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%s%s ", 
             clusterStateColorBegin(cluster.state()), 
             STR(cluster.state()),
             clusterStateColorEnd());
-    printf("\n");
+    S9sOutput::printf("\n");
     
-    printf("%s    Type:%s ", greyBegin, greyEnd);
-    printf("%-32s ", STR(cluster.clusterType()));
+    S9sOutput::printf("%s    Type:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-32s ", STR(cluster.clusterType()));
     
-    printf("%s   Vendor:%s ", greyBegin, greyEnd);
-    printf("%s", STR(cluster.vendorAndVersion()));
-    printf("\n");
+    S9sOutput::printf("%s   Vendor:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(cluster.vendorAndVersion()));
+    S9sOutput::printf("\n");
     
-    printf("%s  Status:%s ", greyBegin, greyEnd);
-    printf("%s", STR(cluster.statusText()));
-    printf("\n");
+    S9sOutput::printf("%s  Status:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(cluster.statusText()));
+    S9sOutput::printf("\n");
 
     //
     // Counting the alarms.
     //
-    printf("%s  Alarms:%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.alarmsCritical());
-    printf("%scrit %s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.alarmsWarning());
-    printf("%swarn %s ", greyBegin, greyEnd);
-    printf("\n");
+    S9sOutput::printf("%s  Alarms:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.alarmsCritical());
+    S9sOutput::printf("%scrit %s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.alarmsWarning());
+    S9sOutput::printf("%swarn %s ", greyBegin, greyEnd);
+    S9sOutput::printf("\n");
 
     //
     // Counting the jobs.
     //
-    printf("%s    Jobs:%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsAborted());
-    printf("%sabort%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsDefined());
-    printf("%sdefnd%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsDequeued());
-    printf("%sdequd%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsFailed());
-    printf("%sfaild%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsFinished());
-    printf("%sfinsd%s ", greyBegin, greyEnd);
-    printf("%2d ", cluster.jobsRunning());
-    printf("%srunng%s ", greyBegin, greyEnd);
-    printf("\n");
+    S9sOutput::printf("%s    Jobs:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsAborted());
+    S9sOutput::printf("%sabort%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsDefined());
+    S9sOutput::printf("%sdefnd%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsDequeued());
+    S9sOutput::printf("%sdequd%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsFailed());
+    S9sOutput::printf("%sfaild%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsFinished());
+    S9sOutput::printf("%sfinsd%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%2d ", cluster.jobsRunning());
+    S9sOutput::printf("%srunng%s ", greyBegin, greyEnd);
+    S9sOutput::printf("\n");
     
     //
     // Lines of various files.
     //
-    printf("%s  Config:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s  Config:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(cluster.configFile()),
             STR(cluster.configFile()),
             fileColorEnd());
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
-    printf("%s LogFile:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s LogFile:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(cluster.logFile()),
             STR(cluster.logFile()),
             fileColorEnd());
-    printf("\n");
-    printf("\n");
+    S9sOutput::printf("\n");
+    S9sOutput::printf("\n");
 
     printHostTable(cluster);
     printReplicationTable(cluster);
@@ -1311,11 +1312,11 @@ S9sFormatter::printContainerStat(
                 STR(container.ipAddress(addressType)));
     }
 
-    printf("%s", TERM_INVERSE);
-    printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
     for (int n = title.length(); n < terminalWidth; ++n)
-        printf(" ");
-    printf("%s\n", TERM_NORMAL);
+        S9sOutput::printf(" ");
+    S9sOutput::printf("%s\n", TERM_NORMAL);
     
     printObjectStat(container);
 
@@ -1323,115 +1324,115 @@ S9sFormatter::printContainerStat(
     //
     // "    IPv4: 54.93.99.244                          Type: cmon-cloud"
     //
-    printf("%s    IPv4:%s ", greyBegin, greyEnd);
-    printf("%-37s", STR(container.ipv4Addresses()));
+    S9sOutput::printf("%s    IPv4:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-37s", STR(container.ipv4Addresses()));
 
-    printf("%s Type:%s ", greyBegin, greyEnd);
-    printf("%s", STR(container.type()));
+    S9sOutput::printf("%s Type:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(container.type()));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
     tmp = container.ipAddress(S9s::PublicIpv4Address, "-");
-    printf("%sPublicIp:%s ", greyBegin, greyEnd);
-    printf("%s%-33s%s", ipColorBegin(tmp), STR(tmp), ipColorEnd(tmp));
+    S9sOutput::printf("%sPublicIp:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%-33s%s", ipColorBegin(tmp), STR(tmp), ipColorEnd(tmp));
 
     tmp = container.ipAddress(S9s::PrivateIpv4Address, "-");
-    printf("%sPrivateIp:%s ", greyBegin, greyEnd);
-    printf("%s%s%s", ipColorBegin(tmp), STR(tmp), ipColorEnd(tmp));
+    S9sOutput::printf("%sPrivateIp:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%s%s", ipColorBegin(tmp), STR(tmp), ipColorEnd(tmp));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     // "  Server: core1                                State: RUNNING"
     //
-    printf("%s  Server:%s ", greyBegin, greyEnd);
-    printf("%s", serverColorBegin());
-    printf("%-33s ", STR(container.parentServerName()));
-    printf("%s", serverColorEnd());
+    S9sOutput::printf("%s  Server:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", serverColorBegin());
+    S9sOutput::printf("%-33s ", STR(container.parentServerName()));
+    S9sOutput::printf("%s", serverColorEnd());
     
-    printf("%s   State:%s ", greyBegin, greyEnd);
-    printf("%s%s%s ", 
+    S9sOutput::printf("%s   State:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s%s%s ", 
             clusterStateColorBegin(container.state()), 
             STR(container.state()),
             clusterStateColorEnd());
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
      
     //
     // "   Cloud: az                                  Region: Southeast Asia"
     //
-    printf("%s   Cloud:%s ", greyBegin, greyEnd);
-    printf("%-34s", STR(container.provider("-")));
+    S9sOutput::printf("%s   Cloud:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-34s", STR(container.provider("-")));
 
-    printf("%s  Region:%s ", greyBegin, greyEnd);
-    printf("%s", STR(container.region("-")));
+    S9sOutput::printf("%s  Region:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(container.region("-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // "  Subnet: subnet-6a1d1c12                       CIDR: 172.31.0.0/20"
     //
-    printf("%s  Subnet:%s ", greyBegin, greyEnd);
-    printf("%-34s", STR(container.subnetId("-")));
+    S9sOutput::printf("%s  Subnet:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-34s", STR(container.subnetId("-")));
     
-    printf("%s    CIDR:%s ", greyBegin, greyEnd);
-    printf("%s", STR(container.subnetCidr("-")));
+    S9sOutput::printf("%s    CIDR:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(container.subnetCidr("-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s  VPC ID:%s ", greyBegin, greyEnd);
-    printf("%-34s", STR(container.subnetVpcId("-")));
+    S9sOutput::printf("%s  VPC ID:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-34s", STR(container.subnetVpcId("-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%sFirewall:%s ", greyBegin, greyEnd);
-    printf("%-34s", STR(container.firewalls("-")));
+    S9sOutput::printf("%sFirewall:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-34s", STR(container.firewalls("-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     //
     //
-    printf("%sTemplate:%s ", greyBegin, greyEnd);
-    printf("%-36s", STR(container.templateName("-")));
+    S9sOutput::printf("%sTemplate:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-36s", STR(container.templateName("-")));
 
-    printf("%s Image:%s ", greyBegin, greyEnd);
-    printf("%s", STR(container.image("-")));
+    S9sOutput::printf("%s Image:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s", STR(container.image("-")));
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     //
     // "      OS: ubuntu 16.04 xenial                  Arch: x86_64"
     //
-    printf("%s      OS:%s ", greyBegin, greyEnd);
-    printf("%-36s", STR(container.osVersionString()));
+    S9sOutput::printf("%s      OS:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%-36s", STR(container.osVersionString()));
     
-    printf("%s  Arch:%s ", greyBegin, greyEnd);
-    printf("%s ", STR(container.architecture()));
+    S9sOutput::printf("%s  Arch:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s ", STR(container.architecture()));
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s   Start:%s ", greyBegin, greyEnd);
-    printf("%s",  container.autoStart() ? "y" : "n");
-    printf("\n");
+    S9sOutput::printf("%s   Start:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s",  container.autoStart() ? "y" : "n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s  Limits:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("%s  Limits:%s ", greyBegin, greyEnd);
 
     tmpString = "";
     if (container.memoryLimitGBytes() > 0)
@@ -1440,40 +1441,40 @@ S9sFormatter::printContainerStat(
     for (uint idx = 0u; idx < container.nVolumes(); ++idx)
     {
         if (!tmpString.empty())
-            printf(", ");
+            S9sOutput::printf(", ");
         
-        ::printf("%dGB %s", 
+        S9sOutput::printf("%dGB %s", 
                 container.volumeGigaBytes(idx), 
                 STR(container.volumeType(idx).toUpper()));
     }
 
-    ::printf("%s", STR(tmpString));
-    ::printf("\n");
+    S9sOutput::printf("%s", STR(tmpString));
+    S9sOutput::printf("\n");
 
 
     //
     // "  Config: '/var/lib/lxc/www/config'"
     //
-    printf("%s  Config:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s  Config:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             fileColorBegin(container.configFile()),
             STR(container.configFile()),
             fileColorEnd());
     
-    printf("\n");
+    S9sOutput::printf("\n");
     
     //
     //
     //
-    printf("%s Root FS:%s ", greyBegin, greyEnd);
-    printf("'%s%s%s'", 
+    S9sOutput::printf("%s Root FS:%s ", greyBegin, greyEnd);
+    S9sOutput::printf("'%s%s%s'", 
             XTERM_COLOR_BLUE,
             STR(container.rootFsPath()),
             TERM_NORMAL);
 
-    printf("\n");
-    printf("\n");
-    printf("\n");
+    S9sOutput::printf("\n");
+    S9sOutput::printf("\n");
+    S9sOutput::printf("\n");
 }
 
 
@@ -1520,16 +1521,16 @@ S9sFormatter::printBackendServersSubList(
         if (terminalWidth - tableWidth > 0)
             indent = S9sString(" ") * ((terminalWidth - tableWidth) / 2);
 
-        printf("\n");
+        S9sOutput::printf("\n");
         
-        printf("%s", headerColorBegin());
-        printf("%s", STR(indent));
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", STR(indent));
         hostNameFormat.printf("NAME", false);
         portFormat.printf("PORT", false);
         statusFormat.printf("STATUS", false);
         commentFormat.printf("COMMENT", false);
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
 
         for (uint idx = 0u; idx < node.numberOfBackendServers(); ++idx)
         {
@@ -1538,16 +1539,16 @@ S9sFormatter::printBackendServersSubList(
             S9sString status   = node.backendServerStatus(idx);
             S9sString comment  = node.backendServerComment(idx);
 
-            printf("%s", STR(indent));
+            S9sOutput::printf("%s", STR(indent));
             hostNameFormat.printf(hostName);
             portFormat.printf(port);
             statusFormat.printf(status);
             commentFormat.printf(comment);
 
-            printf("\n");
+            S9sOutput::printf("\n");
         }
             
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 }
 
@@ -1599,16 +1600,16 @@ S9sFormatter::printContainersCompact(
     ipFormat.widen("IP ADDRESS");
     aliasFormat.widen("NAME");
 
-    printf("%s", headerColorBegin());
-    printf("%s", STR(indent));
-    printf("S ");
+    S9sOutput::printf("%s", headerColorBegin());
+    S9sOutput::printf("%s", STR(indent));
+    S9sOutput::printf("S ");
     providerFormat.printf("CLOUD", false);
     userFormat.printf("OWNER", false);
     groupFormat.printf("GROUP", false);
     ipFormat.printf("IP ADDRESS", false);
     aliasFormat.printf("NAME", false);
-    printf("%s", headerColorEnd());
-    printf("\n");
+    S9sOutput::printf("%s", headerColorEnd());
+    S9sOutput::printf("\n");
 
 
     for (uint idx = 0u; idx < containers.size(); ++idx)
@@ -1620,19 +1621,19 @@ S9sFormatter::printContainersCompact(
         S9sString          alias     = container.alias();
         S9sString          ipAddress = container.ipAddress(addressType, "-");
         
-        printf("%s", STR(indent));
-        printf("%c ", container.stateAsChar());
+        S9sOutput::printf("%s", STR(indent));
+        S9sOutput::printf("%c ", container.stateAsChar());
 
         providerFormat.printf(provider);
         userFormat.printf(user);
         groupFormat.printf(group);
         ipFormat.printf(ipAddress);
 
-        ::printf("%s", containerColorBegin(container.stateAsChar()));
+        S9sOutput::printf("%s", containerColorBegin(container.stateAsChar()));
         aliasFormat.printf(alias);
-        ::printf("%s", containerColorEnd());
+        S9sOutput::printf("%s", containerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 }
 
@@ -1708,16 +1709,16 @@ S9sFormatter::printReplicationTable(
     /*
      * Printing the header.
      */
-    printf("%s", headerColorBegin());
-    printf("%s", STR(indent));
+    S9sOutput::printf("%s", headerColorBegin());
+    S9sOutput::printf("%s", STR(indent));
         
     slaveNameFormat.printf("SLAVE");
     masterNameFormat.printf("MASTER");
     masterClusterFormat.printf("MASTER_CLUSTER");
     linkStatusFormat.printf("STATUS");
 
-    printf("%s", headerColorEnd());
-    printf("\n");
+    S9sOutput::printf("%s", headerColorEnd());
+    S9sOutput::printf("\n");
 
     /*
      *
@@ -1747,7 +1748,7 @@ S9sFormatter::printReplicationTable(
         masterName.sprintf("%s:%d", STR(masterHostname), masterPort);
         slaveName.sprintf("%s:%d", STR(hostName), port);
 
-        ::printf("%s", STR(indent));
+        S9sOutput::printf("%s", STR(indent));
         slaveNameFormat.printf(slaveName);
         masterNameFormat.printf(masterName);
 
@@ -1757,10 +1758,10 @@ S9sFormatter::printReplicationTable(
             masterClusterFormat.printf("?");
 
         linkStatusFormat.printf(linkStatus);
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
 
-    ::printf("\n");
+    S9sOutput::printf("\n");
 }
 
 void 
@@ -1838,8 +1839,8 @@ S9sFormatter::printHostTable(
 
     hostNameFormat.widen("HOSTNAME");
 
-    printf("%s", headerColorBegin());
-    printf("%s", STR(indent));
+    S9sOutput::printf("%s", headerColorBegin());
+    S9sOutput::printf("%s", STR(indent));
 
     hostNameFormat.printf("HOSTNAME");
     
@@ -1863,8 +1864,8 @@ S9sFormatter::printHostTable(
     labelFormat.setCenterJustify();
     labelFormat.printf("NICs"); 
 
-    printf("%s", headerColorEnd());
-    printf("\n");
+    S9sOutput::printf("%s", headerColorEnd());
+    S9sOutput::printf("\n");
 
         
     for (uint idx = 0u; idx < hostIds.size(); ++idx)
@@ -1882,7 +1883,7 @@ S9sFormatter::printHostTable(
         S9sVariant rxSpeed   = cluster.rxBytesPerSecond(hostId);
         S9sVariant txSpeed   = cluster.txBytesPerSecond(hostId);
 
-        printf("%s", STR(indent));
+        S9sOutput::printf("%s", STR(indent));
 
         hostNameFormat.printf(hostName);
         coresFormat.printf(nCores.toInt());
@@ -1900,9 +1901,9 @@ S9sFormatter::printHostTable(
         
         rxSpeedFormat.printf(rxSpeed.toString(S9sVariant::BytesPerSecShort));
         txSpeedFormat.printf(txSpeed.toString(S9sVariant::BytesPerSecShort));
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
@@ -2,6 +2,7 @@
  * Copyright (C) 2011-2017 severalnines.com
  */
 #include "s9sgraph.h"
+#include "S9sOutput"
 
 #include "S9sDateTime"
 #include "S9sOptions"
@@ -207,7 +208,7 @@ S9sGraph::print() const
 {
     for (uint idx = 0u; idx < m_lines.size(); ++idx)
     {
-        printf("%s\n", STR(m_lines[idx].toString()));
+        S9sOutput::printf("%s\n", STR(m_lines[idx].toString()));
     }
 }
 
@@ -802,15 +803,15 @@ S9sGraph::printRow(
             if (lineIdx < graph->m_lines.size())
             {
                 if (hadLine)
-                    printf("%s", STR(columnSeparator));
+                    S9sOutput::printf("%s", STR(columnSeparator));
 
-                printf("%s", STR(graph->m_lines[lineIdx].toString()));
+                S9sOutput::printf("%s", STR(graph->m_lines[lineIdx].toString()));
                 hadLine = true;
             }
         }
 
         if (hadLine)
-            printf("\n");
+            S9sOutput::printf("\n");
         else
             break;
     }
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sinfopanel.h"
+#include "S9sOutput"
 
 #include "S9sDisplay"
 #include "S9sUser"
@@ -208,7 +209,7 @@ S9sInfoPanel::printLine(
     const char *selection = "\033[1m\033[48;5;51m" "\033[2m\033[38;5;237m";
 
     m_nChars = 0;
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", normal);
     if (lineIndex == 0)
     {
         // The top frame line.
@@ -307,12 +308,12 @@ S9sInfoPanel::printLine(
             printChar("─", titleStart);
             
             if (hasFocus())
-                ::printf("%s", selection);
+                S9sOutput::printf("%s", selection);
 
             printString(title);
             
             if (hasFocus())
-                ::printf("%s%s", TERM_NORMAL, normal);
+                S9sOutput::printf("%s%s", TERM_NORMAL, normal);
         }
 
         printChar("─", width() - 1);
@@ -620,10 +621,10 @@ S9sInfoPanel::printString(
     if ((int)asciiString.length() > availableChars)
     {
         asciiString.resize(availableChars);
-        ::printf("%s", STR(asciiString));
+        S9sOutput::printf("%s", STR(asciiString));
     } else {
-        ::printf("%s", STR(colorString));
-        ::printf("%s", normal);
+        S9sOutput::printf("%s", STR(colorString));
+        S9sOutput::printf("%s", normal);
     }
 
     m_nChars += asciiString.length();
@@ -639,12 +640,12 @@ S9sInfoPanel::printNameValue(
     S9sString   tmp;
 
     tmp.sprintf("%11s: ", STR(name));
-    ::printf("%s", STR(tmp));
+    S9sOutput::printf("%s", STR(tmp));
     m_nChars += tmp.length();
    
-    ::printf("%s", header);
-    ::printf("%s", STR(value));
-    ::printf("%s", normal);
+    S9sOutput::printf("%s", header);
+    S9sOutput::printf("%s", STR(value));
+    S9sOutput::printf("%s", normal);
     m_nChars += value.length();
 }
 
@@ -652,7 +653,7 @@ void
 S9sInfoPanel::printChar(
         int c)
 {
-    ::printf("%c", c);
+    S9sOutput::printf("%c", c);
     ++m_nChars;
 }
 
@@ -660,7 +661,7 @@ void
 S9sInfoPanel::printChar(
         const char *c)
 {
-    ::printf("%s", c);
+    S9sOutput::printf("%s", c);
     ++m_nChars;
 }
 
@@ -671,7 +672,7 @@ S9sInfoPanel::printChar(
 {
     while (m_nChars < lastColumn)
     {
-        ::printf("%s", c);
+        S9sOutput::printf("%s", c);
         ++m_nChars;
     }
 }
@@ -0,0 +1,209 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sinternedstring.h"
+
+#include <string.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sInternedString::S9sInternedString() :
+    m_string(NULL),
+    m_owned(false),
+    m_hash(0u)
+{
+    setString("", 0);
+}
+
+/**
+ * The NULL pointer is handled as the empty string, as the S9sString keys
+ * did.
+ */
+S9sInternedString::S9sInternedString(
+        const char *theString) :
+    m_string(NULL),
+    m_owned(false),
+    m_hash(0u)
+{
+    if (theString == NULL)
+        setString("", 0);
+    else
+        setString(theString, strlen(theString));
+}
+
+S9sInternedString::S9sInternedString(
+        const S9sString &theString) :
+    m_string(NULL),
+    m_owned(false),
+    m_hash(0u)
+{
+    setString(theString.c_str(), theString.length());
+}
+
+S9sInternedString::S9sInternedString(
+        const S9sInternedString &orig) :
+    m_string(orig.m_string),
+    m_owned(orig.m_owned),
+    m_hash(orig.m_hash)
+{
+    if (m_owned)
+        m_string = new S9sString(*orig.m_string);
+}
+
+/**
+ * The move constructor takes over the string if it is not interned, the 
+ * original is left empty.
+ */
+S9sInternedString::S9sInternedString(
+        S9sInternedString &&orig) noexcept :
+    m_string(orig.m_string),
+    m_owned(orig.m_owned),
+    m_hash(orig.m_hash)
+{
+    if (orig.m_owned)
+    {
+        orig.m_string = emptyString();
+        orig.m_owned  = false;
+        orig.m_hash   = S9sStringInterner::hash("", 0);
+    }
+}
+
+S9sInternedString::~S9sInternedString()
+{
+    if (m_owned)
+        delete m_string;
+}
+
+S9sInternedString &
+S9sInternedString::operator=(
+        const S9sInternedString &rhs)
+{
+    if (this == &rhs)
+        return *this;
+
+    if (m_owned)
+        delete m_string;
+
+    m_string = rhs.m_string;
+    m_owned  = rhs.m_owned;
+    m_hash   = rhs.m_hash;
+
+    if (m_owned)
+        m_string = new S9sString(*rhs.m_string);
+
+    return *this;
+}
+
+S9sInternedString &
+S9sInternedString::operator=(
+        S9sInternedString &&rhs) noexcept
+{
+    if (this == &rhs)
+        return *this;
+
+    if (m_owned)
+        delete m_string;
+
+    m_string = rhs.m_string;
+    m_owned  = rhs.m_owned;
+    m_hash   = rhs.m_hash;
+
+    if (rhs.m_owned)
+    {
+        rhs.m_string = emptyString();
+        rhs.m_owned  = false;
+        rhs.m_hash   = S9sStringInterner::hash("", 0);
+    }
+
+    return *this;
+}
+
+/**
+ * \returns The string stored in the S9sStringInterner, added to the pool if
+ *   it is not there yet. If the string can not be interned it is stored in 
+ *   the object.
+ */
+S9sInternedString
+S9sInternedString::intern(
+        const S9sString &theString)
+{
+    S9sInternedString retval;
+
+    retval.setString(theString.c_str(), theString.length(), true);
+    return retval;
+}
+
+/**
+ * \returns True if the string is stored in the S9sStringInterner.
+ */
+bool
+S9sInternedString::isInterned() const
+{
+    return !m_owned;
+}
+
+/**
+ * \param addToPool If true the string is added to the pool, otherwise only an
+ *   already interned copy is used.
+ *
+ * The empty strings all point to the same static string, it is not in the 
+ * pool.
+ */
+void
+S9sInternedString::setString(
+        const char *theString,
+        size_t      length,
+        bool        addToPool)
+{
+    if (m_owned)
+        delete m_string;
+
+    m_hash = S9sStringInterner::hash(theString, length);
+
+    if (length == 0u)
+    {
+        m_string = emptyString();
+        m_owned  = false;
+        return;
+    }
+
+    if (addToPool)
+        m_string = S9sStringInterner::intern(theString, length, m_hash);
+    else
+        m_string = S9sStringInterner::lookup(theString, length, m_hash);
+
+    m_owned  = m_string == NULL;
+
+    if (m_owned)
+        m_string = new S9sString(std::string(theString, length));
+}
+
+/**
+ * \returns The empty string the moved-from and the empty objects point to, 
+ *   it is not in the pool.
+ */
+const S9sString *
+S9sInternedString::emptyString()
+{
+    static const S9sString retval;
+
+    return &retval;
+}
@@ -0,0 +1,152 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sStringInterner"
+
+/**
+ * A string that is stored in the S9sStringInterner when possible, this is 
+ * the key of the S9sVariantMap. An interned string is only a pointer, so 
+ * copying it needs no allocation and two interned strings are equal if and 
+ * only if the pointers are equal. The strings that are not in the pool are
+ * stored in the object itself as a fallback.
+ *
+ * Only intern() adds strings to the pool, the JSon parser uses it for the
+ * keys it reads. The constructors only find the string in the pool, so the
+ * keys used for lookups ("hostname" or a host name) do not fill the pool.
+ */
+class S9sInternedString
+{
+    public:
+        S9sInternedString();
+        S9sInternedString(const char *theString);
+        S9sInternedString(const S9sString &theString);
+        S9sInternedString(const S9sInternedString &orig);
+        S9sInternedString(S9sInternedString &&orig) noexcept;
+        ~S9sInternedString();
+
+        S9sInternedString &operator=(const S9sInternedString &rhs);
+        S9sInternedString &operator=(S9sInternedString &&rhs) noexcept;
+
+        inline bool operator==(const S9sInternedString &rhs) const;
+        inline bool operator!=(const S9sInternedString &rhs) const;
+        inline bool operator<(const S9sInternedString &rhs) const;
+        
+        inline operator const S9sString &() const;
+        inline const S9sString &toString() const;
+        inline const char *c_str() const;
+
+        inline size_t hash() const;
+        bool isInterned() const;
+
+        static S9sInternedString intern(const S9sString &theString);
+
+    private:
+        void setString(
+                const char *theString, 
+                size_t      length, 
+                bool        addToPool = false);
+
+        static const S9sString *emptyString();
+
+    private:
+        const S9sString *m_string;
+        bool             m_owned;
+        uint             m_hash;
+};
+
+/**
+ * The hash function object for the hash tables keyed by interned strings.
+ */
+struct S9sInternedStringHash
+{
+    size_t operator()(const S9sInternedString &key) const
+    {
+        return key.hash();
+    }
+};
+
+/**
+ * Two interned strings with different pointers are different, only the
+ * strings that are not interned need to be compared.
+ */
+inline bool 
+S9sInternedString::operator==(
+        const S9sInternedString &rhs) const
+{
+    if (m_string == rhs.m_string)
+        return true;
+    else if (!m_owned && !rhs.m_owned)
+        return false;
+
+    return *m_string == *rhs.m_string;
+}
+
+inline bool 
+S9sInternedString::operator!=(
+        const S9sInternedString &rhs) const
+{
+    return !(*this == rhs);
+}
+
+/**
+ * The order is the order of the strings, so the maps keyed by interned 
+ * strings are iterated in the same order as the ones keyed by strings.
+ */
+inline bool 
+S9sInternedString::operator<(
+        const S9sInternedString &rhs) const
+{
+    if (m_string == rhs.m_string)
+        return false;
+
+    return m_string->compare(*rhs.m_string) < 0;
+}
+
+inline 
+S9sInternedString::operator const S9sString &() const
+{
+    return *m_string;
+}
+
+inline const S9sString &
+S9sInternedString::toString() const
+{
+    return *m_string;
+}
+
+inline const char *
+S9sInternedString::c_str() const
+{
+    return m_string->c_str();
+}
+
+/**
+ * \returns The hash value of the characters, calculated once when the string
+ *   is set. A string might be interned after an equal string that is stored
+ *   in the object was put into a map, so the address of the interned string
+ *   can not be used as the hash value.
+ */
+inline size_t
+S9sInternedString::hash() const
+{
+    return m_hash;
+}
@@ -0,0 +1,107 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sjobview.h"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sJobView::S9sJobView() :
+    S9sObjectView(),
+    m_cached(0)
+{
+}
+
+S9sJobView::S9sJobView(
+        const S9sVariantMap &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+S9sJobView::S9sJobView(
+        const S9sVariant &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+int
+S9sJobView::jobId() const
+{
+    if (!(m_cached & JobIdCached))
+    {
+        m_jobId   = property("job_id").toInt();
+        m_cached |= JobIdCached;
+    }
+
+    return m_jobId;
+}
+
+/**
+ * \returns The ID of the cluster that the job belongs to.
+ */
+int
+S9sJobView::clusterId() const
+{
+    if (!(m_cached & ClusterIdCached))
+    {
+        m_clusterId = property("cluster_id").toInt();
+        m_cached   |= ClusterIdCached;
+    }
+
+    return m_clusterId;
+}
+
+/**
+ * \returns The status of the job as "RUNNING", "FINISHED", "FAILED"...
+ */
+const S9sString &
+S9sJobView::status() const
+{
+    if (!(m_cached & StatusCached))
+    {
+        m_status  = property("status").toString();
+        m_cached |= StatusCached;
+    }
+
+    return m_status;
+}
+
+const S9sString &
+S9sJobView::title() const
+{
+    if (!(m_cached & TitleCached))
+    {
+        m_title   = property("title").toString();
+        m_cached |= TitleCached;
+    }
+
+    return m_title;
+}
+
+/**
+ * \returns A job object with a copy of all the properties.
+ */
+S9sJob
+S9sJobView::toJob() const
+{
+    return S9sJob(*m_properties);
+}
@@ -0,0 +1,57 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sObjectView"
+#include "S9sJob"
+
+/**
+ * A read-only view of a job in a parsed reply (see S9sObjectView). The
+ * frequently used fields are converted only once, on the first access.
+ */
+class S9sJobView : public S9sObjectView
+{
+    public:
+        S9sJobView();
+        S9sJobView(const S9sVariantMap &properties);
+        S9sJobView(const S9sVariant &properties);
+
+        int jobId() const;
+        int clusterId() const;
+        const S9sString &status() const;
+        const S9sString &title() const;
+
+        S9sJob toJob() const;
+
+    private:
+        enum CachedField
+        {
+            JobIdCached     = 0x01,
+            ClusterIdCached = 0x02,
+            StatusCached    = 0x04,
+            TitleCached     = 0x08
+        };
+
+        mutable int        m_cached;
+        mutable int        m_jobId;
+        mutable int        m_clusterId;
+        mutable S9sString  m_status;
+        mutable S9sString  m_title;
+};
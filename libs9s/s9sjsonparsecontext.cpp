@@ -3,6 +3,8 @@
  */
 #include "s9sjsonparsecontext.h"
 
+#include <new>
+
 #define DEBUG
 #include "s9sdebug.h"
 
@@ -17,10 +19,97 @@ S9sJsonParseContext::setValues(
         S9sVariantMap *values)
 {
     clear();
+    S9sVariantMapBase::swap(*values);
+}
+
+
+/**
+ * \returns A new variant in the arena of the parser that took over the
+ *   value.
+ *
+ * The lexer and the parser create a lot of short lived objects, one or two 
+ * for every token, that are destroyed as soon as their content is moved 
+ * into the result. Allocating them from the arena spares the heap.
+ */
+S9sVariant *
+S9sJsonParseContext::newVariant(
+        S9sVariant &&value)
+{
+    return new (m_arena.allocate(sizeof(S9sVariant))) 
+        S9sVariant(std::move(value));
+}
+
+/**
+ * \returns A new, empty string in the arena of the parser.
+ */
+S9sString *
+S9sJsonParseContext::newString()
+{
+    return new (m_arena.allocate(sizeof(S9sString))) S9sString;
+}
+
+/**
+ * \returns A new, empty map in the arena of the parser.
+ */
+S9sVariantMap *
+S9sJsonParseContext::newMap()
+{
+    return new (m_arena.allocate(sizeof(S9sVariantMap))) S9sVariantMap;
+}
+
+/**
+ * \returns A new, empty list in the arena of the parser.
+ */
+S9sVariantList *
+S9sJsonParseContext::newList()
+{
+    return new (m_arena.allocate(sizeof(S9sVariantList))) S9sVariantList;
+}
+
+/**
+ * Destroys a variant created by newVariant() and gives its memory back to 
+ * the arena.
+ */
+void
+S9sJsonParseContext::release(
+        S9sVariant *value)
+{
+    if (value == NULL)
+        return;
+
+    value->~S9sVariant();
+    m_arena.release(value, sizeof(S9sVariant));
+}
+
+void
+S9sJsonParseContext::release(
+        S9sString *value)
+{
+    if (value == NULL)
+        return;
+
+    value->~S9sString();
+    m_arena.release(value, sizeof(S9sString));
+}
 
-    std::vector<S9sString> newKeys = values->keys();
+void
+S9sJsonParseContext::release(
+        S9sVariantMap *value)
+{
+    if (value == NULL)
+        return;
 
-    for (uint idx = 0; idx < newKeys.size(); ++idx)
-        (*this)[newKeys[idx]] = (*values)[newKeys[idx]];
+    value->~S9sVariantMap();
+    m_arena.release(value, sizeof(S9sVariantMap));
 }
 
+void
+S9sJsonParseContext::release(
+        S9sVariantList *value)
+{
+    if (value == NULL)
+        return;
+
+    value->~S9sVariantList();
+    m_arena.release(value, sizeof(S9sVariantList));
+}
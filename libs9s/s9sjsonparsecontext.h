@@ -5,6 +5,7 @@
 
 #include "S9sVariantMap"
 #include "S9sParseContext"
+#include "S9sArena"
 
 class S9sJsonParseContext :
     public S9sVariantMap,
@@ -13,6 +14,20 @@ class S9sJsonParseContext :
     public:
         S9sJsonParseContext(const char *input);
         void setValues(S9sVariantMap *values);
+
+        S9sVariant *newVariant(S9sVariant &&value);
+        S9sString *newString();
+        S9sVariantMap *newMap();
+        S9sVariantList *newList();
+
+        void release(S9sVariant *value);
+        void release(S9sString *value);
+        void release(S9sVariantMap *value);
+        void release(S9sVariantList *value);
+
+    private:
+        /** The tokens and the partial results live here while parsing. */
+        S9sArena  m_arena;
 };
 
 extern int json_parse(S9sJsonParseContext &context);
@@ -0,0 +1,581 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sjsonwriter.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+
+#include "S9sVariant"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sObject"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * When writing into a file descriptor the buffer is written when it grows over
+ * this size.
+ */
+#define JSON_WRITER_BUFFER_SIZE (64 * 1024)
+
+/*
+ * The escape sequences of the characters that need to be escaped in the Json
+ * strings, NULL for the characters that are copied as they are.
+ */
+static const char *jsonEscapes[256];
+
+class S9sJsonEscapesInit
+{
+    public:
+        S9sJsonEscapesInit()
+        {
+            jsonEscapes[(unsigned char) '"']  = "\\\"";
+            jsonEscapes[(unsigned char) '\\'] = "\\\\";
+            jsonEscapes[(unsigned char) '\n'] = "\\n";
+            jsonEscapes[(unsigned char) '\r'] = "\\r";
+            jsonEscapes[(unsigned char) '\t'] = "\\t";
+        }
+};
+
+static S9sJsonEscapesInit jsonEscapesInit;
+
+/*
+ * The properties that are printed first in the Json strings, in this order.
+ */
+static const char *firstProperties[] =
+{
+    S9sObject::propClassName,
+    S9sObject::propName,
+    S9sObject::propPath,
+    S9sObject::propOwnerId,
+    S9sObject::propOwnerName,
+    S9sObject::propGroupId,
+    S9sObject::propGroupName,
+    S9sObject::propAcl,
+    S9sObject::propTags,
+};
+
+#define N_FIRST_PROPERTIES \
+    (sizeof(firstProperties) / sizeof(firstProperties[0]))
+
+static bool
+isFirstProperty(
+        const S9sString &key)
+{
+    for (uint idx = 0u; idx < N_FIRST_PROPERTIES; ++idx)
+    {
+        if (key == firstProperties[idx])
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * \param buffer The string where the output is appended.
+ */
+S9sJsonWriter::S9sJsonWriter(
+        S9sString &buffer) :
+    m_buffer(&buffer),
+    m_fd(-1),
+    m_error(false)
+{
+}
+
+/**
+ * \param fileDescriptor The file descriptor where the output is written.
+ *
+ * The output is collected in an internal buffer and written when the buffer is
+ * full, when flush() is called and when the writer is destroyed.
+ */
+S9sJsonWriter::S9sJsonWriter(
+        int fileDescriptor) :
+    m_buffer(&m_ownBuffer),
+    m_fd(fileDescriptor),
+    m_error(false)
+{
+    m_ownBuffer.reserve(JSON_WRITER_BUFFER_SIZE + 1024);
+}
+
+S9sJsonWriter::~S9sJsonWriter()
+{
+    flush();
+}
+
+/**
+ * Writes the value in the format S9sVariant::toJsonString() uses.
+ */
+void
+S9sJsonWriter::writeJson(
+        const S9sVariant     &value,
+        int                   depth,
+        const S9sFormatFlags &formatFlags)
+{
+    if (formatFlags & S9sFormatColor)
+        write(value.ansiColor());
+
+    switch (value.type())
+    {
+        case Invalid:
+            write("null", 4);
+            break;
+
+        case Bool:
+        case Int:
+        case Double:
+        case Ulonglong:
+            writeNumber(value);
+            break;
+
+        case String:
+            writeQuoted(*value.m_union.stringValue, formatFlags);
+            break;
+
+        case List:
+            writeJson(value.toVariantList(), depth, formatFlags);
+            break;
+        
+        case Map:
+        case Node:
+        case Container:
+        case Account:
+            writeJson(value.toVariantMap(), depth, formatFlags);
+            break;
+    }
+           
+    if (formatFlags & S9sFormatColor)
+        write(TERM_NORMAL);
+}
+
+/**
+ * Writes the map in the format S9sVariantMap::toJsonString() uses: the well
+ * known object properties first, then the scalar values and then the maps and
+ * lists.
+ */
+void
+S9sJsonWriter::writeJson(
+        const S9sVariantMap  &map,
+        int                   depth,
+        const S9sFormatFlags &formatFlags)
+{
+    S9sVariantMap::const_iterator it;
+    size_t  nWritten = 0u;
+    size_t  nEntries = map.size();
+
+    if (formatFlags & S9sFormatIndent)
+        write("{\n", 2);
+    else
+        write("{ ", 2);
+
+    for (uint idx = 0u; idx < N_FIRST_PROPERTIES; ++idx)
+    {
+        it = map.find(firstProperties[idx]);
+        if (it == map.end())
+            continue;
+
+        ++nWritten;
+        writeJsonEntry(
+                it->first, it->second, depth, formatFlags, 
+                nWritten == nEntries);
+    }
+
+    for (it = map.begin(); it != map.end(); ++it)
+    {
+        if (it->second.isVariantMap() || it->second.isVariantList())
+            continue;
+
+        if (isFirstProperty(it->first))
+            continue;
+
+        ++nWritten;
+        writeJsonEntry(
+                it->first, it->second, depth, formatFlags, 
+                nWritten == nEntries);
+    }
+    
+    for (it = map.begin(); it != map.end(); ++it)
+    {
+        if (!it->second.isVariantMap() && !it->second.isVariantList())
+            continue;
+
+        if (isFirstProperty(it->first))
+            continue;
+
+        ++nWritten;
+        writeJsonEntry(
+                it->first, it->second, depth, formatFlags, 
+                nWritten == nEntries);
+    }
+
+    if (formatFlags & S9sFormatIndent)
+        writeIndent(depth, "  ", 2);
+
+    write('}');
+}
+
+/**
+ * Writes the list in the format S9sVariantList::toJsonString() uses.
+ */
+void
+S9sJsonWriter::writeJson(
+        const S9sVariantList &list,
+        int                   depth,
+        const S9sFormatFlags &formatFlags)
+{
+    bool multiLine = (formatFlags & S9sFormatIndent) && list.size() > 1u;
+
+    if (multiLine)
+        write("[\n", 2);
+    else
+        write("[ ", 2);
+
+    for (size_t idx = 0u; idx < list.size(); ++idx)
+    {
+        if (multiLine)
+            writeIndent(depth + 1, "  ", 2);
+
+        writeJson(list[idx], depth + 1, formatFlags);
+
+        if (idx + 1 < list.size())
+            write(',');
+
+        write(multiLine ? '\n' : ' ');
+    }
+
+    if (multiLine)
+    {
+        writeIndent(depth, "  ", 2);
+        write(']');
+    } else {
+        write(" ]", 2);
+    }
+}
+
+/**
+ * Writes the map in the format S9sVariantMap::toString() uses, this is what we
+ * send to the controller.
+ */
+void
+S9sJsonWriter::writeToString(
+        const S9sVariantMap  &map,
+        int                   depth)
+{
+    S9sVariantMap::const_iterator it;
+    size_t  nWritten = 0u;
+
+    writeIndent(depth, "    ", 4);
+    write("{\n", 2);
+
+    for (it = map.begin(); it != map.end(); ++it)
+    {
+        writeIndent(depth + 1, "    ", 4);
+        writeQuoted(it->first, S9sFormatNormal);
+        write(": ", 2);
+        writeToString(it->second, depth);
+
+        if (++nWritten < map.size())
+            write(',');
+
+        write('\n');
+    }
+
+    writeIndent(depth, "    ", 4);
+    write('}');
+}
+
+void
+S9sJsonWriter::writeToString(
+        const S9sVariantList &list,
+        int                   depth)
+{
+    write("[ ", 2);
+    
+    for (uint idx = 0; idx < list.size(); ++idx)
+    {
+        if (idx > 0)
+            write(", ", 2);
+
+        writeToString(list[idx], depth);
+    }
+
+    write(" ]", 2);
+}
+
+void
+S9sJsonWriter::writeToString(
+        const S9sVariant     &value,
+        int                   depth)
+{
+    switch (value.type())
+    {
+        case String:
+            writeQuoted(*value.m_union.stringValue, S9sFormatNormal);
+            break;
+
+        case Int:
+        case Bool:
+        case Ulonglong:
+            writeNumber(value);
+            break;
+
+        case Double: 
+            if (std::isnan(value.m_union.dVal))
+                write("NaN", 3);
+            else if (std::isinf(value.m_union.dVal))
+                write("Infinity", 8);
+            else
+                writeNumber(value);
+            break;
+
+        case Map:
+        case Node:
+        case Account:
+            write('\n');
+            writeToString(value.toVariantMap(), depth + 1);
+            break;
+
+        case List:
+            writeToString(value.toVariantList(), depth);
+            break;
+        
+        default:
+            // Let's use 'null' for invalid/null data (http://www.json.org/)
+            write("null", 4);
+            break;
+    }
+}
+
+/**
+ * Writes the string as a quoted Json string. With the S9sFormatColor flag the
+ * escape sequences are highlighted.
+ */
+void
+S9sJsonWriter::writeQuoted(
+        const S9sString      &value,
+        const S9sFormatFlags &formatFlags)
+{
+    const char *data     = value.data();
+    size_t      length   = value.length();
+    size_t      runStart = 0u;
+    bool        color    = formatFlags & S9sFormatColor;
+
+    write('"');
+
+    for (size_t idx = 0u; idx < length; ++idx)
+    {
+        const char *escape = jsonEscapes[(unsigned char) data[idx]];
+
+        if (escape == NULL)
+            continue;
+
+        if (idx > runStart)
+            write(data + runStart, idx - runStart);
+
+        if (color && data[idx] != '"')
+        {
+            write("\033[35m", 5);
+            write(escape, 2);
+            write("\033[38;5;40m", 10);
+        } else {
+            write(escape, 2);
+        }
+
+        runStart = idx + 1;
+    }
+
+    if (length > runStart)
+        write(data + runStart, length - runStart);
+
+    write('"');
+}
+
+void
+S9sJsonWriter::write(
+        const char *data,
+        size_t      length)
+{
+    m_buffer->append(data, length);
+    flushIfFull();
+}
+
+void
+S9sJsonWriter::write(
+        const char *text)
+{
+    write(text, strlen(text));
+}
+
+void
+S9sJsonWriter::write(
+        const S9sString &text)
+{
+    write(text.data(), text.length());
+}
+
+void
+S9sJsonWriter::write(
+        char c)
+{
+    *m_buffer += c;
+    flushIfFull();
+}
+
+/**
+ * Writes what is in the buffer to the file descriptor, does nothing if the
+ * writer appends to a string.
+ *
+ * \returns false if the data could not be written.
+ */
+bool
+S9sJsonWriter::flush()
+{
+    const char *data;
+    size_t      length;
+
+    if (m_fd < 0)
+        return true;
+
+    data   = m_ownBuffer.data();
+    length = m_ownBuffer.length();
+
+    while (length > 0u && !m_error)
+    {
+        ssize_t nWritten = ::write(m_fd, data, length);
+
+        if (nWritten < 0 && errno == EINTR)
+            continue;
+
+        if (nWritten <= 0)
+        {
+            S9S_WARNING("Error writing: %m");
+            m_error = true;
+            break;
+        }
+
+        data   += nWritten;
+        length -= nWritten;
+    }
+
+    m_ownBuffer.clear();
+    return !m_error;
+}
+
+/**
+ * \returns true if writing into the file descriptor failed.
+ */
+bool
+S9sJsonWriter::hasError() const
+{
+    return m_error;
+}
+
+void
+S9sJsonWriter::writeIndent(
+        int         depth,
+        const char *unit,
+        size_t      unitLength)
+{
+    for (int n = 0; n < depth; ++n)
+        write(unit, unitLength);
+}
+
+/**
+ * Writes the numbers and booleans the way S9sVariant::toString() formats them.
+ */
+void
+S9sJsonWriter::writeNumber(
+        const S9sVariant &value)
+{
+    char buffer[64];
+    int  length = 0;
+
+    switch (value.type())
+    {
+        case Bool:
+            if (value.m_union.bVal)
+                write("true", 4);
+            else
+                write("false", 5);
+            return;
+
+        case Int:
+            length = snprintf(
+                    buffer, sizeof(buffer), "%d", value.m_union.iVal);
+            break;
+
+        case Ulonglong:
+            length = snprintf(
+                    buffer, sizeof(buffer), "%llu", value.m_union.ullVal);
+            break;
+
+        case Double:
+            length = snprintf(buffer, sizeof(buffer), "%g", value.m_union.dVal);
+            break;
+
+        default:
+            return;
+    }
+
+    if (length > 0 && length < (int) sizeof(buffer))
+        write(buffer, length);
+}
+
+void
+S9sJsonWriter::writeJsonEntry(
+        const S9sString      &key,
+        const S9sVariant     &value,
+        int                   depth,
+        const S9sFormatFlags &formatFlags,
+        bool                  last)
+{
+    if (formatFlags & S9sFormatIndent)
+        writeIndent(depth + 1, "  ", 2);
+
+    if (formatFlags & S9sFormatColor)
+        write("\033[38;5;63m", 10);
+
+    writeQuoted(key, S9sFormatNormal);
+
+    if (formatFlags & S9sFormatColor)
+        write(TERM_NORMAL);
+
+    write(": ", 2);
+    writeJson(value, depth + 1, formatFlags);
+
+    if (!last)
+        write(',');
+
+    if (formatFlags & S9sFormatIndent)
+        write('\n');
+    else
+        write(' ');
+}
+
+void
+S9sJsonWriter::flushIfFull()
+{
+    if (m_fd >= 0 && m_ownBuffer.length() >= JSON_WRITER_BUFFER_SIZE)
+        flush();
+}
@@ -0,0 +1,104 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sFormatter"
+
+class S9sVariant;
+class S9sVariantMap;
+class S9sVariantList;
+
+/**
+ * A class that serializes variants, variant maps and lists into Json strings.
+ * The output is appended to one buffer, either a string the caller owns (and
+ * may reuse for the next document) or an internal buffer that is written to a
+ * file descriptor whenever it is full, so big documents are never built in
+ * memory as a whole. The strings are escaped using a lookup table, the parts
+ * that need no escaping are copied in one step.
+ *
+ * The writer produces the very same text the toJsonString() and toString()
+ * functions of the S9sVariant, S9sVariantMap and S9sVariantList classes
+ * returned, those functions are now implemented using this class.
+ */
+class S9sJsonWriter
+{
+    public:
+        S9sJsonWriter(S9sString &buffer);
+        S9sJsonWriter(int fileDescriptor);
+        virtual ~S9sJsonWriter();
+
+        void writeJson(
+                const S9sVariant     &value,
+                int                   depth,
+                const S9sFormatFlags &formatFlags);
+
+        void writeJson(
+                const S9sVariantMap  &map,
+                int                   depth,
+                const S9sFormatFlags &formatFlags);
+
+        void writeJson(
+                const S9sVariantList &list,
+                int                   depth,
+                const S9sFormatFlags &formatFlags);
+
+        void writeToString(
+                const S9sVariantMap  &map,
+                int                   depth = 0);
+
+        void writeQuoted(
+                const S9sString      &value,
+                const S9sFormatFlags &formatFlags);
+
+        void write(const char *data, size_t length);
+        void write(const char *text);
+        void write(const S9sString &text);
+        void write(char c);
+
+        bool flush();
+        bool hasError() const;
+
+    private:
+        void writeToString(
+                const S9sVariantList &list,
+                int                   depth);
+
+        void writeToString(
+                const S9sVariant     &value,
+                int                   depth);
+
+        void writeIndent(int depth, const char *unit, size_t unitLength);
+        void writeNumber(const S9sVariant &value);
+        void writeJsonEntry(
+                const S9sString      &key,
+                const S9sVariant     &value,
+                int                   depth,
+                const S9sFormatFlags &formatFlags,
+                bool                  last);
+
+        void flushIfFull();
+
+    private:
+        S9sString  *m_buffer;
+        S9sString   m_ownBuffer;
+        int         m_fd;
+        bool        m_error;
+};
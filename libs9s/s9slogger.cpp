@@ -0,0 +1,333 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9slogger.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "S9sMutexLocker"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The pending lines are written by the calling thread when they grow over this
+ * size, so the buffer can not grow without limits.
+ */
+#define LOGGER_PENDING_LIMIT  (256 * 1024)
+
+/**
+ * The background thread writes the pending lines this often.
+ */
+#define LOGGER_FLUSH_INTERVAL_US (200 * 1000)
+
+int s9s_log_threshold = LogOff;
+
+S9sLogger::S9sLogger() :
+    S9sThread(),
+    m_file(NULL),
+    m_fileSize(0ull),
+    m_maxFileSize(0ull),
+    m_threshold(LogDebug),
+    m_threadStarted(false)
+{
+    atexit(S9sLogger::flushAtExit);
+}
+
+S9sLogger *
+S9sLogger::instance()
+{
+    // Never deleted, so it is still there when the atexit() handler runs.
+    static S9sLogger *theInstance = new S9sLogger;
+
+    return theInstance;
+}
+
+/**
+ * \param fileName The path of the log file, an empty string turns off the
+ *   logging.
+ * \returns true if the file could be opened.
+ *
+ * Opens the log file for appending and keeps it open.
+ */
+bool
+S9sLogger::open(
+        const S9sString &fileName)
+{
+    struct stat statBuffer;
+
+    close();
+
+    if (fileName.empty())
+        return true;
+
+    {
+        S9sMutexLocker locker(m_fileMutex);
+
+        m_file = fopen(STR(fileName), "a");
+        if (m_file == NULL)
+            return false;
+
+        m_fileName = fileName;
+        m_fileSize = 
+            fstat(fileno(m_file), &statBuffer) == 0 ? statBuffer.st_size : 0;
+    }
+
+    s9s_log_threshold = m_threshold;
+
+    if (!m_threadStarted)
+        m_threadStarted = start();
+
+    return true;
+}
+
+/**
+ * Writes the pending lines and closes the log file, the logging is turned off.
+ */
+void
+S9sLogger::close()
+{
+    s9s_log_threshold = LogOff;
+    flush();
+
+    S9sMutexLocker locker(m_fileMutex);
+
+    if (m_file != NULL)
+    {
+        fclose(m_file);
+        m_file = NULL;
+    }
+
+    m_fileName.clear();
+}
+
+S9sString
+S9sLogger::fileName() const
+{
+    return m_fileName;
+}
+
+/**
+ * \param severity The messages with lower severity are not logged, their
+ *   arguments are not even evaluated.
+ */
+void
+S9sLogger::setThreshold(
+        S9sLogSeverity severity)
+{
+    m_threshold = severity;
+
+    if (m_file != NULL)
+        s9s_log_threshold = m_threshold;
+}
+
+/**
+ * \param maxFileSize The size in bytes when the log file is rotated, 0 means
+ *   the file is never rotated.
+ */
+void
+S9sLogger::setMaxFileSize(
+        ulonglong maxFileSize)
+{
+    m_maxFileSize = maxFileSize;
+}
+
+/**
+ * Formats one line and puts it into the pending buffer. The line is formatted
+ * in a buffer owned by the calling thread and the lock is only held while it is
+ * appended, the file is written later by the background thread.
+ */
+void
+S9sLogger::log(
+        S9sLogSeverity  severity,
+        const char     *file,
+        const int       line,
+        const char     *formatString,
+        va_list         arguments)
+{
+    static __thread time_t  lastTime = 0;
+    static __thread char    timeString[32];
+    time_t                  now = time(NULL);
+    S9sString               logLine;
+    S9sString               message;
+    bool                    full;
+
+    if (severity < m_threshold)
+        return;
+
+    // The time stamp only changes once in a second.
+    if (now != lastTime)
+    {
+        struct tm lt;
+
+        localtime_r(&now, &lt);
+        strftime(timeString, sizeof(timeString), "%Y-%m-%d %H:%M:%S", &lt);
+        lastTime = now;
+    }
+
+    message.vsprintf(formatString, arguments);
+    logLine.sprintf("%s %20s:%5d %s %s\n", 
+            timeString, file, line, severityName(severity), STR(message));
+
+    {
+        S9sMutexLocker locker(m_mutex);
+
+        m_pending += logLine;
+        full = m_pending.length() > LOGGER_PENDING_LIMIT;
+    }
+
+    if (full || !m_threadStarted)
+        flush();
+}
+
+/**
+ * Writes all the pending lines into the log file.
+ */
+void
+S9sLogger::flush()
+{
+    S9sString lines;
+
+    m_mutex.lock();
+    lines.swap(m_pending);
+    m_mutex.unlock();
+
+    if (!lines.empty())
+        writeLines(lines);
+}
+
+const char *
+S9sLogger::severityName(
+        S9sLogSeverity severity)
+{
+    switch (severity)
+    {
+        case LogDebug:
+            return "DEBUG";
+
+        case LogInfo:
+            return "INFO";
+
+        case LogWarning:
+            return "WARNING";
+
+        case LogError:
+            return "ERROR";
+
+        case LogOff:
+            break;
+    }
+
+    return "";
+}
+
+/**
+ * \param name The name of the severity as it is in the "log_level" config
+ *   variable: "debug", "info", "warning", "error" or "off", case insensitive.
+ * \param severity The severity is returned here.
+ * \returns True if the name is valid.
+ */
+bool
+S9sLogger::severityFromName(
+        const S9sString &name,
+        S9sLogSeverity  &severity)
+{
+    S9sString lowerName = name.trim().toLower();
+
+    if (lowerName == "debug")
+        severity = LogDebug;
+    else if (lowerName == "info")
+        severity = LogInfo;
+    else if (lowerName == "warning")
+        severity = LogWarning;
+    else if (lowerName == "error")
+        severity = LogError;
+    else if (lowerName == "off")
+        severity = LogOff;
+    else
+        return false;
+
+    return true;
+}
+
+/**
+ * The background thread that periodically writes the pending lines.
+ */
+int
+S9sLogger::exec()
+{
+    while (!shouldStop())
+    {
+        usleep(LOGGER_FLUSH_INTERVAL_US);
+        flush();
+    }
+
+    return 0;
+}
+
+void
+S9sLogger::writeLines(
+        const S9sString &lines)
+{
+    S9sMutexLocker locker(m_fileMutex);
+
+    if (m_file == NULL)
+        return;
+
+    if (fwrite(lines.data(), 1, lines.length(), m_file) != lines.length())
+    {
+        S9S_WARNING("fwrite(): %m");
+    }
+
+    fflush(m_file);
+    m_fileSize += lines.length();
+
+    if (m_maxFileSize > 0ull && m_fileSize >= m_maxFileSize)
+        rotate();
+}
+
+/**
+ * Renames the log file to "<name>.1" (replacing the previous one) and starts
+ * a new, empty log file. The file mutex should be locked when calling this.
+ */
+void
+S9sLogger::rotate()
+{
+    S9sString oldName = m_fileName + ".1";
+
+    fclose(m_file);
+
+    if (rename(STR(m_fileName), STR(oldName)) != 0)
+    {
+        S9S_WARNING("rename(): %m");
+    }
+
+    m_file     = fopen(STR(m_fileName), "a");
+    m_fileSize = 0ull;
+}
+
+void
+S9sLogger::flushAtExit()
+{
+    instance()->flush();
+}
@@ -0,0 +1,88 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdio.h>
+#include <stdarg.h>
+
+#include "S9sString"
+#include "S9sMutex"
+#include "S9sThread"
+#include "s9sdebug.h"
+
+/**
+ * The logger that writes the s9s log file (the --log-file command line option
+ * and the "log_file" configuration variable) for the PRINT_LOG() macro.
+ *
+ * The calling thread only formats the line and appends it to a pending buffer,
+ * the file is kept open and a background thread writes the pending lines in
+ * batches. When the file grows over the maximum size it is renamed to
+ * "<name>.1" and a new file is started.
+ */
+class S9sLogger : public S9sThread
+{
+    public:
+        static S9sLogger *instance();
+
+        bool open(const S9sString &fileName);
+        void close();
+        S9sString fileName() const;
+
+        void setThreshold(S9sLogSeverity severity);
+        void setMaxFileSize(ulonglong maxFileSize);
+
+        void log(
+                S9sLogSeverity  severity,
+                const char     *file,
+                const int       line,
+                const char     *formatString,
+                va_list         arguments);
+
+        void flush();
+
+        static const char *severityName(S9sLogSeverity severity);
+
+        static bool severityFromName(
+                const S9sString &name,
+                S9sLogSeverity  &severity);
+
+    protected:
+        virtual int exec();
+
+    private:
+        S9sLogger();
+
+        void writeLines(const S9sString &lines);
+        void rotate();
+        static void flushAtExit();
+
+    private:
+        /** Protects the pending buffer. */
+        S9sMutex         m_mutex;
+        /** Protects the file, serializes the writers. */
+        S9sMutex         m_fileMutex;
+        S9sString        m_pending;
+        S9sString        m_fileName;
+        FILE            *m_file;
+        ulonglong        m_fileSize;
+        ulonglong        m_maxFileSize;
+        S9sLogSeverity   m_threshold;
+        bool             m_threadStarted;
+};
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9smonitor.h"
+#include "S9sOutput"
 
 #include "S9sOptions"
 #include "S9sCluster"
@@ -329,7 +330,7 @@ S9sMonitor::refreshScreen()
             break;
 
         default:
-            ::printf("error");
+            S9sOutput::printf("error");
     }
 
     //if (m_viewHelp)
@@ -379,7 +380,7 @@ S9sMonitor::printHelp()
         S9sString line = lines[n].toString();
         
         gotoXy(indent, n + 3);
-        ::printf("%s", STR(line));
+        S9sOutput::printf("%s", STR(line));
     }
 }
 
@@ -431,7 +432,7 @@ S9sMonitor::printContainers()
         serverFormat.widen("SERVER");
         aliasFormat.widen("NAME");
         
-        printf("%s", TERM_SCREEN_HEADER);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER);
         typeFormat.printf("CLOUD");
         templateFormat.printf("TEMPLATE");
         stateFormat.printf("STATE");
@@ -482,20 +483,20 @@ S9sMonitor::printContainers()
                 templateFormat.printf(container.templateName("-", true));
                 stateFormat.printf(STR(container.state()));
 
-                ::printf("%s", ipColorBegin(ipAddress));
+                S9sOutput::printf("%s", ipColorBegin(ipAddress));
                 ipFormat.printf(STR(ipAddress));
-                ::printf("%s", ipColorEnd(ipAddress));
+                S9sOutput::printf("%s", ipColorEnd(ipAddress));
 
-                ::printf("%s", serverColorBegin());
+                S9sOutput::printf("%s", serverColorBegin());
                 serverFormat.printf(container.parentServerName());
-                ::printf("%s", serverColorEnd());
+                S9sOutput::printf("%s", serverColorEnd());
 
-                ::printf("%s", containerColorBegin(stateAsChar));
+                S9sOutput::printf("%s", containerColorBegin(stateAsChar));
                 aliasFormat.printf(container.alias());
-                ::printf("%s", containerColorEnd());
+                S9sOutput::printf("%s", containerColorEnd());
             } else {
                 // The line is selected, we use a highlight color.
-                ::printf("%s", XTERM_COLOR_SELECTION);
+                S9sOutput::printf("%s", XTERM_COLOR_SELECTION);
                 typeFormat.printf(STR(container.provider()));
                 templateFormat.printf(container.templateName("-"));
                 stateFormat.printf(STR(container.state()));
@@ -577,7 +578,7 @@ S9sMonitor::printServers()
         ipFormat.widen("IPADDRESS");
         commentsFormat.widen("COMMENT");
 
-        printf("%s", TERM_SCREEN_HEADER);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER);
         
         if (m_viewDebug)
         {
@@ -630,7 +631,7 @@ S9sMonitor::printServers()
 
         if (isSelected)
         {
-            ::printf("%s", XTERM_COLOR_SELECTION);
+            S9sOutput::printf("%s", XTERM_COLOR_SELECTION);
 
             if (m_viewDebug)
             {
@@ -731,7 +732,7 @@ S9sMonitor::printClusters()
         groupFormat.widen("GROUP");
         pathFormat.widen("PATH");
 
-        printf("%s", TERM_SCREEN_HEADER);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER);
         
         if (m_viewObjects)
         {
@@ -768,15 +769,15 @@ S9sMonitor::printClusters()
             versionFormat.printf(cluster.vendorAndVersion());
             idFormat.printf(cluster.clusterId());
         
-            printf("%s", clusterStateColorBegin(cluster.state()));
+            S9sOutput::printf("%s", clusterStateColorBegin(cluster.state()));
             stateFormat.printf(cluster.state());
-            printf("%s", clusterStateColorEnd());
+            S9sOutput::printf("%s", clusterStateColorEnd());
 
             typeFormat.printf(cluster.clusterType());
     
-            printf("%s", clusterColorBegin());
+            S9sOutput::printf("%s", clusterColorBegin());
             nameFormat.printf(cluster.name());
-            printf("%s", clusterColorEnd());
+            S9sOutput::printf("%s", clusterColorEnd());
         
             messageFormat.printf(cluster.statusText());
         }
@@ -824,7 +825,7 @@ S9sMonitor::printJobs()
         titleFormat.widen("TITLE");
         titleFormat.widen("STATUS");
 
-        printf("%s", TERM_SCREEN_HEADER /*m_formatter.headerColorBegin()*/);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER /*m_formatter.headerColorBegin()*/);
         idFormat.printf("ID");
         stateFormat.printf("STATE");
         progressFormat.printf("PROGRESS");
@@ -878,7 +879,7 @@ S9sMonitor::printJobs()
         idFormat.printf(job.jobId());
         stateFormat.printf(job.status());
 
-        ::printf("%s", STR(progressBar));
+        S9sOutput::printf("%s", STR(progressBar));
 
         titleFormat.printf(job.title());
         statusTextFormat.printf(statusText);
@@ -959,7 +960,7 @@ S9sMonitor::printNodes()
         groupFormat.widen("GROUP");
         pathFormat.widen("PATH");
 
-        printf("%s", TERM_SCREEN_HEADER);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER);
        
         if (m_viewDebug)
         {
@@ -974,13 +975,13 @@ S9sMonitor::printNodes()
             groupFormat.printf("GROUP", false);
             pathFormat.printf("PATH", false);
         } else {
-            printf("STAT ");
+            S9sOutput::printf("STAT ");
             versionFormat.printf("VERSION");
             clusterIdFormat.printf("CID");
             clusterNameFormat.printf("CLUSTER");
             hostNameFormat.printf("HOST");
             portFormat.printf("PORT");
-            printf("COMMENT");
+            S9sOutput::printf("COMMENT");
         }
 
         printNewLine();
@@ -1013,22 +1014,22 @@ S9sMonitor::printNodes()
             groupFormat.printf(node.groupOwnerName());
             pathFormat.printf(node.fullCdtPath());
         } else {
-            ::printf("%c", node.nodeTypeFlag());
-            ::printf("%c", node.stateAsChar());
-            ::printf("%c", node.roleFlag());
-            ::printf("%c ", node.maintenanceFlag());
+            S9sOutput::printf("%c", node.nodeTypeFlag());
+            S9sOutput::printf("%c", node.stateAsChar());
+            S9sOutput::printf("%c", node.roleFlag());
+            S9sOutput::printf("%c ", node.maintenanceFlag());
 
             versionFormat.printf(node.version());
             clusterIdFormat.printf(node.clusterId());
 
-            printf("%s", clusterColorBegin());
+            S9sOutput::printf("%s", clusterColorBegin());
             clusterNameFormat.printf(clusterName);
-            printf("%s", clusterColorEnd());
+            S9sOutput::printf("%s", clusterColorEnd());
 
             hostNameFormat.printf(node.hostName());
             portFormat.printf(node.port());
 
-            ::printf("%s ", STR(node.message()));
+            S9sOutput::printf("%s ", STR(node.message()));
         }
 
         printNewLine();
@@ -1111,11 +1112,11 @@ S9sMonitor::printEventList()
        
         if (isSelected)
         {
-            ::printf("%s", XTERM_COLOR_SELECTION);
-            ::printf("%s ", STR(line));
+            S9sOutput::printf("%s", XTERM_COLOR_SELECTION);
+            S9sOutput::printf("%s ", STR(line));
             printNewLine();
         } else {
-            ::printf("%s ", STR(line));
+            S9sOutput::printf("%s ", STR(line));
             printNewLine();
         }
     }
@@ -1137,16 +1138,16 @@ S9sMonitor::printEventView()
     S9sString title = " Event JSon";
 
     // The title bar.
-    ::printf("%s", TERM_INVERSE);
-    ::printf("%s", STR(title));
+    S9sOutput::printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", STR(title));
 
 #if 1
     for (int n = title.length(); n < width() - 2; ++n)
-        ::printf(" ");
+        S9sOutput::printf(" ");
 
-    ::printf("x ");
+    S9sOutput::printf("x ");
 #else
-    ::printf("  %d, %d %dx%d %d - %d", 
+    S9sOutput::printf("  %d, %d %dx%d %d - %d", 
             m_eventViewWidget.x(), m_eventViewWidget.y(),
             m_eventViewWidget.height(), m_eventViewWidget.width(),
             m_eventViewWidget.firstVisibleIndex(),
@@ -1172,7 +1173,7 @@ S9sMonitor::printEventView()
 
         line.replace("\n", "\\n");
         line.replace("\r", "\\r");
-        ::printf("%s", STR(line));
+        S9sOutput::printf("%s", STR(line));
         printNewLine();
 
     }
@@ -1193,32 +1194,34 @@ S9sMonitor::processEvent(
     while (m_events.size() > 3000)
         m_events.takeFirst();
 
-    // The clusters.
+    /*
+     * The clusters, jobs and hosts are looked at through views, the properties
+     * are copied only once, when they are stored.
+     */
     if (event.hasCluster())
     {
-        S9sCluster cluster = event.cluster();
+        S9sClusterView cluster = event.clusterView();
+
         // FIXME: what about cluster delete events?
         if (cluster.clusterId() != 0)
-            m_clusters[cluster.clusterId()] = cluster;
+            m_clusters[cluster.clusterId()] = cluster.toCluster();
     }
 
     // The jobs.
     if (event.hasJob())
     {
-        S9sJob job = event.job();
+        S9sJobView job = event.jobView();
             
-        m_jobs[job.jobId()] = job;
+        m_jobs[job.jobId()] = job.toJob();
         m_jobActivity[job.jobId()] = time(NULL);
     }
     
     // The hosts.
     if (event.hasHost())
     {
-        S9sNode  node;
-
-        node = event.host();
+        S9sNodeView node = event.hostView();
 
-        m_nodes[node.hostId()] = node;
+        m_nodes[node.hostId()] = node.toNode();
         m_eventsForNodes[node.hostId()] = event;
     }
     
@@ -1306,7 +1309,7 @@ S9sMonitor::processEventList(
 
     output.replace("\n", "\n\r");
     if (!output.empty())
-        ::printf("\n\r%s", STR(output));
+        S9sOutput::printf("\n\r%s", STR(output));
 }
 
 /**
@@ -1380,39 +1383,39 @@ S9sMonitor::printHeader()
             break;
     }
 
-    ::printf("%s%s%s ", bold, STR(title), normal);
-    ::printf("%c ", rotatingCharacter());
+    S9sOutput::printf("%s%s%s ", bold, STR(title), normal);
+    S9sOutput::printf("%c ", rotatingCharacter());
     
     if (hasInputFile())
     {
         if (m_isStopped)
         {
             if (m_fastMode)
-                ::printf(" ⏩ ");
+                S9sOutput::printf(" ⏩ ");
             else
-                ::printf(" ▶️ ");
+                S9sOutput::printf(" ▶️ ");
         } else {
-            ::printf(" ⏸️ ");
+            S9sOutput::printf(" ⏸️ ");
         }
     } else {
-        ::printf("   ");
+        S9sOutput::printf("   ");
     }
 
     //::printf("⏺ ⏹ ⏸ ⏵ ⏩");
 
-    ::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
+    S9sOutput::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
     
-    ::printf("%s%4zu%s event(s) ", bold, m_events.size(), normal);
-    ::printf("%s%zu%s node(s) ",   bold, m_nodes.size(), normal);
-    ::printf("%s%d%s VM(s) ",      bold, nContainers(), normal);
-    ::printf("%s%zu%s cluster(s) ", bold, m_clusters.size(), normal);
-    ::printf("%s%zu%s jobs(s) ",   bold, m_jobs.size(), normal);
+    S9sOutput::printf("%s%4zu%s event(s) ", bold, m_events.size(), normal);
+    S9sOutput::printf("%s%zu%s node(s) ",   bold, m_nodes.size(), normal);
+    S9sOutput::printf("%s%d%s VM(s) ",      bold, nContainers(), normal);
+    S9sOutput::printf("%s%zu%s cluster(s) ", bold, m_clusters.size(), normal);
+    S9sOutput::printf("%s%zu%s jobs(s) ",   bold, m_jobs.size(), normal);
 
     if (m_viewDebug)
     {
-        ::printf("0x%08x ",      lastKeyCode());
-        ::printf("%02dx%02d ",   width(), height());
-        ::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
+        S9sOutput::printf("0x%08x ",      lastKeyCode());
+        S9sOutput::printf("%02dx%02d ",   width(), height());
+        S9sOutput::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
     }
 
     printNewLine();
@@ -1430,20 +1433,20 @@ S9sMonitor::printFooter()
     //::printf("%s", TERM_ERASE_EOL);
     for (;m_lineCounter < height() - 1; ++m_lineCounter)
     {
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\n\r");
-        ::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
     } 
 
-    ::printf("%s ", normal);
-    ::printf("%sN%s-Nodes ", bold, normal);
-    ::printf("%sC%s-Clusters ", bold, normal);
-    ::printf("%sJ%s-Jobs ", bold, normal);
-    ::printf("%sV%s-Containers ", bold, normal);
-    ::printf("%sE%s-Events ", bold, normal);
-    ::printf("%sD%s-Debug mode ", bold, normal);
-    ::printf("%sH%s-Help ", bold, normal);
-    ::printf("%sQ%s-Quit", bold, normal);
+    S9sOutput::printf("%s ", normal);
+    S9sOutput::printf("%sN%s-Nodes ", bold, normal);
+    S9sOutput::printf("%sC%s-Clusters ", bold, normal);
+    S9sOutput::printf("%sJ%s-Jobs ", bold, normal);
+    S9sOutput::printf("%sV%s-Containers ", bold, normal);
+    S9sOutput::printf("%sE%s-Events ", bold, normal);
+    S9sOutput::printf("%sD%s-Debug mode ", bold, normal);
+    S9sOutput::printf("%sH%s-Help ", bold, normal);
+    S9sOutput::printf("%sQ%s-Quit", bold, normal);
    
     //if (!m_outputFileName.empty())
     //    ::printf("    [%s]", STR(m_outputFileName));
@@ -1452,13 +1455,13 @@ S9sMonitor::printFooter()
     // Just for debugging now.
     //::printf("'%s'", STR(m_client.reply().requestStatusAsString()));
     // No new-line at the end, this is the last line.
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("%s", TERM_NORMAL);
 
     if (m_viewHelp)
         printHelp();
     
-    fflush(stdout);
+    S9sOutput::flush();
 }
 
 /**
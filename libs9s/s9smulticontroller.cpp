@@ -0,0 +1,365 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9smulticontroller.h"
+
+#include "S9sOptions"
+#include "S9sRegExp"
+#include "S9sThreadPool"
+#include "S9sRpcFuture"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The number of controllers contacted in parallel when the --parallellism
+ * command line option is not provided.
+ */
+#define DEFAULT_CONTROLLER_PARALLELISM 8
+
+/**
+ * The task of the S9sMultiController executed by the thread pool, authenticates
+ * on one controller and sends the request there. The task does not print
+ * anything, the result goes into the promise.
+ */
+class S9sMultiControllerTask : public S9sRunnable
+{
+    public:
+        S9sMultiControllerTask(
+                const S9sString     &hostName,
+                const int            port,
+                const S9sString     &path,
+                const bool           useTls,
+                const S9sRpcPromise &promise) :
+            S9sRunnable(),
+            m_client(hostName, port, path, useTls),
+            m_promise(promise)
+        {
+        }
+
+        virtual void
+        run()
+        {
+            S9sOptions *options = S9sOptions::instance();
+            bool        success;
+
+            success = m_client.authenticate();
+            if (!success)
+            {
+                m_promise.setValue(false, S9sRpcReply(), 
+                        m_client.errorString().empty() ?
+                        S9sString("Authentication failed.") : 
+                        m_client.errorString());
+                return;
+            }
+
+            if (options->isClusterOperation())
+                success = m_client.getClusters();
+            else if (options->isAlarmOperation())
+                success = m_client.getAlarms();
+            else
+                success = m_client.getBackups(options->clusterId());
+
+            m_promise.setValue(success, m_client);
+        }
+
+    private:
+        S9sRpcClient   m_client;
+        S9sRpcPromise  m_promise;
+};
+
+/**
+ * \param controllers The list of the controller URLs (e.g. 
+ *   "https://10.0.0.1:9501") as the --controllers command line option or the
+ *   "controllers" configuration variable holds them.
+ */
+S9sMultiController::S9sMultiController(
+        const S9sVariantList &controllers) :
+    m_controllers(controllers),
+    m_parallelism(DEFAULT_CONTROLLER_PARALLELISM)
+{
+}
+
+void
+S9sMultiController::setParallelism(
+        int parallelism)
+{
+    m_parallelism = parallelism > 0 ? parallelism : 1;
+}
+
+int
+S9sMultiController::parallelism() const
+{
+    return m_parallelism;
+}
+
+/**
+ * \returns True if the command line requests an operation that can be
+ *   executed on more controllers at once.
+ */
+bool
+S9sMultiController::isSupported()
+{
+    S9sOptions *options = S9sOptions::instance();
+
+    if (!options->isListRequested())
+        return false;
+
+    return options->isClusterOperation() || 
+        options->isAlarmOperation() ||
+        options->isBackupOperation();
+}
+
+/**
+ * \param url The controller URL to parse, e.g. "https://10.0.0.1:9501/path".
+ * \param hostName The place where the host name is returned.
+ * \param port The place where the port is returned, 9501 if the URL has no
+ *   port.
+ * \param path The place where the path is returned.
+ * \param useTls The place where the TLS flag is returned, true if the protocol
+ *   is "https". Without a protocol the TLS is used the same way as for the
+ *   --controller.
+ * \returns False if the URL has no host name.
+ *
+ * Parses the URL the same way the --controller command line option is parsed.
+ */
+bool
+S9sMultiController::parseUrl(
+        const S9sString &url,
+        S9sString       &hostName,
+        int             &port,
+        S9sString       &path,
+        bool            &useTls)
+{
+    S9sString myUrl = url.trim();
+    S9sString protocol;
+    S9sRegExp regexp;
+
+    regexp = "([a-zA-Z]+):\\/\\/(.+)";
+    if (regexp == myUrl)
+    {
+        protocol = regexp[1];
+        myUrl    = regexp[2];
+    }
+
+    regexp = "(.+):([0-9]+)(\\/.*)?";
+    if (regexp == myUrl)
+    {
+        hostName = regexp[1];
+        port     = regexp[2].toInt();
+        path     = regexp[3];
+    } else {
+        hostName = myUrl;
+        port     = 0;
+        path     = "";
+    }
+
+    if (port < 1)
+        port = 9501;
+
+    if (protocol.empty())
+        useTls = S9sOptions::instance()->useTls();
+    else
+        useTls = protocol.toLower() == "https";
+
+    return !hostName.empty() && !hostName.contains("/");
+}
+
+/**
+ * \returns True if the request succeeded on all the controllers.
+ *
+ * Executes the request on all the controllers, returns when all of them are
+ * done. The replies are merged by the reply() method.
+ */
+bool
+S9sMultiController::execute()
+{
+    S9sVector<S9sRpcFuture> futures;
+    S9sRpcClient firstClient;
+    S9sString    reason;
+    bool         canAuthenticate;
+    int          nThreads;
+    bool         retval = true;
+
+    m_replies.clear();
+    m_results.clear();
+
+    /*
+     * The options are resolved on the first use, we do it here (and parse the
+     * URLs here) so the threads only read them.
+     */
+    S9sOptions::instance()->isBatchRequested();
+    canAuthenticate = firstClient.canAuthenticate(reason);
+
+    nThreads = m_parallelism;
+    if (nThreads > (int) m_controllers.size())
+        nThreads = m_controllers.size();
+
+    S9sThreadPool pool(nThreads);
+
+    for (uint idx = 0u; idx < m_controllers.size(); ++idx)
+    {
+        S9sString     url = m_controllers[idx].toString();
+        S9sVariantMap result;
+        S9sRpcPromise promise;
+        S9sString     hostName;
+        S9sString     path;
+        int           port;
+        bool          useTls;
+
+        result["controller"] = url;
+        result["success"]    = false;
+
+        m_replies << S9sRpcReply();
+        m_results << result;
+        futures   << promise.future();
+
+        if (!parseUrl(url, hostName, port, path, useTls))
+        {
+            promise.setValue(false, S9sRpcReply(), "Invalid controller URL.");
+        } else if (!canAuthenticate)
+        {
+            promise.setValue(false, S9sRpcReply(), reason);
+        } else {
+            S9sMultiControllerTask *task = new S9sMultiControllerTask(
+                    hostName, port, path, useTls, promise);
+
+            // If the pool has no threads we do the job ourselves.
+            if (!pool.submit(task))
+            {
+                S9sMultiControllerTask(
+                        hostName, port, path, useTls, promise).run();
+            }
+        }
+    }
+
+    for (uint idx = 0u; idx < futures.size(); ++idx)
+    {
+        S9sVariantMap &result = m_results[idx];
+
+        result["success"]      = futures[idx].success();
+        result["error_string"] = futures[idx].errorString();
+        m_replies[idx]         = futures[idx].reply();
+
+        if (!result["success"].toBoolean())
+            retval = false;
+    }
+
+    return retval;
+}
+
+/**
+ * \returns The replies of the controllers merged into one reply. The list of
+ *   the items holds the items of all the controllers that succeeded, every one
+ *   of them with a "controller" key, the "controllers" key holds the per
+ *   controller results.
+ */
+S9sRpcReply
+S9sMultiController::reply() const
+{
+    S9sString      key = listKey();
+    S9sRpcReply    retval;
+    S9sVariantList items;
+    int            total = 0;
+
+    for (uint idx = 0u; idx < m_replies.size(); ++idx)
+    {
+        const S9sVariantMap  &result = m_results[idx];
+        S9sString             url = result.at("controller").toString();
+        S9sVariantList        list;
+
+        if (!result.at("success").toBoolean())
+            continue;
+
+        if (m_replies[idx].contains(key))
+            list = m_replies[idx].at(key).toVariantList();
+
+        for (uint itemIdx = 0u; itemIdx < list.size(); ++itemIdx)
+        {
+            S9sVariantMap item = list[itemIdx].toVariantMap();
+
+            item["controller"] = url;
+            items << item;
+        }
+
+        if (m_replies[idx].contains("total"))
+            total += m_replies[idx].at("total").toInt();
+        else
+            total += list.size();
+    }
+
+    retval["request_status"] = "Ok";
+    retval["controllers"]    = results();
+    retval["total"]          = total;
+    retval[key]              = items;
+
+    return retval;
+}
+
+/**
+ * \returns The per controller results of the last execute() call, one map for
+ *   every controller with the "controller", "success" and "error_string" keys.
+ */
+S9sVariantList
+S9sMultiController::results() const
+{
+    S9sVariantList retval;
+
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+        retval << m_results[idx];
+
+    return retval;
+}
+
+/**
+ * Prints the error of every controller where the request failed to the 
+ * standard error.
+ */
+void
+S9sMultiController::printErrors() const
+{
+    for (uint idx = 0u; idx < m_results.size(); ++idx)
+    {
+        const S9sVariantMap &result = m_results[idx];
+
+        if (result.at("success").toBoolean())
+            continue;
+
+        PRINT_ERROR("Controller %s: %s", 
+                STR(result.at("controller").toString()),
+                STR(result.valueByPath("error_string").toString()));
+    }
+}
+
+/**
+ * \returns The key of the item list in the reply of the request.
+ */
+S9sString
+S9sMultiController::listKey()
+{
+    S9sOptions *options = S9sOptions::instance();
+
+    if (options->isClusterOperation())
+        return "clusters";
+    else if (options->isAlarmOperation())
+        return "alarms";
+
+    return "backup_records";
+}
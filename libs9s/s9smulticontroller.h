@@ -0,0 +1,67 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sVector"
+#include "S9sRpcClient"
+#include "S9sRpcReply"
+
+/**
+ * Executes one list request (the "cluster --list", "alarm --list" and 
+ * "backup --list" functions) on many controllers using an S9sThreadPool of a
+ * bounded size and merges the replies into one. Every item in the
+ * merged reply has a "controller" key showing where it came from, the
+ * "controllers" key of the merged reply holds the per controller results so
+ * one failing controller does not hide the items of the others.
+ */
+class S9sMultiController
+{
+    public:
+        S9sMultiController(const S9sVariantList &controllers);
+
+        void setParallelism(int parallelism);
+        int parallelism() const;
+
+        bool execute();
+
+        S9sRpcReply reply() const;
+        S9sVariantList results() const;
+        void printErrors() const;
+
+        static bool isSupported();
+        static bool parseUrl(
+                const S9sString &url,
+                S9sString       &hostName,
+                int             &port,
+                S9sString       &path,
+                bool            &useTls);
+
+    private:
+        static S9sString listKey();
+
+    private:
+        S9sVariantList            m_controllers;
+        int                       m_parallelism;
+        S9sVector<S9sRpcReply>    m_replies;
+        S9sVector<S9sVariantMap>  m_results;
+};
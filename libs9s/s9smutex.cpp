@@ -3,15 +3,23 @@
  */
 #include "s9smutex.h"
 
+#include <time.h>
+#include <errno.h>
 
 S9sMutex::S9sMutex()
 {
     pthread_mutexattr_init(&m_attrs);
     pthread_mutex_init(&m_mutex, &m_attrs);
+
+    pthread_condattr_init(&m_conditionAttrs);
+    pthread_condattr_setclock(&m_conditionAttrs, CLOCK_MONOTONIC);
+    pthread_cond_init(&m_condition, &m_conditionAttrs);
 }
  
 S9sMutex::~S9sMutex()
 {
+    pthread_cond_destroy(&m_condition);
+    pthread_condattr_destroy(&m_conditionAttrs);
     pthread_mutex_destroy(&m_mutex);
     pthread_mutexattr_destroy(&m_attrs);
 }
@@ -28,3 +36,50 @@ S9sMutex::unlock()
     pthread_mutex_unlock(&m_mutex);
 }
 
+/**
+ * Waits until an other thread calls notifyAll(). The mutex has to be locked
+ * when this method is called, it is unlocked while waiting and locked again
+ * before returning. As always with wait conditions the caller should check
+ * the condition again when this method returns.
+ */
+void
+S9sMutex::wait()
+{
+    pthread_cond_wait(&m_condition, &m_mutex);
+}
+
+/**
+ * \param milliseconds The maximum time to wait.
+ * \returns False if the time elapsed without a notification.
+ *
+ * The same as wait(), but with a time limit.
+ */
+bool
+S9sMutex::wait(
+        int milliseconds)
+{
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec  += milliseconds / 1000;
+    deadline.tv_nsec += (milliseconds % 1000) * 1000000L;
+
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec  += 1;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    return pthread_cond_timedwait(
+            &m_condition, &m_mutex, &deadline) != ETIMEDOUT;
+}
+
+/**
+ * Wakes up all the threads that are waiting in the wait() method. Should be
+ * called with the mutex locked.
+ */
+void
+S9sMutex::notifyAll()
+{
+    pthread_cond_broadcast(&m_condition);
+}
@@ -4,6 +4,10 @@
 #pragma once
 #include <pthread.h>
 
+/**
+ * A mutex with a wait condition: the thread that holds the lock may wait() for
+ * an other thread to notify it about a change of the data the mutex protects.
+ */
 class S9sMutex
 {
     public:
@@ -13,7 +17,13 @@ class S9sMutex
         void lock();
         void unlock();
 
+        void wait();
+        bool wait(int milliseconds);
+        void notifyAll();
+
     private:
         pthread_mutex_t     m_mutex;
         pthread_mutexattr_t m_attrs;
+        pthread_cond_t      m_condition;
+        pthread_condattr_t  m_conditionAttrs;
 };
@@ -23,6 +23,7 @@
 #include <S9sVariantMap>
 #include <S9sRpcReply>
 #include <S9sSshCredentials>
+#include <S9sFormatTemplate>
 
 //#define DEBUG
 //#define WARNING
@@ -193,485 +194,423 @@ S9sString
 S9sNode::toString(
         const bool       syntaxHighlight,
         const S9sString &formatString) const
+{
+    return toString(
+            syntaxHighlight, S9sFormatTemplate::compiled(formatString, "f"));
+}
+
+/**
+ * Converts the object to a string using a format template that is already
+ * compiled, see the other toString() for the format string itself.
+ */
+S9sString
+S9sNode::toString(
+        const bool               syntaxHighlight,
+        const S9sFormatTemplate &format) const
 {
     S9sFormatter formatter;
     S9sString    retval;
     S9sString    tmp;
-    char         c;
     S9sString    partFormat;
-    bool         percent      = false;
-    bool         escaped      = false;
-    bool         modifierFree = false;
+    bool         modifierFree;
 
-    for (uint n = 0; n < formatString.size(); ++n)
+    for (uint idx = 0; idx < format.size(); ++idx)
     {
-        c = formatString[n];
-       
-        if (c == '%' && !percent)
-        {
-            percent    = true;
-            partFormat = "%";
-            continue;
-        } else if (percent && c == 'f')
-        {
-            modifierFree = true;
-            continue;
-        } else if (c == '\\' && !escaped)
+        const S9sFormatTemplate::Part &part = format.part(idx);
+
+        if (part.isLiteral())
         {
-            escaped = true;
+            retval += part.literal;
             continue;
         }
 
-        if (escaped)
-        {
-            switch (c)
-            {
-                case '\"':
-                    retval += '\"';
-                    break;
-
-                case '\\':
-                    retval += '\\';
-                    break;
-       
-                case 'a':
-                    retval += '\a';
-                    break;
-
-                case 'b':
-                    retval += '\b';
-                    break;
-
-                case 'e':
-                    retval += '\027';
-                    break;
-
-                case 'n':
-                    retval += '\n';
-                    break;
-
-                case 'r':
-                    retval += '\r';
-                    break;
-
-                case 't':
-                    retval += '\t';
-                    break;
-            }
-        } else if (percent)
+        partFormat = part.prefix;
+        modifierFree = part.modifier == 'f';
+
+        switch (part.directive)
         {
-            switch (c)
-            {
-                case 'A':
-                    // The ip address of the node.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(ipAddress()));
-                    retval += tmp;
-                    break;
-                
-                case 'a':
-                    // Maintenance flag.
-                    partFormat += 's';
-                    
-                    tmp.sprintf(STR(partFormat), 
-                            isMaintenanceActive() ? "M" : "-");
-
-                    retval += tmp;
-                    break;
-
-                case 'b':
-                    // The master, this node is following.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(masterHost()));
-                    retval += tmp;
+            case 'A':
+                // The ip address of the node.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(ipAddress()));
+                retval += tmp;
+                break;
+            
+            case 'a':
+                // Maintenance flag.
+                partFormat += 's';
                 
-                    break;
+                tmp.sprintf(STR(partFormat), 
+                        isMaintenanceActive() ? "M" : "-");
+
+                retval += tmp;
+                break;
+
+            case 'b':
+                // The master, this node is following.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(masterHost()));
+                retval += tmp;
+            
+                break;
  
-                case 'C':
-                    // The configuration file. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(configFile()));
+            case 'C':
+                // The configuration file. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(configFile()));
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(configFile());
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(configFile());
 
-                    retval += tmp;
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
 
-                    break;
+                break;
 
-                case 'c':
-                    // The total number of CPU cores in the cluster.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nCpuCores().toInt());
-                    retval += tmp;
-                    break;
+            case 'c':
+                // The total number of CPU cores in the cluster.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nCpuCores().toInt());
+                retval += tmp;
+                break;
 
-                case 'D':
-                    // The data directory.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(dataDir()));
+            case 'D':
+                // The data directory.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(dataDir()));
 
-                    if (syntaxHighlight)
-                        retval += XTERM_COLOR_BLUE;
+                if (syntaxHighlight)
+                    retval += XTERM_COLOR_BLUE;
 
-                    retval += tmp;
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += TERM_NORMAL;
+                if (syntaxHighlight)
+                    retval += TERM_NORMAL;
 
-                    break;
-                
-                case 'd':
-                    // The PID file.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(pidFile()));
+                break;
+            
+            case 'd':
+                // The PID file.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(pidFile()));
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(pidFile());
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(pidFile());
 
-                    retval += tmp;
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
 
-                    break;
-                
-                case 'E':
-                    // The replication state.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), STR(replicationState()));
-                    retval += tmp;
-                    break; 
-
-                case 'G':
-                    // The name of the group owner.
-                    partFormat += 's';
-                    tmp.sprintf(
-                            STR(partFormat),
-                            STR(groupOwnerName()));
+                break;
+            
+            case 'E':
+                // The replication state.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), STR(replicationState()));
+                retval += tmp;
+                break; 
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::groupColorBegin();
+            case 'G':
+                // The name of the group owner.
+                partFormat += 's';
+                tmp.sprintf(
+                        STR(partFormat),
+                        STR(groupOwnerName()));
 
-                    retval += tmp;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::groupColorBegin();
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::groupColorEnd();
+                retval += tmp;
 
-                    break;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::groupColorEnd();
 
-                case 'g':
-                    // The log file. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(logFile()));
+                break;
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorBegin(logFile());
+            case 'g':
+                // The log file. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(logFile()));
 
-                    retval += tmp;
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorBegin(logFile());
 
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::fileColorEnd();
-
-                    break;
-                
-                case 'h':
-                    // The CDT path 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(cdtPath()));
+                retval += tmp;
 
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorBegin();
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::fileColorEnd();
 
-                    retval += tmp;
+                break;
+            
+            case 'h':
+                // The CDT path 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(cdtPath()));
 
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorEnd();
+                if (syntaxHighlight)
+                    retval += formatter.folderColorBegin();
 
-                    break;
+                retval += tmp;
 
-                case 'I':
-                    // The ID of the node.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), hostId());
+                if (syntaxHighlight)
+                    retval += formatter.folderColorEnd();
 
-                    retval += tmp;
-                    break;
+                break;
 
-                case 'i':
-                    // The total number of monitored disk devices.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nDevices().toInt());
+            case 'I':
+                // The ID of the node.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), hostId());
 
-                    retval += tmp;
-                    break;
+                retval += tmp;
+                break;
 
-                case 'k':
-                    // The total disk size found in the node.
-                    partFormat += 'f';
+            case 'i':
+                // The total number of monitored disk devices.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nDevices().toInt());
 
-                    if (modifierFree)
-                    {
-                        tmp.sprintf(
-                                STR(partFormat), 
-                                freeDiskBytes().toTBytes());
-                    } else {
-                        tmp.sprintf(
-                                STR(partFormat), 
-                                totalDiskBytes().toTBytes());
-                    }
+                retval += tmp;
+                break;
 
-                    retval += tmp;
-                    break;
+            case 'k':
+                // The total disk size found in the node.
+                partFormat += 'f';
 
-                case 'N':
-                    // The name of the node.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(name()));
-
-                    if (syntaxHighlight)
-                        retval += XTERM_COLOR_BLUE;
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += TERM_NORMAL;
-
-                    break;
-                
-                case 'M':
-                    // The message describing the node's status. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(message()));
-                    retval += tmp;
-                    break;
-
-                case 'm':
-                    // The total memory size found on the host.
-                    partFormat += 'f';
-                    if (modifierFree)
-                        tmp.sprintf(STR(partFormat), memFree().toGBytes());
-                    else
-                        tmp.sprintf(STR(partFormat), memTotal().toGBytes());
-
-                    retval += tmp;
-                    break;
-
-                case 'n':
-                    // The total number of monitored network interfaces.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nNics().toInt());
-
-                    retval += tmp;
-                    break;
-
-                case 'O':
-                    // The name of the owner.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(ownerName()));
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorBegin();
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += S9sRpcReply::userColorEnd();
-
-                    break;
-
-                case 'o':
-                    // The OS version string.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(osVersionString()));
-                    retval += tmp;
-                    break;
-                
-                case 'L':
-                    // The replay location.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(replayLocation()));
-                    retval += tmp;
-                    break;
-                
-                case 'l':
-                    // The received location.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(receivedLocation()));
-                    retval += tmp;
-                    break;
-
-                case 'P':
-                    // The Port.
-                    partFormat += "d";
-                    tmp.sprintf(STR(partFormat), port());
-                    retval += tmp;
-                    break;
-                
-                case 'p':
-                    // The PID.
-                    partFormat += "d";
-                    tmp.sprintf(STR(partFormat), pid());
-                    retval += tmp;
-                    break;
-                
-                case 'R':
-                    // The role.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), STR(role()));
-                    retval += tmp;
-                    break;
-                
-                case 'r':
-                    // A string 'read-only' or 'read-write'.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), 
-                            readOnly() ? "read-only" : "read-write");
-                    retval += tmp;
-                    break;
-
-                case 'S':
-                    // The state of the node.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(hostStatus()));
-
-                    if (syntaxHighlight)
-                    {
-                        retval += formatter.hostStateColorBegin(hostStatus());
-                    }
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += formatter.hostStateColorEnd();
-
-                    break;
-                
-                case 's':
-                    // The list of slaves in one string.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(slavesAsString()));
-                    retval += tmp;
-                
-                    break;
-
-                case 'T':
-                    // The type of the node.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(nodeType()));
-                    retval += tmp;
-                    break;
-
-                case 't':
-                    // The network traffic found in the cluster.
-                    partFormat += 'f';
-                    tmp.sprintf(STR(partFormat), 
-                            netBytesPerSecond().toMBytes());
-
-                    retval += tmp;
-                    break;
+                if (modifierFree)
+                {
+                    tmp.sprintf(
+                            STR(partFormat), 
+                            freeDiskBytes().toTBytes());
+                } else {
+                    tmp.sprintf(
+                            STR(partFormat), 
+                            totalDiskBytes().toTBytes());
+                }
+
+                retval += tmp;
+                break;
+
+            case 'N':
+                // The name of the node.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(name()));
+
+                if (syntaxHighlight)
+                    retval += XTERM_COLOR_BLUE;
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += TERM_NORMAL;
+
+                break;
+            
+            case 'M':
+                // The message describing the node's status. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(message()));
+                retval += tmp;
+                break;
+
+            case 'm':
+                // The total memory size found on the host.
+                partFormat += 'f';
+                if (modifierFree)
+                    tmp.sprintf(STR(partFormat), memFree().toGBytes());
+                else
+                    tmp.sprintf(STR(partFormat), memTotal().toGBytes());
+
+                retval += tmp;
+                break;
+
+            case 'n':
+                // The total number of monitored network interfaces.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nNics().toInt());
+
+                retval += tmp;
+                break;
+
+            case 'O':
+                // The name of the owner.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(ownerName()));
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += S9sRpcReply::userColorEnd();
+
+                break;
+
+            case 'o':
+                // The OS version string.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(osVersionString()));
+                retval += tmp;
+                break;
+            
+            case 'L':
+                // The replay location.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(replayLocation()));
+                retval += tmp;
+                break;
+            
+            case 'l':
+                // The received location.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(receivedLocation()));
+                retval += tmp;
+                break;
+
+            case 'P':
+                // The Port.
+                partFormat += "d";
+                tmp.sprintf(STR(partFormat), port());
+                retval += tmp;
+                break;
+            
+            case 'p':
+                // The PID.
+                partFormat += "d";
+                tmp.sprintf(STR(partFormat), pid());
+                retval += tmp;
+                break;
+            
+            case 'R':
+                // The role.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), STR(role()));
+                retval += tmp;
+                break;
+            
+            case 'r':
+                // A string 'read-only' or 'read-write'.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), 
+                        readOnly() ? "read-only" : "read-write");
+                retval += tmp;
+                break;
+
+            case 'S':
+                // The state of the node.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(hostStatus()));
+
+                if (syntaxHighlight)
+                {
+                    retval += formatter.hostStateColorBegin(hostStatus());
+                }
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += formatter.hostStateColorEnd();
+
+                break;
+            
+            case 's':
+                // The list of slaves in one string.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(slavesAsString()));
+                retval += tmp;
+            
+                break;
+
+            case 'T':
+                // The type of the node.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(nodeType()));
+                retval += tmp;
+                break;
+
+            case 't':
+                // The network traffic found in the cluster.
+                partFormat += 'f';
+                tmp.sprintf(STR(partFormat), 
+                        netBytesPerSecond().toMBytes());
+
+                retval += tmp;
+                break;
 
 #if 0
-                case 'U':
-                    // The uptime.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), 
-                            STR(S9sString::uptime(uptime())));
-                    retval += tmp;
-                    break;
+            case 'U':
+                // The uptime.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), 
+                        STR(S9sString::uptime(uptime())));
+                retval += tmp;
+                break;
 #endif
-                case 'V':
-                    // The version.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), STR(version()));
-                    retval += tmp;
-                    break;
+            case 'V':
+                // The version.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), STR(version()));
+                retval += tmp;
+                break;
+            
+            case 'v':
+                // The container/vm ID.
+                partFormat += "s";
+                tmp.sprintf(STR(partFormat), STR(containerId("-")));
+                retval += tmp;
+                break;
+
+            case 'U':
+                // The number of CPUs.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), nCpus().toInt());
+                retval += tmp;
+                break;
+
+            case 'u':
+                // The cpu usage percent. 
+                partFormat += 'f';
+                tmp.sprintf(STR(partFormat), cpuUsagePercent().toDouble());
+                retval += tmp;
+                break;
+
+            case 'w':
+                // The total swap space found in the host.
+                partFormat += 'f';
+                if (modifierFree)
+                    tmp.sprintf(STR(partFormat), swapTotal().toGBytes());
+                else
+                    tmp.sprintf(STR(partFormat), swapFree().toGBytes());
+
+                retval += tmp;
+                break;
+
+            case 'Z':
+                // The CPU model.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(cpuModel()));
+                retval += tmp;
+                break;
+            
+            case 'z':
+                // The class name.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(className()));
                 
-                case 'v':
-                    // The container/vm ID.
-                    partFormat += "s";
-                    tmp.sprintf(STR(partFormat), STR(containerId("-")));
-                    retval += tmp;
-                    break;
-
-                case 'U':
-                    // The number of CPUs.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), nCpus().toInt());
-                    retval += tmp;
-                    break;
-
-                case 'u':
-                    // The cpu usage percent. 
-                    partFormat += 'f';
-                    tmp.sprintf(STR(partFormat), cpuUsagePercent().toDouble());
-                    retval += tmp;
-                    break;
-
-                case 'w':
-                    // The total swap space found in the host.
-                    partFormat += 'f';
-                    if (modifierFree)
-                        tmp.sprintf(STR(partFormat), swapTotal().toGBytes());
-                    else
-                        tmp.sprintf(STR(partFormat), swapFree().toGBytes());
-
-                    retval += tmp;
-                    break;
-
-                case 'Z':
-                    // The CPU model.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(cpuModel()));
-                    retval += tmp;
-                    break;
+                if (syntaxHighlight)
+                    retval += XTERM_COLOR_GREEN;
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += TERM_NORMAL;
                 
-                case 'z':
-                    // The class name.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(className()));
-                    
-                    if (syntaxHighlight)
-                        retval += XTERM_COLOR_GREEN;
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += TERM_NORMAL;
-                    
-                    break;
-
-                case '%':
-                    retval += '%';
-                    break;
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '-':
-                case '+':
-                case '.':
-                case '\'':
-                    partFormat += c;
-                    continue;
-            }
-        } else {
-            retval += c;
+                break;
         }
-
-        percent      = false;
-        escaped      = false;
-        modifierFree = false;
     }
 
     return retval;
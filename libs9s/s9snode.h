@@ -25,6 +25,7 @@
 #include "S9sCluster"
 
 class S9sSshCredentials;
+class S9sFormatTemplate;
 
 /**
  * A class that represents a node/host/server. 
@@ -55,6 +56,11 @@ class S9sNode : public S9sObject
                 const bool       syntaxHighlight,
                 const S9sString &formatString) const;
 
+        S9sString 
+            toString(
+                const bool               syntaxHighlight,
+                const S9sFormatTemplate &format) const;
+
         virtual int hostId() const;
         int clusterId() const;
         virtual S9sString name() const;
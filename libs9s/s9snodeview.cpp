@@ -0,0 +1,135 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9snodeview.h"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sNodeView::S9sNodeView() :
+    S9sObjectView(),
+    m_cached(0)
+{
+}
+
+S9sNodeView::S9sNodeView(
+        const S9sVariantMap &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+S9sNodeView::S9sNodeView(
+        const S9sVariant &properties) :
+    S9sObjectView(properties),
+    m_cached(0)
+{
+}
+
+/**
+ * \returns The ID of the host, the same as S9sNode::hostId().
+ */
+int
+S9sNodeView::hostId() const
+{
+    if (!(m_cached & HostIdCached))
+    {
+        m_hostId  = property("hostId").toInt();
+        m_cached |= HostIdCached;
+    }
+
+    return m_hostId;
+}
+
+/**
+ * \returns The ID of the cluster holding the node.
+ */
+int
+S9sNodeView::clusterId() const
+{
+    if (!(m_cached & ClusterIdCached))
+    {
+        m_clusterId = property("clusterid").toInt();
+        m_cached   |= ClusterIdCached;
+    }
+
+    return m_clusterId;
+}
+
+int
+S9sNodeView::port() const
+{
+    if (!(m_cached & PortCached))
+    {
+        m_port    = property("port").toInt();
+        m_cached |= PortCached;
+    }
+
+    return m_port;
+}
+
+/**
+ * \returns The host name, the name that used in the Cmon Configuration file to
+ *   register the node.
+ */
+const S9sString &
+S9sNodeView::hostName() const
+{
+    if (!(m_cached & HostNameCached))
+    {
+        m_hostName = property("hostname").toString();
+        m_cached  |= HostNameCached;
+    }
+
+    return m_hostName;
+}
+
+/**
+ * \returns The name of the node, the same as S9sNode::name().
+ */
+const S9sString &
+S9sNodeView::name() const
+{
+    return hostName();
+}
+
+/**
+ * \returns The host status as a string (e.g. "CmonHostOnline").
+ */
+const S9sString &
+S9sNodeView::hostStatus() const
+{
+    if (!(m_cached & HostStatusCached))
+    {
+        m_hostStatus = property("hoststatus").toString();
+        m_cached    |= HostStatusCached;
+    }
+
+    return m_hostStatus;
+}
+
+/**
+ * \returns A node object with a copy of all the properties.
+ */
+S9sNode
+S9sNodeView::toNode() const
+{
+    return S9sNode(*m_properties);
+}
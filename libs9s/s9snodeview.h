@@ -0,0 +1,61 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sObjectView"
+#include "S9sNode"
+
+/**
+ * A read-only view of a host in a parsed reply (see S9sObjectView). The
+ * frequently used fields are converted only once, on the first access.
+ */
+class S9sNodeView : public S9sObjectView
+{
+    public:
+        S9sNodeView();
+        S9sNodeView(const S9sVariantMap &properties);
+        S9sNodeView(const S9sVariant &properties);
+
+        int hostId() const;
+        int clusterId() const;
+        int port() const;
+        const S9sString &hostName() const;
+        const S9sString &name() const;
+        const S9sString &hostStatus() const;
+
+        S9sNode toNode() const;
+
+    private:
+        enum CachedField
+        {
+            HostIdCached     = 0x01,
+            ClusterIdCached  = 0x02,
+            PortCached       = 0x04,
+            HostNameCached   = 0x08,
+            HostStatusCached = 0x10
+        };
+
+        mutable int        m_cached;
+        mutable int        m_hostId;
+        mutable int        m_clusterId;
+        mutable int        m_port;
+        mutable S9sString  m_hostName;
+        mutable S9sString  m_hostStatus;
+};
@@ -0,0 +1,95 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sobjectview.h"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+const S9sVariant S9sObjectView::sm_invalid;
+
+/**
+ * Creates a view of an empty object, every property is going to be the invalid
+ * variant.
+ */
+S9sObjectView::S9sObjectView() :
+    m_properties(&sm_invalid.toVariantMap())
+{
+}
+
+S9sObjectView::S9sObjectView(
+        const S9sVariantMap &properties) :
+    m_properties(&properties)
+{
+}
+
+/**
+ * \param properties The variant holding the properties, usually an item of a
+ *   list in the reply. If it is not a map the view shows an empty object.
+ */
+S9sObjectView::S9sObjectView(
+        const S9sVariant &properties) :
+    m_properties(&properties.toVariantMap())
+{
+}
+
+/**
+ * \returns True if the viewed object has at least one property.
+ */
+bool
+S9sObjectView::isValid() const
+{
+    return !m_properties->empty();
+}
+
+bool
+S9sObjectView::hasProperty(
+        const S9sString &name) const
+{
+    return m_properties->contains(name);
+}
+
+/**
+ * \returns The reference of the property in the viewed map or the invalid
+ *   variant if the object has no such property. Nothing is copied.
+ */
+const S9sVariant &
+S9sObjectView::property(
+        const S9sString &name) const
+{
+    S9sVariantMap::const_iterator it = m_properties->find(name);
+
+    if (it == m_properties->end())
+        return sm_invalid;
+
+    return it->second;
+}
+
+const S9sVariantMap &
+S9sObjectView::toVariantMap() const
+{
+    return *m_properties;
+}
+
+S9sString 
+S9sObjectView::className() const 
+{
+    return property("class_name").toString();
+}
@@ -0,0 +1,51 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sVariantMap"
+
+/**
+ * A light weight, read-only view of an object (a host, a cluster, a job...) in
+ * a parsed reply. Unlike the S9sObject the view does not copy the properties,
+ * it points into the map of the reply, so it can be used to filter and sort
+ * the items of a list before the ones that are actually printed are copied
+ * into S9sObject instances.
+ *
+ * The view must not outlive the map it was created from.
+ */
+class S9sObjectView
+{
+    public:
+        S9sObjectView();
+        S9sObjectView(const S9sVariantMap &properties);
+        S9sObjectView(const S9sVariant &properties);
+
+        bool isValid() const;
+        bool hasProperty(const S9sString &name) const;
+        const S9sVariant &property(const S9sString &name) const;
+
+        const S9sVariantMap &toVariantMap() const;
+        S9sString className() const;
+
+    protected:
+        const S9sVariantMap *m_properties;
+        
+        static const S9sVariant  sm_invalid;
+};
@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9soptions.h"
+#include "S9sOutput"
 
 #include "config.h"
 #include "S9sNode"
@@ -38,6 +39,8 @@
 #include <unistd.h>
 #include <cctype>
 #include <fnmatch.h>
+#include <signal.h>
+#include <string.h>
 
 // for build/version info
 #include "../config.h"
@@ -47,6 +50,10 @@
 #include "s9sdebug.h"
 
 S9sOptions *S9sOptions::sm_instance = 0;
+
+std::atomic<int>  S9sOptions::sm_terminalWidth(80);
+std::atomic<int>  S9sOptions::sm_terminalHeight(25);
+std::atomic<bool> S9sOptions::sm_terminalSizeValid(false);
 S9sString   S9sOptions::sm_defaultUserConfigFileName;
 S9sString   S9sOptions::sm_defaultSystemConfigFileName;
 
@@ -55,6 +62,7 @@ enum S9sOptionType
     OptionRpcTls     = 1000,
     OptionPrintJson,
     OptionPrintRequest,
+    OptionPrintTimings,
     OptionColor,
     OptionConfigFile,
     OptionTop,
@@ -425,6 +433,8 @@ enum S9sOptionType
     OptionDbSchemaDate,
     OptionDbSchemaName,
     OptionSetupLogRotate,
+    OptionShell,
+    OptionControllers,
 };
 
 /**
@@ -432,11 +442,10 @@ enum S9sOptionType
  */
 S9sOptions::S9sOptions() :
     m_operationMode(NoMode),
-    m_exitStatus(EXIT_SUCCESS)
+    m_exitStatus(EXIT_SUCCESS),
+    m_resolved(false),
+    m_resolvedClusterId(S9S_INVALID_CLUSTER_ID)
 {
-    S9sString   theString;
-    const char *tmp;
-
     sm_instance = this;
 
     /*
@@ -488,20 +497,7 @@ S9sOptions::S9sOptions() :
     m_modes["replications"] = Replication;
     m_modes["dbschema"]     = DbSchema;
 
-    /*
-     * Reading environment variables and storing them as settings.
-     */
-    tmp = getenv("CMON_CONTROLLER");
-    if (tmp)
-    {
-        setController(tmp);
-    }
-
-    theString = getenv("CMON_CLUSTER_ID");
-    if (!theString.empty())
-    {
-        m_options["cluster_id"] = theString.toInt();
-    }
+    readEnvironment();
 }
 
 /**
@@ -524,6 +520,49 @@ S9sOptions::instance()
     return sm_instance;
 }
 
+/**
+ * Reading environment variables and storing them as settings.
+ */
+void
+S9sOptions::readEnvironment()
+{
+    S9sString   theString;
+    const char *tmp;
+
+    tmp = getenv("CMON_CONTROLLER");
+    if (tmp)
+    {
+        setController(tmp);
+    }
+
+    theString = getenv("CMON_CLUSTER_ID");
+    if (!theString.empty())
+    {
+        m_options["cluster_id"] = theString.toInt();
+    }
+}
+
+/**
+ * Forgets everything the previous command line set (the options, the mode, the
+ * exit status and the error message) so that the next command line can be
+ * processed by readOptions() in the same process. The loaded configuration
+ * files and the state are kept, this is what the --shell mode uses to execute
+ * one command after the other.
+ */
+void
+S9sOptions::reset()
+{
+    m_operationMode = NoMode;
+    m_exitStatus    = EXIT_SUCCESS;
+    m_errorMessage.clear();
+    m_options.clear();
+    m_extraArguments.clear();
+    m_allOptions.clear();
+    
+    readEnvironment();
+    invalidateResolvedOptions();
+}
+
 /**
  * This method should be called before exiting the application to destroy the
  * singleton instance.
@@ -680,6 +719,7 @@ S9sOptions::loadConfigFiles()
 
     m_userConfig   = S9sConfigFile();
     m_systemConfig = S9sConfigFile();
+    invalidateResolvedOptions();
 
     /*
      * If the user specified a config file name in the command line we load that
@@ -918,6 +958,35 @@ S9sOptions::controllerPort()
     return retval;
 }
 
+/**
+ * \returns True if the --controllers command line option was provided, the
+ *   list request should be sent to multiple controllers then.
+ */
+bool
+S9sOptions::hasControllers() const
+{
+    return m_options.contains("controllers");
+}
+
+/**
+ * \returns The URLs of the controllers from the --controllers=LIST command
+ *   line option or if the list is not provided there from the "controllers"
+ *   configuration variable.
+ */
+S9sVariantList
+S9sOptions::controllers() const
+{
+    S9sString listString = getString("controllers");
+
+    if (listString.empty())
+        listString = m_userConfig.variableValue("controllers");
+
+    if (listString.empty())
+        listString = m_systemConfig.variableValue("controllers");
+
+    return listString.split(";, ");
+}
+
 S9sString
 S9sOptions::controllerPath()
 {
@@ -1611,6 +1680,40 @@ S9sOptions::logFile() const
     return retval;
 }
 
+/**
+ * \returns The size in bytes when the log file is rotated as it is set in the
+ *   "log_file_max_size" configuration variable, 0 if the file should not be
+ *   rotated.
+ */
+ulonglong
+S9sOptions::logFileMaxSize() const 
+{
+    S9sString retval;
+
+    retval = m_userConfig.variableValue("log_file_max_size");
+    if (retval.empty())
+        retval = m_systemConfig.variableValue("log_file_max_size");
+
+    return retval.toULongLong();
+}
+
+/**
+ * \returns The lowest severity that is written into the log file as it is set
+ *   in the "log_level" configuration variable, the empty string if it is not
+ *   set.
+ */
+S9sString
+S9sOptions::logLevel() const 
+{
+    S9sString retval;
+
+    retval = m_userConfig.variableValue("log_level");
+    if (retval.empty())
+        retval = m_systemConfig.variableValue("log_level");
+
+    return retval;
+}
+
 /**
  * \param value the node list as a string using field separators that the
  *   S9sString::split() function can interpret.
@@ -2115,17 +2218,10 @@ S9sString
 S9sOptions::formatDateTime(
         S9sDateTime value) const
 {
-    S9sString formatString;
-
-    if (m_options.contains("date_format"))
-        return value.toString(m_options.at("date_format").toString());
-
-    formatString = m_userConfig.variableValue("date_format");
-    if (formatString.empty())
-        formatString = m_systemConfig.variableValue("date_format");
+    resolveOptions();
 
-    if (!formatString.empty())
-        return value.toString(formatString);
+    if (!m_resolvedDateFormat.empty())
+        return value.toString(m_resolvedDateFormat);
 
     // The default date&time format.
     return value.toString(S9sDateTime::CompactFormat);
@@ -2215,22 +2311,8 @@ S9sOptions::offset() const
 int
 S9sOptions::clusterId() const
 {
-    int retval = S9S_INVALID_CLUSTER_ID;
-
-    if (m_options.contains("cluster_id"))
-    {
-        retval = m_options.at("cluster_id").toInt(S9S_INVALID_CLUSTER_ID);
-    } else {
-        S9sString stringVal = m_userConfig.variableValue("default_cluster_id");
-
-        if (stringVal.empty())
-            stringVal = m_systemConfig.variableValue("default_cluster_id");
-
-        if (!stringVal.empty())
-            retval = stringVal.toInt(S9S_INVALID_CLUSTER_ID);
-    }
-
-    return retval;
+    resolveOptions();
+    return m_resolvedClusterId;
 }
 
 /**
@@ -2239,7 +2321,8 @@ S9sOptions::clusterId() const
 bool
 S9sOptions::hasClusterIdOption() const
 {
-    return m_options.contains("cluster_id");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedHasClusterId];
 }
 
 bool
@@ -5515,7 +5598,8 @@ S9sOptions::isListFilesRequested() const
 bool
 S9sOptions::isLongRequested() const
 {
-    return getBool("long");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedLong];
 }
 
 /**
@@ -5525,7 +5609,8 @@ S9sOptions::isLongRequested() const
 bool
 S9sOptions::isJsonRequested() const
 {
-    return getBool("print_json");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedJson];
 }
 
 /**
@@ -5538,6 +5623,37 @@ S9sOptions::isJsonRequestRequested() const
     return getBool("print_request");
 }
 
+/**
+ * \returns true if the --shell command line option was provided, the program
+ *   should read and execute the commands one after the other then.
+ */
+bool
+S9sOptions::isShellRequested() const
+{
+    return m_options.contains("shell");
+}
+
+/**
+ * \returns The path of the UNIX domain socket where the --shell mode should
+ *   accept the connections or the empty string if the commands should be read
+ *   from the standard input.
+ */
+S9sString
+S9sOptions::shellSocketPath() const
+{
+    return getString("shell");
+}
+
+/**
+ * \returns true if the --print-timings command line option was provided when
+ *   the program was started.
+ */
+bool
+S9sOptions::isPrintTimingsRequested() const
+{
+    return getBool("print_timings");
+}
+
 /**
  * \returns true if the --top command line option was provided when starting the
  *   program.
@@ -5563,7 +5679,8 @@ S9sOptions::isWaitRequested() const
 bool
 S9sOptions::isBatchRequested() const
 {
-    return getBool("batch");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedBatch];
 }
 
 /**
@@ -5573,10 +5690,8 @@ S9sOptions::isBatchRequested() const
 bool
 S9sOptions::isNoHeaderRequested() const
 {
-    if (isBatchRequested())
-        return true;
-    
-    return getBool("no_header");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedNoHeader];
 }
 
 /**
@@ -5588,15 +5703,23 @@ bool
 S9sOptions::isStringMatchExtraArguments(
         const S9sString &theString) const
 {
-    if (m_extraArguments.empty())
+    resolveOptions();
+
+    if (m_resolvedPatterns.empty())
         return true;
 
-    for (uint idx = 0u; idx < m_extraArguments.size(); ++idx)
+    for (uint idx = 0u; idx < m_resolvedPatterns.size(); ++idx)
     {
-        const S9sString &pattern = m_extraArguments[idx].toString();
+        const S9sString &pattern = m_resolvedPatterns[idx];
 
-        if (fnmatch(STR(pattern), STR(theString), FNM_EXTMATCH) == 0)
+        if (!m_resolvedWildcards[idx])
+        {
+            if (pattern == theString)
+                return true;
+        } else if (fnmatch(STR(pattern), STR(theString), FNM_EXTMATCH) == 0)
+        {
             return true;
+        }
     }
 
     return false;
@@ -5637,6 +5760,7 @@ S9sOptions::addExtraArgument(
         const S9sString &argument)
 {
     m_extraArguments << argument;
+    invalidateResolvedOptions();
 }
 
 /**
@@ -5678,36 +5802,8 @@ S9sOptions::extraArgument(
 bool
 S9sOptions::useSyntaxHighlight() 
 {
-    S9sString configValue;
-
-    if (isBatchRequested())
-        return false;
-
-    if (m_options.contains("color"))
-    {
-        configValue = m_options.at("color").toString();
-    } else {
-        configValue = m_userConfig.variableValue("color");
-
-        if (configValue.empty())
-            configValue = m_systemConfig.variableValue("color");
-    }
-
-    if (configValue.empty())
-        configValue = "auto";
-
-    if (configValue.toLower() == "auto")
-    {
-        if (isBatchRequested())
-            return false;
-
-        return isatty(fileno(stdout)) ? true : false;
-    } else if (configValue.toLower() == "always")
-    {
-        return true;
-    }
-
-    return false;
+    resolveOptions();
+    return m_resolvedFlags[ResolvedSyntaxHighlight];
 }
 
 bool
@@ -5719,33 +5815,8 @@ S9sOptions::noWrap() const
 bool
 S9sOptions::truncate()
 {
-    S9sString configValue;
-
-    if (m_options.contains("truncate"))
-    {
-        configValue = m_options.at("truncate").toString();
-    } else {
-        configValue = m_userConfig.variableValue("truncate");
-
-        if (configValue.empty())
-            configValue = m_systemConfig.variableValue("truncate");
-    }
-
-    if (configValue.empty())
-        configValue = "auto";
-
-    if (configValue.toLower() == "auto")
-    {
-        if (isBatchRequested())
-            return false;
-
-        return isatty(fileno(stdout)) ? true : false;
-    } else if (configValue.toLower() == "always")
-    {
-        return true;
-    }
-
-    return false;
+    resolveOptions();
+    return m_resolvedFlags[ResolvedTruncate];
 }
 
 /**
@@ -5755,7 +5826,8 @@ S9sOptions::truncate()
 bool
 S9sOptions::humanReadable() const
 {
-    return getBool("human_readable");
+    resolveOptions();
+    return m_resolvedFlags[ResolvedHumanReadable];
 }
 
 void
@@ -5763,6 +5835,7 @@ S9sOptions::setHumanReadable(
         const bool value)
 {
     m_options["human_readable"] = value;
+    invalidateResolvedOptions();
 }
 
 S9sString 
@@ -5786,20 +5859,10 @@ S9sOptions::isTerminal()
 int 
 S9sOptions::terminalWidth() 
 {
-    S9sString      theString;
-    struct winsize win;
-    int            retcode;
-
-    retcode = ioctl(STDOUT_FILENO, TIOCGWINSZ, &win);
-
-    if (retcode == 0)
-        return win.ws_col;
+    if (!sm_terminalSizeValid)
+        resolveTerminalSize();
 
-    theString = getenv("COLUMNS");
-    if (!theString.empty())
-        return theString.toInt();
-
-    return 80;
+    return sm_terminalWidth;
 }
 
 /**
@@ -5808,14 +5871,63 @@ S9sOptions::terminalWidth()
 int 
 S9sOptions::terminalHeight() 
 {
+    if (!sm_terminalSizeValid)
+        resolveTerminalSize();
+
+    return sm_terminalHeight;
+}
+
+/**
+ * Asks the size of the terminal and stores it, so the printing code can ask
+ * it for every line without a system call. The first call installs a SIGWINCH
+ * handler, so the size is asked again when the terminal is resized while the
+ * monitors (e.g. "s9s job --wait") are running.
+ */
+void
+S9sOptions::resolveTerminalSize()
+{
+    static std::atomic<bool> handlerInstalled(false);
     struct winsize win;
-    int            retcode;
+    S9sString      theString;
+    int            width  = 80;
+    int            height = 25;
 
-    retcode = ioctl(STDOUT_FILENO, TIOCGWINSZ, &win);
-    if (retcode == 0)
-        return win.ws_row;
+    if (!handlerInstalled.exchange(true))
+    {
+        struct sigaction action;
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = terminalSizeChanged;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESTART;
+        sigaction(SIGWINCH, &action, NULL);
+    }
 
-    return 25;
+    sm_terminalSizeValid = true;
+
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &win) == 0)
+    {
+        width  = win.ws_col;
+        height = win.ws_row;
+    } else {
+        theString = getenv("COLUMNS");
+        if (!theString.empty())
+            width = theString.toInt();
+    }
+
+    sm_terminalWidth  = width;
+    sm_terminalHeight = height;
+}
+
+/**
+ * The SIGWINCH handler, only marks the stored terminal size as outdated.
+ */
+void
+S9sOptions::terminalSizeChanged(
+        int signal)
+{
+    S9S_UNUSED(signal);
+    sm_terminalSizeValid = false;
 }
 
 
@@ -5944,7 +6056,7 @@ S9sOptions::printVerbose(
     theString.vsprintf (formatString, arguments);
     va_end(arguments);
 
-    printf("%s\n", STR(theString));
+    S9sOutput::printf("%s\n", STR(theString));
 }
 
 /**
@@ -5990,6 +6102,8 @@ S9sOptions::readOptions(
 {
     bool retval = true;
 
+    invalidateResolvedOptions();
+
     // Reconstructing the command line from argv[]. This is used for debugging.
     m_allOptions = "";
     for (int idx = 0; argv[idx] != NULL; ++idx)
@@ -6220,6 +6334,8 @@ S9sOptions::readOptions(
             break;
     }
 
+    // The checks might have resolved the options before all were read.
+    invalidateResolvedOptions();
     return retval;
 }
 
@@ -6238,25 +6354,25 @@ S9sOptions::executeInfoRequest()
 
     if (m_options["print-version"].toBoolean())
     {
-        printf("      ___            _              _     \n"
+        S9sOutput::printf("      ___            _              _     \n"
                " ___ / _ \\ ___      | |_ ___   ___ | |___ \n"
                "/ __| (_) / __|_____| __/ _ \\ / _ \\| / __|\n"
                "\\__ \\\\__, \\__ \\_____| || (_) | (_) | \\__ \\\n"
                "|___/  /_/|___/      \\__\\___/ \\___/|_|___/\n");
-        printf("\n");
+        S9sOutput::printf("\n");
 
-        printf("%s version %s (Sweden)\n",
+        S9sOutput::printf("%s version %s (Sweden)\n",
             PACKAGE_NAME, BUILD_VERSION);
 
         /*
          * Older installer scripts (install-s9s-tools.sh) are grepping
          * for uppercase 'BUILD', so lets keep it like that for a while
          */
-        printf("BUILD (%s-%s) %s\n",
+        S9sOutput::printf("BUILD (%s-%s) %s\n",
             BUILD_VERSION, GIT_VERSION, BUILD_DATE);
 
-        printf("Copyright (C) 2016-2022 Severalnines AB\n");
-        printf("\n");
+        S9sOutput::printf("Copyright (C) 2016-2022 Severalnines AB\n");
+        S9sOutput::printf("\n");
         //printf("Written by ...\n");
         return true;
     } else if (m_options.contains("help") && m_options["help"].toBoolean())
@@ -6399,7 +6515,7 @@ S9sOptions::printHelp()
 void 
 S9sOptions::printHelpGeneric()
 {
-    printf(
+    S9sOutput::printf(
 "Usage:\n"
 "  %s COMMAND [OPTION...]\n"
 "\n"
@@ -6430,6 +6546,7 @@ S9sOptions::printHelpGeneric()
 "  -p, --password=PASSWORD    The password for the Cmon user.\n"
 "  --private-key-file=FILE    The name of the file for authentication.\n"
 "  --rpc-tls                  Use TLS encryption to controller.\n"
+"  --shell[=SOCKET]           Execute the commands read from stdin or socket.\n"
 "  -u, --cmon-user=USERNAME   The username on the Cmon system.\n"
 "  -v, --verbose              Print more messages than normally.\n"
 "  -V, --version              Print version information and exit.\n"
@@ -6444,6 +6561,7 @@ S9sOptions::printHelpGeneric()
 "  --only-ascii               Do not use UTF8 characters.\n"
 "  --print-json               Print the sent/received JSon messages.\n"
 "  --print-request            Print the sent JSon request message.\n"
+"  --print-timings            Print the timings of the RPC requests at exit.\n"
 "\n"
 "Job related options:\n"
 "  --job-tags=LIST            Set job tags when creating a new job.\n"
@@ -6460,7 +6578,7 @@ S9sOptions::printHelpJob()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"job\" command:\n"
 "  --clone                    Clone and re-run a job.\n"
 "  --delete                   Delete the job referenced by the job ID.\n"
@@ -6499,7 +6617,7 @@ S9sOptions::printHelpProcess()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"process\" command:\n"
 "  --list-digests             Print statement patters/statement digests.\n"
 "  --list                     List the processes.\n"
@@ -6528,7 +6646,7 @@ S9sOptions::printHelpBackup()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"backup\" command:\n"
 "  --create                       Create a new backup.\n"
 "  --create-schedule              Crate a backup schedule.\n"
@@ -6550,6 +6668,7 @@ S9sOptions::printHelpBackup()
 "\n"
 "  --backup-id=ID             The ID of the backup.\n"
 "  --cluster-id=ID            The ID of the cluster.\n"
+"  --controllers[=LIST]       List the backups of all the controllers.\n"
 "  --nodes=NODELIST           The list of nodes involved in the backup.\n"
 "\n"
 "  --backup-datadir           Backup the SQL data directory before restoring.\n"
@@ -6592,7 +6711,7 @@ S9sOptions::printHelpMaintenance()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"maintenance\" command:\n"
 "  --create                   Create a new maintenance period.\n"
 "  --current                  Print information about the active maintenance.\n"
@@ -6618,7 +6737,7 @@ S9sOptions::printHelpMetaType()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"metatype\" command:\n"
 "  --list                     List all the metatypes.\n"
 "  --list-cluster-types       Lists the supported cluster types.\n"
@@ -6639,7 +6758,7 @@ S9sOptions::printHelpUser()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"user\" command:\n"
 "  --add-key                  Register a new public key for a user.\n"
 "  --add-to-group             Add the user to a group.\n"
@@ -6693,7 +6812,7 @@ S9sOptions::printHelpGroup()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"group\" command:\n"
 "  --create                   Create a new Cmon user.\n"
 "  --delete                   Delete existing user.\n"
@@ -6711,7 +6830,7 @@ S9sOptions::printHelpAccount()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"account\" command:\n"
 "  --create                   Create a new account on the cluster.\n"
 "  --delete                   Remove the account from the cluster.\n"
@@ -6731,7 +6850,7 @@ S9sOptions::printHelpCluster()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"cluster\" command:\n"
 "  --add-node                 Add a new node to the cluster.\n"
 "  --change-config            Changes the configuration for the cluster.\n"
@@ -6780,6 +6899,7 @@ S9sOptions::printHelpCluster()
 "  --cluster-type=TYPE        The type of the cluster to install. Currently\n"
 "  --config-template=FILE     Use the given file as configuration template.\n"
 "  --containers=LIST          List of containers to be created.\n"
+"  --controllers[=LIST]       List the clusters of all the controllers.\n"
 "  --credential-id=ID         The optional cloud credential ID.\n"
 "  --datadir=DIRECTORY        The directory on the node that holds the data.\n"
 "  --db-admin-passwd=PASSWD   The password for the database admin.\n"
@@ -6801,6 +6921,7 @@ S9sOptions::printHelpCluster()
 "  --os-password=PASSWORD     The password to set on the container.\n"
 "  --os-user=USERNAME         The name of the user for the SSH commands.\n"
 "  --output-dir=DIR           The directory where the files are created.\n"
+"  --parallellism=N           How many controllers are queried at once.\n"
 "  --provider-version=VER     The version of the software.\n" 
 "  --remote-cluster-id=ID     Remote cluster ID for the c2c replication.\n"
 "  --db-cluster-id=ID         cluster ID when there is no cluster, only data on db.\n"
@@ -6850,7 +6971,7 @@ S9sOptions::printHelpContainer()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"container\" command:\n"
 "  --create                   Create and start a new container.\n"
 "  --delete                   Stop and delete the container.\n"
@@ -6884,7 +7005,7 @@ S9sOptions::printHelpNode()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"node\" command:\n"
 "  --change-config            Change the configuration for a node.\n"
 "  --enable-binary-logging    Enables binary logs on a node.\n"
@@ -6916,6 +7037,7 @@ S9sOptions::printHelpNode()
 "  --opt-name=NAME            The name of the configuration option.\n"
 "  --opt-value=VALUE          The value of the configuration option.\n"
 "  --output-dir=DIR           The directory where the files are created.\n"
+"  --parallellism=N           Number of nodes to pull the config from at once.\n"
 "  --properties=ASSIGNMENTS   Names and values of the properties to change.\n"
 "\n"
 "Load balancer related options\n"
@@ -6932,7 +7054,7 @@ S9sOptions::printHelpScript()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"script\" command:\n"
 "  --execute                  Execute a CJS imparetive program.\n"
 "  --run                      Run a CDT entry as a job.\n"
@@ -6949,7 +7071,7 @@ S9sOptions::printHelpSheet()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"sheet\" command:\n"
 "  --create                   Create a new spreadsheet.\n"
 "  --edit                     Edit a spreadsheet.\n"
@@ -6966,7 +7088,7 @@ S9sOptions::printHelpServer()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"server\" command:\n"
 "  --add-acl                  Adds a new ACL entry to the object.\n"
 "  --create                   Creates a new server.\n"
@@ -7002,7 +7124,7 @@ S9sOptions::printHelpController()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"controller\" command:\n"
 "  --create-snapshot          Creates a controller to controller snapshot.\n"
 "  --enable-cmon-ha           Enables the Cmon HA mode.\n"
@@ -7019,7 +7141,7 @@ S9sOptions::printHelpTree()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"tree\" command:\n"
 "  --access                   Check access rights for a CDT entry.\n"
 "  --add-acl                  Adds a new ACL entry to the object.\n"
@@ -7057,7 +7179,7 @@ S9sOptions::printHelpLog()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"log\" command:\n"
 "  --list                     List the log messages, print the log.\n"
 "\n"
@@ -7079,7 +7201,7 @@ S9sOptions::printHelpEvent()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"event\" command:\n"
 "  --list                     List the events as they are detected.\n"
 "  --watch                    Open an interactive UI to monitor events.\n"
@@ -7125,11 +7247,14 @@ S9sOptions::printHelpAlarm()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"alarm\" command:\n"
 "  --delete                   Set the alarm to be ignored.\n"
 "  --list                     List the alarms.\n"
 "  --stat                     Prints a short list about the number of alarms.\n"
+"\n"
+"  --controllers[=LIST]       List the alarms of all the controllers.\n"
+"  --parallellism=N           How many controllers are queried at once.\n"
 "\n"
     );
 }
@@ -7142,7 +7267,7 @@ S9sOptions::printHelpReport()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"report\" command:\n"
 "  --cat                      Prints the report test of one report.\n"
 "  --create                   Creates a new report.\n"
@@ -7163,7 +7288,7 @@ S9sOptions::printHelpReplication()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"replication\" command:\n"
 "  --failover                 Take the role of master from a failed master.\n"
 "  --list                     List the replication links.\n"
@@ -7190,11 +7315,12 @@ S9sOptions::printHelpDbSchema()
 {
     printHelpGeneric();
 
-    printf(
+    S9sOutput::printf(
 "Options for the \"dbschema\" command:\n"
 "  --dbgrowth                 Tells to retrieve the database growth.\n"
 "  --cluster-id=ID            The ID of the cluster.\n"
 "  --date=DATE                The date of getting the database information.\n"
+"  --limit=N                  Print only the N largest items.\n"
 "  --name=STRING              The name of a database.\n"
 "\n"
     );
@@ -7225,6 +7351,7 @@ S9sOptions::readOptionsNode(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0,  4                    },
         { "no-header",        no_argument,       0, OptionNoHeader        },
@@ -7274,6 +7401,7 @@ S9sOptions::readOptionsNode(
         { "opt-name",         required_argument, 0, OptionOptName         },
         { "opt-value",        required_argument, 0, OptionOptValue        }, 
         { "output-dir",       required_argument, 0, OptionOutputDir       },
+        { "parallellism",     required_argument, 0, OptionParallellism    },
         { "node-format",      required_argument, 0, OptionNodeFormat      }, 
 
         // Options for ProxySql.
@@ -7516,6 +7644,11 @@ S9sOptions::readOptionsNode(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -7562,6 +7695,13 @@ S9sOptions::readOptionsNode(
                 m_options["output_dir"] = optarg;
                 break;
 
+            case OptionParallellism:
+                // --parallellism=N
+                if (!setParallellism(optarg))
+                    return false;
+
+                break;
+
             case OptionForce:
                 // --force
                 m_options["force"] = true;
@@ -7685,6 +7825,7 @@ S9sOptions::readOptionsBackup(
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "controller-port",  required_argument, 0, 'P'                   },
         { "controller",       required_argument, 0, 'c'                   },
+        { "controllers",      optional_argument, 0, OptionControllers     },
         { "date-format",      required_argument, 0, OptionDateFormat      },
         { "debug",            no_argument,       0, OptionDebug           },
         { "dry",              no_argument,       0, OptionDry             },
@@ -7694,6 +7835,7 @@ S9sOptions::readOptionsBackup(
         { "password",         required_argument, 0, 'p'                   }, 
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "private-key-file", required_argument, 0, OptionPrivateKeyFile  }, 
         { "rpc-tls",          no_argument,       0, OptionRpcTls          },
         { "time-style",       required_argument, 0, OptionTimeStyle       },
@@ -7846,6 +7988,14 @@ S9sOptions::readOptionsBackup(
                 setController(optarg);
                 break;
 
+            case OptionControllers:
+                // --controllers[=LIST]
+                if (optarg)
+                    m_options["controllers"] = optarg;
+                else
+                    m_options["controllers"] = "";
+                break;
+
             case 'P':
                 // -P, --controller-port=PORT
                 m_options["controller_port"] = atoi(optarg);
@@ -8004,6 +8154,11 @@ S9sOptions::readOptionsBackup(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -8549,6 +8704,7 @@ S9sOptions::readOptionsLog(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0,  4                    },
         { "no-header",        no_argument,       0, OptionNoHeader        },
@@ -8691,6 +8847,11 @@ S9sOptions::readOptionsLog(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -8793,6 +8954,7 @@ S9sOptions::readOptionsEvent(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0,  4                    },
         { "no-header",        no_argument,       0, OptionNoHeader        },
@@ -8968,6 +9130,11 @@ S9sOptions::readOptionsEvent(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -9168,6 +9335,8 @@ S9sOptions::readOptionsAlarm(
         { "config-file",      required_argument, 0,  4                    },
         { "controller-port",  required_argument, 0, 'P'                   },
         { "controller",       required_argument, 0, 'c'                   },
+        { "controllers",      optional_argument, 0, OptionControllers     },
+        { "parallellism",     required_argument, 0, OptionParallellism    },
         { "debug",            no_argument,       0, OptionDebug           },
         { "help",             no_argument,       0, OptionHelp            },
         { "human-readable",   no_argument,       0, 'h'                   },
@@ -9176,6 +9345,7 @@ S9sOptions::readOptionsAlarm(
         { "password",         required_argument, 0, 'p'                   }, 
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "private-key-file", required_argument, 0, OptionPrivateKeyFile  }, 
         { "rpc-tls",          no_argument,       0, OptionRpcTls          },
         { "verbose",          no_argument,       0, 'v'                   },
@@ -9253,6 +9423,21 @@ S9sOptions::readOptionsAlarm(
                 setController(optarg);
                 break;
 
+            case OptionControllers:
+                // --controllers[=LIST]
+                if (optarg)
+                    m_options["controllers"] = optarg;
+                else
+                    m_options["controllers"] = "";
+                break;
+
+            case OptionParallellism:
+                // --parallellism=N
+                if (!setParallellism(optarg))
+                    return false;
+
+                break;
+
             case 'P':
                 // -P, --controller-port=PORT
                 m_options["controller_port"] = atoi(optarg);
@@ -9301,6 +9486,11 @@ S9sOptions::readOptionsAlarm(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -9394,6 +9584,7 @@ S9sOptions::readOptionsReport(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0,  4                    },
         { "no-header",        no_argument,       0, OptionNoHeader        },
@@ -9520,6 +9711,11 @@ S9sOptions::readOptionsReport(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -9625,6 +9821,7 @@ S9sOptions::readOptionsReplication(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0,  4                    },
         { "no-header",        no_argument,       0, OptionNoHeader        },
@@ -9769,6 +9966,11 @@ S9sOptions::readOptionsReplication(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -9961,6 +10163,7 @@ S9sOptions::readOptionsDbSchema(
                     {"password",         required_argument, 0, 'p'},
                     {"print-json",       no_argument,       0, OptionPrintJson},
                     {"print-request",    no_argument,       0, OptionPrintRequest},
+                    {"print-timings",    no_argument,       0, OptionPrintTimings},
                     {"private-key-file", required_argument, 0, OptionPrivateKeyFile},
                     {"rpc-tls",          no_argument,       0, OptionRpcTls},
                     {"verbose",          no_argument,       0, 'v'},
@@ -9975,6 +10178,7 @@ S9sOptions::readOptionsDbSchema(
 
                     // Database attributes related options.
                     {"name",             required_argument, 0, OptionDbSchemaName},
+                    {"limit",            required_argument, 0, OptionLimit},
 
                     {0, 0,                                  0, 0}
             };
@@ -10081,6 +10285,11 @@ S9sOptions::readOptionsDbSchema(
                 m_options["print_request"] = true;
                 break;
 
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
+
             case OptionRpcTls:
                 // --rpc-tls
                 m_options["rpc_tls"] = true;
@@ -10114,6 +10323,11 @@ S9sOptions::readOptionsDbSchema(
                 m_options["name"] = optarg;
                 break;
 
+            case OptionLimit:
+                // --limit=NUMBER
+                m_options["limit"] = optarg;
+                break;
+
             case '?':
             default:
             S9S_WARNING("Unrecognized command line option.");
@@ -11017,6 +11231,7 @@ S9sOptions::readOptionsProcess(
         { "password",         required_argument, 0, 'p'                   }, 
         { "print-json",       no_argument,       0,  OptionPrintJson      },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "private-key-file", required_argument, 0, OptionPrivateKeyFile  }, 
         { "rpc-tls",          no_argument,       0, OptionRpcTls          },
         { "sort-by-memory",   no_argument,       0, OptionSortByMemory    },
@@ -11175,6 +11390,11 @@ S9sOptions::readOptionsProcess(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionTop:
                 // --top
@@ -11280,6 +11500,7 @@ S9sOptions::readOptionsUser(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -11409,6 +11630,11 @@ S9sOptions::readOptionsUser(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionRpcTls:
                 // --rpc-tls
@@ -11659,6 +11885,7 @@ S9sOptions::readOptionsGroup(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -11754,6 +11981,11 @@ S9sOptions::readOptionsGroup(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionRpcTls:
                 // --rpc-tls
@@ -11847,6 +12079,7 @@ S9sOptions::readOptionsAccount(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -11956,6 +12189,11 @@ S9sOptions::readOptionsAccount(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionRpcTls:
                 // --rpc-tls
@@ -12143,6 +12381,7 @@ S9sOptions::readOptionsMaintenance(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -12285,6 +12524,11 @@ S9sOptions::readOptionsMaintenance(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionCreate:
                 // --create
@@ -12443,6 +12687,7 @@ S9sOptions::readOptionsMetaType(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -12563,6 +12808,11 @@ S9sOptions::readOptionsMetaType(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case 'L': 
                 // --list
@@ -12675,11 +12925,14 @@ S9sOptions::readOptionsCluster(
         { "password",         required_argument, 0, 'p'                   }, 
         { "private-key-file", required_argument, 0, OptionPrivateKeyFile  }, 
         { "controller",       required_argument, 0, 'c'                   },
+        { "controllers",      optional_argument, 0, OptionControllers     },
+        { "parallellism",     required_argument, 0, OptionParallellism    },
         { "controller-port",  required_argument, 0, 'P'                   },
         { "rpc-tls",          no_argument,       0,  OptionRpcTls         },
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "human-readable",   no_argument,       0, 'h'                   },
         { "config-file",      required_argument, 0, OptionConfigFile      },
@@ -12905,6 +13158,21 @@ S9sOptions::readOptionsCluster(
                 setController(optarg);
                 break;
 
+            case OptionControllers:
+                // --controllers[=LIST]
+                if (optarg)
+                    m_options["controllers"] = optarg;
+                else
+                    m_options["controllers"] = "";
+                break;
+
+            case OptionParallellism:
+                // --parallellism=N
+                if (!setParallellism(optarg))
+                    return false;
+
+                break;
+
             case 'P':
                 // -P, --controller-port=PORT
                 m_options["controller_port"] = atoi(optarg);
@@ -13150,6 +13418,11 @@ S9sOptions::readOptionsCluster(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionWait:
                 // --wait
@@ -13689,6 +13962,7 @@ S9sOptions::readOptionsContainer(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "human-readable",   no_argument,       0, 'h'                   },
         { "config-file",      required_argument, 0, OptionConfigFile      },
@@ -13825,6 +14099,11 @@ S9sOptions::readOptionsContainer(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionWait:
                 // --wait
@@ -14055,6 +14334,7 @@ S9sOptions::readOptionsJob(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0,  OptionPrintJson      },
         { "print-request",    no_argument,       0,  OptionPrintRequest   },
+        { "print-timings",    no_argument,       0,  OptionPrintTimings   },
         { "config-file",      required_argument, 0,  OptionConfigFile     },
         { "color",            optional_argument, 0,  OptionColor          },
         { "date-format",      required_argument, 0,  OptionDateFormat     },
@@ -14241,6 +14521,11 @@ S9sOptions::readOptionsJob(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case OptionBatch:
                 // --batch
@@ -14395,6 +14680,7 @@ S9sOptions::readOptionsScript(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -14520,6 +14806,11 @@ S9sOptions::readOptionsScript(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
            
             /*
              * Options about the cluster.
@@ -14665,6 +14956,7 @@ S9sOptions::readOptionsSheet(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "config-file",      required_argument, 0, OptionConfigFile      },
         { "batch",            no_argument,       0, OptionBatch           },
@@ -14789,6 +15081,11 @@ S9sOptions::readOptionsSheet(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
            
             /*
              * Options about the cluster.
@@ -14923,6 +15220,7 @@ S9sOptions::readOptionsServer(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "human-readable",   no_argument,       0, 'h'                   },
         { "config-file",      required_argument, 0, OptionConfigFile      },
@@ -15082,6 +15380,11 @@ S9sOptions::readOptionsServer(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case 'i':
                 // -i, --cluster-id=ID
@@ -15323,6 +15626,7 @@ S9sOptions::readOptionsController(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "human-readable",   no_argument,       0, 'h'                   },
         { "config-file",      required_argument, 0, OptionConfigFile      },
@@ -15476,6 +15780,11 @@ S9sOptions::readOptionsController(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             /*
              * Main options.
@@ -15622,6 +15931,7 @@ S9sOptions::readOptionsTree(
         { "long",             no_argument,       0, 'l'                   },
         { "print-json",       no_argument,       0, OptionPrintJson       },
         { "print-request",    no_argument,       0, OptionPrintRequest    },
+        { "print-timings",    no_argument,       0, OptionPrintTimings    },
         { "color",            optional_argument, 0, OptionColor           },
         { "human-readable",   no_argument,       0, 'h'                   },
         { "config-file",      required_argument, 0, OptionConfigFile      },
@@ -15772,6 +16082,11 @@ S9sOptions::readOptionsTree(
                 // --print-request
                 m_options["print_request"] = true;
                 break;
+
+            case OptionPrintTimings:
+                // --print-timings
+                m_options["print_timings"] = true;
+                break;
             
             case 'i':
                 // -i, --cluster-id=ID
@@ -16306,9 +16621,12 @@ S9sOptions::readOptionsNoMode(
         { "version",          no_argument,       0, 'V'                      },
         
         { "color",            optional_argument, 0, OptionColor              },
+        { "shell",            optional_argument, 0, OptionShell              },
         { 0, 0, 0, 0 }
     };
 
+    optind = 0;
+
     for (;;)
     {
         int option_index = 0;
@@ -16339,6 +16657,14 @@ S9sOptions::readOptionsNoMode(
                     m_options["color"] = "always";
                 break;
 
+            case OptionShell:
+                // --shell[=SOCKET]
+                if (optarg)
+                    m_options["shell"] = optarg;
+                else
+                    m_options["shell"] = "";
+                break;
+
             case '?':
             default:
                 S9S_WARNING("Unrecognized command line option.");
@@ -16497,6 +16823,127 @@ S9sOptions::userPreferencesToDelete() const
     return getString("preferences_to_delete");
 }
 
+/**
+ * Resolves the options that are read while printing every line of the output
+ * (e.g. --long, --batch, --color, date_format) into typed fields so that the
+ * accessors do not need to look up the option map and the configuration files
+ * every time. The fields are computed on the first call after the command
+ * line or the config files are (re)read.
+ */
+void
+S9sOptions::resolveOptions() const
+{
+    S9sString configValue;
+
+    if (m_resolved)
+        return;
+
+    m_resolvedFlags[ResolvedLong]          = getBool("long");
+    m_resolvedFlags[ResolvedJson]          = getBool("print_json");
+    m_resolvedFlags[ResolvedBatch]         = getBool("batch");
+    m_resolvedFlags[ResolvedNoHeader]      = 
+        m_resolvedFlags[ResolvedBatch] || getBool("no_header");
+    m_resolvedFlags[ResolvedHumanReadable] = getBool("human_readable");
+
+    /*
+     * The --color and --truncate options can be set in the config files too.
+     * The "auto" value means we use them when the output is a terminal.
+     */
+    m_resolvedFlags[ResolvedSyntaxHighlight] = false;
+    m_resolvedFlags[ResolvedTruncate]        = false;
+
+    if (!m_resolvedFlags[ResolvedBatch])
+    {
+        bool isTerminal = isatty(fileno(stdout)) ? true : false;
+
+        configValue = resolvedConfigValue("color").toLower();
+        if (configValue.empty() || configValue == "auto")
+            m_resolvedFlags[ResolvedSyntaxHighlight] = isTerminal;
+        else if (configValue == "always")
+            m_resolvedFlags[ResolvedSyntaxHighlight] = true;
+
+        configValue = resolvedConfigValue("truncate").toLower();
+        if (configValue.empty() || configValue == "auto")
+            m_resolvedFlags[ResolvedTruncate] = isTerminal;
+        else if (configValue == "always")
+            m_resolvedFlags[ResolvedTruncate] = true;
+    } else {
+        configValue = resolvedConfigValue("truncate").toLower();
+        if (configValue == "always")
+            m_resolvedFlags[ResolvedTruncate] = true;
+    }
+
+    m_resolvedDateFormat = resolvedConfigValue("date_format");
+
+    /*
+     * The cluster ID from the command line or the default from the config
+     * files.
+     */
+    m_resolvedFlags[ResolvedHasClusterId] = m_options.contains("cluster_id");
+    m_resolvedClusterId = S9S_INVALID_CLUSTER_ID;
+
+    if (m_resolvedFlags[ResolvedHasClusterId])
+    {
+        m_resolvedClusterId = 
+            m_options.at("cluster_id").toInt(S9S_INVALID_CLUSTER_ID);
+    } else {
+        configValue = m_userConfig.variableValue("default_cluster_id");
+
+        if (configValue.empty())
+            configValue = m_systemConfig.variableValue("default_cluster_id");
+
+        if (!configValue.empty())
+            m_resolvedClusterId = configValue.toInt(S9S_INVALID_CLUSTER_ID);
+    }
+
+    /*
+     * The extra arguments are matched against every name in the lists, the
+     * ones without wildcards are compared as strings.
+     */
+    m_resolvedPatterns.clear();
+    m_resolvedWildcards.clear();
+
+    for (uint idx = 0u; idx < m_extraArguments.size(); ++idx)
+    {
+        S9sString pattern = m_extraArguments[idx].toString();
+
+        m_resolvedPatterns  << pattern;
+        m_resolvedWildcards << (strpbrk(STR(pattern), "*?[\\(") != NULL);
+    }
+
+    m_resolved = true;
+}
+
+/**
+ * \returns The value of the option from the command line or if it is not
+ *   provided from the user's or the system config file.
+ */
+S9sString
+S9sOptions::resolvedConfigValue(
+        const char *key) const
+{
+    S9sString retval;
+
+    if (m_options.contains(key))
+        return m_options.at(key).toString();
+
+    retval = m_userConfig.variableValue(key);
+    if (retval.empty())
+        retval = m_systemConfig.variableValue(key);
+
+    return retval;
+}
+
+/**
+ * Marks the resolved options as outdated. This should be called every time the
+ * options or the configuration files change.
+ */
+void
+S9sOptions::invalidateResolvedOptions()
+{
+    m_resolved = false;
+}
+
 bool 
 S9sOptions::getBool(
         const char *key) const
@@ -27,6 +27,8 @@
 #include "S9sVariantMap"
 #include "S9sConfigFile"
 
+#include <atomic>
+
 class S9sDateTime;
 class S9sSshCredentials;
 
@@ -44,6 +46,7 @@ class S9sOptions
     public:
         static S9sOptions *instance();
         static void uninit();
+        void reset();
 
         /**
          * An enum for the main modes. When one writes for example 
@@ -103,6 +106,8 @@ class S9sOptions
         int controllerPort();
         S9sString controllerProtocol();
         S9sString controllerPath();
+        bool hasControllers() const;
+        S9sVariantList controllers() const;
 
         S9sString controllerUrl();
 
@@ -158,6 +163,8 @@ class S9sOptions
         S9sString inputFile() const;
         S9sString outputFile() const;
         S9sString logFile() const;
+        ulonglong logFileMaxSize() const;
+        S9sString logLevel() const;
 
         S9sString briefJobLogFormat() const;
         S9sString briefLogFormat() const;
@@ -614,6 +621,9 @@ class S9sOptions
         bool isLongRequested() const;
         bool isJsonRequested() const;
         bool isJsonRequestRequested() const;
+        bool isPrintTimingsRequested() const;
+        bool isShellRequested() const;
+        S9sString shellSocketPath() const;
         bool isTopRequested() const;
         bool isWaitRequested() const;
         bool isBatchRequested() const;
@@ -796,13 +806,44 @@ class S9sOptions
 
         bool setMode(const S9sString &modeName);
 
+        void resolveOptions() const;
+        S9sString resolvedConfigValue(const char *key) const;
+        void invalidateResolvedOptions();
+        void readEnvironment();
+
+        static void resolveTerminalSize();
+        static void terminalSizeChanged(int signal);
+
         S9sOptions();
         ~S9sOptions();
 
+        /**
+         * The options that are used while printing every single line of a
+         * list. These are resolved from the command line and the config
+         * files once and then read as plain fields.
+         */
+        enum ResolvedFlag
+        {
+            ResolvedLong,
+            ResolvedJson,
+            ResolvedBatch,
+            ResolvedNoHeader,
+            ResolvedHumanReadable,
+            ResolvedSyntaxHighlight,
+            ResolvedTruncate,
+            ResolvedHasClusterId,
+            NResolvedFlags
+        };
+
         static S9sString   sm_defaultUserConfigFileName;
         static S9sString   sm_defaultSystemConfigFileName;
         static S9sOptions *sm_instance;
 
+        /** The size of the terminal, resolved again after a SIGWINCH. */
+        static std::atomic<int>   sm_terminalWidth;
+        static std::atomic<int>   sm_terminalHeight;
+        static std::atomic<bool>  sm_terminalSizeValid;
+
     private:
         S9sMap<S9sString, OperationMode> m_modes;
         S9sFileName          m_myName;
@@ -816,6 +857,14 @@ class S9sOptions
         S9sVariantMap        m_state;
         /* Reconstructed command line for debugging purposes. */
         S9sString            m_allOptions;
+        /* The typed copies of the frequently used options. */
+        mutable bool         m_resolved;
+        mutable bool         m_resolvedFlags[NResolvedFlags];
+        mutable S9sString    m_resolvedDateFormat;
+        mutable int          m_resolvedClusterId;
+        /* The extra arguments as patterns, true if it has wildcards. */
+        mutable S9sVector<S9sString>  m_resolvedPatterns;
+        mutable S9sVector<bool>       m_resolvedWildcards;
 
     friend class UtS9sOptions;
     friend class UtS9sRpcClient;
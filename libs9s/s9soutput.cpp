@@ -0,0 +1,233 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9soutput.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "S9sMutexLocker"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The buffer is written to the standard output when it grows over this size.
+ */
+#define OUTPUT_BUFFER_SIZE (64 * 1024)
+
+/**
+ * The standard output is line buffered when it is a terminal, so that the user
+ * sees every line as soon as it is printed, and fully buffered otherwise, just
+ * like the stdio does it.
+ */
+S9sOutput::S9sOutput() :
+    m_lineBuffered(isatty(STDOUT_FILENO))
+{
+    m_buffer.reserve(OUTPUT_BUFFER_SIZE + 1024);
+    atexit(S9sOutput::flushAtExit);
+}
+
+S9sOutput *
+S9sOutput::instance()
+{
+    // Never deleted, so it is still there when the atexit() handler runs.
+    static S9sOutput *theInstance = new S9sOutput;
+
+    return theInstance;
+}
+
+void
+S9sOutput::flushAtExit()
+{
+    flush();
+}
+
+/**
+ * Prints a printf() style formatted string into the output buffer.
+ */
+void
+S9sOutput::printf(
+        const char *formatString,
+        ...)
+{
+    va_list arguments;
+
+    va_start(arguments, formatString);
+    vprintf(formatString, arguments);
+    va_end(arguments);
+}
+
+void
+S9sOutput::vprintf(
+        const char *formatString,
+        va_list     arguments)
+{
+    char    buffer[512];
+    int     nPrinted;
+    va_list argsCopy;
+
+    // The most frequent formats by far, nothing to format here.
+    if (formatString[0] == '%' && formatString[1] == 's' &&
+            formatString[2] == '\0')
+    {
+        write(va_arg(arguments, const char *));
+        return;
+    } else if (strchr(formatString, '%') == NULL)
+    {
+        write(formatString);
+        return;
+    }
+
+    va_copy(argsCopy, arguments);
+    nPrinted = vsnprintf(buffer, sizeof(buffer), formatString, arguments);
+    
+    if (nPrinted < 0)
+    {
+        S9S_WARNING("vsnprintf() failed: %m");
+    } else if (nPrinted < (int) sizeof(buffer))
+    {
+        write(buffer, nPrinted);
+    } else {
+        S9sString longString;
+
+        longString.vsprintf(formatString, argsCopy);
+        write(longString.data(), longString.length());
+    }
+
+    va_end(argsCopy);
+}
+
+void
+S9sOutput::write(
+        const char *text)
+{
+    if (text != NULL)
+        write(text, strlen(text));
+}
+
+void
+S9sOutput::write(
+        const S9sString &text)
+{
+    write(text.data(), text.length());
+}
+
+void
+S9sOutput::write(
+        const char *data,
+        size_t      length)
+{
+    if (length > 0)
+        instance()->append(data, length);
+}
+
+/**
+ * Writes everything that is in the buffer to the standard output.
+ */
+void
+S9sOutput::flush()
+{
+    S9sOutput      *output = instance();
+    S9sMutexLocker  locker(output->m_mutex);
+
+    output->writeBuffer();
+}
+
+/**
+ * \param lineBuffered True to write the buffer every time a line is finished,
+ *   false to write it only when it is full or flushed.
+ *
+ * The screen oriented user interfaces turn the line buffering off and flush
+ * once when the whole screen is printed.
+ */
+void
+S9sOutput::setLineBuffered(
+        bool lineBuffered)
+{
+    S9sOutput      *output = instance();
+    S9sMutexLocker  locker(output->m_mutex);
+
+    output->m_lineBuffered = lineBuffered;
+}
+
+bool
+S9sOutput::isLineBuffered()
+{
+    S9sOutput      *output = instance();
+    S9sMutexLocker  locker(output->m_mutex);
+
+    return output->m_lineBuffered;
+}
+
+void
+S9sOutput::append(
+        const char *data,
+        size_t      length)
+{
+    S9sMutexLocker  locker(m_mutex);
+
+    m_buffer.append(data, length);
+
+    if (m_buffer.length() >= OUTPUT_BUFFER_SIZE ||
+            (m_lineBuffered && memchr(data, '\n', length) != NULL))
+    {
+        writeBuffer();
+    }
+}
+
+/**
+ * Writes the buffer to the standard output. Whatever is still waiting in the
+ * stdio buffer of the standard output is written first, so the text printed by
+ * the printf() and the text printed here do not get mixed up.
+ */
+void
+S9sOutput::writeBuffer()
+{
+    const char *data   = m_buffer.data();
+    size_t      length = m_buffer.length();
+
+    if (length == 0u)
+        return;
+
+    fflush(stdout);
+
+    while (length > 0u)
+    {
+        ssize_t nWritten = ::write(STDOUT_FILENO, data, length);
+
+        if (nWritten < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            S9S_WARNING("write(): %m");
+            break;
+        }
+
+        data   += nWritten;
+        length -= nWritten;
+    }
+
+    m_buffer.clear();
+}
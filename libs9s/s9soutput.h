@@ -0,0 +1,66 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include "S9sString"
+#include "S9sMutex"
+
+/**
+ * The output sink all the printing code uses to write on the standard output.
+ * Instead of calling printf() for every little piece (field values, color
+ * sequences, separators) the text is collected in a large buffer and written
+ * with a single write() system call when the buffer is full, when a line is
+ * finished on a terminal or when flush() is called.
+ *
+ * Everything is static, there is only one standard output. The buffer is
+ * flushed automatically when the program exits.
+ */
+class S9sOutput
+{
+    public:
+        static void printf(const char *formatString, ...);
+        static void vprintf(const char *formatString, va_list arguments);
+
+        static void write(const char *text);
+        static void write(const S9sString &text);
+        static void write(const char *data, size_t length);
+
+        static void flush();
+
+        static void setLineBuffered(bool lineBuffered);
+        static bool isLineBuffered();
+
+    private:
+        S9sOutput();
+
+        static S9sOutput *instance();
+        static void flushAtExit();
+
+        void append(const char *data, size_t length);
+        void writeBuffer();
+
+    private:
+        S9sMutex     m_mutex;
+        S9sString    m_buffer;
+        bool         m_lineBuffered;
+};
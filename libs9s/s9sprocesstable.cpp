@@ -0,0 +1,318 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sprocesstable.h"
+
+#include "S9sVariantMap"
+#include "S9sOptions"
+
+#include <algorithm>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+static const S9sVariant &
+valueOf(const S9sVariantMap &map, 
+        const char          *key)
+{
+    static const S9sVariant empty;
+    S9sVariantMap::const_iterator it = map.find(key);
+
+    return it == map.end() ? empty : it->second;
+}
+
+S9sProcessTable::Row::Row() :
+    m_hostIndex(-1),
+    m_pid(0),
+    m_priority(0),
+    m_virtMem(0ull),
+    m_resMem(0ull),
+    m_cpuUsage(0.0),
+    m_memUsage(0.0),
+    m_cpuTime(-1.0),
+    m_matches(true),
+    m_generation(0u)
+{
+}
+
+S9sProcessTable::S9sProcessTable() :
+    m_generation(0u),
+    m_lastUpdate(0.0)
+{
+}
+
+/**
+ * \param hostList The "data" list of the getRunningProcesses reply, one map
+ *   with the "hostname" and the "processes" for every host.
+ * \param now The time of the reply in seconds, used to compute the CPU usage
+ *   from the CPU time.
+ *
+ * Updates the rows in place. When the controller sends the CPU time the
+ * processes used ("cpu_time" in seconds) the CPU usage is computed from the
+ * difference between this and the previous update, otherwise the
+ * "cpu_usage" of the reply is used.
+ */
+void
+S9sProcessTable::update(
+        const S9sVariantList &hostList,
+        double                now)
+{
+    S9sOptions *options = S9sOptions::instance();
+    double      elapsed = m_lastUpdate > 0.0 ? now - m_lastUpdate : 0.0;
+
+    ++m_generation;
+
+    for (uint idx = 0u; idx < hostList.size(); ++idx)
+    {
+        const S9sVariantMap  &hostMap   = hostList[idx].toVariantMap();
+        const S9sVariantList &processes = 
+            valueOf(hostMap, "processes").toVariantList();
+        int                   hostIndex;
+        
+        hostIndex = internHostName(valueOf(hostMap, "hostname").toString());
+
+        for (uint idx1 = 0u; idx1 < processes.size(); ++idx1)
+        {
+            const S9sVariantMap &process = processes[idx1].toVariantMap();
+            int                  pid = valueOf(process, "pid").toInt();
+            ulonglong            rowKey = key(hostIndex, pid);
+            S9sString            executable;
+            double               cpuTime = -1.0;
+            uint                 rowIdx;
+            bool                 isNew;
+
+            std::unordered_map<ulonglong, uint>::iterator it = 
+                m_rowIndex.find(rowKey);
+
+            isNew = it == m_rowIndex.end();
+            if (isNew)
+            {
+                rowIdx = m_rows.size();
+                m_rows.push_back(Row());
+                m_rowIndex[rowKey] = rowIdx;
+
+                m_rows[rowIdx].m_hostIndex = hostIndex;
+                m_rows[rowIdx].m_pid       = pid;
+            } else {
+                rowIdx = it->second;
+            }
+
+            Row &row = m_rows[rowIdx];
+
+            row.m_generation = m_generation;
+            row.m_userName   = valueOf(process, "user").toString();
+            row.m_priority   = valueOf(process, "priority").toInt();
+            row.m_virtMem    = valueOf(process, "virt_mem").toULongLong();
+            row.m_resMem     = valueOf(process, "res_mem").toULongLong();
+            row.m_memUsage   = valueOf(process, "mem_usage").toDouble();
+            row.m_state      = valueOf(process, "state").toString();
+            
+            if (process.contains("cpu_time"))
+                cpuTime = valueOf(process, "cpu_time").toDouble();
+
+            if (!isNew && cpuTime >= 0.0 && row.m_cpuTime >= 0.0 && 
+                    elapsed > 0.0)
+            {
+                row.m_cpuUsage = 100.0 * (cpuTime - row.m_cpuTime) / elapsed;
+            } else {
+                row.m_cpuUsage = valueOf(process, "cpu_usage").toDouble();
+            }
+
+            row.m_cpuTime = cpuTime;
+
+            // The filter is checked only when the executable changes.
+            executable = valueOf(process, "executable").toString();
+            if (isNew || executable != row.m_executable)
+            {
+                row.m_executable = executable;
+                row.m_matches    = 
+                    options->isStringMatchExtraArguments(executable);
+            }
+        }
+    }
+
+    // Removing the processes that are not running any more.
+    for (uint idx = 0u; idx < m_rows.size(); )
+    {
+        if (m_rows[idx].m_generation != m_generation)
+            removeRow(idx);
+        else
+            ++idx;
+    }
+
+    m_lastUpdate = now;
+}
+
+void
+S9sProcessTable::clear()
+{
+    m_rows.clear();
+    m_rowIndex.clear();
+    m_hostNames.clear();
+    m_hostIndex.clear();
+    m_lastUpdate = 0.0;
+}
+
+uint
+S9sProcessTable::size() const
+{
+    return m_rows.size();
+}
+
+bool
+S9sProcessTable::empty() const
+{
+    return m_rows.empty();
+}
+
+const S9sProcessTable::Row &
+S9sProcessTable::row(
+        uint index) const
+{
+    return m_rows[index];
+}
+
+const S9sString &
+S9sProcessTable::hostName(
+        const Row &row) const
+{
+    return m_hostNames[row.m_hostIndex];
+}
+
+/**
+ * \param order The column to sort by.
+ * \param maxRows The number of rows that fit on the screen.
+ * \param rows The place where the method returns the first rows in order.
+ *
+ * Only the first maxRows rows are sorted, the rest of the table is just
+ * partitioned, the table itself is not reordered.
+ */
+void
+S9sProcessTable::selectRows(
+        S9sProcessTable::SortOrder  order,
+        uint                        maxRows,
+        S9sVector<const Row *>     &rows) const
+{
+    S9sVector<uint> indices;
+    RowOrder        rowOrder(*this, order);
+
+    rows.clear();
+    indices.reserve(m_rows.size());
+
+    for (uint idx = 0u; idx < m_rows.size(); ++idx)
+    {
+        if (m_rows[idx].m_matches)
+            indices.push_back(idx);
+    }
+
+    if (maxRows > indices.size())
+        maxRows = indices.size();
+
+    std::partial_sort(
+            indices.begin(), indices.begin() + maxRows, indices.end(), 
+            rowOrder);
+
+    for (uint idx = 0u; idx < maxRows; ++idx)
+        rows.push_back(&m_rows[indices[idx]]);
+}
+
+/**
+ * The PID order is ascending, the CPU and memory orders are descending with
+ * the higher PIDs first on equal usage.
+ */
+bool
+S9sProcessTable::RowOrder::operator()(
+        uint a, 
+        uint b) const
+{
+    const Row &rowA = m_table.m_rows[a];
+    const Row &rowB = m_table.m_rows[b];
+
+    switch (m_order)
+    {
+        case PidOrder:
+            if (rowA.m_pid != rowB.m_pid)
+                return rowA.m_pid < rowB.m_pid;
+            break;
+
+        case CpuUsage:
+            if (rowA.m_cpuUsage != rowB.m_cpuUsage)
+                return rowA.m_cpuUsage > rowB.m_cpuUsage;
+            
+            if (rowA.m_pid != rowB.m_pid)
+                return rowA.m_pid > rowB.m_pid;
+            break;
+
+        case MemUsage:
+            if (rowA.m_memUsage != rowB.m_memUsage)
+                return rowA.m_memUsage > rowB.m_memUsage;
+            
+            if (rowA.m_pid != rowB.m_pid)
+                return rowA.m_pid > rowB.m_pid;
+            break;
+    }
+
+    return rowA.m_hostIndex < rowB.m_hostIndex;
+}
+
+int
+S9sProcessTable::internHostName(
+        const S9sString &hostName)
+{
+    std::unordered_map<std::string, int>::iterator it = 
+        m_hostIndex.find(hostName);
+
+    if (it != m_hostIndex.end())
+        return it->second;
+
+    m_hostNames.push_back(hostName);
+    m_hostIndex[hostName] = m_hostNames.size() - 1;
+
+    return m_hostNames.size() - 1;
+}
+
+/**
+ * Removes the row by moving the last row into its place.
+ */
+void
+S9sProcessTable::removeRow(
+        uint index)
+{
+    uint last = m_rows.size() - 1;
+
+    m_rowIndex.erase(key(m_rows[index].m_hostIndex, m_rows[index].m_pid));
+
+    if (index != last)
+    {
+        m_rows[index] = m_rows[last];
+        m_rowIndex[key(m_rows[index].m_hostIndex, m_rows[index].m_pid)] = 
+            index;
+    }
+
+    m_rows.pop_back();
+}
+
+ulonglong
+S9sProcessTable::key(
+        int hostIndex, 
+        int pid)
+{
+    return ((ulonglong) (uint) hostIndex << 32) | (uint) pid;
+}
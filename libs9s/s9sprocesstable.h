@@ -0,0 +1,118 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+#include "S9sVariantList"
+
+#include <unordered_map>
+
+/**
+ * The OS processes of the hosts of a cluster for the "top" screen. The rows
+ * are typed and keyed by the host and the PID, so every reply of the
+ * getRunningProcesses call updates the table in place: the processes that
+ * are still running keep their row, the new ones are added and the ones that
+ * were not in the reply are removed. Only the rows that fit on the screen are
+ * sorted when printing.
+ */
+class S9sProcessTable
+{
+    public:
+        enum SortOrder
+        {
+            PidOrder,
+            CpuUsage,
+            MemUsage,
+        };
+
+        /**
+         * One process on one host.
+         */
+        class Row
+        {
+            public:
+                Row();
+
+                int         m_hostIndex;
+                int         m_pid;
+                S9sString   m_userName;
+                int         m_priority;
+                ulonglong   m_virtMem;
+                ulonglong   m_resMem;
+                double      m_cpuUsage;
+                double      m_memUsage;
+                /** The CPU time used by the process if the controller sent it. */
+                double      m_cpuTime;
+                S9sString   m_executable;
+                S9sString   m_state;
+                /** If the executable matches the command line arguments. */
+                bool        m_matches;
+                /** The number of the update that last saw the process. */
+                uint        m_generation;
+        };
+
+        S9sProcessTable();
+
+        void update(const S9sVariantList &hostList, double now);
+        void clear();
+
+        uint size() const;
+        bool empty() const;
+        const Row &row(uint index) const;
+        const S9sString &hostName(const Row &row) const;
+
+        void selectRows(
+                S9sProcessTable::SortOrder  order,
+                uint                        maxRows,
+                S9sVector<const Row *>     &rows) const;
+
+    private:
+        /**
+         * Orders the row indices by the selected column.
+         */
+        class RowOrder
+        {
+            public:
+                RowOrder(
+                        const S9sProcessTable     &table,
+                        S9sProcessTable::SortOrder order) : 
+                    m_table(table), m_order(order) {}
+
+                bool operator()(uint a, uint b) const;
+
+            private:
+                const S9sProcessTable      &m_table;
+                S9sProcessTable::SortOrder  m_order;
+        };
+
+        int internHostName(const S9sString &hostName);
+        void removeRow(uint index);
+
+        static ulonglong key(int hostIndex, int pid);
+
+    private:
+        S9sVector<Row>                        m_rows;
+        std::unordered_map<ulonglong, uint>   m_rowIndex;
+        S9sVector<S9sString>                  m_hostNames;
+        std::unordered_map<std::string, int>  m_hostIndex;
+        uint                                  m_generation;
+        double                                m_lastUpdate;
+};
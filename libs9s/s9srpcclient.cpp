@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9srpcclient.h"
+#include "S9sOutput"
 #include "s9srpcclient_p.h"
 
 #include "S9sOptions"
@@ -29,6 +30,7 @@
 #include "S9sFile"
 #include "S9sSshCredentials"
 #include "S9sContainer"
+#include "S9sJsonWriter"
 
 #include <cstring>
 #include <cstdio>
@@ -126,6 +128,31 @@ S9sRpcClient::operator= (
     return *this;
 }
 
+/**
+ * \returns A new client that connects to the same controller and uses the
+ *   same (already authenticated) session.
+ *
+ * The copy constructor shares the private data, so the copies can not be used
+ * from different threads. This method creates a client with its own
+ * connection and buffers that can send requests in parallel with the
+ * original one without authenticating again.
+ */
+S9sRpcClient
+S9sRpcClient::sessionCopy() const
+{
+    S9sRpcClient retval(
+            m_priv->m_hostName, m_priv->m_port, m_priv->m_path,
+            m_priv->m_useTls);
+
+    retval.m_priv->m_cookies       = m_priv->m_cookies;
+    retval.m_priv->m_authenticated = m_priv->m_authenticated;
+    retval.m_priv->m_serverHeader  = m_priv->m_serverHeader;
+    retval.m_priv->m_controllers   = m_priv->m_controllers;
+    retval.m_priv->m_servers       = m_priv->m_servers;
+
+    return retval;
+}
+
 S9sString
 S9sRpcClient::hostName() const
 {
@@ -222,7 +249,7 @@ S9sRpcClient::maybeAuthenticate()
         {
             if (options->isJsonRequested())
             {
-                printf("%s\n", STR(reply().toString()));
+                S9sOutput::printf("%s\n", STR(reply().toString()));
             } else {
                 if (m_priv->m_errorString.empty())
                     m_priv->m_errorString = reply().errorString();
@@ -239,7 +266,7 @@ S9sRpcClient::maybeAuthenticate()
         S9sString controllerVersion = serverVersion();
         if (options->isVerbose())
         {
-            printf("Controller version: %s\n", STR(controllerVersion));
+            S9sOutput::printf("Controller version: %s\n", STR(controllerVersion));
         }
 
         // I am not sure if this is the best place, but this version
@@ -370,7 +397,7 @@ S9sRpcClient::printMessages(
     } else {
         if (options->isJsonRequested())
         {
-            printf("%s\n", STR(rpcReply.toString()));
+            S9sOutput::printf("%s\n", STR(rpcReply.toString()));
         } else {
             rpcReply.printMessages(errorString());
             //PRINT_ERROR("%s", STR(errorString()));
@@ -390,14 +417,14 @@ S9sRpcClient::printServerRegistered(
     {
         rpcReply.printMessages("Registered.");
         #if 0
-        printf("  Processors\n");
+        S9sOutput::printf("  Processors\n");
         rpcReply.printProcessors("    ");
-        printf("  Memory\n");
+        S9sOutput::printf("  Memory\n");
         rpcReply.printMemoryBanks("    ");
         #endif
     } else {
         if (options->isJsonRequested())
-            printf("%s\n", STR(rpcReply.toString()));
+            S9sOutput::printf("%s\n", STR(rpcReply.toString()));
         else
             PRINT_ERROR("%s", STR(errorString()));
     }
@@ -708,6 +735,30 @@ S9sRpcClient::getDatabases()
 bool
 S9sRpcClient::getTree(
         bool withDotDot)
+{
+    S9sOptions    *options = S9sOptions::instance();
+    S9sString      path;
+    
+    if (options->nExtraArguments() > 0)
+        path = options->extraArgument(0u);
+
+    return getTree(path, withDotDot);
+}
+
+/**
+ * \param path The path of the sub-tree to get or the empty string for the whole
+ *   tree.
+ * \param withDotDot If the ".." entries should be added to the folders.
+ * \returns true if the request sent and a return is received (even if the reply
+ *   is an error message).
+ *
+ * This method is used to get only one branch of the Cmon Directory Tree, the
+ * sub-tree that starts at the given path. 
+ */
+bool
+S9sRpcClient::getTree(
+        const S9sString &path,
+        bool             withDotDot)
 {
     S9sOptions    *options = S9sOptions::instance();
     S9sString      uri = "/v2/tree";
@@ -715,8 +766,8 @@ S9sRpcClient::getTree(
     
     request["operation"]       = "getTree";
 
-    if (options->nExtraArguments() > 0)
-        request["path"] = options->extraArgument(0u);
+    if (!path.empty())
+        request["path"] = path;
 
     if (options->isRefreshRequested())
         request["refresh_now"] = true;
@@ -10899,6 +10950,8 @@ S9sRpcClient::executeRequest(
     bool           retval;
     int            nTry = 0;
     S9sVariantMap  triedKeys;
+    S9sRpcStats   *stats = S9sRpcStats::instance();
+    double         started = S9sRpcStats::now();
    
     request["request_created"] = timeString;
     request["request_id"]      = ++m_priv->m_requestId;
@@ -10906,6 +10959,25 @@ S9sRpcClient::executeRequest(
     if (printRequest)
         printRequestJson(request);
 
+    /*
+     * The time between the previous request and this one was spent by the
+     * caller processing (printing) the previous reply.
+     */
+    if (m_priv->m_lastStatsIndex >= 0)
+    {
+        stats->setPrintMs(
+                m_priv->m_lastStatsIndex, 
+                started - m_priv->m_stats.m_finished);
+    }
+
+    m_priv->m_stats.clear();
+    m_priv->m_stats.m_operation = request["operation"].toString();
+    m_priv->m_stats.m_uri       = uri;
+    m_priv->m_stats.m_hostName  = m_priv->m_hostName;
+    m_priv->m_stats.m_port      = m_priv->m_port;
+    m_priv->m_stats.m_useTls    = m_priv->m_useTls;
+    m_priv->m_stats.m_started   = started;
+
     while (true)
     {
         S9sString      hostName;
@@ -10976,7 +11048,7 @@ S9sRpcClient::executeRequest(
             if (hostName.empty())
             {
                 PRINT_VERBOSE("Could not find controller to try.");
-                return retval;
+                break;
             }
     
             //S9S_WARNING("Trying %s:%d", STR(hostName), port);
@@ -10986,6 +11058,7 @@ S9sRpcClient::executeRequest(
             m_priv->close();
             m_priv->m_hostName = hostName;
             m_priv->m_port     = port;
+            m_priv->m_stats.m_nRedirects++;
 
             // This is just an unnecessary protection: if the code is ok this
             // will never happen.
@@ -10999,6 +11072,12 @@ S9sRpcClient::executeRequest(
         }
     }
 
+    m_priv->m_stats.m_success  = retval;
+    m_priv->m_stats.m_finished = S9sRpcStats::now();
+
+    if (stats->isEnabled())
+        m_priv->m_lastStatsIndex = stats->addRequest(m_priv->m_stats);
+
     return retval;
 }
 
@@ -11017,17 +11096,21 @@ S9sRpcClient::doExecuteRequest(
         S9sVariantMap       &request,
         S9s::Redirect        redirect)
 {
-    S9sString    payload = request.toString();
+    S9sString   &payload = m_priv->m_payload;
+    S9sJsonWriter writer(payload);
     S9sOptions  *options = S9sOptions::instance();    
     S9sDateTime  replyReceived;
     S9sString    header;
     S9sString    myUri = uri;
     ssize_t      readLength;
     ssize_t      writtenLength;
-    S9sString    dataToSend; 
-    size_t       dataSize;
-    size_t       payloadSize = 0;
+    S9sString   &dataToSend = m_priv->m_sendBuffer;
     bool         isJSonStream = false;
+    bool         success;
+    S9sRpcRequestStats &stats = m_priv->m_stats;
+    double       sent;
+    double       firstByte = 0.0;
+    double       started;
 
     PRINT_LOG("Sending request to '%s'.", STR(uri));
     PRINT_VERBOSE("Preparing to send request.");
@@ -11042,6 +11125,9 @@ S9sRpcClient::doExecuteRequest(
     m_priv->m_jsonReply.clear();
     m_priv->m_reply.clear();
 
+    payload.clear();
+    writer.writeToString(request);
+
     if (!m_priv->connect(redirect))
     {
         PRINT_LOG("%s", STR(m_priv->m_errorString));
@@ -11057,13 +11143,10 @@ S9sRpcClient::doExecuteRequest(
      */
     if (options->isJsonRequested() && options->isVerbose())
     {
-        printf("Preparing to send request on %s: \n%s\n", 
+        S9sOutput::printf("Preparing to send request on %s: \n%s\n", 
                 STR(myUri), STR(payload));
     }
 
-    if (!payload.empty())
-        payloadSize = strlen(STR(payload));
-
     header.sprintf(
         "POST %s HTTP/1.0\r\n"
         "Host: %s:%d\r\n"
@@ -11079,17 +11162,19 @@ S9sRpcClient::doExecuteRequest(
         STR(m_priv->m_hostName),
         m_priv->m_port,
         STR(m_priv->cookieHeaders()),
-        payloadSize);
+        payload.length());
 
-    dataToSend = header + payload;
-    dataSize   = strlen(STR(dataToSend));
+    dataToSend.clear();
+    dataToSend.reserve(header.length() + payload.length());
+    dataToSend.append(header);
+    dataToSend.append(payload);
     
     PRINT_VERBOSE("Sending: \n%s\n", STR(dataToSend));
-    writtenLength = m_priv->write(STR(dataToSend), dataSize);
+    writtenLength = m_priv->write(dataToSend.data(), dataToSend.length());
 
 
     S9S_DEBUG("%s: Size: %zd, written: %zd", 
-            STR(timeStampString()), dataSize, writtenLength);
+            STR(timeStampString()), dataToSend.length(), writtenLength);
 
     //S9S_WARNING("dataToSend: \n%s\n", STR(dataToSend));
 
@@ -11107,9 +11192,12 @@ S9sRpcClient::doExecuteRequest(
         return false;
     }
             
+    sent = S9sRpcStats::now();
+    stats.m_bytesSent += writtenLength;
+
     if (options->isJsonRequested() && options->isVerbose())
     {
-        printf("Sent request.\n");
+        S9sOutput::printf("Sent request.\n");
     }
 
     /*
@@ -11126,6 +11214,13 @@ S9sRpcClient::doExecuteRequest(
 
         if (readLength > 0)
         {
+            if (firstByte == 0.0)
+            {
+                firstByte = S9sRpcStats::now();
+                stats.m_firstByteMs += firstByte - sent;
+            }
+
+            stats.m_bytesReceived += readLength;
             m_priv->m_dataSize += readLength;
 
             // read may got interrupted due to too small buffer
@@ -11167,7 +11262,12 @@ S9sRpcClient::doExecuteRequest(
             //S9S_WARNING("1 Parsing json");
 
             m_priv->skipRecord();
-            if (!jsonRecord.parse(STR(m_priv->m_jsonReply)))
+
+            started = S9sRpcStats::now();
+            success = jsonRecord.parse(STR(m_priv->m_jsonReply));
+            stats.m_parseMs += S9sRpcStats::now() - started;
+
+            if (!success)
             {
                 PRINT_ERROR("Failed to parse JSon string.");
                 return false;
@@ -11195,7 +11295,10 @@ S9sRpcClient::doExecuteRequest(
             // If we read no data in streaming mode that simply means the
             // connection ended by the server.
             if (readLength == 0)
+            {
+                stats.m_lastByteMs += S9sRpcStats::now() - firstByte;
                 return true;
+            }
 
             // We continue reading the connection.
             continue;
@@ -11207,6 +11310,9 @@ S9sRpcClient::doExecuteRequest(
             break;
     } // for(;;)
 
+    if (firstByte > 0.0)
+        stats.m_lastByteMs += S9sRpcStats::now() - firstByte;
+
     // Closing the buffer with a null terminating byte.
     m_priv->ensureHasBuffer(m_priv->m_dataSize + 1);
     m_priv->m_buffer[m_priv->m_dataSize] = '\0';
@@ -11232,7 +11338,7 @@ S9sRpcClient::doExecuteRequest(
 
             if (options->isJsonRequested() && options->isVerbose())
             {
-                printf("Reply: \n%s\n", STR(m_priv->m_jsonReply));
+                S9sOutput::printf("Reply: \n%s\n", STR(m_priv->m_jsonReply));
             }
 
             //PRINT_LOG("    reply: \n%s\n", STR(m_priv->m_jsonReply));
@@ -11250,7 +11356,12 @@ S9sRpcClient::doExecuteRequest(
     }
 
     replyReceived = S9sDateTime::currentDateTime();
-    if (!m_priv->m_reply.parse(STR(m_priv->m_jsonReply)))
+
+    started = S9sRpcStats::now();
+    success = m_priv->m_reply.parse(STR(m_priv->m_jsonReply));
+    stats.m_parseMs += S9sRpcStats::now() - started;
+
+    if (!success)
     {
         PRINT_VERBOSE("Error in reply: \n%s\n", STR(m_priv->m_jsonReply));
 
@@ -44,6 +44,8 @@ class S9sRpcClient
 
         S9sRpcClient &operator=(const S9sRpcClient &rhs);
 
+        S9sRpcClient sessionCopy() const;
+
         S9sString hostName() const;
         int port() const;
         bool useTls() const;
@@ -84,6 +86,7 @@ class S9sRpcClient
         bool getTopQueries();
 
         bool getTree(bool withDotDot = false);
+        bool getTree(const S9sString &path, bool withDotDot = false);
         bool getDatabases();
 
         
@@ -2,6 +2,7 @@
  * Copyright (C) 2011-present severalnines.com
  */
 #include "s9srpcclient_p.h"
+#include "S9sOutput"
  
 #include <string.h>
 #include <sys/types.h>
@@ -13,6 +14,7 @@
 
 #include "S9sRegExp"
 #include "S9sOptions"
+#include "S9sRpcStats"
 
 //#define DEBUG
 //#define WARNING
@@ -31,7 +33,8 @@ S9sRpcClientPrivate::S9sRpcClientPrivate() :
     m_ssl(0),
     m_callbackFunction(0),
     m_callbackUserData(0),
-    m_authenticated(false)
+    m_authenticated(false),
+    m_lastStatsIndex(-1)
 {
 }
 
@@ -99,6 +102,7 @@ S9sRpcClientPrivate::connect(
     struct timeval timeout;
     struct sockaddr_in server;
     bool   success;
+    double started;
 
     PRINT_LOG("%p: Connecting to '%s:%d'.", this, STR(m_hostName), m_port);
 
@@ -150,7 +154,11 @@ S9sRpcClientPrivate::connect(
      * Doing the DNS lookup.
      */
     success = true;
+    started = S9sRpcStats::now();
     hp = gethostbyname(STR(m_hostName));
+    m_stats.m_resolveMs += S9sRpcStats::now() - started;
+    m_stats.m_nConnects++;
+
     if (hp == NULL)
     {
         m_errorString.sprintf("Host '%s' not found.", STR(m_hostName));
@@ -166,8 +174,12 @@ S9sRpcClientPrivate::connect(
         server.sin_family = AF_INET;
         server.sin_port = htons(m_port);
 
-        if (::connect(m_socketFd, (struct sockaddr *) &server, sizeof server)
-                == -1)
+        started = S9sRpcStats::now();
+        success = ::connect(
+                m_socketFd, (struct sockaddr *) &server, sizeof server) != -1;
+        m_stats.m_connectMs += S9sRpcStats::now() - started;
+
+        if (!success)
         {
 
             // errno: 111 connection refused.
@@ -267,7 +279,11 @@ S9sRpcClientPrivate::connect(
         SSL_set_connect_state(m_ssl);
         SSL_set_tlsext_host_name(m_ssl, STR(m_hostName));
 
-        if (SSL_connect(m_ssl) <= 0 || SSL_do_handshake(m_ssl) <= 0)
+        started = S9sRpcStats::now();
+        success = SSL_connect(m_ssl) > 0 && SSL_do_handshake(m_ssl) > 0;
+        m_stats.m_tlsMs += S9sRpcStats::now() - started;
+
+        if (!success)
         {
             m_errorString = "SSL handshake failed.";
             close();
@@ -709,8 +725,8 @@ void
 S9sRpcClientPrivate::printBuffer(
         const S9sString &title)
 {
-    ::printf("\n\n");
-    ::printf("%s\n", STR(title));
+    S9sOutput::printf("\n\n");
+    S9sOutput::printf("%s\n", STR(title));
 
     for (int n = 0; n < (int) m_dataSize; ++n)
     {
@@ -718,42 +734,42 @@ S9sRpcClientPrivate::printBuffer(
 
         if (c == '\036')
         {
-            ::printf("%s\\36%s", TERM_RED, TERM_NORMAL);
+            S9sOutput::printf("%s\\36%s", TERM_RED, TERM_NORMAL);
         } else if (c == '\n')
         {
-            ::printf("\\n");
+            S9sOutput::printf("\\n");
         } else if (c == '\r')
         {
-            ::printf("\\r");
+            S9sOutput::printf("\\r");
         } else if (c >= 'a' && c < 'z')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else if (c >= 'A' && c < 'Z')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else if (c >= '!' && c < '/')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else if (c >= '0' && c < '9')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else if (c == '{' || c == '}' || c == '[' || c == ']')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else if (c == ' ')
         {
-            ::printf("%c", c);
+            S9sOutput::printf("%c", c);
         } else {
-            ::printf("\\%02d", c);
+            S9sOutput::printf("\\%02d", c);
         }
 
         //printf(" ");
         if (n % 40 == 0 && n != 0)
-            printf("\n");
+            S9sOutput::printf("\n");
     }
 
-    printf("\n");
-    fflush(stdout);
+    S9sOutput::printf("\n");
+    S9sOutput::flush();
 }
 
 /**
@@ -831,7 +847,8 @@ S9sRpcClientPrivate::skipRecord()
         return false;
 
     nextRecord += 2;
-    if (*nextRecord == '\036')
+    // The record might be the last one in the buffer.
+    if (nextRecord < m_buffer + m_dataSize && *nextRecord == '\036')
         ++nextRecord;
 
     recordSize = nextRecord - m_buffer;
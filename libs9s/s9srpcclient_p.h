@@ -10,6 +10,7 @@
 #include "S9sRpcReply"
 #include "S9sVariantMap"
 #include "S9sController"
+#include "S9sRpcStats"
 #include "s9srpcclient.h"
 
 class S9sRpcClientPrivate
@@ -69,6 +70,10 @@ class S9sRpcClientPrivate
         SSL            *m_ssl;
         S9sVariantMap   m_cookies;
         S9sString       m_serverHeader;
+        /** The Json payload of the request, reused for every request. */
+        S9sString       m_payload;
+        /** The header and the payload as they are sent. */
+        S9sString       m_sendBuffer;
 
         S9sJSonHandler  m_callbackFunction;
         void           *m_callbackUserData;
@@ -76,6 +81,11 @@ class S9sRpcClientPrivate
         
         S9sVariantList  m_controllers;
         S9sVector<S9sController> m_servers;
+
+        /** The measurements of the request that is being executed. */
+        S9sRpcRequestStats m_stats;
+        /** The index of the previous request in the S9sRpcStats or -1. */
+        int             m_lastStatsIndex;
         friend class S9sRpcClient;
 };
 
@@ -0,0 +1,336 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9srpcfuture.h"
+
+#include "S9sRpcClient"
+#include "S9sMutex"
+#include "S9sMutexLocker"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The time the S9sRpcFuture::wait() checks the cancellation token.
+ */
+#define CANCELLATION_CHECK_MS 100
+
+/**
+ * The data shared by the S9sRpcFuture and the S9sRpcPromise objects.
+ */
+class S9sRpcFuturePrivate
+{
+    public:
+        S9sRpcFuturePrivate() :
+            m_referenceCounter(1),
+            m_nPromises(0),
+            m_ready(false),
+            m_success(false)
+        {
+        }
+
+        void 
+        ref()
+        {
+            S9sMutexLocker locker(m_mutex);
+
+            ++m_referenceCounter;
+        }
+
+        int 
+        unRef()
+        {
+            S9sMutexLocker locker(m_mutex);
+
+            return --m_referenceCounter;
+        }
+
+        int          m_referenceCounter;
+        int          m_nPromises;
+        bool         m_ready;
+        bool         m_success;
+        S9sRpcReply  m_reply;
+        S9sString    m_errorString;
+        S9sMutex     m_mutex;
+};
+
+S9sRpcFuture::S9sRpcFuture() :
+    m_priv(new S9sRpcFuturePrivate)
+{
+}
+
+S9sRpcFuture::S9sRpcFuture(
+        S9sRpcFuturePrivate *priv) :
+    m_priv(priv)
+{
+    m_priv->ref();
+}
+
+S9sRpcFuture::S9sRpcFuture(
+        const S9sRpcFuture &orig)
+{
+    m_priv = orig.m_priv;
+    m_priv->ref();
+}
+
+S9sRpcFuture::~S9sRpcFuture()
+{
+    if (m_priv->unRef() == 0)
+        delete m_priv;
+
+    m_priv = 0;
+}
+
+/**
+ * Assignment operator to utilize the implicit sharing.
+ */
+S9sRpcFuture &
+S9sRpcFuture::operator=(
+        const S9sRpcFuture &rhs)
+{
+    if (this == &rhs || m_priv == rhs.m_priv)
+        return *this;
+
+    if (m_priv->unRef() == 0)
+        delete m_priv;
+
+    m_priv = rhs.m_priv;
+    m_priv->ref();
+
+    return *this;
+}
+
+/**
+ * \returns True if the result is already set, the methods that return the
+ *   result will not block.
+ */
+bool
+S9sRpcFuture::isReady() const
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    return m_priv->m_ready;
+}
+
+/**
+ * Waits until the result is set.
+ */
+void
+S9sRpcFuture::wait() const
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    while (!m_priv->m_ready)
+        m_priv->m_mutex.wait();
+}
+
+/**
+ * \param milliseconds The maximum time to wait.
+ * \returns True if the result is set.
+ */
+bool
+S9sRpcFuture::wait(
+        int milliseconds) const
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    if (!m_priv->m_ready)
+        m_priv->m_mutex.wait(milliseconds);
+
+    return m_priv->m_ready;
+}
+
+/**
+ * \param token The token that aborts the waiting.
+ * \returns True if the result is set, false if the token was cancelled before
+ *   the result arrived.
+ */
+bool
+S9sRpcFuture::wait(
+        const S9sCancellationToken &token) const
+{
+    while (!token.isCancelled())
+    {
+        if (wait(CANCELLATION_CHECK_MS))
+            return true;
+    }
+
+    return isReady();
+}
+
+/**
+ * \returns True if the request was sent and the reply was received. Waits for
+ *   the result if it is not yet set.
+ */
+bool
+S9sRpcFuture::success() const
+{
+    wait();
+
+    S9sMutexLocker locker(m_priv->m_mutex);
+    return m_priv->m_success;
+}
+
+/**
+ * \returns The reply of the request. Waits for the result if it is not yet
+ *   set.
+ */
+S9sRpcReply
+S9sRpcFuture::reply() const
+{
+    wait();
+
+    S9sMutexLocker locker(m_priv->m_mutex);
+    return m_priv->m_reply;
+}
+
+/**
+ * \returns The error string if the request failed. Waits for the result if it
+ *   is not yet set.
+ */
+S9sString
+S9sRpcFuture::errorString() const
+{
+    wait();
+
+    S9sMutexLocker locker(m_priv->m_mutex);
+    return m_priv->m_errorString;
+}
+
+/*
+ * S9sRpcPromise
+ */
+S9sRpcPromise::S9sRpcPromise() :
+    m_priv(new S9sRpcFuturePrivate)
+{
+    m_priv->m_nPromises = 1;
+}
+
+S9sRpcPromise::S9sRpcPromise(
+        const S9sRpcPromise &orig)
+{
+    m_priv = orig.m_priv;
+    m_priv->ref();
+
+    S9sMutexLocker locker(m_priv->m_mutex);
+    ++m_priv->m_nPromises;
+}
+
+S9sRpcPromise::~S9sRpcPromise()
+{
+    release();
+}
+
+/**
+ * Assignment operator to utilize the implicit sharing.
+ */
+S9sRpcPromise &
+S9sRpcPromise::operator=(
+        const S9sRpcPromise &rhs)
+{
+    if (this == &rhs || m_priv == rhs.m_priv)
+        return *this;
+
+    release();
+
+    m_priv = rhs.m_priv;
+    m_priv->ref();
+
+    S9sMutexLocker locker(m_priv->m_mutex);
+    ++m_priv->m_nPromises;
+
+    return *this;
+}
+
+/**
+ * \returns The future that receives the result set by this promise.
+ */
+S9sRpcFuture
+S9sRpcPromise::future() const
+{
+    return S9sRpcFuture(m_priv);
+}
+
+/**
+ * \param success True if the request was successfully executed.
+ * \param reply The reply of the request.
+ * \param errorString The error message if the request failed.
+ *
+ * Sets the result and wakes up the threads waiting for it. Only the first 
+ * result is kept.
+ */
+void
+S9sRpcPromise::setValue(
+        bool               success,
+        const S9sRpcReply &reply,
+        const S9sString   &errorString)
+{
+    S9sMutexLocker locker(m_priv->m_mutex);
+
+    if (m_priv->m_ready)
+        return;
+
+    m_priv->m_success     = success;
+    m_priv->m_reply       = reply;
+    m_priv->m_errorString = errorString;
+    m_priv->m_ready       = true;
+    m_priv->m_mutex.notifyAll();
+}
+
+/**
+ * \param success The return value of the RPC client method that sent the
+ *   request.
+ * \param client The client that sent the request.
+ *
+ * Sets the reply and the error string the client holds as the result.
+ */
+void
+S9sRpcPromise::setValue(
+        bool                success,
+        const S9sRpcClient &client)
+{
+    S9sRpcReply reply = client.reply();
+
+    if (success && !reply.isOk())
+        success = false;
+
+    setValue(success, reply, 
+            success ? S9sString() : 
+            (reply.errorString().empty() ? 
+             client.errorString() : reply.errorString()));
+}
+
+void
+S9sRpcPromise::release()
+{
+    bool abandoned;
+
+    m_priv->m_mutex.lock();
+    abandoned = --m_priv->m_nPromises == 0 && !m_priv->m_ready;
+    m_priv->m_mutex.unlock();
+
+    if (abandoned)
+        setValue(false, S9sRpcReply(), "The request was cancelled.");
+
+    if (m_priv->unRef() == 0)
+        delete m_priv;
+
+    m_priv = 0;
+}
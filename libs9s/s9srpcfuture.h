@@ -0,0 +1,93 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sRpcReply"
+#include "S9sCancellationToken"
+
+class S9sRpcClient;
+class S9sRpcFuturePrivate;
+
+/**
+ * The result of an RPC request that is executed by an other thread (e.g. a
+ * task in an S9sThreadPool). The S9sRpcPromise of the request is used to set
+ * the result, the copies of the future all see the result as soon as it is
+ * set.
+ */
+class S9sRpcFuture
+{
+    public:
+        S9sRpcFuture();
+        S9sRpcFuture(const S9sRpcFuture &orig);
+        ~S9sRpcFuture();
+
+        S9sRpcFuture &operator=(const S9sRpcFuture &rhs);
+
+        bool isReady() const;
+        void wait() const;
+        bool wait(int milliseconds) const;
+        bool wait(const S9sCancellationToken &token) const;
+
+        bool success() const;
+        S9sRpcReply reply() const;
+        S9sString errorString() const;
+
+    private:
+        S9sRpcFuture(S9sRpcFuturePrivate *priv);
+
+    private:
+        S9sRpcFuturePrivate *m_priv;
+
+    friend class S9sRpcPromise;
+};
+
+/**
+ * The side of the S9sRpcFuture that sets the result. If all the copies of the
+ * promise are destroyed without setting the result (e.g. the task was
+ * cancelled before it was executed) the future becomes ready with a failure
+ * so nobody waits for it forever.
+ */
+class S9sRpcPromise
+{
+    public:
+        S9sRpcPromise();
+        S9sRpcPromise(const S9sRpcPromise &orig);
+        ~S9sRpcPromise();
+
+        S9sRpcPromise &operator=(const S9sRpcPromise &rhs);
+
+        S9sRpcFuture future() const;
+
+        void setValue(
+                bool               success,
+                const S9sRpcReply &reply,
+                const S9sString   &errorString = "");
+
+        void setValue(
+                bool                success,
+                const S9sRpcClient &client);
+
+    private:
+        void release();
+
+    private:
+        S9sRpcFuturePrivate *m_priv;
+};
@@ -18,15 +18,21 @@
  * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9srpcreply.h"
+#include "S9sOutput"
 
 #include <stdio.h>
+#include <unistd.h>
 
 #include "S9sOptions"
 #include "S9sDateTime"
 #include "S9sFile"
 #include "S9sFormat"
+#include "S9sTable"
 #include "S9sRegExp"
 #include "S9sNode"
+#include "S9sNodeView"
+#include "S9sClusterView"
+#include "S9sJobView"
 #include "S9sSpreadsheet"
 #include "S9sCluster"
 #include "S9sAlarm"
@@ -46,6 +52,7 @@
 #include "S9sStringList"
 #include "S9sReplication"
 #include "S9sSqlProcess"
+#include "S9sJsonWriter"
 
 //#define DEBUG
 //#define WARNING
@@ -507,7 +514,7 @@ S9sRpcReply::printSqlProcessesLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         pidFormat.printHeader("PID");
         commandFormat.printHeader("TYPE");
         timeFormat.printHeader("TIME");
@@ -516,9 +523,9 @@ S9sRpcReply::printSqlProcessesLong()
         hostNameFormat.printHeader("CLIENT");
         instanceFormat.printHeader("SERVER");
         queryFormat.printHeader("QUERY");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
         
     nColumns += pidFormat.realWidth();
@@ -569,28 +576,28 @@ S9sRpcReply::printSqlProcessesLong()
         commandFormat.printf(command);
         timeFormat.printf(time);
         
-        ::printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         userFormat.printf(user);
-        ::printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
 
         hostNameFormat.printf(hostName);
         instanceFormat.printf(instance);
        
         if (!query.empty())
         {
-            ::printf("%s", sqlColorBegin());
+            S9sOutput::printf("%s", sqlColorBegin());
             queryFormat.printf(query);
-            ::printf("%s", sqlColorEnd());
+            S9sOutput::printf("%s", sqlColorEnd());
         } else {
             queryFormat.printf("-");
         }
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
     {
-        ::printf("Total: %s%'d%s processes on %s%zu%s instance(s).\n", 
+        S9sOutput::printf("Total: %s%'d%s processes on %s%zu%s instance(s).\n", 
                 numberColorBegin(), nProcessess, numberColorEnd(),
                 numberColorBegin(), instances.size(), numberColorEnd());
     }
@@ -645,7 +652,7 @@ S9sRpcReply::printTopQueriesLong()
     
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         countFormat.printHeader("COUNT");
         timeFormat.printHeader("TIME");
         minFormat.printHeader("MIN");
@@ -654,8 +661,8 @@ S9sRpcReply::printTopQueriesLong()
         databaseFormat.printHeader("DATABASE");
         instanceFormat.printHeader("SERVER");
         patternFormat.printHeader("DIGEST PATTERN");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
     
     for (size_t idx = 0u; idx < variantList.size(); ++idx)
@@ -676,22 +683,22 @@ S9sRpcReply::printTopQueriesLong()
         avgFormat.printf(avgTime);
         maxFormat.printf(maxTime);
         
-        ::printf("%s", databaseColorBegin());
+        S9sOutput::printf("%s", databaseColorBegin());
         databaseFormat.printf(database);
-        ::printf("%s", sqlColorEnd());
+        S9sOutput::printf("%s", sqlColorEnd());
         
         instanceFormat.printf(instance);
 
-        ::printf("%s", sqlColorBegin());
+        S9sOutput::printf("%s", sqlColorBegin());
         patternFormat.printf(pattern);
-        ::printf("%s", sqlColorEnd());
+        S9sOutput::printf("%s", sqlColorEnd());
         
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
     {
-        ::printf("Total: %s%'d%s statement pattern(s).\n", 
+        S9sOutput::printf("Total: %s%'d%s statement pattern(s).\n", 
                 numberColorBegin(), total, numberColorEnd());
     }
 }
@@ -709,10 +716,10 @@ S9sRpcReply::printCat()
         PRINT_ERROR("%s", STR(errorString()));
     } else {
         S9sString content = operator[]("file_content").toString();
-        ::printf("%s", STR(content));
+        S9sOutput::printf("%s", STR(content));
 
         if (!content.endsWith("\n"))
-            ::printf("\n");
+            S9sOutput::printf("\n");
     }
 }
 
@@ -734,16 +741,16 @@ S9sRpcReply::printAcl()
         S9sString name  = operator[]("object_name").toString();
 
         if (!name.empty())
-            printf("# name: %s\n", STR(name));
+            S9sOutput::printf("# name: %s\n", STR(name));
 
         if (!owner.empty())
-            printf("# owner: %s\n", STR(owner));
+            S9sOutput::printf("# owner: %s\n", STR(owner));
         
         if (!group.empty())
-            printf("# group: %s\n", STR(group));
+            S9sOutput::printf("# group: %s\n", STR(group));
 
         acl.replace(",", "\n");
-        printf("%s\n", STR(acl));
+        S9sOutput::printf("%s\n", STR(acl));
     }
     
 }
@@ -840,15 +847,15 @@ S9sRpcReply::printReplicationListLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         clusterIdFormat.printHeader("CID");
         slaveNameFormat.printHeader("SLAVE");
         masterNameFormat.printHeader("MASTER");
         linkStatusFormat.printHeader("STATUS");
         masterClusterFormat.printHeader("MASTER_CLUSTER"); 
         lagFormat.printHeader("LAG"); 
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
     
     
@@ -889,19 +896,19 @@ S9sRpcReply::printReplicationListLong()
             slaveNameFormat.printf(slaveName);
             masterNameFormat.printf(masterName);
 
-            ::printf("%s", formatter.hostStateColorBegin(status));
+            S9sOutput::printf("%s", formatter.hostStateColorBegin(status));
             linkStatusFormat.printf(status);
-            ::printf("%s", formatter.hostStateColorEnd());
+            S9sOutput::printf("%s", formatter.hostStateColorEnd());
 
 
             masterClusterFormat.printf(masterCluster);
             lagFormat.printf(lag);
-            ::printf("\n");
+            S9sOutput::printf("\n");
         }
     }    
     
     if (!options->isBatchRequested())
-        printf("Total: %d replication link(s)\n", nLines); 
+        S9sOutput::printf("Total: %d replication link(s)\n", nLines); 
 }
 
 void
@@ -935,7 +942,7 @@ S9sRpcReply::printReplicationListCustom()
             if (!replication.matchMaster(masterFilter))
                 continue;
 
-            ::printf("%s", 
+            S9sOutput::printf("%s", 
                     STR(replication.toString(syntaxHighlight, formatString)));
         }
     }
@@ -1309,7 +1316,7 @@ S9sRpcReply::printMessages(
         S9sVariantList list = at("messages").toVariantList();
         for (uint idx = 0u; idx < list.size(); ++idx)
         {
-            ::printf("%s\n", STR(S9sString::html2ansi(list[idx].toString())));
+            S9sOutput::printf("%s\n", STR(S9sString::html2ansi(list[idx].toString())));
         }
     }
     
@@ -1318,7 +1325,7 @@ S9sRpcReply::printMessages(
         // no messages, and no error string, print out the default
         if (isOk())
         {
-            printf("%s\n", STR(defaultMessage));
+            S9sOutput::printf("%s\n", STR(defaultMessage));
         } else {
             PRINT_ERROR("Error: Unknown error: %s\n", STR(toString()));
         }
@@ -1329,7 +1336,7 @@ S9sRpcReply::printMessages(
     {
         if (isOk())
         {
-            ::printf("%s\n", STR(S9sString::html2ansi(errorString())));
+            S9sOutput::printf("%s\n", STR(S9sString::html2ansi(errorString())));
         } else {
             PRINT_ERROR("%s", STR(errorString()));
         }
@@ -1370,10 +1377,10 @@ S9sRpcReply::printCheckHostsReply()
         if (message.empty())
             message = "-";
 
-        printf("%s ", errorCode == "HostIsOk" ?  "SUCCESS" : "FAILURE");
-        printf("%s%s%s ", hostColorBegin, STR(node.hostName()), hostColorEnd);
-        printf("%s", STR(message));
-        printf("\n");
+        S9sOutput::printf("%s ", errorCode == "HostIsOk" ?  "SUCCESS" : "FAILURE");
+        S9sOutput::printf("%s%s%s ", hostColorBegin, STR(node.hostName()), hostColorEnd);
+        S9sOutput::printf("%s", STR(message));
+        S9sOutput::printf("\n");
     }
 }
 
@@ -1459,13 +1466,13 @@ S9sRpcReply::printSupportedClusterListLong()
     
     if (!options->isNoHeaderRequested())
     {
-        ::printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         nameFormat.printHeader("CLUSTER TYPE");
         vendorNameFormat.printHeader("VENDOR");
         versionFormat.printHeader("VERSION");
         longNameFormat.printHeader("DESCRIPTION");
-        ::printf("%s", headerColorEnd());
-        ::printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
     
     versionFormat.setRightJustify();
@@ -1491,13 +1498,13 @@ S9sRpcReply::printSupportedClusterListLong()
                 vendorNameFormat.printf(vendorName);
                 versionFormat.printf(version);
                 longNameFormat.printf(longName);
-                ::printf("\n");
+                S9sOutput::printf("\n");
             }
         }
     }
     
     if (!options->isBatchRequested())
-        printf("Total: %d cluster types.\n", (int)names.size()); 
+        S9sOutput::printf("Total: %d cluster types.\n", (int)names.size()); 
 }
 
 void
@@ -1509,10 +1516,10 @@ S9sRpcReply::printSupportedClusterListBrief()
     {
         S9sString name = names[idx].toString();
 
-        ::printf("%s ", STR(name));
+        S9sOutput::printf("%s ", STR(name));
     }
 
-    ::printf("\n");
+    S9sOutput::printf("\n");
 }
 
 /**
@@ -1540,9 +1547,19 @@ S9sRpcReply::printJsonFormat() const
         theString.replace("\\r", "\r");
         theString.replace("\\t", "\t");
 
-        printf("%s", STR(theString));
+        S9sOutput::printf("%s", STR(theString));
     } else {
-        printf("%s\n", STR(toJsonString(format)));
+        /*
+         * The reply can be big, it is written to the standard output while
+         * it is serialized, not built in one string first.
+         */
+        S9sOutput::flush();
+        fflush(stdout);
+
+        S9sJsonWriter writer(STDOUT_FILENO);
+
+        writer.writeJson(*this, 0, format);
+        writer.write('\n');
     }
         
 }
@@ -1580,9 +1597,9 @@ S9sRpcReply::printJobStarted()
         }
             
         if (isBatch)
-            printf("%d\n", id);
+            S9sOutput::printf("%d\n", id);
         else
-            printf("Job with ID %d registered.\n", id);
+            S9sOutput::printf("Job with ID %d registered.\n", id);
     } else {
         printJsonFormat();
     }
@@ -1671,8 +1688,8 @@ S9sRpcReply::printClusterPing(
     if (contains("reply_received"))
         replyReceived  = at("reply_received").toString();
 
-    printf("PING ");
-    printf("%s ", STR(requestStatus));
+    S9sOutput::printf("PING ");
+    S9sOutput::printf("%s ", STR(requestStatus));
 
     if (!requestCreated.empty() && !replyReceived.empty())
     {
@@ -1682,7 +1699,7 @@ S9sRpcReply::printClusterPing(
         {
             double millisec = S9sDateTime::milliseconds(end, start);
 
-            printf("%3.0f ms", millisec);
+            S9sOutput::printf("%3.0f ms", millisec);
             if (sequenceIndex == 0)
             {
                 minimum = millisec;
@@ -1698,7 +1715,7 @@ S9sRpcReply::printClusterPing(
                 average += millisec;
                 average /= 2.0;
 
-                ::printf(" min/avg/max=%.0f/%.0f/%.0f ms", 
+                S9sOutput::printf(" min/avg/max=%.0f/%.0f/%.0f ms", 
                         minimum, average, maximum);
             }
 
@@ -1706,7 +1723,7 @@ S9sRpcReply::printClusterPing(
         }
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 }
 
 bool 
@@ -1862,7 +1879,7 @@ S9sRpcReply::printProcessListLong(
 
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
 
         pidFormat.printHeader("PID");
         userFormat.printHeader("USER");
@@ -1871,9 +1888,9 @@ S9sRpcReply::printProcessListLong(
         virtFormat.printHeader("VIRT");
         resFormat.printHeader("RES");
 
-        ::printf("%s", "S   %CPU   %MEM COMMAND    ");
-        ::printf("%s", TERM_NORMAL);
-        ::printf("\n");
+        S9sOutput::printf("%s", "S   %CPU   %MEM COMMAND    ");
+        S9sOutput::printf("%s", TERM_NORMAL);
+        S9sOutput::printf("\n");
     }
 
     // rss          resident set size
@@ -1902,13 +1919,13 @@ S9sRpcReply::printProcessListLong(
 
         pidFormat.printf(pid);
 
-        printf("%s", userColorBegin());        
+        S9sOutput::printf("%s", userColorBegin());        
         userFormat.printf(user);
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
         
-        printf("%s", serverColorBegin());
+        S9sOutput::printf("%s", serverColorBegin());
         hostFormat.printf(hostName);
-        printf("%s", serverColorEnd()); 
+        S9sOutput::printf("%s", serverColorEnd()); 
 
         priorityFormat.printf(priority);
 
@@ -1916,18 +1933,18 @@ S9sRpcReply::printProcessListLong(
         resFormat.printf(m_formatter.kiloBytesToHuman(rss));
 
         if (state.length() == 1u)
-            ::printf("%1s ", STR(state));
+            S9sOutput::printf("%1s ", STR(state));
         else 
-            ::printf("? ");
+            S9sOutput::printf("? ");
 
-        printf("%6.2f ", cpuUsage);
-        printf("%6.2f ", memUsage); 
+        S9sOutput::printf("%6.2f ", cpuUsage);
+        S9sOutput::printf("%6.2f ", memUsage); 
         
-        ::printf("%s", executableColorBegin(executable));
-        ::printf("%s", STR(executable));
-        ::printf("%s", executableColorEnd()); 
+        S9sOutput::printf("%s", executableColorBegin(executable));
+        S9sOutput::printf("%s", STR(executable));
+        S9sOutput::printf("%s", executableColorEnd()); 
 
-        printf("\n");
+        S9sOutput::printf("\n");
 
         ++nItems;;
         if (nItemsLimit > 0 && nItems >= nItemsLimit)
@@ -1936,7 +1953,7 @@ S9sRpcReply::printProcessListLong(
         
     if (!options->isBatchRequested())
     {
-        ::printf("Total: %s%'d%s processes on %s%d%s host(s),"
+        S9sOutput::printf("Total: %s%'d%s processes on %s%d%s host(s),"
                 " %s%d%s running.\n", 
                 numberColorBegin(), nTotal, numberColorEnd(),
                 numberColorBegin(), nHosts, numberColorEnd(),
@@ -2007,17 +2024,17 @@ S9sRpcReply::printProcessListTop(
     columns -= priorityFormat.realWidth();
     columns -= 45;
 
-    printf("%s", TERM_INVERSE);
+    S9sOutput::printf("%s", TERM_INVERSE);
     
     pidFormat.printf("PID");
     userFormat.printf("USER");
     hostFormat.printf("HOST");
     priorityFormat.printf("PR");
-    printf("%s", " VIRT      RES    S   %CPU   %MEM COMMAND    ");
+    S9sOutput::printf("%s", " VIRT      RES    S   %CPU   %MEM COMMAND    ");
     
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("\n\r");
-    ::printf("%s", TERM_NORMAL);
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("\n\r");
+    S9sOutput::printf("%s", TERM_NORMAL);
 
     // rss          resident set size
     // vsz          virtual memory size
@@ -2043,16 +2060,16 @@ S9sRpcReply::printProcessListTop(
         hostFormat.printf(hostName);
         priorityFormat.printf(priority);
 
-        printf("%8llu ", virtMem);
-        printf("%8llu ", rss);
-        printf("%1s ", STR(state));
-        printf("%6.2f ", cpuUsage);
-        printf("%6.2f ", memUsage); 
-        printf("%s", STR(executable));
+        S9sOutput::printf("%8llu ", virtMem);
+        S9sOutput::printf("%8llu ", rss);
+        S9sOutput::printf("%1s ", STR(state));
+        S9sOutput::printf("%6.2f ", cpuUsage);
+        S9sOutput::printf("%6.2f ", memUsage); 
+        S9sOutput::printf("%s", STR(executable));
 
-        ::printf("%s", TERM_ERASE_EOL);
-        ::printf("\n\r");
-        ::printf("%s", TERM_NORMAL);
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_NORMAL);
 
         if (maxLines > 0 && (int) idx + 1 >= maxLines)
             break;
@@ -2074,7 +2091,7 @@ S9sRpcReply::printJobLogBrief(
     S9sVariantList  theList = operator[]("messages").toVariantList();
 
     if (noWrap)
-        ::printf("%s", TERM_AUTOWRAP_OFF);
+        S9sOutput::printf("%s", TERM_AUTOWRAP_OFF);
 
     if (format != NULL)
         formatString = format;
@@ -2097,15 +2114,15 @@ S9sRpcReply::printJobLogBrief(
 
         if (formatString.empty())
         {
-            printf("%s\n", STR(S9sString::html2ansi(message.message())));
+            S9sOutput::printf("%s\n", STR(S9sString::html2ansi(message.message())));
         } else {
-            printf("%s",
+            S9sOutput::printf("%s",
                     STR(message.toString(syntaxHighlight, formatString)));
         }
     }
     
     if (noWrap)
-        ::printf("%s", TERM_AUTOWRAP_ON);
+        S9sOutput::printf("%s", TERM_AUTOWRAP_ON);
 }
 
 /**
@@ -2135,9 +2152,9 @@ S9sRpcReply::printJobLogLong()
             S9sMessage    message = theMap;
 
             if (formatString.empty())
-                printf("%s\n", STR(S9sString::html2ansi(message.message())));
+                S9sOutput::printf("%s\n", STR(S9sString::html2ansi(message.message())));
             else {
-                printf("%s",
+                S9sOutput::printf("%s",
                         STR(message.toString(syntaxHighlight, formatString)));
             }
         }
@@ -2203,16 +2220,16 @@ S9sRpcReply::printJobLogLong()
         }
 
         //printf("%s%s%s\n\n", TERM_BOLD, STR(message), TERM_NORMAL);
-        printf("%s\n\n", STR(message));
+        S9sOutput::printf("%s\n\n", STR(message));
 
-        printf("  %sCreated:%s %s%s%s  ", 
+        S9sOutput::printf("  %sCreated:%s %s%s%s  ", 
                 XTERM_COLOR_DARK_GRAY, 
                 TERM_NORMAL,
                 XTERM_COLOR_LIGHT_GRAY,
                 STR(created),
                 TERM_NORMAL); 
         
-        printf("%sSeverity:%s %s%s%s\n", 
+        S9sOutput::printf("%sSeverity:%s %s%s%s\n", 
                 XTERM_COLOR_DARK_GRAY, 
                 TERM_NORMAL,
                 stateColorStart, 
@@ -2220,7 +2237,7 @@ S9sRpcReply::printJobLogLong()
                 stateColorEnd); 
 
 
-        printf("%s\n", STR(line));
+        S9sOutput::printf("%s\n", STR(line));
     }
 }
 
@@ -2276,7 +2293,7 @@ S9sRpcReply::printBackupSchedulesBrief()
         S9sVariantMap scheduleMap = schedules[idx].toVariantMap();
         int           scheduleId  = scheduleMap["id"].toInt();
 
-        ::printf("%d\n", scheduleId);
+        S9sOutput::printf("%d\n", scheduleId);
     }
 }
 
@@ -2321,14 +2338,14 @@ S9sRpcReply::printBackupSchedulesLong()
     
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         clusterIdFormat.printHeader("CID");
         scheduleFormat.printHeader("REPEAT");
         enabledFormat.printHeader("STATUS");
         descriptionFormat.printHeader("DESCRIPTION");
-        printf("%s", headerColorEnd());
-        printf("\n");        
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");        
     }
     
     for (uint idx = 0u; idx < schedules.size(); ++idx)
@@ -2359,16 +2376,16 @@ S9sRpcReply::printBackupSchedulesLong()
         clusterIdFormat.printf(clusterId);
         scheduleFormat.printf(schedule);
 
-        ::printf("%s", statusColorBegin);
+        S9sOutput::printf("%s", statusColorBegin);
         enabledFormat.printf(enabled);
-        ::printf("%s", statusColorEnd);
+        S9sOutput::printf("%s", statusColorEnd);
 
         descriptionFormat.printf(description);
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
-        ::printf("Total: %d scheduled backup(s)\n", nLines);
+        S9sOutput::printf("Total: %d scheduled backup(s)\n", nLines);
 }
 
 void 
@@ -2416,7 +2433,7 @@ S9sRpcReply::printSnapshotRepositoriesBrief(bool allClusters)
             for (S9sString key : repositories.keys())
             {
                 S9sVariantMap  theMap    = repositories.operator[](key.c_str()).toVariantMap();
-                printf("cluster: %s\trepository name:%s\n", STR(cidStr), STR(key));
+                S9sOutput::printf("cluster: %s\trepository name:%s\n", STR(cidStr), STR(key));
             }
         }
     }
@@ -2431,7 +2448,7 @@ S9sRpcReply::printSnapshotRepositoriesBrief(bool allClusters)
         for (S9sString key : repositories.keys())
         {
             S9sVariantMap  theMap    = repositories.operator[](key.c_str()).toVariantMap();
-            printf("%s\n", STR(key));
+            S9sOutput::printf("%s\n", STR(key));
         }
     }
 
@@ -2497,14 +2514,14 @@ S9sRpcReply::printSnapshotRepositoriesLong(bool allClusters)
     
         if (!options->isNoHeaderRequested() && nLines > 0)
         {
-            printf("%s", headerColorBegin());
+            S9sOutput::printf("%s", headerColorBegin());
             cidFormat.printHeader("CID");
             nameFormat.printHeader("NAME");
             typeFormat.printHeader("TYPE");
             locationFormat.printHeader("LOCATION");
             storageHostFormat.printHeader("STORAGE HOST");
-            printf("%s", headerColorEnd());
-            printf("\n");        
+            S9sOutput::printf("%s", headerColorEnd());
+            S9sOutput::printf("\n");        
         }
     
         for (S9sString cidStr : infoByCluster.keys())
@@ -2541,7 +2558,7 @@ S9sRpcReply::printSnapshotRepositoriesLong(bool allClusters)
                 typeFormat.printf(typeString);
                 storageHostFormat.printf(storageHostField);
                 locationFormat.printf(locationField);
-                printf("\n");        
+                S9sOutput::printf("\n");        
             }
         }
 
@@ -2586,13 +2603,13 @@ S9sRpcReply::printSnapshotRepositoriesLong(bool allClusters)
     
         if (!options->isNoHeaderRequested() && nLines > 0)
         {
-            printf("%s", headerColorBegin());
+            S9sOutput::printf("%s", headerColorBegin());
             nameFormat.printHeader("NAME");
             typeFormat.printHeader("TYPE");
             storageHostFormat.printHeader("STORAGE HOST");
             locationFormat.printHeader("LOCATION");
-            printf("%s", headerColorEnd());
-            printf("\n");        
+            S9sOutput::printf("%s", headerColorEnd());
+            S9sOutput::printf("\n");        
         }
     
         for (S9sString key : repositories.keys())
@@ -2626,12 +2643,12 @@ S9sRpcReply::printSnapshotRepositoriesLong(bool allClusters)
             typeFormat.printf(typeString);
             storageHostFormat.printf(storageHostField);
             locationFormat.printf(locationField);
-            printf("\n");        
+            S9sOutput::printf("\n");        
         }
     }
     
     if (!options->isBatchRequested())
-        ::printf("\nTotal: %d snapshot repository(ies)\n", nLines);
+        S9sOutput::printf("\nTotal: %d snapshot repository(ies)\n", nLines);
 }
 
 
@@ -2696,12 +2713,12 @@ S9sRpcReply::printKeys()
         {
             S9sVariantMap theMap = theList[idx].toVariantMap();
 
-            printf("\"%s\"\n", STR(theMap["name"].toString()));
-            printf("%s\n\n",   STR(theMap["key"].toString()));
+            S9sOutput::printf("\"%s\"\n", STR(theMap["name"].toString()));
+            S9sOutput::printf("%s\n\n",   STR(theMap["key"].toString()));
         }
     
         if (!options->isBatchRequested())
-            ::printf("Total: %d\n", operator[]("total").toInt());
+            S9sOutput::printf("Total: %d\n", operator[]("total").toInt());
     }
 }
 
@@ -2803,7 +2820,7 @@ S9sRpcReply::printAccountListBrief(const S9sString &clusterType)
             colorEnd   = "";
         }
 
-        printf("%s%s%s\n", colorBegin, STR(accountName), colorEnd);
+        S9sOutput::printf("%s%s%s\n", colorBegin, STR(accountName), colorEnd);
         printed[accountName] = true;
     }
 }
@@ -2868,7 +2885,7 @@ S9sRpcReply::printAccountListLong(const S9sString &clusterType)
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         // Johan asked for ''@'' format, this is a temporary solution for that.
         // FIXME: Well, not temporary it seems, this code persists.
         #if 0
@@ -2882,10 +2899,10 @@ S9sRpcReply::printAccountListLong(const S9sString &clusterType)
         passwordFormat.printHeader("P");
         connectionsFormat.printHeader("CONN");
         maxConnectionsFormat.printHeader("MAXC");
-        printf("GRANTS");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("GRANTS");
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     columns  = terminalWidth;
@@ -2931,31 +2948,31 @@ S9sRpcReply::printAccountListLong(const S9sString &clusterType)
             password = "Y";
        
         // Johan asked for ''@'' format, this is a temporary solution for that.
-        printf("%s", colorBegin);
-        printf("'%s'", STR(accountName));
-        printf("%s", colorEnd);
-        printf("@");
-        printf("%s", hostColorBegin);
-        printf("'%s'", STR(hostName));
-        printf("%s", hostColorEnd);
+        S9sOutput::printf("%s", colorBegin);
+        S9sOutput::printf("'%s'", STR(accountName));
+        S9sOutput::printf("%s", colorEnd);
+        S9sOutput::printf("@");
+        S9sOutput::printf("%s", hostColorBegin);
+        S9sOutput::printf("'%s'", STR(hostName));
+        S9sOutput::printf("%s", hostColorEnd);
         
         // The 5 is the length of ''@''
         thisWidth = accountName.length() + hostName.length() + 5;
         requiredWidth = accountNameFormat.realWidth();
 
         for (int n = thisWidth; n < requiredWidth; ++n)
-            printf(" ");
+            S9sOutput::printf(" ");
 
         passwordFormat.printf(password);
         connectionsFormat.printf(connections);
         maxConnectionsFormat.printf(maxConnections);
         
-        ::printf("%s", STR(account.grants(syntaxHighlight)));
-        ::printf("\n");
+        S9sOutput::printf("%s", STR(account.grants(syntaxHighlight)));
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
-        printf("Total: %d\n", operator[]("total").toInt());
+        S9sOutput::printf("Total: %d\n", operator[]("total").toInt());
 }
 
 void
@@ -3003,7 +3020,7 @@ S9sRpcReply::printCurrentMaintenance() const
             uiString = at("ui_string").toString();
 
         if (found && !uiString.empty())
-            ::printf("%s\n", STR(uiString));
+            S9sOutput::printf("%s\n", STR(uiString));
 
         //printDebugMessages();
         //printJsonFormat();
@@ -3030,7 +3047,7 @@ S9sRpcReply::printNextMaintenance() const
             uiString = at("ui_string").toString();
 
         if (found && !uiString.empty())
-            ::printf("%s\n", STR(uiString));
+            S9sOutput::printf("%s\n", STR(uiString));
 
         //printDebugMessages();
         //printJsonFormat();
@@ -3156,11 +3173,11 @@ S9sRpcReply::printExtendedConfigLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         nameFormat.printHeader("NAME");
         valueFormat.printHeader("VALUE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     for (size_t idx = 0u; idx < items.size(); ++idx)
@@ -3173,21 +3190,21 @@ S9sRpcReply::printExtendedConfigLong()
             continue;
 
         if (syntaxHighlight)
-            ::printf("%s", "\033[38;5;4m");
+            S9sOutput::printf("%s", "\033[38;5;4m");
 
         nameFormat.printf(name.toString());
 
         if (syntaxHighlight)
-            ::printf("%s", TERM_NORMAL);
+            S9sOutput::printf("%s", TERM_NORMAL);
        
         if (syntaxHighlight)
         {
-            ::printf("%s", STR(value.toJsonString(0, S9sFormatColor)));
+            S9sOutput::printf("%s", STR(value.toJsonString(0, S9sFormatColor)));
         } else {
-            ::printf("%s", STR(value.toJsonString(0, S9sFormatNormal)));
+            S9sOutput::printf("%s", STR(value.toJsonString(0, S9sFormatNormal)));
         }
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
 
     if (!options->isBatchRequested())
@@ -3195,12 +3212,12 @@ S9sRpcReply::printExtendedConfigLong()
         
         if (syntaxHighlight)
         {
-            printf("Total: %s%d%s values.\n", 
+            S9sOutput::printf("Total: %s%d%s values.\n", 
                     numberColorBegin(),
                     nValues,
                     numberColorEnd());
         } else {
-            printf("Total: %d values.\n", nValues);
+            S9sOutput::printf("Total: %d values.\n", nValues);
         }
     }
 }
@@ -3240,9 +3257,9 @@ S9sRpcReply::printLogBrief()
         // Filtering by severity level is done on the controller now.
 
         if (formatString.empty())
-            printf("%s\n", STR(S9sString::html2ansi(message.message())));
+            S9sOutput::printf("%s\n", STR(S9sString::html2ansi(message.message())));
         else {
-            printf("%s",
+            S9sOutput::printf("%s",
                     STR(message.toString(syntaxHighlight, formatString)));
         }
     }
@@ -3314,7 +3331,7 @@ S9sRpcReply::printLogLong()
         {
             //printf("%s\n", STR(S9sString::html2ansi(message.message())));
         } else {
-            ::printf("%s",
+            S9sOutput::printf("%s",
                     STR(message.toString(syntaxHighlight, formatString)));
         }
     }
@@ -3340,16 +3357,16 @@ S9sRpcReply::printConfigDebug()
 
         lines = content.split("\n", true);
 
-        ::printf("filename : %s\n", STR(fileName));
-        ::printf("    path : %s\n", STR(path));
-        ::printf("  syntax : %s\n", STR(syntax));
+        S9sOutput::printf("filename : %s\n", STR(fileName));
+        S9sOutput::printf("    path : %s\n", STR(path));
+        S9sOutput::printf("  syntax : %s\n", STR(syntax));
 
         for (uint idx1 = 0u; idx1 < lines.size(); ++idx1)
         {
             S9sString  line = lines[idx1].toString();
             
             //line.replace("\\r", "");
-            ::printf("[%04u] %s\n", idx1, STR(line));
+            S9sOutput::printf("[%04u] %s\n", idx1, STR(line));
         }
     }
 }
@@ -3406,12 +3423,12 @@ S9sRpcReply::printConfigLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         sectionFormat.printHeader("GROUP");
         nameFormat.printHeader("OPTION NAME");
         valueFormat.printHeader("VALUE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     for (uint idx1 = 0; idx1 < fileList.size(); ++idx1)
@@ -3445,32 +3462,32 @@ S9sRpcReply::printConfigLong()
             if (section.empty())
                 section = "-";
 
-            printf("%sFile    :%s %s%s%s:%d\n", 
+            S9sOutput::printf("%sFile    :%s %s%s%s:%d\n", 
                 syntaxHighlight ? XTERM_COLOR_DARK_GRAY : "", 
                 syntaxHighlight ? TERM_NORMAL : "",
                 XTERM_COLOR_ORANGE, STR(filePath), TERM_NORMAL,
                 line);
             
-            printf("%sSection :%s %s\n", 
+            S9sOutput::printf("%sSection :%s %s\n", 
                 syntaxHighlight ? XTERM_COLOR_DARK_GRAY : "",
                 syntaxHighlight ? TERM_NORMAL : "",
                 STR(section));
             
-            printf("%sName    :%s %s%s%s\n", 
+            S9sOutput::printf("%sName    :%s %s%s%s\n", 
                 syntaxHighlight ? XTERM_COLOR_DARK_GRAY : "",
                 syntaxHighlight ? TERM_NORMAL : "",
                 optNameColorBegin(), STR(name), optNameColorEnd());
             
-            printf("%sValue   :%s %s\n", 
+            S9sOutput::printf("%sValue   :%s %s\n", 
                 syntaxHighlight ? XTERM_COLOR_DARK_GRAY : "", 
                 syntaxHighlight ? TERM_NORMAL : "",
                 STR(valueMap["value"].toString()));
             
             // A horizontal line.
             for (int n = 0; n < terminalWidth; ++n)
-                printf("-");
+                S9sOutput::printf("-");
 
-            printf("\n");
+            S9sOutput::printf("\n");
         }
     }
 }
@@ -3527,13 +3544,13 @@ S9sRpcReply::printConfigBrief(
 
         sectionFormat.printf(section);
 
-        printf("%s", optNameColorBegin());
+        S9sOutput::printf("%s", optNameColorBegin());
         nameFormat.printf(name);
-        printf("%s", optNameColorEnd());
+        S9sOutput::printf("%s", optNameColorEnd());
         
         valueFormat.printf(value);
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 }
 
@@ -3597,12 +3614,12 @@ S9sRpcReply::printConfigBrief()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         sectionFormat.printHeader("GROUP");
         nameFormat.printHeader("OPTION NAME");
         valueFormat.printHeader("VALUE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     for (uint idx1 = 0; idx1 < fileList.size(); ++idx1)
@@ -3644,68 +3661,81 @@ S9sRpcReply::printConfigBrief()
             
             sectionFormat.printf(section);
 
-            printf("%s", optNameColorBegin());
+            S9sOutput::printf("%s", optNameColorBegin());
             nameFormat.printf(name);
-            printf("%s", optNameColorEnd());
+            S9sOutput::printf("%s", optNameColorEnd());
 
             valueFormat.printf(valueMap["value"].toString());
-            printf("\n");
+            S9sOutput::printf("\n");
         }
     }
     
     if (!options->isBatchRequested())
-        printf("Total: %d\n", total);
+        S9sOutput::printf("Total: %d\n", total);
 }
 
-void
+/**
+ * \param outputDir The directory where the files are saved.
+ * \param nWritten The number of files actually written is returned here.
+ * \param nUnchanged The number of files that were found on the disk with the
+ *   same content is returned here.
+ * \param errorString The error message is returned here.
+ * \returns True if all the files are saved.
+ *
+ * Saves the configuration files from a "getConfig" reply. The files that are
+ * already there with the same content are not touched, so the modification
+ * time shows when the configuration actually changed. The others are written
+ * into a temporary file and renamed, so a half written file is never seen.
+ */
+bool
 S9sRpcReply::saveConfig(
-        S9sString outputDir)
+        const S9sString &outputDir,
+        int             &nWritten,
+        int             &nUnchanged,
+        S9sString       &errorString)
 {
     S9sVariantList files = operator[]("files").toVariantList();
-    int            nFilesExist = 0;
-
-    /*
-     * First we check if the files are not already there. If any of the files
-     * are already exist we won't crate the others either.
-     */
-    for (uint idx = 0; idx < files.size(); ++idx)
-    {
-        S9sVariantMap map      = files[idx].toVariantMap();
-        S9sString     fileName = map["filename"].toString();
-        S9sString     path     = S9sFile::buildPath(outputDir, fileName);;
-        S9sFile       file(path);
-
-        if (!file.exists())
-            continue;
+    bool           retval = true;
 
-        nFilesExist++;
-        PRINT_ERROR("The file '%s' already exists.", STR(path));
-    }
+    nWritten   = 0;
+    nUnchanged = 0;
 
-    if (nFilesExist > 0)
-        return;
-   
-    /*
-     * Then we save the files one by one.
-     */
     for (uint idx = 0; idx < files.size(); ++idx)
     {
         S9sVariantMap map      = files[idx].toVariantMap();
         S9sString     fileName = map["filename"].toString();
         S9sString     content  = map["content"].toString();
         S9sString     path;
-        S9sString     errorString;
+        S9sString     oldContent;
+        S9sString     message;
         bool          success;
 
         path = S9sFile::buildPath(outputDir, fileName);
-        //printf("-> '%s'\n", STR(path));
 
-        success = S9sString::writeFile(path, content, errorString);
+        if (S9sFile::fileExists(path) &&
+                S9sString::readFile(path, oldContent, message) &&
+                oldContent == content)
+        {
+            PRINT_VERBOSE("The file '%s' is unchanged.", STR(path));
+            ++nUnchanged;
+            continue;
+        }
+
+        success = S9sString::writeFileAtomic(path, content, message);
         if (!success)
         {
-            PRINT_ERROR("Error saving configuration: %s", STR(errorString));
+            if (errorString.empty())
+                errorString = message;
+
+            retval = false;
+            continue;
         }
+
+        PRINT_VERBOSE("Saved '%s'.", STR(path));
+        ++nWritten;
     }
+
+    return retval;
 }
 
 /**
@@ -3753,9 +3783,9 @@ S9sRpcReply::printClusterListBrief()
         //
         if (hasFormat)
         {
-            printf("%s", STR(cluster.toString(syntaxHighlight, format)));
+            S9sOutput::printf("%s", STR(cluster.toString(syntaxHighlight, format)));
         } else {
-            printf("%s%s%s ", 
+            S9sOutput::printf("%s%s%s ", 
                     clusterColorBegin(), 
                     STR(clusterName), 
                     clusterColorEnd());
@@ -3767,8 +3797,8 @@ S9sRpcReply::printClusterListBrief()
 
     if (nPrinted > 0 && !hasFormat)
     {
-        printf("\n");
-        fflush(stdout);
+        S9sOutput::printf("\n");
+        S9sOutput::flush();
     }
 }
 
@@ -3810,7 +3840,7 @@ S9sRpcReply::printDatabaseListBrief()
             if (!options->isStringMatchExtraArguments(name))
                 continue;
 
-            printf("%s ", STR(name));
+            S9sOutput::printf("%s ", STR(name));
         }
 
         ++nPrinted;
@@ -3818,8 +3848,8 @@ S9sRpcReply::printDatabaseListBrief()
 
     if (nPrinted > 0)
     {
-        printf("\n");
-        fflush(stdout);
+        S9sOutput::printf("\n");
+        S9sOutput::flush();
     }
 }
 
@@ -3829,14 +3859,8 @@ S9sRpcReply::printAlarmListLong()
     S9sOptions     *options = S9sOptions::instance();
     bool            syntaxHighlight = options->useSyntaxHighlight();
     S9sVariantList  theList = alarms();
-    S9sFormat       idFormat;
-    S9sFormat       clusterIdFormat;
-    S9sFormat       severityFormat;
-    S9sFormat       typeNameFormat;
-    S9sFormat       componentNameFormat;
-    S9sFormat       titleFormat;
-    S9sFormat       hostNameFormat;
-    int             nLines = 0;
+    bool            multiController = contains("controllers");
+    S9sTable        table;
     const char     *hostColorBegin = "";
     const char     *hostColorEnd   = "";
     const char     *keyColorBegin = "";
@@ -3851,74 +3875,54 @@ S9sRpcReply::printAlarmListLong()
         keyColorEnd     = TERM_NORMAL;
     }
 
-    for (uint idx = 0; idx < theList.size(); ++idx)
-    {
-        S9sVariantMap alarmMap  = theList[idx].toVariantMap();
-        S9sAlarm      alarm(alarmMap);
-
-        if (alarm.isIgnored())
-            continue;
-
-        idFormat.widen(alarm.alarmId());
-        clusterIdFormat.widen(alarm.clusterId());
-        componentNameFormat.widen(alarm.componentName());
-        severityFormat.widen(alarm.severityName());
-        typeNameFormat.widen(alarm.typeName());
-        titleFormat.widen(alarm.title());
-        hostNameFormat.widen(alarm.hostName());
-        ++nLines;
-    }
-
-    if (!options->isNoHeaderRequested() && nLines > 0)
-    {
-        printf("%s", headerColorBegin());
-        idFormat.printHeader("ID");
-        clusterIdFormat.printHeader("CID");
-        severityFormat.printHeader("SEVERITY");
-        componentNameFormat.printHeader("COMPONENT");
-        typeNameFormat.printHeader("TYPE");
-        hostNameFormat.printHeader("HOSTNAME");
-        titleFormat.printHeader("TITLE");
-        
-        printf("%s", headerColorEnd());
-        printf("\n");
-    }
+    // The merged list of more controllers shows where the alarm came from.
+    if (multiController)
+        table.addColumn("CONTROLLER");
 
-    
+    table.addColumn("ID");
+    table.addColumn("CID");
+    table.addColumn("SEVERITY");
+    table.addColumn("COMPONENT");
+    table.addColumn("TYPE");
+    table.addColumn("HOSTNAME");
+    table.addColumn("TITLE");
 
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap alarmMap  = theList[idx].toVariantMap();
-        S9sAlarm      alarm(alarmMap);
+        S9sAlarm      alarm(theList[idx].toVariantMap());
 
         if (alarm.isIgnored())
             continue;
 
-        idFormat.printf(alarm.alarmId());
-        clusterIdFormat.printf(alarm.clusterId());
-
-        ::printf("%s", alarm.severityColorBegin(syntaxHighlight));
-        severityFormat.printf(alarm.severityName());
-        ::printf("%s", alarm.severityColorEnd(syntaxHighlight));
-
-        ::printf("%s", keyColorBegin);
-        componentNameFormat.printf(alarm.componentName());
-        ::printf("%s", keyColorEnd);
-
-        ::printf("%s", keyColorBegin);
-        typeNameFormat.printf(alarm.typeName());
-        ::printf("%s", keyColorEnd);
+        table.addRow();
+        if (multiController)
+        {
+            table.addCell(
+                    alarm.toVariantMap().value("controller").toString(),
+                    serverColorBegin(), serverColorEnd());
+        }
 
-        ::printf("%s", hostColorBegin);
-        hostNameFormat.printf(alarm.hostName());
-        ::printf("%s", hostColorEnd);
+        table.addCell(alarm.alarmId());
+        table.addCell(alarm.clusterId());
+        table.addCell(
+                alarm.severityName(),
+                alarm.severityColorBegin(syntaxHighlight),
+                alarm.severityColorEnd(syntaxHighlight));
 
-        ::printf("%s\n", STR(alarm.title()));
+        table.addCell(alarm.componentName(), keyColorBegin, keyColorEnd);
+        table.addCell(alarm.typeName(), keyColorBegin, keyColorEnd);
+        table.addCell(alarm.hostName(), hostColorBegin, hostColorEnd);
+        table.addCell(alarm.title());
     }
+
+    table.setHeaderVisible(
+            !options->isNoHeaderRequested() && table.nRows() > 0);
+    table.setHeaderColor(headerColorBegin(), headerColorEnd());
+    table.print();
     
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%lu%s alarm(s)\n", 
+        S9sOutput::printf("Total: %s%lu%s alarm(s)\n", 
                 numberColorBegin(),
                 (unsigned long int) theList.size(),
                 numberColorEnd());
@@ -3939,12 +3943,8 @@ S9sRpcReply::printClusterListLong()
     int             isTerminal    = options->isTerminal();
     int             terminalWidth = options->terminalWidth();
     S9sString       formatString  = options->longClusterFormat();
-    int             nLines = 0;
-    S9sFormat       idFormat;
-    S9sFormat       stateFormat;
-    S9sFormat       typeFormat;
-    S9sFormat       ownerFormat, groupFormat;
-    S9sFormat       nameFormat;
+    bool            multiController = contains("controllers");
+    S9sTable        table;
 
     if (options->hasClusterFormat())
         formatString = options->clusterFormat();
@@ -3982,85 +3982,29 @@ S9sRpcReply::printClusterListLong()
             /*
              * Printing using the formatstring.
              */
-            printf("%s", STR(cluster.toString(syntaxHighlight, formatString)));
+            S9sOutput::printf("%s", STR(cluster.toString(syntaxHighlight, formatString)));
         }
 
         if (!options->isBatchRequested())
-            printf("Total: %lu\n", (unsigned long int) theList.size());
+            S9sOutput::printf("Total: %lu\n", (unsigned long int) theList.size());
 
         return;
     }
 
     /*
-     * First run-through: collecting some information.
+     * Collecting the rows of the table in one pass.
      */
-    for (uint idx = 0; idx < theList.size(); ++idx)
-    {
-        S9sVariantMap clusterMap  = theList[idx].toVariantMap();
-        S9sVariantMap ownerMap    = clusterMap["owner"].toVariantMap();
-        S9sString     ownerName   = ownerMap["user_name"].toString();
-        S9sVariantMap groupMap    = clusterMap["group_owner"].toVariantMap();
-        S9sString     groupName   = groupMap["group_name"].toString();
-        S9sString     clusterName = clusterMap["cluster_name"].toString();
-        int           clusterId   = clusterMap["cluster_id"].toInt();
-        S9sString     clusterType = clusterMap["cluster_type"].toString();
-        S9sString     state       = clusterMap["state"].toString();
-        S9sString     version     = 
-            clusterMap["vendor"].toString() + " " +
-            clusterMap["version"].toString();
-        
-        //
-        // Filtering.
-        //
-        if (options->hasClusterIdOption())
-        {
-            if (clusterId != options->clusterId())
-                continue;
-        }
-        
-        if (options->hasClusterNameOption())
-        {
-            if (clusterName != options->clusterName())
-                continue;
-        }
-
-        if (!options->isStringMatchExtraArguments(clusterName))
-            continue;
-
-        if (groupName.empty())
-            groupName = "0";
-
-        idFormat.widen(clusterId);
-        stateFormat.widen(state);
-        typeFormat.widen(clusterType);
-        ownerFormat.widen(ownerName);
-        groupFormat.widen(groupName);
-        nameFormat.widen(clusterName);
+    if (multiController)
+        table.addColumn("CONTROLLER");
 
-        ++nLines;
-    }
+    table.addColumn("ID");
+    table.addColumn("STATE");
+    table.addColumn("TYPE");
+    table.addColumn("OWNER");
+    table.addColumn("GROUP");
+    table.addColumn("NAME");
+    table.addColumn("COMMENT");
 
-    /*
-     * Printing the header.
-     */
-    if (!options->isNoHeaderRequested() && nLines > 0)
-    {
-        printf("%s", headerColorBegin());
-        idFormat.printHeader("ID");
-        stateFormat.printHeader("STATE");
-        typeFormat.printHeader("TYPE");
-        ownerFormat.printHeader("OWNER");
-        groupFormat.printHeader("GROUP");
-        nameFormat.printHeader("NAME");
-        printf("COMMENT");
-        
-        printf("%s", headerColorEnd());
-        printf("\n");
-    }
-
-    /*
-     * Second run: doing the actual printing.
-     */
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
         S9sVariantMap clusterMap  = theList[idx].toVariantMap();
@@ -4073,10 +4017,8 @@ S9sRpcReply::printClusterListLong()
         S9sString     clusterType = clusterMap["cluster_type"].toString();
         S9sString     state       = clusterMap["state"].toString();
         S9sString     statusText  = clusterMap["status_text"].toString();
-        int           nColumns    = 0;
-        S9sString     version     = 
-            clusterMap["vendor"].toString() + " " +
-            clusterMap["version"].toString();
+        const char   *stateColorBegin = "";
+        const char   *stateColorEnd   = "";
         
         if (groupName.empty())
             groupName = "0";
@@ -4106,55 +4048,50 @@ S9sRpcReply::printClusterListLong()
         if (clusterName.empty())
             continue;
         
-        nColumns += idFormat.realWidth();
-        nColumns += stateFormat.realWidth();
-        nColumns += typeFormat.realWidth();
-        nColumns += ownerFormat.realWidth();
-        nColumns += groupFormat.realWidth();
-        nColumns += nameFormat.realWidth();
-
-        if (isTerminal && nColumns < terminalWidth)
-        {
-            int remaining  = terminalWidth - nColumns;
-            
-            if (remaining < (int) statusText.length())
-            {
-                statusText.resize(remaining - 1);
-                statusText += "…";
-            }
-        }
-        
         if (syntaxHighlight)
         {
+            stateColorEnd = TERM_NORMAL;
+
             if (state == "STARTED")
-                stateFormat.setColor(XTERM_COLOR_GREEN, TERM_NORMAL);
+                stateColorBegin = XTERM_COLOR_GREEN;
             else if (state == "FAILED" || state == "FAILURE")
-                stateFormat.setColor(XTERM_COLOR_RED, TERM_NORMAL);
+                stateColorBegin = XTERM_COLOR_RED;
             else
-                stateFormat.setColor(XTERM_COLOR_YELLOW, TERM_NORMAL);
+                stateColorBegin = XTERM_COLOR_YELLOW;
         }
 
-        idFormat.printf(clusterId); 
-        stateFormat.printf(state);
-        typeFormat.printf(clusterType.toLower());
-        
-        printf("%s", userColorBegin());
-        ownerFormat.printf(ownerName);
-        printf("%s", userColorEnd());
-
-        printf("%s", groupColorBegin(groupName));
-        groupFormat.printf(groupName);
-        printf("%s", groupColorEnd());
-        
-        printf("%s", clusterColorBegin());
-        nameFormat.printf(clusterName);
-        printf("%s", clusterColorEnd());
+        table.addRow();
+        if (multiController)
+        {
+            table.addCell(
+                    clusterMap["controller"].toString(),
+                    serverColorBegin(), serverColorEnd());
+        }
 
-        printf("%s\n", STR(statusText));
+        table.addCell(clusterId); 
+        table.addCell(state, stateColorBegin, stateColorEnd);
+        table.addCell(clusterType.toLower());
+        table.addCell(ownerName, userColorBegin(), userColorEnd());
+        table.addCell(
+                groupName, groupColorBegin(groupName), groupColorEnd());
+        table.addCell(clusterName, clusterColorBegin(), clusterColorEnd());
+        table.addCell(statusText);
     }
+
+    /*
+     * Printing the table. The comment is truncated if we print to a terminal.
+     */
+    table.setHeaderVisible(!options->isNoHeaderRequested() && 
+            table.nRows() > 0);
+    table.setHeaderColor(headerColorBegin(), headerColorEnd());
+
+    if (isTerminal)
+        table.setMaxWidth(terminalWidth);
+
+    table.print();
    
     if (!options->isBatchRequested())
-        printf("Total: %lu\n", (unsigned long int) theList.size());
+        S9sOutput::printf("Total: %lu\n", (unsigned long int) theList.size());
 }
 
 void 
@@ -4196,14 +4133,14 @@ S9sRpcReply::printReportListLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         cidFormat.printHeader("CID");
         typeFormat.printHeader("TYPE");
         createdFormat.printHeader("CREATED");
         titleFormat.printHeader("TITLE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     for (uint idx = 0u; idx < reports.size(); ++idx)
@@ -4225,7 +4162,7 @@ S9sRpcReply::printReportListLong()
         createdFormat.printf(timeStamp);
         titleFormat.printf(title);
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
 }
 
@@ -4255,11 +4192,11 @@ S9sRpcReply::printReportTemplateListLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        ::printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         typeFormat.printHeader("TYPE");
         titleFormat.printHeader("TITLE");
-        ::printf("%s", headerColorEnd());
-        ::printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     for (uint idx = 0u; idx < reports.size(); ++idx)
@@ -4271,11 +4208,11 @@ S9sRpcReply::printReportTemplateListLong()
         typeFormat.printf(reportType);
         titleFormat.printf(title);
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
 
     if (nLines > 0)
-        ::printf("Total: %d report templates\n", nLines);
+        S9sOutput::printf("Total: %d report templates\n", nLines);
 }
 
 void 
@@ -4288,7 +4225,7 @@ S9sRpcReply::printReportTemplateListBrief()
         S9sVariantMap  reportMap = reports[idx].toVariantMap();
         S9sString      reportType = reportMap["report_type"].toString();
         
-        ::printf("%s\n", STR(reportType));
+        S9sOutput::printf("%s\n", STR(reportType));
     }
 }
 
@@ -4343,7 +4280,7 @@ S9sRpcReply::printAlarmStatistics()
             int critical  = theMap["critical"].toInt();
             int warning   = theMap["warning"].toInt();
 
-            ::printf("%d,%d,%d\n", clusterId, critical, warning);
+            S9sOutput::printf("%d,%d,%d\n", clusterId, critical, warning);
         }
     }
 }
@@ -4452,7 +4389,7 @@ S9sRpcReply::printDatabaseListLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
 
         sizeFormat.printHeader("SIZE");
         nTablesFormat.printHeader("#TBL");
@@ -4462,8 +4399,8 @@ S9sRpcReply::printDatabaseListLong()
         clusterNameFormat.printHeader("CLUSTER");
         nameFormat.printHeader("DATABASE");
  
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     sizeFormat.setRightJustify();
@@ -4529,29 +4466,29 @@ S9sRpcReply::printDatabaseListLong()
             nTablesFormat.printf(nTablesString);
             nRowsFormat.printf(nRowsString);
 
-            printf("%s", userColorBegin());
+            S9sOutput::printf("%s", userColorBegin());
             ownerFormat.printf(ownerName);
-            printf("%s", userColorEnd());
+            S9sOutput::printf("%s", userColorEnd());
 
-            printf("%s", groupColorBegin(groupName));
+            S9sOutput::printf("%s", groupColorBegin(groupName));
             groupFormat.printf(groupName);
-            printf("%s", groupColorEnd());
+            S9sOutput::printf("%s", groupColorEnd());
 
-            printf("%s", clusterColorBegin());
+            S9sOutput::printf("%s", clusterColorBegin());
             clusterNameFormat.printf(clusterName);
-            printf("%s", clusterColorEnd());
+            S9sOutput::printf("%s", clusterColorEnd());
 
-            printf("%s", databaseColorBegin());
+            S9sOutput::printf("%s", databaseColorBegin());
             nameFormat.printf(name);
-            printf("%s", databaseColorEnd());
+            S9sOutput::printf("%s", databaseColorEnd());
 
-            printf("\n");
+            S9sOutput::printf("\n");
         }
     }
 
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%d%s databases, %s%s%s, %s%'llu%s tables.\n", 
+        S9sOutput::printf("Total: %s%d%s databases, %s%s%s, %s%'llu%s tables.\n", 
                 numberColorBegin(), nDatabases, numberColorEnd(),
                 numberColorBegin(),
                 STR(m_formatter.mBytesToHuman(totalBytes / (1024*1024))),
@@ -4590,31 +4527,47 @@ S9sRpcReply::printNodeListBrief()
     {
         for (uint idx = 0; idx < theList.size(); ++idx)
         {
-            S9sVariantMap  theMap      = theList[idx].toVariantMap();
-            S9sVariantList hosts       = theMap["hosts"].toVariantList();
-            S9sString      clusterName = theMap["cluster_name"].toString();
+            S9sClusterView        clusterView(theList[idx]);
+            const S9sVariantList &hosts = clusterView.hosts();
+            S9sCluster            theCluster;
+            bool                  clusterCopied = false;
 
-            if (!clusterNameFilter.empty() && clusterNameFilter != clusterName)
+            if (!clusterNameFilter.empty() && 
+                    clusterNameFilter != clusterView.name())
+            {
                 continue;
+            }
 
             for (uint idx2 = 0; idx2 < hosts.size(); ++idx2)
             {
-                S9sVariantMap hostMap   = hosts[idx2].toVariantMap();
-                S9sNode       node      = hostMap;
-                int           clusterId = node.clusterId();
-                S9sCluster    cluster   = clusterMap(clusterId);
-                S9sString     hostName  = node.name();
+                S9sNodeView   hostView(hosts[idx2]);
+                S9sNode       node;
                 
                 // Filtering...
-                if (!properties.isSubSet(hostMap))
+                if (!properties.isSubSet(hostView.toVariantMap()))
                     continue;
 
-                if (!options->isStringMatchExtraArguments(hostName))
+                if (!options->isStringMatchExtraArguments(hostView.name()))
                     continue;
 
-                node.setCluster(cluster);
+                // The hosts are listed inside their own clusters, there is no
+                // need to look up the cluster for every host. The cluster is
+                // copied only if a host of it is printed.
+                node = hostView.toNode();
+                if (hostView.clusterId() == clusterView.clusterId())
+                {
+                    if (!clusterCopied)
+                    {
+                        theCluster    = clusterView.toCluster();
+                        clusterCopied = true;
+                    }
+
+                    node.setCluster(theCluster);
+                } else {
+                    node.setCluster(clusterMap(hostView.clusterId()));
+                }
 
-                printf("%s", STR(node.toString(syntaxHighlight, formatString)));
+                S9sOutput::printf("%s", STR(node.toString(syntaxHighlight, formatString)));
             }
         }
     
@@ -4627,21 +4580,18 @@ S9sRpcReply::printNodeListBrief()
      */
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap = theList[idx].toVariantMap();
-        S9sVariantList hostList = theMap["hosts"].toVariantList();
+        S9sClusterView        clusterView(theList[idx]);
+        const S9sVariantList &hostList = clusterView.hosts();
 
         for (uint idx2 = 0; idx2 < hostList.size(); ++idx2)
         {
-            S9sVariantMap hostMap   = hostList[idx2].toVariantMap();
-            S9sNode       node      = hostMap;
-            S9sString     hostName  = node.name();
-            S9sString     version   = hostMap["version"].toString();
+            S9sNodeView hostView(hostList[idx2]);
                 
-            if (!properties.isSubSet(hostMap))
+            if (!properties.isSubSet(hostView.toVariantMap()))
                 continue;
             
-            if (hostName.length() > maxHostNameLength)
-                maxHostNameLength = hostName.length();
+            if (hostView.name().length() > maxHostNameLength)
+                maxHostNameLength = hostView.name().length();
         }
     }
 
@@ -4659,20 +4609,18 @@ S9sRpcReply::printNodeListBrief()
      */
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap = theList[idx].toVariantMap();
-        S9sString      clusterName = theMap["cluster_name"].toString();
-        S9sVariantList hostList = theMap["hosts"].toVariantList();
+        S9sClusterView        clusterView(theList[idx]);
+        const S9sVariantList &hostList = clusterView.hosts();
 
         for (uint idx2 = 0; idx2 < hostList.size(); ++idx2)
         {
-            S9sVariantMap hostMap   = hostList[idx2].toVariantMap();
-            S9sNode       node      = hostMap;
-            S9sString     hostName  = node.name();
-            S9sString     status    = hostMap["hoststatus"].toString();
-            const char   *nameStart = "";
-            const char   *nameEnd   = "";
+            S9sNodeView       hostView(hostList[idx2]);
+            const S9sString  &hostName  = hostView.name();
+            const S9sString  &status    = hostView.hostStatus();
+            const char       *nameStart = "";
+            const char       *nameEnd   = "";
 
-            if (!properties.isSubSet(hostMap))
+            if (!properties.isSubSet(hostView.toVariantMap()))
                 continue;
 
             if (syntaxHighlight)
@@ -4696,17 +4644,17 @@ S9sRpcReply::printNodeListBrief()
 
             if (isTerminal)
             {
-                printf(STR(hostNameFormat), 
+                S9sOutput::printf(STR(hostNameFormat), 
                         nameStart, STR(hostName), nameEnd);
 
                 column += maxHostNameLength;
                 if (column + (int) maxHostNameLength > terminalWidth)
                 {
-                    printf("\n");
+                    S9sOutput::printf("\n");
                     column = 0;
                 }
             } else {
-                printf("%s%s%s\n", nameStart, STR(hostName), nameEnd);
+                S9sOutput::printf("%s%s%s\n", nameStart, STR(hostName), nameEnd);
                 column = 0;
             }
         }
@@ -4714,8 +4662,8 @@ S9sRpcReply::printNodeListBrief()
 
     if (column > 0)
     {
-        printf("\n");
-        fflush(stdout);
+        S9sOutput::printf("\n");
+        S9sOutput::flush();
     }
 }
 
@@ -4744,7 +4692,7 @@ S9sRpcReply::printScriptTreeBrief(
     bool            isDir   = type == "directory";
     S9sString       indent;
 
-    printf("%s", STR(indentString));
+    S9sOutput::printf("%s", STR(indentString));
 
     if (recursionLevel)
     {
@@ -4756,11 +4704,11 @@ S9sRpcReply::printScriptTreeBrief(
 
     if (isDir)
     {
-        printf("%s%s%s%s\n", 
+        S9sOutput::printf("%s%s%s%s\n", 
                 STR(indent), 
                 XTERM_COLOR_BLUE, STR(name), TERM_NORMAL);
     } else {
-        printf("%s%s%s%s\n", 
+        S9sOutput::printf("%s%s%s%s\n", 
                 STR(indent), 
                 XTERM_COLOR_GREEN, STR(name), TERM_NORMAL);
     }
@@ -4828,9 +4776,9 @@ S9sRpcReply::printProcessors(
     
     if (!options->isNoHeaderRequested() && compact)
     {
-        printf("%s", headerColorBegin());
-        printf("QUA   PROCESSOR\n");
-        printf("%s", headerColorEnd());    
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("QUA   PROCESSOR\n");
+        S9sOutput::printf("%s", headerColorEnd());    
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -4847,7 +4795,7 @@ S9sRpcReply::printProcessors(
             S9sString name = theMap["hostname"].toString();
             S9sString model = theMap["model"].toString();
 
-            printf("%s (%s)\n", STR(name), STR(model));
+            S9sOutput::printf("%s (%s)\n", STR(name), STR(model));
         }
 
         for (uint idx1 = 0; idx1 < processorList.size(); ++idx1)
@@ -4861,9 +4809,9 @@ S9sRpcReply::printProcessors(
             {
                 cpuModels[model] += 1;
             } else {
-                printf("    %s", STR(indent));
-                printf("%s", STR(model));
-                printf("\n");
+                S9sOutput::printf("    %s", STR(indent));
+                S9sOutput::printf("%s", STR(model));
+                S9sOutput::printf("\n");
             }
                 
             ++totalCpus;
@@ -4879,14 +4827,14 @@ S9sRpcReply::printProcessors(
             S9sString  name = cpuModels.keys().at(idx);
             int        volume = cpuModels[name].toInt();
 
-            printf("%s", STR(indent));
-            printf("%3d x %s\n", volume, STR(name));
+            S9sOutput::printf("%s", STR(indent));
+            S9sOutput::printf("%3d x %s\n", volume, STR(name));
         }
     }
 
     if (!options->isBatchRequested())
     {
-        printf("%sTotal: %s%d%s cpus, %s%d%s cores, %s%d%s threads\n", 
+        S9sOutput::printf("%sTotal: %s%d%s cpus, %s%d%s cores, %s%d%s threads\n", 
                 STR(indent),
                 numberColorBegin(), totalCpus, numberColorEnd(),
                 numberColorBegin(), totalCores, numberColorEnd(),
@@ -4919,7 +4867,7 @@ S9sRpcReply::printDisks(
             S9sString name = theMap["hostname"].toString();
             S9sString model = theMap["model"].toString();
 
-            printf("%s (%s)\n", STR(name), STR(model));
+            S9sOutput::printf("%s (%s)\n", STR(name), STR(model));
         }
 
         for (uint idx1 = 0; idx1 < processorList.size(); ++idx1)
@@ -4947,9 +4895,9 @@ S9sRpcReply::printDisks(
             {
                 diskModels[model] += 1;
             } else {
-                printf("    %s", STR(indent));
-                printf("%s", STR(model));
-                printf("\n");
+                S9sOutput::printf("    %s", STR(indent));
+                S9sOutput::printf("%s", STR(model));
+                S9sOutput::printf("\n");
             }
                 
             ++totalDisks;
@@ -4963,12 +4911,12 @@ S9sRpcReply::printDisks(
             S9sString  name = diskModels.keys().at(idx);
             int        volume = diskModels[name].toInt();
 
-            printf("%s", STR(indent));
-            printf("%3d x %s\n", volume, STR(name));
+            S9sOutput::printf("%s", STR(indent));
+            S9sOutput::printf("%3d x %s\n", volume, STR(name));
         }
     }
 
-    ::printf("%sTotal: %d disks, %llu GBytes\n", 
+    S9sOutput::printf("%sTotal: %d disks, %llu GBytes\n", 
             STR(indent), totalDisks, totalCapacity);
 }
 
@@ -4986,9 +4934,9 @@ S9sRpcReply::printNics(
     
     if (!options->isNoHeaderRequested() && compact)
     {
-        printf("%s", headerColorBegin());
-        printf("QUA   NIC\n");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("QUA   NIC\n");
+        S9sOutput::printf("%s", headerColorEnd());
         
     }
 
@@ -5006,9 +4954,9 @@ S9sRpcReply::printNics(
             S9sString name = theMap["hostname"].toString();
             S9sString model = theMap["model"].toString();
 
-            printf(TERM_BOLD);
-            printf("%s (%s)\n", STR(name), STR(model));
-            printf(TERM_NORMAL);
+            S9sOutput::printf(TERM_BOLD);
+            S9sOutput::printf("%s (%s)\n", STR(name), STR(model));
+            S9sOutput::printf(TERM_NORMAL);
         }
 
         for (uint idx1 = 0; idx1 < nicList.size(); ++idx1)
@@ -5025,19 +4973,19 @@ S9sRpcReply::printNics(
             {
                 diskModels[model] += 1;
             } else {
-                printf("    %s", STR(indent));
+                S9sOutput::printf("    %s", STR(indent));
 
                 if (link)
-                    printf(XTERM_COLOR_NIC_UP);
+                    S9sOutput::printf(XTERM_COLOR_NIC_UP);
                 else
-                    printf(XTERM_COLOR_NIC_NOLINK);
+                    S9sOutput::printf(XTERM_COLOR_NIC_NOLINK);
 
-                printf("%s ", STR(mac));
-                printf("%s", STR(model));
+                S9sOutput::printf("%s ", STR(mac));
+                S9sOutput::printf("%s", STR(model));
 
-                printf(TERM_NORMAL);
+                S9sOutput::printf(TERM_NORMAL);
 
-                printf("\n");
+                S9sOutput::printf("\n");
             }
                 
             ++totalDisks;
@@ -5054,19 +5002,19 @@ S9sRpcReply::printNics(
             S9sString  name = diskModels.keys().at(idx);
             int        volume = diskModels[name].toInt();
 
-            printf("%s", STR(indent));
-            printf("%3d x %s\n", volume, STR(name));
+            S9sOutput::printf("%s", STR(indent));
+            S9sOutput::printf("%3d x %s\n", volume, STR(name));
         }
     }
 
     if (syntaxHighlight)
     {
-        printf("%sTotal: %s%d%s network interfaces, %s%d%s connected\n", 
+        S9sOutput::printf("%sTotal: %s%d%s network interfaces, %s%d%s connected\n", 
             STR(indent), 
             TERM_BOLD, totalDisks, TERM_NORMAL, 
             TERM_BOLD, totalLink, TERM_NORMAL);
     } else {
-        printf("%sTotal: %d network interfaces, %d connected\n", 
+        S9sOutput::printf("%sTotal: %d network interfaces, %d connected\n", 
             STR(indent), 
             totalDisks, 
             totalLink);
@@ -5142,7 +5090,7 @@ S9sRpcReply::printPartitions(
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         totalFormat.printHeader("SIZE");
         usedFormat.printHeader("USED");
         freeFormat.printHeader("AVAIL");
@@ -5152,9 +5100,9 @@ S9sRpcReply::printPartitions(
         filesystemFormat.printHeader("FS");
         deviceFormat.printHeader("DEVICE");
         mountpointFormat.printHeader("MOUNT POINT");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -5196,29 +5144,29 @@ S9sRpcReply::printPartitions(
             freeFormat.printf(freeStr);
             percentFormat.printf(percentStr);
             
-            printf("%s", serverColorBegin());
+            S9sOutput::printf("%s", serverColorBegin());
             hostnameFormat.printf(hostName);
-            printf("%s", serverColorEnd());
+            S9sOutput::printf("%s", serverColorEnd());
 
-            printf("%s", XTERM_COLOR_FILESYSTEM);
+            S9sOutput::printf("%s", XTERM_COLOR_FILESYSTEM);
             filesystemFormat.printf(filesystem);
-            printf("%s", TERM_NORMAL);
+            S9sOutput::printf("%s", TERM_NORMAL);
             
-            printf("%s", XTERM_COLOR_BDEV);
+            S9sOutput::printf("%s", XTERM_COLOR_BDEV);
             deviceFormat.printf(deviceName);
-            printf("%s", TERM_NORMAL);
+            S9sOutput::printf("%s", TERM_NORMAL);
 
-            printf("%s", XTERM_COLOR_DIR);
-            printf("%s", STR(mountPoint));
-            printf("%s", TERM_NORMAL);
+            S9sOutput::printf("%s", XTERM_COLOR_DIR);
+            S9sOutput::printf("%s", STR(mountPoint));
+            S9sOutput::printf("%s", TERM_NORMAL);
 
-            printf("\n");
+            S9sOutput::printf("\n");
         }
     }
 
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%s%s, %s%s%s free\n", 
+        S9sOutput::printf("Total: %s%s%s, %s%s%s free\n", 
                 numberColorBegin(), 
                 STR(m_formatter.mBytesToHuman(totalTotal)),
                 numberColorEnd(),
@@ -5265,9 +5213,9 @@ S9sRpcReply::printMemoryBanks(
      */
     if (!options->isNoHeaderRequested() && compact)
     {
-        printf("%s", headerColorBegin());
-        printf("QUA   MODULE\n");
-        printf("%s", headerColorEnd()); 
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("QUA   MODULE\n");
+        S9sOutput::printf("%s", headerColorEnd()); 
     }
 
     /*
@@ -5294,7 +5242,7 @@ S9sRpcReply::printMemoryBanks(
             S9sString name = theMap["hostname"].toString();
             S9sString model = theMap["model"].toString();
 
-            printf("%s (%s)\n", STR(name), STR(model));
+            S9sOutput::printf("%s (%s)\n", STR(name), STR(model));
         }
 
         for (uint idx1 = 0; idx1 < processorList.size(); ++idx1)
@@ -5310,9 +5258,9 @@ S9sRpcReply::printMemoryBanks(
             {
                 memoryModels[model] += 1;
             } else {
-                printf("    %s", STR(indent));
-                printf("%s", STR(model));
-                printf("\n");
+                S9sOutput::printf("    %s", STR(indent));
+                S9sOutput::printf("%s", STR(model));
+                S9sOutput::printf("\n");
             }
                 
             ++totalModules;
@@ -5329,8 +5277,8 @@ S9sRpcReply::printMemoryBanks(
             S9sString  name   = memoryModels.keys().at(idx);
             int        volume = memoryModels[name].toInt();
 
-            printf("%s", STR(indent));
-            printf("%3d x %s\n", volume, STR(name));
+            S9sOutput::printf("%s", STR(indent));
+            S9sOutput::printf("%3d x %s\n", volume, STR(name));
         }
     }
 
@@ -5339,9 +5287,9 @@ S9sRpcReply::printMemoryBanks(
      */
     if (!options->isBatchRequested())
     {
-        printf("%s", STR(indent));
+        S9sOutput::printf("%s", STR(indent));
 
-        printf(
+        S9sOutput::printf(
             "Total: %s%d%s modules, %s%d%s GBytes, %s%d%s GBytes free\n", 
             numberColorBegin(), totalModules, numberColorEnd(),
             numberColorBegin(), (int)(totalSize/1024), numberColorEnd(), 
@@ -5364,7 +5312,7 @@ S9sRpcReply::printRegionsBrief()
         for (uint idx1 = 0; idx1 < regionList.size(); ++idx1)
         {
             S9sString regionName = regionList[idx1].toString();
-            ::printf("%s\n", STR(regionName));
+            S9sOutput::printf("%s\n", STR(regionName));
         }
     }
 }
@@ -5432,15 +5380,15 @@ S9sRpcReply::printTemplates()
     
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         cloudFormat.printHeader("CLD");
         regionFormat.printHeader("REGION");
         cpuFormat.printHeader("CPU");
         memoryFormat.printHeader("MEMORY");
         hostNameFormat.printHeader("SERVER");
         nameFormat.printHeader("TEMPLATE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
 
     }
     
@@ -5486,13 +5434,13 @@ S9sRpcReply::printTemplates()
             hostNameFormat.printf(hostName);
             nameFormat.printf(name);
 
-            ::printf("\n");
+            S9sOutput::printf("\n");
         }
     }
     
     if (!options->isBatchRequested())
     {
-        ::printf("Total %s%d%s template(s) in %s%d%s region(s).\n",
+        S9sOutput::printf("Total %s%d%s template(s) in %s%d%s region(s).\n",
                 numberColorBegin(), nTemplatesFound, numberColorEnd(),
                 numberColorBegin(), (int)regions.size(), numberColorEnd()
                 );
@@ -5544,10 +5492,10 @@ S9sRpcReply::printSubnets()
 
         foreach(S9sVariant name, subnetsMap)
         {
-            ::printf("%s ", STR(name.toString()));
+            S9sOutput::printf("%s ", STR(name.toString()));
         }
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
         return;
     }
 
@@ -5585,15 +5533,15 @@ S9sRpcReply::printSubnets()
     
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         cloudFormat.printHeader("CLD");
         regionFormat.printHeader("REGION");
         hostNameFormat.printHeader("SERVER");
         cidrFormat.printHeader("CIDR");
         vpcFormat.printHeader("VPC");
         idFormat.printHeader("ID");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
 
     }
     
@@ -5626,13 +5574,13 @@ S9sRpcReply::printSubnets()
             vpcFormat.printf(vpcId);
             idFormat.printf(id);
 
-            ::printf("\n");
+            S9sOutput::printf("\n");
         }
     }
     
     if (!options->isBatchRequested())
     {
-        ::printf("Total %s%d%s subnet(s) in %s%d%s region(s).\n",
+        S9sOutput::printf("Total %s%d%s subnet(s) in %s%d%s region(s).\n",
                 numberColorBegin(), nSubnetsFound, numberColorEnd(),
                 numberColorBegin(), (int)regions.size(), numberColorEnd()
                 );
@@ -5704,12 +5652,12 @@ S9sRpcReply::printRegions()
     
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         hasCredentialsFormat.printHeader("CRED");
         providerFormat.printHeader("CLOUD");
         hostNameFormat.printHeader("SERVER");
         nameFormat.printHeader("REGION");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
     
     /*
@@ -5760,13 +5708,13 @@ S9sRpcReply::printRegions()
             hostNameFormat.printf(hostName);
             nameFormat.printf(name);
 
-            ::printf("\n");
+            S9sOutput::printf("\n");
         }
     }
     
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%d%s regions in %s%zu%s clouds.\n", 
+        S9sOutput::printf("Total: %s%d%s regions in %s%zu%s clouds.\n", 
                 numberColorBegin(), nRegions, numberColorEnd(),
                 numberColorBegin(), cloudMap.size(), numberColorEnd());
     }
@@ -5815,13 +5763,13 @@ S9sRpcReply::printSheetsBrief()
         S9sString      name     = theMap["name"].toString();
 
         if (hasSpace)
-            ::printf("\"%s\" ", STR(name));
+            S9sOutput::printf("\"%s\" ", STR(name));
         else
-            ::printf("%s ", STR(name));
+            S9sOutput::printf("%s ", STR(name));
     }
 
     if (nLines > 0)
-        ::printf("\n");
+        S9sOutput::printf("\n");
 }
 
 void
@@ -5854,12 +5802,12 @@ S9sRpcReply::printSheetsLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         ownerFormat.printHeader("OWNER");
         groupFormat.printHeader("GROUP");
         nameFormat.printHeader("NAME");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -5870,16 +5818,16 @@ S9sRpcReply::printSheetsLong()
         S9sString      name     = theMap["name"].toString();
 
         idFormat.printf(id);
-        printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         ownerFormat.printf(sheet.ownerName());
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
         
-        printf("%s", groupColorBegin());
+        S9sOutput::printf("%s", groupColorBegin());
         groupFormat.printf(sheet.groupOwnerName());
-        printf("%s", groupColorEnd());
+        S9sOutput::printf("%s", groupColorEnd());
 
         nameFormat.printf(name);
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 }
 
@@ -5897,13 +5845,13 @@ S9sRpcReply::printSheet()
     } else if (options->isLongRequested()) 
     {
         //printImagesLong();
-        printf("%s\n", STR(toString()));
+        S9sOutput::printf("%s\n", STR(toString()));
     } else if (options->isStatRequested())
     {
         printSheetStat();
     } else {
         //printImagesBrief();
-        printf("%s\n", STR(toString()));
+        S9sOutput::printf("%s\n", STR(toString()));
     }
 }
 
@@ -5975,9 +5923,9 @@ S9sRpcReply::printImagesBrief()
     }
     
     for (uint idx = 0; idx < collectedList.size(); ++idx)
-        ::printf("%s ", STR(collectedList[idx]));
+        S9sOutput::printf("%s ", STR(collectedList[idx]));
 
-    ::printf("\n");
+    S9sOutput::printf("\n");
 }
 
 void
@@ -6005,7 +5953,7 @@ S9sRpcReply::printImagesLong()
        
         #if 0
         // Printing the server name in color.
-        ::printf("%s%s%s:", 
+        S9sOutput::printf("%s%s%s:", 
                 server.colorBegin(syntaxHighlight),
                 STR(hostName),
                 server.colorEnd(syntaxHighlight));
@@ -6043,13 +5991,13 @@ S9sRpcReply::printImagesLong()
 
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         cloudFormat.printHeader("CLD");
         regionFormat.printHeader("REGION");
         hostNameFormat.printHeader("SERVER");
         imageFormat.printHeader("IMAGE");
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
 
     }
 
@@ -6092,18 +6040,18 @@ S9sRpcReply::printImagesLong()
             cloudFormat.printf(cloud);
             regionFormat.printf(region);
         
-            ::printf("%s", server.colorBegin(syntaxHighlight));
+            S9sOutput::printf("%s", server.colorBegin(syntaxHighlight));
             hostNameFormat.printf(hostName);
-            ::printf("%s", server.colorEnd(syntaxHighlight));
+            S9sOutput::printf("%s", server.colorEnd(syntaxHighlight));
 
             imageFormat.printf(image);
-            ::printf("\n");
+            S9sOutput::printf("\n");
         }
     }
     
     if (!options->isBatchRequested())
     {
-        ::printf("Total %s%d%s image(s).\n",
+        S9sOutput::printf("Total %s%d%s image(s).\n",
                 numberColorBegin(), nImages, numberColorEnd());
     }
 }
@@ -6225,8 +6173,8 @@ S9sRpcReply::printControllersLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        ::printf("%s", headerColorBegin());
-        ::printf("S ");
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("S ");
         versionFormat.printHeader("VERSION");
         ownerFormat.printHeader("OWNER");
         groupFormat.printHeader("GROUP");
@@ -6234,8 +6182,8 @@ S9sRpcReply::printControllersLong()
         ipFormat.printHeader("IP");
         portFormat.printHeader("PORT");
 
-        printf("COMMENT");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("COMMENT");
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -6264,36 +6212,36 @@ S9sRpcReply::printControllersLong()
         
         // Printing.
         if (status != "CmonHostOnline")
-            ::printf("- ");
+            S9sOutput::printf("- ");
         else if (role == "leader")
-            ::printf("l ");
+            S9sOutput::printf("l ");
         else if (role == "follower")
-            ::printf("f ");
+            S9sOutput::printf("f ");
         else 
-            ::printf("? ");
+            S9sOutput::printf("? ");
 
         versionFormat.printf(version);
         
-        printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         ownerFormat.printf(owner);
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
         
-        printf("%s", groupColorBegin(group));
+        S9sOutput::printf("%s", groupColorBegin(group));
         groupFormat.printf(group);
-        printf("%s", groupColorEnd());
+        S9sOutput::printf("%s", groupColorEnd());
 
         hostNameFormat.printf(hostName);
         ipFormat.printf(ip);
 
         portFormat.printf(port);
 
-        printf("%s", STR(message));
+        S9sOutput::printf("%s", STR(message));
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     if (!options->isBatchRequested())
-        printf("Total: %d controller(s)\n", total);
+        S9sOutput::printf("Total: %d controller(s)\n", total);
 }
 
 /**
@@ -6323,7 +6271,7 @@ S9sRpcReply::printControllersBrief()
         if (!options->isStringMatchExtraArguments(hostName))
             continue;
 
-        printf("%s%s%s\n", hostColorBegin, STR(hostName), hostColorEnd);
+        S9sOutput::printf("%s%s%s\n", hostColorBegin, STR(hostName), hostColorEnd);
     }
 }
 
@@ -6394,14 +6342,14 @@ S9sRpcReply::printUpgradesLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        ::printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         hostNameFormat.printHeader("HOSTNAME");
         nameFormat.printHeader("NAME");
         hostClassNameFormat.printHeader("HOST CLASS NAME");
         installedVersionFormat.printHeader("INSTALLED VERSION");
         availableVersionFormat.printHeader("AVAILABLE VERSION");
         lastUpdatedFormat.printHeader("LAST UPDATED");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -6430,11 +6378,11 @@ S9sRpcReply::printUpgradesLong()
         availableVersionFormat.printf(availableVersion);
         lastUpdatedFormat.printf(lastUpdated);
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     if (!options->isBatchRequested())
-        printf("Total: %d package(s)\n", total);
+        S9sOutput::printf("Total: %d package(s)\n", total);
 }
 
 /**
@@ -6466,7 +6414,7 @@ S9sRpcReply::printUpgradesBrief()
             S9sVariantMap theMap  = theList[idx].toVariantMap();
             S9sPkgInfo    pkgInfo = theMap;
 
-            printf("%s", STR(pkgInfo.toString(syntaxHighlight, formatString)));
+            S9sOutput::printf("%s", STR(pkgInfo.toString(syntaxHighlight, formatString)));
         }
 
         return;
@@ -6494,7 +6442,7 @@ S9sRpcReply::printUpgradesBrief()
             continue;
 
         //printf("%s%s%s\n", hostColorBegin, STR(hostName), hostColorEnd);
-        printf("%s%s%s\n", hostColorBegin, STR(pkgName), hostColorEnd);
+        S9sOutput::printf("%s%s%s\n", hostColorBegin, STR(pkgName), hostColorEnd);
     }
 }
 
@@ -6577,7 +6525,7 @@ S9sRpcReply::printServersLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         protocolFormat.printHeader("CLD");
         versionFormat.printHeader("VERSION");
         nContainersFormat.printHeader("#C");
@@ -6585,8 +6533,8 @@ S9sRpcReply::printServersLong()
         groupFormat.printHeader("GROUP");
         hostNameFormat.printHeader("NAME");
         ipFormat.printHeader("IP");
-        printf("COMMENT");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("COMMENT");
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
 
     for (uint idx = 0; idx < theList.size(); ++idx)
@@ -6620,24 +6568,24 @@ S9sRpcReply::printServersLong()
         versionFormat.printf(version);
         nContainersFormat.printf(nContainers);
         
-        printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         ownerFormat.printf(owner);
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
         
-        printf("%s", groupColorBegin(group));
+        S9sOutput::printf("%s", groupColorBegin(group));
         groupFormat.printf(group);
-        printf("%s", groupColorEnd());
+        S9sOutput::printf("%s", groupColorEnd());
 
         hostNameFormat.printf(hostName);
         ipFormat.printf(ip);
 
-        printf("%s", STR(message));
+        S9sOutput::printf("%s", STR(message));
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     if (!options->isBatchRequested())
-        printf("Total: %d server(s)\n", total);
+        S9sOutput::printf("Total: %d server(s)\n", total);
 }
 
 /**
@@ -6667,7 +6615,7 @@ S9sRpcReply::printServersBrief()
         if (!options->isStringMatchExtraArguments(hostName))
             continue;
 
-        printf("%s%s%s\n", hostColorBegin, STR(hostName), hostColorEnd);
+        S9sOutput::printf("%s%s%s\n", hostColorBegin, STR(hostName), hostColorEnd);
     }
 }
 
@@ -6793,12 +6741,12 @@ S9sRpcReply::printContainersLong()
             if (!vpcId.empty() && vpcId != container.subnetVpcId())
                 continue;
 
-            printf("%s", 
+            S9sOutput::printf("%s", 
                     STR(container.toString(syntaxHighlight, formatString)));
         }
     
         if (!options->isBatchRequested())
-            printf("Total: %d\n", total); 
+            S9sOutput::printf("Total: %d\n", total); 
 
         return;
     }
@@ -6847,17 +6795,17 @@ S9sRpcReply::printContainersLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
-        printf("S ");
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("S ");
         typeFormat.printHeader("CLD");
         templateFormat.printHeader("TEMPLATE");
         userFormat.printHeader("OWNER");
         groupFormat.printHeader("GROUP");
         ipFormat.printHeader("IP ADDRESS");
         parentFormat.printHeader("SERVER");
-        ::printf("NAME");
+        S9sOutput::printf("NAME");
 
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("%s\n", headerColorEnd());
     }
 
     nColumns  = 0;
@@ -6915,36 +6863,36 @@ S9sRpcReply::printContainersLong()
             }  
         }
        
-        printf("%c ", container.stateAsChar());
+        S9sOutput::printf("%c ", container.stateAsChar());
         
         typeFormat.printf(type);
         templateFormat.printf(templateName);
 
-        printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         userFormat.printf(user);
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
         
-        printf("%s", groupColorBegin(group));
+        S9sOutput::printf("%s", groupColorBegin(group));
         groupFormat.printf(group);
-        printf("%s", groupColorEnd());
+        S9sOutput::printf("%s", groupColorEnd());
 
         ipFormat.printf(ip);
 
-        printf("%s", serverColorBegin());
+        S9sOutput::printf("%s", serverColorBegin());
         parentFormat.printf(parent);
-        printf("%s", serverColorEnd());
+        S9sOutput::printf("%s", serverColorEnd());
 
-        ::printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 containerColorBegin(container.stateAsChar()), 
                 STR(alias),
                 containerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%d%s containers, %s%d%s running.\n", 
+        S9sOutput::printf("Total: %s%d%s containers, %s%d%s running.\n", 
                 numberColorBegin(), total, numberColorEnd(),
                 numberColorBegin(), totalRunning, numberColorEnd());
     }
@@ -6990,7 +6938,7 @@ S9sRpcReply::printContainersBrief()
             if (!vpcId.empty() && vpcId != container.subnetVpcId())
                 continue;
 
-            ::printf("%s", 
+            S9sOutput::printf("%s", 
                     STR(container.toString(syntaxHighlight, formatString)));
         }
 
@@ -7018,7 +6966,7 @@ S9sRpcReply::printContainersBrief()
         if (!cloudName.empty() && container.provider() != cloudName)
             continue;
 
-        ::printf("%s%s%s ", 
+        S9sOutput::printf("%s%s%s ", 
                 containerColorBegin(container.stateAsChar()), 
                 STR(alias),
                 containerColorEnd());
@@ -7027,7 +6975,7 @@ S9sRpcReply::printContainersBrief()
     }
     
     if (nPrinted > 0)
-        printf("\n");
+        S9sOutput::printf("\n");
 }
 
 /**
@@ -7087,7 +7035,7 @@ S9sRpcReply::printObjectTreeBrief(
     if (options->fullPathRequested())
         name = node.fullPath();
 
-    printf("%s", STR(indentString));
+    S9sOutput::printf("%s", STR(indentString));
 
     if (recursionLevel)
     {
@@ -7099,63 +7047,63 @@ S9sRpcReply::printObjectTreeBrief(
 
     if (node.isFolder())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 m_formatter.folderColorBegin(), 
                 STR(name), 
                 m_formatter.folderColorEnd());
     } else if (node.isFile())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 fileColorBegin(name), 
                 STR(name), fileColorEnd());
     } else if (node.isContainer())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 containerColorBegin(), STR(name), containerColorEnd());
     } else if (node.isCluster())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 clusterColorBegin(), STR(name), clusterColorEnd());
     } else if (node.isNode())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 ipColorBegin(), STR(name), ipColorEnd());
     } else if (node.isServer())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 serverColorBegin(), STR(name), serverColorEnd());
     } else if (node.isUser())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 userColorBegin(), STR(name), userColorEnd());
     } else if (node.isGroup())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 groupColorBegin(), STR(name), groupColorEnd());
     } else if (node.isDatabase())
     {
-        printf("%s%s%s%s", 
+        S9sOutput::printf("%s%s%s%s", 
                 STR(indent), 
                 databaseColorBegin(), STR(name), databaseColorEnd());
     } else {
-        printf("%s%s", STR(indent), STR(name));
+        S9sOutput::printf("%s%s", STR(indent), STR(name));
     }
 
     if (options->isLongRequested())
     {
         if (!node.spec().empty())
-            printf(" (%s)", STR(node.spec()));
+            S9sOutput::printf(" (%s)", STR(node.spec()));
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
     for (uint idx = 0; idx < childNodes.size(); ++idx)
     {
@@ -7268,85 +7216,85 @@ S9sRpcReply::printObjectListLong(
     /*
      * The type and then the acl string.
      */
-    ::printf("%c", node.typeAsChar());
-    ::printf("%s", STR(aclStringToUiString(node.acl())));
-    ::printf(" ");
+    S9sOutput::printf("%c", node.typeAsChar());
+    S9sOutput::printf("%s", STR(aclStringToUiString(node.acl())));
+    S9sOutput::printf(" ");
 
     m_sizeFormat.printf(node.sizeString());
 
     /*
      * The owner and the group owner.
      */
-    ::printf("%s", userColorBegin());
+    S9sOutput::printf("%s", userColorBegin());
     m_ownerFormat.printf(node.ownerUserName());
-    ::printf("%s", userColorEnd());
+    S9sOutput::printf("%s", userColorEnd());
 
-    ::printf("%s", groupColorBegin(node.ownerGroupName()));
+    S9sOutput::printf("%s", groupColorBegin(node.ownerGroupName()));
     m_groupFormat.printf(node.ownerGroupName());
-    ::printf("%s", groupColorEnd());
+    S9sOutput::printf("%s", groupColorEnd());
 
     /*
      * The name.
      */
     if (node.type() == "folder")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 m_formatter.folderColorBegin(), 
                 STR(name), 
                 m_formatter.folderColorEnd());
     } else if (node.type() == "file")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 fileColorBegin(name), 
                 STR(name), 
                 fileColorEnd());
     } else if (node.type() == "cluster")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 clusterColorBegin(), 
                 STR(name), 
                 clusterColorEnd());
     } else if (node.type() == "node")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 ipColorBegin(), 
                 STR(name), 
                 ipColorEnd());
     } else if (node.type() == "server")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 serverColorBegin(), 
                 STR(name), 
                 serverColorEnd());
     } else if (node.type() == "user")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 userColorBegin(), 
                 STR(name), 
                 userColorEnd());
     } else if (node.type() == "group")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 groupColorBegin(), 
                 STR(name), 
                 groupColorEnd());
     } else if (node.type() == "container")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 containerColorBegin(), 
                 STR(name), 
                 containerColorEnd());
     } else if (node.type() == "database")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 databaseColorBegin(),
                 STR(name), 
                 databaseColorEnd());
     } else {
-        printf("%s", STR(name));
+        S9sOutput::printf("%s", STR(name));
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
 recursive_print:
 
@@ -7420,63 +7368,63 @@ S9sRpcReply::printObjectListBrief(
      */
     if (type == "Folder")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 m_formatter.folderColorBegin(), 
                 STR(name), 
                 m_formatter.folderColorEnd());
     } else if (type == "File")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 fileColorBegin(name), 
                 STR(node.name()), 
                 fileColorEnd());
     } else if (type == "Cluster")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 clusterColorBegin(), 
                 STR(name), 
                 clusterColorEnd());
     } else if (type == "Node")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 ipColorBegin(), 
                 STR(name), 
                 ipColorEnd());
     } else if (type == "Server")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 serverColorBegin(), 
                 STR(name), 
                 serverColorEnd());
     } else if (type == "User")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 userColorBegin(), 
                 STR(name), 
                 userColorEnd());
     } else if (type == "Group")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 groupColorBegin(), 
                 STR(name), 
                 groupColorEnd());
     } else if (type == "Container")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 containerColorBegin(), 
                 STR(name), 
                 containerColorEnd());
     } else if (type == "Database")
     {
-        printf("%s%s%s", 
+        S9sOutput::printf("%s%s%s", 
                 databaseColorBegin(),
                 STR(name), 
                 databaseColorEnd());
     } else {
-        printf("%s", STR(name));
+        S9sOutput::printf("%s", STR(name));
     }
 
-    printf("\n");
+    S9sOutput::printf("\n");
 
 recursive_print:
     {
@@ -7581,13 +7529,13 @@ S9sRpcReply::printObjectListLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
-        printf("MODE        ");
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("MODE        ");
         m_sizeFormat.printHeader("SIZE");
         m_ownerFormat.printHeader("OWNER");
         m_groupFormat.printHeader("GROUP");
-        printf("NAME");
-        printf("%s\n", headerColorEnd());
+        S9sOutput::printf("NAME");
+        S9sOutput::printf("%s\n", headerColorEnd());
 
     }
 
@@ -7595,7 +7543,7 @@ S9sRpcReply::printObjectListLong()
         
     if (!options->isBatchRequested())
     {
-        printf("Total: %d object(s) in %d folder(s).\n", 
+        S9sOutput::printf("Total: %d object(s) in %d folder(s).\n", 
                 m_numberOfObjects,
                 m_numberOfFolders);
     }
@@ -7641,14 +7589,14 @@ S9sRpcReply::printScriptBacktrace()
 
     if (!backtrace.empty())
     {
-        printf("\nBacktrace:\n");
+        S9sOutput::printf("\nBacktrace:\n");
     }
 
     for (uint idx = 0; idx < backtrace.size(); ++idx)
     {
         S9sString message = backtrace[idx].toString();
 
-        printf("  %s\n", STR(message));
+        S9sOutput::printf("  %s\n", STR(message));
     }
 }
 
@@ -7667,9 +7615,9 @@ S9sRpcReply::printScriptOutputBrief()
 
         if (syntaxHighlight)
         {
-            printf("%s\n", STR(message.termColorString()));
+            S9sOutput::printf("%s\n", STR(message.termColorString()));
         } else {
-            printf("%s\n", STR(message.toString()));
+            S9sOutput::printf("%s\n", STR(message.toString()));
         }
     }
 
@@ -7699,7 +7647,7 @@ S9sRpcReply::printReport()
 
         content.replace("001b", "\033");
         content = S9sString::html2ansi(content);
-        ::printf("%s", STR(content));
+        S9sOutput::printf("%s", STR(content));
     }
 }
 
@@ -7715,12 +7663,12 @@ compareHostMaps(
         const S9sVariant &a,
         const S9sVariant &b)
 {
-    S9sVariantMap aMap       = a.toVariantMap();
-    S9sVariantMap bMap       = b.toVariantMap();
-    int           clusterId1 = aMap["clusterid"].toInt();
-    int           clusterId2 = bMap["clusterid"].toInt();
-    S9sString     hostName1  = aMap["hostname"].toString();
-    S9sString     hostName2  = bMap["hostname"].toString();
+    const S9sVariantMap &aMap = a.toVariantMap();
+    const S9sVariantMap &bMap = b.toVariantMap();
+    int           clusterId1 = aMap.value("clusterid").toInt();
+    int           clusterId2 = bMap.value("clusterid").toInt();
+    S9sString     hostName1  = aMap.value("hostname").toString();
+    S9sString     hostName2  = bMap.value("hostname").toString();
 
     if (clusterId1 != clusterId2)
         return clusterId1 < clusterId2;
@@ -7901,7 +7849,7 @@ S9sRpcReply::printGraph()
             sumWidth += separatorWidth;
         } else {
             if (nPrinted > 0)
-                printf("\n\n");
+                S9sOutput::printf("\n\n");
 
             S9sGraph::printRow(selectedGraphs, columnSeparator);
             nPrinted += selectedGraphs.size();
@@ -7917,14 +7865,14 @@ S9sRpcReply::printGraph()
     if (!selectedGraphs.empty())
     {
         if (nPrinted > 0)
-            printf("\n\n");
+            S9sOutput::printf("\n\n");
 
         S9sGraph::printRow(selectedGraphs, columnSeparator);
         nPrinted += selectedGraphs.size();
     }
 
     if (nPrinted > 0)
-        printf("\n");
+        S9sOutput::printf("\n");
 
     /*
      * Destroying the graph objects.
@@ -7947,19 +7895,18 @@ S9sRpcReply::printNodesStat()
 
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  clusterMap  = theList[idx].toVariantMap();
-        S9sCluster     cluster     = clusterMap;
-        S9sVariantList hosts       = clusterMap["hosts"].toVariantList();
+        S9sClusterView        clusterView(theList[idx]);
+        const S9sVariantList &hosts = clusterView.hosts();
+        S9sCluster            cluster = clusterView.toCluster();
 
         for (uint idx2 = 0; idx2 < hosts.size(); ++idx2)
         {
-            S9sVariantMap hostMap   = hosts[idx2].toVariantMap();
-            S9sNode       node      = hostMap;
+            S9sNodeView hostView(hosts[idx2]);
            
-            if (!options->isStringMatchExtraArguments(node.name()))
+            if (!options->isStringMatchExtraArguments(hostView.name()))
                 continue;
             
-            m_formatter.printNodeStat(cluster, node);
+            m_formatter.printNodeStat(cluster, hostView.toNode());
         }
     }
 }
@@ -8028,14 +7975,9 @@ S9sRpcReply::printNodeListLong()
     S9sVariantList  theList = clusters();
     S9sString       formatString = options->longNodeFormat();
     S9sVariantList  hostList;
-    S9sFormat       cidFormat;
-    S9sFormat       hostNameFormat;
-    S9sFormat       versionFormat;
-    S9sFormat       clusterNameFormat;
-    S9sFormat       portFormat;
+    S9sTable        table;
     int             total = 0;
     int             terminalWidth = options->terminalWidth();
-    int             nColumns;
 
     if (options->hasNodeFormat())
         formatString = options->nodeFormat();
@@ -8047,80 +7989,85 @@ S9sRpcReply::printNodeListLong()
     {
         for (uint idx = 0; idx < theList.size(); ++idx)
         {
-            S9sVariantMap  theMap      = theList[idx].toVariantMap();
-            S9sVariantList hosts       = theMap["hosts"].toVariantList();
-            S9sString      clusterName = theMap["cluster_name"].toString();
+            S9sClusterView        clusterView(theList[idx]);
+            const S9sVariantList &hosts = clusterView.hosts();
+            S9sCluster            theCluster;
+            bool                  clusterCopied = false;
 
             total += hosts.size();
    
-            if (!clusterNameFilter.empty() && clusterNameFilter != clusterName)
+            if (!clusterNameFilter.empty() && 
+                    clusterNameFilter != clusterView.name())
+            {
                 continue;
+            }
 
             for (uint idx2 = 0; idx2 < hosts.size(); ++idx2)
             {
-                S9sVariantMap hostMap   = hosts[idx2].toVariantMap();
-                S9sNode       node      = hostMap;
-                int           clusterId = node.clusterId();
-                S9sCluster    cluster   = clusterMap(clusterId);
-                S9sString     hostName  = node.name();
+                S9sNodeView   hostView(hosts[idx2]);
+                S9sNode       node;
 
-                if (!properties.isSubSet(hostMap))
+                if (!properties.isSubSet(hostView.toVariantMap()))
                     continue;
 
-                if (!options->isStringMatchExtraArguments(hostName))
+                if (!options->isStringMatchExtraArguments(hostView.name()))
                     continue;
 
-                node.setCluster(cluster);
+                // The hosts are listed inside their own clusters, there is no
+                // need to look up the cluster for every host. The cluster is
+                // copied only if a host of it is printed.
+                node = hostView.toNode();
+                if (hostView.clusterId() == clusterView.clusterId())
+                {
+                    if (!clusterCopied)
+                    {
+                        theCluster    = clusterView.toCluster();
+                        clusterCopied = true;
+                    }
+
+                    node.setCluster(theCluster);
+                } else {
+                    node.setCluster(clusterMap(hostView.clusterId()));
+                }
 
-                printf("%s", STR(node.toString(syntaxHighlight, formatString)));
+                S9sOutput::printf("%s", STR(node.toString(syntaxHighlight, formatString)));
             }
         }
     
         if (!options->isBatchRequested())
-            printf("Total: %d\n", total); 
+            S9sOutput::printf("Total: %d\n", total); 
 
         return;
     }
 
     /*
-     * First run-through: collecting some information.
+     * Collecting the hosts.
      */
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap      = theList[idx].toVariantMap();
-        S9sVariantList hosts       = theMap["hosts"].toVariantList();
-        S9sString      clusterName = theMap["cluster_name"].toString();
+        const S9sVariantMap  &theMap = theList[idx].toVariantMap();
+        const S9sVariantList &hosts  = 
+            theMap.value("hosts").toVariantList();
+        S9sString      clusterName = 
+            theMap.value("cluster_name").toString();
 
         total += hosts.size();
 
         if (!clusterNameFilter.empty() && clusterNameFilter != clusterName)
             continue;
 
-        clusterNameFormat.widen(clusterName);
-
         for (uint idx2 = 0; idx2 < hosts.size(); ++idx2)
         {
-            S9sVariantMap hostMap   = hosts[idx2].toVariantMap();
-            S9sNode       node      = hostMap;
-            S9sString     hostName  = node.name();
-            S9sString     version   = node.version();
-            int           port      = hostMap["port"].toInt(-1);
-            int           clusterId = hostMap["clusterid"].toInt();
+            S9sNodeView   hostView(hosts[idx2]);
+            S9sVariantMap hostMap;
 
-            if (!properties.isSubSet(hostMap))
+            if (!properties.isSubSet(hostView.toVariantMap()))
                 continue;
-
-            if (!options->isStringMatchExtraArguments(hostName))
-                continue;
-
-            if (version.empty())
-                version = "-";
             
-            hostNameFormat.widen(hostName);
-            cidFormat.widen(clusterId);
-            versionFormat.widen(version);
-            portFormat.widen(port);
+            if (!options->isStringMatchExtraArguments(hostView.name()))
+                continue;
 
+            hostMap = hostView.toVariantMap();
             hostMap["cluster_name"] = clusterName;
             hostList << hostMap;
         }
@@ -8132,43 +8079,32 @@ S9sRpcReply::printNodeListLong()
     sort(hostList.begin(), hostList.end(), compareHostMaps);
     
     /*
-     * Printing the header.
-     */
-    if (!options->isNoHeaderRequested())
-    {
-        printf("%s", headerColorBegin());
-        printf("STAT ");
-        versionFormat.printHeader("VERSION");
-        cidFormat.printHeader("CID");
-        clusterNameFormat.printHeader("CLUSTER");
-        hostNameFormat.printHeader("HOST");
-        portFormat.printHeader("PORT");
-        printf("COMMENT");
-        printf("%s\n", headerColorEnd());
-    }
-        
-    /*
-     * Second run: doing the actual printing.
+     * Filling the table.
      */
+    table.addColumn("STAT");
+    table.addColumn("VERSION");
+    table.addColumn("CID");
+    table.addColumn("CLUSTER");
+    table.addColumn("HOST");
+    table.addColumn("PORT");
+    table.addColumn("COMMENT");
+
     for (uint idx2 = 0; idx2 < hostList.size(); ++idx2)
     {
-        S9sVariantMap hostMap   = hostList[idx2].toVariantMap();
+        const S9sVariantMap &hostMap = hostList[idx2].toVariantMap();
         S9sNode       node      = hostMap;
         S9sString     hostName  = node.name();
         int           clusterId = node.clusterId();
         S9sString     status    = node.hostStatus();
-        S9sString     className = hostMap["class_name"].toString();
-        //S9sString     nodeType  = hostMap["nodetype"].toString();
         S9sString     message   = node.message();
         S9sString     version   = node.version();
-        S9sString     clusterName = hostMap["cluster_name"].toString();
-        bool maintenance = hostMap["maintenance_mode_active"].toBoolean();
-        int           port      = hostMap["port"].toInt(-1);
+        S9sString     clusterName = 
+            hostMap.value("cluster_name").toString();
+        bool maintenance = 
+            hostMap.value("maintenance_mode_active").toBoolean();
+        int           port = hostMap.value("port").toInt(-1);
+        S9sString     flags;
         
-        // Filtering...
-        if (!properties.isSubSet(hostMap))
-            continue;
-
         if (!options->isStringMatchExtraArguments(hostName))
             continue;
 
@@ -8178,62 +8114,46 @@ S9sRpcReply::printNodeListLong()
         if (version.empty())
             version = "-";
 
+        flags.sprintf("%c%c%c%c", 
+                node.nodeTypeFlag(), node.stateAsChar(), node.roleFlag(),
+                maintenance ? 'M' : '-');
+
+        table.addRow();
+        table.addCell(flags);
+        table.addCell(version);
+        table.addCell(clusterId);
+        table.addCell(clusterName, clusterColorBegin(), clusterColorEnd());
+
         // FIXME: I am not sure this is actually user friendly. We use the state
         // color for name color.
         if (syntaxHighlight)
         {
-            hostNameFormat.setColor(
+            table.addCell(
+                    hostName, 
                     formatter.hostStateColorBegin(status),
                     formatter.hostStateColorEnd());
+        } else {
+            table.addCell(hostName);
         }
 
-        // Calculating how much space we have for the message column.
-        nColumns  = 3 + 1 + 1;
-        nColumns += cidFormat.realWidth();
-        nColumns += versionFormat.realWidth();
-        nColumns += clusterNameFormat.realWidth();
-        nColumns += hostNameFormat.realWidth();
-        nColumns += portFormat.realWidth();
-
-        if (nColumns < terminalWidth)
-        {
-            int remaining = terminalWidth - nColumns;
-            
-            if (remaining < (int) message.length())
-            {
-                message.resize(remaining - 1);
-                message += "…";
-            }
-        }
-
-        /*
-         * Printing.
-         */
-        printf("%c", node.nodeTypeFlag());
-        printf("%c", node.stateAsChar());
-        printf("%c", node.roleFlag());
-        printf("%c ", maintenance ? 'M' : '-');
-
-        versionFormat.printf(version);
-        cidFormat.printf(clusterId);
-
-        printf("%s", clusterColorBegin());
-        clusterNameFormat.printf(clusterName);
-        printf("%s", clusterColorEnd());
-
-        hostNameFormat.printf(hostName);
-
         if (port >= 0)
-            portFormat.printf(port);
+            table.addCell(port);
         else
-            portFormat.printf("-");
+            table.addCell("-");
 
-
-        printf("%s\n", STR(message));
+        table.addCell(message);
     }
 
+    /*
+     * Printing the table, the comment is truncated to the terminal width.
+     */
+    table.setHeaderVisible(!options->isNoHeaderRequested());
+    table.setHeaderColor(headerColorBegin(), headerColorEnd());
+    table.setMaxWidth(terminalWidth);
+    table.print();
+
     if (!options->isBatchRequested())
-        printf("Total: %d\n", total); 
+        S9sOutput::printf("Total: %d\n", total); 
 }
 
 /**
@@ -8265,8 +8185,13 @@ S9sRpcReply::printJobListBrief()
     //
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap = theList[idx].toVariantMap();
-        S9sJob         job    = theList[idx].toVariantMap();
+        S9sJobView     jobView(theList[idx]);
+
+        // Filtering before copying the job.
+        if (options->hasJobId() && options->jobId() != jobView.jobId())
+            continue;
+
+        S9sJob         job    = jobView.toJob();
         int            jobId  = job.jobId();
         int            cid    = job.clusterId();
         S9sString      user   = job.userName();
@@ -8274,10 +8199,6 @@ S9sRpcReply::printJobListBrief()
         S9sString      status = job.status();
         S9sDateTime    timeStamp;
         S9sString      timeStampString;
-        
-        // Filtering.
-        if (options->hasJobId() && options->jobId() != jobId)
-            continue;
 
         if (group.empty())
             group = "-";
@@ -8315,7 +8236,7 @@ S9sRpcReply::printJobListBrief()
     //
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         cidFormat.printHeader("CID");
         stateFormat.printHeader("STATE");
@@ -8323,11 +8244,11 @@ S9sRpcReply::printJobListBrief()
         groupFormat.printHeader("GROUP");
         dateFormat.printHeader("CREATED");
         percentFormat.printHeader("RDY");
-        printf("TITLE");
+        S9sOutput::printf("TITLE");
 
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     //
@@ -8335,9 +8256,14 @@ S9sRpcReply::printJobListBrief()
     //
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap = theList[idx].toVariantMap();
-        S9sJob         job    = theList[idx].toVariantMap();
-        int            jobId  = job.jobId();
+        S9sJobView     jobView(theList[idx]);
+
+        // Filtering before copying the job.
+        if (options->hasJobId() && options->jobId() != jobView.jobId())
+            continue;
+
+        S9sJob         job    = jobView.toJob();
+        int            jobId  = jobView.jobId();
         int            cid    = job.clusterId();
         S9sString      status = job.status();
         S9sString      title  = job.title();
@@ -8348,10 +8274,6 @@ S9sRpcReply::printJobListBrief()
         S9sString      timeStamp;
         const char    *stateColorStart = "";
         const char    *stateColorEnd   = "";
-        
-        // Filtering.
-        if (options->hasJobId() && options->jobId() != jobId)
-            continue;
 
         // The title.
         if (title.empty())
@@ -8359,7 +8281,7 @@ S9sRpcReply::printJobListBrief()
 
         // The user name or if it is not there the user ID.
         if (user.empty())
-            user.sprintf("%d", theMap["user_id"].toInt());
+            user.sprintf("%d", jobView.property("user_id").toInt());
         
         if (group.empty())
             group = "-";
@@ -8388,7 +8310,7 @@ S9sRpcReply::printJobListBrief()
         }
 
         // The timestamp.
-        created.parse(theMap["created"].toString());
+        created.parse(jobView.property("created").toString());
         timeStamp = options->formatDateTime(created);
 
         if (syntaxHighlight)
@@ -8419,25 +8341,25 @@ S9sRpcReply::printJobListBrief()
         idFormat.printf(jobId);
         cidFormat.printf(cid);
 
-        printf("%s", stateColorStart);
+        S9sOutput::printf("%s", stateColorStart);
         stateFormat.printf(status);
-        printf("%s", stateColorEnd);
+        S9sOutput::printf("%s", stateColorEnd);
         
-        printf("%s", userColorBegin());
+        S9sOutput::printf("%s", userColorBegin());
         userFormat.printf(user);
-        printf("%s", userColorEnd());
+        S9sOutput::printf("%s", userColorEnd());
 
-        printf("%s", groupColorBegin(group));
+        S9sOutput::printf("%s", groupColorBegin(group));
         groupFormat.printf(group);
-        printf("%s", groupColorEnd());
+        S9sOutput::printf("%s", groupColorEnd());
 
         dateFormat.printf(timeStamp);
         percentFormat.printf(percent);
-        printf("%s\n", STR(title));
+        S9sOutput::printf("%s\n", STR(title));
     }
     
     if (!options->isBatchRequested())
-        printf("Total: %d\n", total);
+        S9sOutput::printf("Total: %d\n", total);
 }
 
 /**
@@ -8510,16 +8432,17 @@ S9sRpcReply::printJobListLong()
     //
     for (uint idx = 0; idx < theList.size(); ++idx)
     {
-        S9sVariantMap  theMap     = theList[idx].toVariantMap();
-        S9sJob         job        = theList[idx].toVariantMap();
-        int            jobId      = theMap["job_id"].toInt();
-        S9sString      user       = theMap["user_name"].toString();
-        S9sString      status     = theMap["status"].toString();
+        S9sJobView     jobView(theList[idx]);
+        S9sString      user       = jobView.property("user_name").toString();
+        S9sString      status     = jobView.status();
+        S9sJob         job;
         
         // Filtering.
-        if (options->hasJobId() && options->jobId() != jobId)
+        if (options->hasJobId() && options->jobId() != jobView.jobId())
             continue;
 
+        job = jobView.toJob();
+
         if (!requiredTags.empty())
         {
             if (!job.hasTags(requiredTags))
@@ -8666,15 +8589,15 @@ S9sRpcReply::printJobListLong()
          * A line, then a title and a status text.
          */
         for (int n = 0; n < terminalWidth; ++n)
-            printf("-");
+            S9sOutput::printf("-");
 
-        printf("\n");
+        S9sOutput::printf("\n");
 
-        printf("%s%s%s\n", TERM_BOLD, STR(title), TERM_NORMAL);
-        printf("%s", STR(statusText));
+        S9sOutput::printf("%s%s%s\n", TERM_BOLD, STR(title), TERM_NORMAL);
+        S9sOutput::printf("%s", STR(statusText));
 
         for (int n = statusTextMonochrome.length(); n < terminalWidth - 13; ++n)
-            printf(" ");
+            S9sOutput::printf(" ");
 
         if (theMap.contains("progress_percent"))
         {
@@ -8684,88 +8607,88 @@ S9sRpcReply::printJobListLong()
             bar = "            ";
         }
 
-        printf("%s", STR(bar));
-        printf("\n");
+        S9sOutput::printf("%s", STR(bar));
+        S9sOutput::printf("\n");
 
         for (int n = 11; n < terminalWidth; ++n)
-            printf(" ");
+            S9sOutput::printf(" ");
 
         if (theMap.contains("progress_percent"))
-            printf("%6.2f%% ", percent);
+            S9sOutput::printf("%6.2f%% ", percent);
         else 
-            printf("        ");
+            S9sOutput::printf("        ");
 
 
         //printf(STR(userNameFormat), STR(user));
         //printf("%s ", STR(timeStamp));
         //printf("%s ", STR(percent));
         //printf("%5d ", jobId);
-        printf("\n");
+        S9sOutput::printf("\n");
         
         // The dates...
-        printf("%sCreated   :%s %s%19s%s    ", 
+        S9sOutput::printf("%sCreated   :%s %s%19s%s    ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 XTERM_COLOR_LIGHT_GRAY, STR(created), TERM_NORMAL);
 
-        printf("%sID   :%s %s%-10d%s ", 
+        S9sOutput::printf("%sID   :%s %s%-10d%s ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 XTERM_COLOR_BLUE, jobId, TERM_NORMAL);
 
-        printf("%sStatus :%s %s%s%s ", 
+        S9sOutput::printf("%sStatus :%s %s%s%s ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 stateColorStart, STR(status), stateColorEnd);
 
-        printf("\n");
+        S9sOutput::printf("\n");
 
         // Started : 2017-02-06 11:13:04  User : system   Host   : 127.0.0.1
-        printf("%sStarted   :%s %s%19s%s    ", 
+        S9sOutput::printf("%sStarted   :%s %s%19s%s    ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 XTERM_COLOR_LIGHT_GRAY, STR(started), TERM_NORMAL);
         
-        printf("%sUser :%s %s%-10s%s ", 
+        S9sOutput::printf("%sUser :%s %s%-10s%s ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 userColorBegin(), STR(user), userColorEnd());
 
-        printf("%sHost   :%s %s%s%s ", 
+        S9sOutput::printf("%sHost   :%s %s%s%s ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 XTERM_COLOR_BLUE, STR(hostName), TERM_NORMAL);
         
-        printf("\n");
+        S9sOutput::printf("\n");
 
 
 
-        printf("%sEnded     :%s %s%19s%s    ", 
+        S9sOutput::printf("%sEnded     :%s %s%19s%s    ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 XTERM_COLOR_LIGHT_GRAY, STR(ended), TERM_NORMAL);
         
-        printf("%sGroup:%s %s%-10s%s ", 
+        S9sOutput::printf("%sGroup:%s %s%-10s%s ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 groupColorBegin(group), STR(group), groupColorEnd());
         
-        printf("%sCluster:%s %d ", 
+        S9sOutput::printf("%sCluster:%s %d ", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 clusterId);
         
-        printf("\n");
+        S9sOutput::printf("\n");
         
         if (!scheduled.empty())
         {
-            printf("%sScheduled :%s %s%19s%s\n", 
+            S9sOutput::printf("%sScheduled :%s %s%19s%s\n", 
                     XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                     XTERM_COLOR_LIGHT_GRAY, STR(scheduled), TERM_NORMAL);
         }
         else if (!recurrence.empty())
         {
-            printf("%sRecurrence:%s %s%s%s\n", 
+            S9sOutput::printf("%sRecurrence:%s %s%s%s\n", 
                     XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                     XTERM_COLOR_LIGHT_GRAY, STR(recurrence), TERM_NORMAL);
         }
 
-        printf("%sTags      :%s %s\n", 
+        S9sOutput::printf("%sTags      :%s %s\n", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 STR(job.tags(syntaxHighlight, "-")));
         
-        printf("%sRPC       :%s %s\n", 
+        S9sOutput::printf("%sRPC       :%s %s\n", 
                 XTERM_COLOR_DARK_GRAY, TERM_NORMAL,
                 STR(job.rpcVersion("-")));
 
@@ -8775,12 +8698,12 @@ S9sRpcReply::printJobListLong()
     }
         
     for (int n = 0; n < terminalWidth; ++n)
-        printf("-");
+        S9sOutput::printf("-");
 
-    printf("\n");
+    S9sOutput::printf("\n");
     
     if (!options->isBatchRequested())
-        printf("Total: %d\n", total);
+        S9sOutput::printf("Total: %d\n", total);
 }
 
 /**
@@ -8885,13 +8808,13 @@ S9sRpcReply::printCpuStat()
             numberEnd   = TERM_NORMAL;
         }
 
-        printf("%%cpu%02d-%02d ", hostId, id);
-        printf("%s%5.1f%s us,", numberStart, user, numberEnd);
-        printf("%s%5.1f%s sy,", numberStart, sys, numberEnd);
-        printf("%s%5.1f%s id,", numberStart, idle, numberEnd);
-        printf("%s%5.1f%s wa,", numberStart, wait, numberEnd);
-        printf("%s%5.1f%s st,", numberStart, steal, numberEnd);
-        printf("%s\n", STR(model));
+        S9sOutput::printf("%%cpu%02d-%02d ", hostId, id);
+        S9sOutput::printf("%s%5.1f%s us,", numberStart, user, numberEnd);
+        S9sOutput::printf("%s%5.1f%s sy,", numberStart, sys, numberEnd);
+        S9sOutput::printf("%s%5.1f%s id,", numberStart, idle, numberEnd);
+        S9sOutput::printf("%s%5.1f%s wa,", numberStart, wait, numberEnd);
+        S9sOutput::printf("%s%5.1f%s st,", numberStart, steal, numberEnd);
+        S9sOutput::printf("%s\n", STR(model));
     }
 }
 
@@ -8946,7 +8869,7 @@ S9sRpcReply::printBackupListFormatString(
                         backupIdx, fileIdx, 
                         syntaxHighlight, formatString);
 
-                printf("%s", STR(outString));
+                S9sOutput::printf("%s", STR(outString));
             }        
         }
     }
@@ -8954,7 +8877,7 @@ S9sRpcReply::printBackupListFormatString(
     if (!options->isBatchRequested() && contains("total"))
     {
         int total = operator[]("total").toInt();
-        printf("Total %d\n", total);
+        S9sOutput::printf("Total %d\n", total);
     }
 }
 
@@ -8987,7 +8910,7 @@ S9sRpcReply::printBackupListBrief()
         if (options->hasBackupId() && options->backupId() != backup.id())
             continue;
 
-        printf("%s\n", STR(backup.title()));
+        S9sOutput::printf("%s\n", STR(backup.title()));
     }
 }
 
@@ -8999,118 +8922,39 @@ S9sRpcReply::printBackupListLong()
 {
     S9sOptions     *options = S9sOptions::instance();
     bool            syntaxHighlight = options->useSyntaxHighlight();
-    S9sVariantList  dataList;
-    S9sFormat       sizeFormat;
-    S9sFormat       hostNameFormat;
-    S9sFormat       idFormat;
-    S9sFormat       parentIdFormat;
-    S9sFormat       cidFormat;
-    S9sFormat       verifyFormat;
-    S9sFormat       incrementalFormat;
-    S9sFormat       stateFormat;
-    S9sFormat       createdFormat;
-    S9sFormat       ownerFormat;
-   
+    bool            multiController = contains("controllers");
+    S9sTable        table;
     // One is RPC 1.0, the other is 2.0.
-    if (contains("data"))
-        dataList = operator[]("data").toVariantList();
-    else if (contains("backup_records"))
-        dataList = operator[]("backup_records").toVariantList();
+    const S9sVariantList &dataList = 
+        valueByPath(contains("data") ? "data" : "backup_records").
+        toVariantList();
+
+    if (multiController)
+        table.addColumn("CONTROLLER");
+
+    table.addColumn("ID");
+    table.addColumn("PI", S9sFormat::AlignRight);
+    table.addColumn("CID");
+    table.addColumn("V");
+    table.addColumn("I");
+    table.addColumn("STATE");
+    table.addColumn("OWNER");
+    table.addColumn("HOSTNAME");
+    table.addColumn("CREATED");
+    table.addColumn("SIZE", S9sFormat::AlignRight);
+    table.addColumn("TITLE");
 
     /*
-     * Collecting some information.
+     * Filling the table in one pass.
      */
     for (uint idx = 0; idx < dataList.size(); ++idx)
     {
-        S9sVariantMap  theMap     = dataList[idx].toVariantMap();
-        S9sBackup      backup     = theMap;
-        S9sString      hostName   = backup.backupHost();
-        int            id         = backup.id(); 
+        S9sBackup      backup     = dataList[idx].toVariantMap();
+        int            id         = backup.id();
         int            parentId   = backup.parentId();
-        int            clusterId  = backup.clusterId(); 
-        S9sString      verifyFlag = backup.verificationFlag();
-        S9sString      owner      = backup.configOwner();
-        S9sString      status     = backup.status(); 
-        ulonglong      fullSize   = 0ull;
-        S9sString      sizeString;
-        S9sString      created;
-
-        if (options->hasBackupId() && options->backupId() != id)
-            continue;
-
-        cidFormat.widen(clusterId);
-        stateFormat.widen(status);
-        hostNameFormat.widen(hostName);
-        ownerFormat.widen(owner);
-        verifyFormat.widen(verifyFlag);
-        incrementalFormat.widen("-");
-
-        for (int backupIdx = 0; backupIdx < backup.nBackups(); ++backupIdx)
-        {
-            idFormat.widen(id);
-            parentIdFormat.widen(parentId);
-
-            for (int fileIdx = 0; 
-                    fileIdx < backup.nFiles(backupIdx); ++fileIdx)
-            {
-                ulonglong size = backup.fileSize(backupIdx, fileIdx).toUll();
-                
-                fullSize += size;
-            }
-                
-            sizeString = S9sFormat::toSizeString(fullSize);
-            sizeFormat.widen(sizeString);
-        }
-                
-        created = backup.beginAsString();
-        createdFormat.widen(created);
-    }
-
-    /*
-     * Printing the header.
-     */
-    if (!options->isNoHeaderRequested())
-    {
-        printf("%s", headerColorBegin());
-        idFormat.printHeader("ID");
-        parentIdFormat.printHeader("PI");
-        cidFormat.printHeader("CID");
-        verifyFormat.printHeader("V");
-        incrementalFormat.printHeader("I");
-        stateFormat.printHeader("STATE");
-        ownerFormat.printHeader("OWNER");
-        hostNameFormat.printHeader("HOSTNAME");
-        createdFormat.printHeader("CREATED");
-        sizeFormat.printHeader("SIZE");
-        printf("TITLE");
- 
-        printf("%s", headerColorEnd());
-        printf("\n");
-    }
-    
-    sizeFormat.setRightJustify();
-    parentIdFormat.setRightJustify();
-
-    /*
-     * Second run, we print things here.
-     */
-    for (uint idx = 0; idx < dataList.size(); ++idx)
-    {
-        S9sVariantMap  theMap     = dataList[idx].toVariantMap();
-        S9sBackup      backup     = theMap;
-        S9sString      hostName   = backup.backupHost();
-        int            clusterId  = backup.clusterId();
-        S9sString      verifyFlag = backup.verificationFlag();
         bool           hasInc     = false;
         bool           hasNotInc  = false;
-        S9sString      owner      = backup.configOwner();
-        int            id         = backup.id();
-        int            parentId   = backup.parentId();
-        S9sString      status     = backup.status();
-        S9sString      root       = backup.rootDir();
         ulonglong      fullSize   = 0ull;
-        S9sString      sizeString;
-        S9sString      created;
 
         /*
          * Filtering.
@@ -9118,33 +8962,6 @@ S9sRpcReply::printBackupListLong()
         if (options->hasBackupId() && options->backupId() != id)
             continue;
 
-        /*
-         * Let's keep this for a while...
-         */
-#if 0
-        if (backups.size() == 0u)
-        {
-            S9sString     path          = "-";
-            S9sString     sizeString    = "-";
-            S9sString     createdString = "-";
-                
-            idFormat.printf(id);
-            cidFormat.printf(clusterId);
-
-            printf("%s", backup.statusColorBegin(syntaxHighlight));
-            stateFormat.printf(status);
-            printf("%s", backup.statusColorEnd(syntaxHighlight));
-
-            ownerFormat.printf(owner);
-            hostNameFormat.printf(hostName);
-            createdFormat.printf(createdString);
-            sizeFormat.printf(sizeString);
-            printf("%s", STR(path));
-            printf("\n");
-
-            continue;
-        }
-#endif
         for (int backupIdx = 0; backupIdx < backup.nBackups(); ++backupIdx)
         {
             for (int fileIdx = 0; fileIdx < backup.nFiles(backupIdx); ++fileIdx)
@@ -9163,45 +8980,49 @@ S9sRpcReply::printBackupListLong()
             }
         }
 
-        created = backup.beginAsString();
-        sizeString = S9sFormat::toSizeString(fullSize);
+        table.addRow();
+        if (multiController)
+        {
+            table.addCell(
+                    backup.toVariantMap().value("controller").toString(),
+                    serverColorBegin(), serverColorEnd());
+        }
+
+        table.addCell(id);
 
-        idFormat.printf(id);
         if (parentId > 0)
-            parentIdFormat.printf(parentId);
+            table.addCell(parentId);
         else
-            parentIdFormat.printf("-");
+            table.addCell("-");
 
-        cidFormat.printf(clusterId);
-        verifyFormat.printf(verifyFlag);
+        table.addCell(backup.clusterId());
+        table.addCell(backup.verificationFlag());
         
         if (hasInc && hasNotInc)
-            printf("B ");
+            table.addCell("B");
         else if (hasInc)
-            printf("I ");
+            table.addCell("I");
         else if (hasNotInc)
-            printf("F ");
+            table.addCell("F");
         else 
-            printf("- ");
+            table.addCell("-");
 
-        printf("%s", backup.statusColorBegin(syntaxHighlight));
-        stateFormat.printf(status);
-        printf("%s", backup.statusColorEnd(syntaxHighlight));
+        table.addCell(
+                backup.status(),
+                backup.statusColorBegin(syntaxHighlight),
+                backup.statusColorEnd(syntaxHighlight));
 
-        printf("%s", userColorBegin());
-        ownerFormat.printf(owner);
-        printf("%s", userColorEnd());
-
-        printf("%s", ipColorBegin());
-        hostNameFormat.printf(hostName);
-        printf("%s", ipColorEnd());
-        
-        createdFormat.printf(created);
-        sizeFormat.printf(sizeString);
-        printf("%s", STR(backup.title()));
-        printf("\n");
+        table.addCell(backup.configOwner(), userColorBegin(), userColorEnd());
+        table.addCell(backup.backupHost(), ipColorBegin(), ipColorEnd());
+        table.addCell(backup.beginAsString());
+        table.addCell(S9sFormat::toSizeString(fullSize));
+        table.addCell(backup.title());
     }
 
+    table.setHeaderVisible(!options->isNoHeaderRequested());
+    table.setHeaderColor(headerColorBegin(), headerColorEnd());
+    table.print();
+
     /*
      * Footer.
      */
@@ -9209,7 +9030,7 @@ S9sRpcReply::printBackupListLong()
     {
         int total = operator[]("total").toInt();
 
-        printf("Total %d\n", total);
+        S9sOutput::printf("Total %d\n", total);
     }
 }
 
@@ -9250,7 +9071,7 @@ S9sRpcReply::printBackupListDatabasesBrief()
             if (databaseNames.empty())
                 databaseNames = "-";
 
-            printf("%s\n", STR(databaseNames));
+            S9sOutput::printf("%s\n", STR(databaseNames));
         }
     }
 }
@@ -9347,7 +9168,7 @@ S9sRpcReply::printBackupListDatabasesLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         parentIdFormat.printHeader("PI");
         cidFormat.printHeader("CID");
@@ -9358,10 +9179,10 @@ S9sRpcReply::printBackupListDatabasesLong()
         hostNameFormat.printHeader("HOSTNAME");
         createdFormat.printHeader("CREATED");
         sizeFormat.printHeader("SIZE");
-        printf("DATABASES");
+        S9sOutput::printf("DATABASES");
  
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
     
     sizeFormat.setRightJustify();
@@ -9414,24 +9235,24 @@ S9sRpcReply::printBackupListDatabasesLong()
             verifyFormat.printf(verifyFlag);
             
             // incremental
-            printf("- ");
+            S9sOutput::printf("- ");
 
-            printf("%s", backup.statusColorBegin(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorBegin(syntaxHighlight));
             stateFormat.printf(status);
-            printf("%s", backup.statusColorEnd(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorEnd(syntaxHighlight));
             
-            printf("%s", userColorBegin());
+            S9sOutput::printf("%s", userColorBegin());
             ownerFormat.printf(owner);
-            printf("%s", userColorEnd());
+            S9sOutput::printf("%s", userColorEnd());
 
-            printf("%s", ipColorBegin());
+            S9sOutput::printf("%s", ipColorBegin());
             hostNameFormat.printf(hostName);
-            printf("%s", ipColorEnd());
+            S9sOutput::printf("%s", ipColorEnd());
 
             createdFormat.printf(createdString);
             sizeFormat.printf(sizeString);
-            printf("%s", STR(database));
-            printf("\n");
+            S9sOutput::printf("%s", STR(database));
+            S9sOutput::printf("\n");
 
             continue;
         }
@@ -9469,34 +9290,34 @@ S9sRpcReply::printBackupListDatabasesLong()
             verifyFormat.printf(verifyFlag);
             
             if (hasInc && hasNotInc)
-                printf("B ");
+                S9sOutput::printf("B ");
             else if (hasInc)
-                printf("I ");
+                S9sOutput::printf("I ");
             else if (hasNotInc)
-                printf("F ");
+                S9sOutput::printf("F ");
             else 
-                printf("- ");
+                S9sOutput::printf("- ");
 
             databaseNames = backup.databaseNamesAsString(backupIdx);
             if (databaseNames.empty())
                 databaseNames = "-";
 
-            printf("%s", backup.statusColorBegin(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorBegin(syntaxHighlight));
             stateFormat.printf(status);
-            printf("%s", backup.statusColorEnd(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorEnd(syntaxHighlight));
 
-            printf("%s", userColorBegin());
+            S9sOutput::printf("%s", userColorBegin());
             ownerFormat.printf(owner);
-            printf("%s", userColorEnd());
+            S9sOutput::printf("%s", userColorEnd());
 
-            printf("%s", ipColorBegin());
+            S9sOutput::printf("%s", ipColorBegin());
             hostNameFormat.printf(hostName);
-            printf("%s", ipColorEnd());
+            S9sOutput::printf("%s", ipColorEnd());
 
             createdFormat.printf(created);
             sizeFormat.printf(sizeString);
-            printf("%s", STR(databaseNames));
-            printf("\n");
+            S9sOutput::printf("%s", STR(databaseNames));
+            S9sOutput::printf("\n");
         }
     }
 
@@ -9507,7 +9328,7 @@ S9sRpcReply::printBackupListDatabasesLong()
     {
         int total = operator[]("total").toInt();
 
-        printf("Total %d\n", total);
+        S9sOutput::printf("Total %d\n", total);
     }
 }
 
@@ -9573,7 +9394,7 @@ S9sRpcReply::printBackupListFilesBrief()
                     colorEnd   = "";
                 }
 
-                printf("%s%s%s\n", colorBegin, STR(path), colorEnd);
+                S9sOutput::printf("%s%s%s\n", colorBegin, STR(path), colorEnd);
             }
         }
     }
@@ -9676,7 +9497,7 @@ S9sRpcReply::printBackupListFilesLong()
      */
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         parentIdFormat.printHeader("PI");
         cidFormat.printHeader("CID");
@@ -9687,10 +9508,10 @@ S9sRpcReply::printBackupListFilesLong()
         hostNameFormat.printHeader("HOSTNAME");
         createdFormat.printHeader("CREATED");
         sizeFormat.printHeader("SIZE");
-        printf("FILENAME");
+        S9sOutput::printf("FILENAME");
  
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
     
     sizeFormat.setRightJustify();
@@ -9738,24 +9559,24 @@ S9sRpcReply::printBackupListFilesLong()
             verifyFormat.printf(verifyFlag);
 
             // incremental
-            printf("- ");
+            S9sOutput::printf("- ");
 
-            printf("%s", backup.statusColorBegin(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorBegin(syntaxHighlight));
             stateFormat.printf(status);
-            printf("%s", backup.statusColorEnd(syntaxHighlight));
+            S9sOutput::printf("%s", backup.statusColorEnd(syntaxHighlight));
             
-            printf("%s", userColorBegin());
+            S9sOutput::printf("%s", userColorBegin());
             ownerFormat.printf(owner);
-            printf("%s", userColorEnd());
+            S9sOutput::printf("%s", userColorEnd());
 
-            printf("%s", ipColorBegin());
+            S9sOutput::printf("%s", ipColorBegin());
             hostNameFormat.printf(hostName);
-            printf("%s", ipColorEnd());
+            S9sOutput::printf("%s", ipColorEnd());
 
             createdFormat.printf(createdString);
             sizeFormat.printf(sizeString);
-            printf("%s", STR(path));
-            printf("\n");
+            S9sOutput::printf("%s", STR(path));
+            S9sOutput::printf("\n");
 
             continue;
         }
@@ -9802,26 +9623,26 @@ S9sRpcReply::printBackupListFilesLong()
                 verifyFormat.printf(verifyFlag);
         
                 if (incremental)
-                    printf("I ");
+                    S9sOutput::printf("I ");
                 else
-                    printf("F ");
+                    S9sOutput::printf("F ");
                 
-                printf("%s", backup.statusColorBegin(syntaxHighlight));
+                S9sOutput::printf("%s", backup.statusColorBegin(syntaxHighlight));
                 stateFormat.printf(status);
-                printf("%s", backup.statusColorEnd(syntaxHighlight));
+                S9sOutput::printf("%s", backup.statusColorEnd(syntaxHighlight));
 
-                printf("%s", userColorBegin());
+                S9sOutput::printf("%s", userColorBegin());
                 ownerFormat.printf(owner);
-                printf("%s", userColorEnd());
+                S9sOutput::printf("%s", userColorEnd());
 
-                printf("%s", ipColorBegin());
+                S9sOutput::printf("%s", ipColorBegin());
                 hostNameFormat.printf(hostName);
-                printf("%s", ipColorEnd());
+                S9sOutput::printf("%s", ipColorEnd());
 
                 createdFormat.printf(created);
                 sizeFormat.printf(sizeString);
-                printf("%s%s%s", colorBegin, STR(path), colorEnd);
-                printf("\n");
+                S9sOutput::printf("%s%s%s", colorBegin, STR(path), colorEnd);
+                S9sOutput::printf("\n");
             }
         }
     }
@@ -9833,7 +9654,7 @@ S9sRpcReply::printBackupListFilesLong()
     {
         int total = operator[]("total").toInt();
 
-        printf("Total %d\n", total);
+        S9sOutput::printf("Total %d\n", total);
     }
 }
 
@@ -9853,7 +9674,7 @@ S9sRpcReply::printMaintenanceListBrief()
             S9sVariantMap period = periods[idx1].toVariantMap();
             S9sString     uuid      = period["UUID"].toString();
 
-            printf("%s\n", STR(uuid));
+            S9sOutput::printf("%s\n", STR(uuid));
         }
     }
 }
@@ -9926,19 +9747,19 @@ S9sRpcReply::printMaintenanceListLong()
     
     if (!options->isNoHeaderRequested())
     {
-        printf("%s", headerColorBegin());
-        printf("ST ");
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("ST ");
         uuidFormat.printHeader("UUID");
         ownerFormat.printHeader("OWNER");
         groupOwnerFormat.printHeader("GROUP");
         startFormat.printHeader("START");
         endFormat.printHeader("END");
         nameFormat.printHeader("HOST/CLUSTER");
-        printf("REASON");
+        S9sOutput::printf("REASON");
         
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     /*
@@ -9982,23 +9803,23 @@ S9sRpcReply::printMaintenanceListLong()
             if (!options->fullUuid())
                 uuid = uuid.substr(0, 7);
 
-            printf("%c", isActive ? 'A' : '-');
+            S9sOutput::printf("%c", isActive ? 'A' : '-');
             if (isHostMaintenance)
-                printf("h ");
+                S9sOutput::printf("h ");
             else if (isClusterMaintenance)
-                printf("c ");
+                S9sOutput::printf("c ");
             else 
-                printf("- ");
+                S9sOutput::printf("- ");
                 
-            printf("%s ", STR(uuid));
+            S9sOutput::printf("%s ", STR(uuid));
 
-            printf("%s", userColorBegin());
+            S9sOutput::printf("%s", userColorBegin());
             ownerFormat.printf(userName);
-            printf("%s", userColorEnd());
+            S9sOutput::printf("%s", userColorEnd());
             
-            printf("%s", groupColorBegin(groupName));
+            S9sOutput::printf("%s", groupColorBegin(groupName));
             groupOwnerFormat.printf(groupName);
-            printf("%s", groupColorEnd());
+            S9sOutput::printf("%s", groupColorEnd());
 
             startFormat.printf(startString);
             endFormat.printf(endString);
@@ -10007,18 +9828,18 @@ S9sRpcReply::printMaintenanceListLong()
             {
                 nameFormat.printf(STR(hostName));
             } else {
-                printf("%s", clusterColorBegin());
+                S9sOutput::printf("%s", clusterColorBegin());
                 nameFormat.printf(STR(clusterName));
-                printf("%s", groupColorEnd());
+                S9sOutput::printf("%s", groupColorEnd());
             }
 
-            printf("%s ", STR(reason));
-            printf("\n");
+            S9sOutput::printf("%s ", STR(reason));
+            S9sOutput::printf("\n");
         }
     }
 
     if (!options->isBatchRequested())
-        printf("Total: %d\n", operator[]("total").toInt());
+        S9sOutput::printf("Total: %d\n", operator[]("total").toInt());
 }
 
 void 
@@ -10044,7 +9865,7 @@ S9sRpcReply::printGroupListBrief()
             groupColorEnd   = TERM_NORMAL;
         }
         
-        printf("%s%s%s\n", 
+        S9sOutput::printf("%s%s%s\n", 
                 groupColorBegin, 
                 STR(group.groupName()), 
                 groupColorEnd);
@@ -10089,14 +9910,14 @@ S9sRpcReply::printGroupListLong()
      */
     if (!options->isNoHeaderRequested() && nLines > 0)
     {
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
         idFormat.printHeader("ID");
         ownerFormat.printHeader("OWNER");
         groupOwnerFormat.printHeader("GOWNER");
         nameFormat.printHeader("NAME");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     for (uint idx = 0; idx < groupList.size(); ++idx)
@@ -10123,24 +9944,24 @@ S9sRpcReply::printGroupListLong()
         
         idFormat.printf(groupId);
 
-        printf("%s", colorBegin);
+        S9sOutput::printf("%s", colorBegin);
         ownerFormat.printf(ownerName);
-        printf("%s", colorEnd);
+        S9sOutput::printf("%s", colorEnd);
         
-        printf("%s", groupColorBegin);
+        S9sOutput::printf("%s", groupColorBegin);
         groupOwnerFormat.printf(groupOwner);
-        printf("%s", groupColorEnd);
+        S9sOutput::printf("%s", groupColorEnd);
 
-        printf("%s", groupColorBegin);
+        S9sOutput::printf("%s", groupColorBegin);
         nameFormat.printf(groupName);
-        printf("%s", groupColorEnd);
+        S9sOutput::printf("%s", groupColorEnd);
 
-        ::printf("\n");
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
     {
-        printf("Total: %s%d%s group(s).\n", 
+        S9sOutput::printf("Total: %s%d%s group(s).\n", 
                 numberColorBegin(), 
                 operator[]("total").toInt(),
                 numberColorEnd());
@@ -10285,7 +10106,7 @@ S9sRpcReply::printUserListBrief()
             if (!groupFilter.empty() && !user.isMemberOf(groupFilter))
                 continue;
    
-            printf("%s", STR(user.toString(syntaxHighlight, formatString)));
+            S9sOutput::printf("%s", STR(user.toString(syntaxHighlight, formatString)));
             
         }
 
@@ -10326,7 +10147,7 @@ S9sRpcReply::printUserListBrief()
             colorEnd   = "";
         }
 
-        printf("%s%s%s\n", colorBegin, STR(userName), colorEnd);
+        S9sOutput::printf("%s%s%s\n", colorBegin, STR(userName), colorEnd);
     }
 }
 
@@ -10376,11 +10197,11 @@ S9sRpcReply::printUserListLong()
             if (!groupFilter.empty() && !user.isMemberOf(groupFilter))
                 continue;
    
-            printf("%s", STR(user.toString(syntaxHighlight, formatString)));
+            S9sOutput::printf("%s", STR(user.toString(syntaxHighlight, formatString)));
         }
 
         if (!options->isBatchRequested())
-            printf("Total: %d\n", operator[]("total").toInt());
+            S9sOutput::printf("Total: %d\n", operator[]("total").toInt());
 
         return;
     }
@@ -10431,16 +10252,16 @@ S9sRpcReply::printUserListLong()
         groupNamesFormat.widen("GROUPS");
         emailFormat.widen("EMAIL");
 
-        printf("%s", headerColorBegin());
-        printf("A ");
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf("A ");
         idFormat.printf("ID");
         userNameFormat.printf("UNAME");
         groupNamesFormat.printf("GROUPS");
         emailFormat.printf("EMAIL");
-        printf("REALNAME");
-        printf("%s", headerColorEnd());
+        S9sOutput::printf("REALNAME");
+        S9sOutput::printf("%s", headerColorEnd());
 
-        printf("\n");
+        S9sOutput::printf("\n");
     }
 
     /*
@@ -10489,28 +10310,28 @@ S9sRpcReply::printUserListLong()
         // Printing the fields.
         //
         if (userId == authUserId)
-            printf("A ");
+            S9sOutput::printf("A ");
         else
-            printf("- ");
+            S9sOutput::printf("- ");
         
         idFormat.printf(userId);
 
-        printf("%s", colorBegin);
+        S9sOutput::printf("%s", colorBegin);
         userNameFormat.printf(userName);
-        printf("%s", colorEnd);
+        S9sOutput::printf("%s", colorEnd);
         
-        printf("%s", groupColorBegin);
+        S9sOutput::printf("%s", groupColorBegin);
         groupNamesFormat.printf(groupNames);
-        printf("%s", groupColorEnd);
+        S9sOutput::printf("%s", groupColorEnd);
 
         emailFormat.printf(emailAddress);
 
-        printf("%s", STR(fullName));
-        printf("\n");
+        S9sOutput::printf("%s", STR(fullName));
+        S9sOutput::printf("\n");
     }
     
     if (!options->isBatchRequested())
-        printf("Total: %d\n", operator[]("total").toInt());
+        S9sOutput::printf("Total: %d\n", operator[]("total").toInt());
 }
 
 void
@@ -10586,13 +10407,13 @@ S9sRpcReply::printCpuStatLine1()
     wait  *= 100.0;
     steal *= 100.0;
     
-    printf("%s%d%s hosts, ", numberStart, (int)hostIds.size(), numberEnd);
-    printf("%s%d%s cores,", numberStart, (int)listMap.size(), numberEnd);
-    printf("%s%5.1f%s us,",  numberStart, user, numberEnd);
-    printf("%s%5.1f%s sy,", numberStart, sys, numberEnd);
-    printf("%s%5.1f%s id,",  numberStart, idle, numberEnd);
-    printf("%s%5.1f%s wa,", numberStart, wait, numberEnd);
-    printf("%s%5.1f%s st,", numberStart, steal, numberEnd);
+    S9sOutput::printf("%s%d%s hosts, ", numberStart, (int)hostIds.size(), numberEnd);
+    S9sOutput::printf("%s%d%s cores,", numberStart, (int)listMap.size(), numberEnd);
+    S9sOutput::printf("%s%5.1f%s us,",  numberStart, user, numberEnd);
+    S9sOutput::printf("%s%5.1f%s sy,", numberStart, sys, numberEnd);
+    S9sOutput::printf("%s%5.1f%s id,",  numberStart, idle, numberEnd);
+    S9sOutput::printf("%s%5.1f%s wa,", numberStart, wait, numberEnd);
+    S9sOutput::printf("%s%5.1f%s st,", numberStart, steal, numberEnd);
 }
 
 /**
@@ -10677,12 +10498,12 @@ S9sRpcReply::printMemoryStatLine1()
     sumBuffers /= 1024 * 1024 * 1024.0;
     sumCached  /= 1024 * 1024 * 1024.0;
 
-    printf("GiB Mem : ");
-    printf("%s%.1f%s total, ",   numberStart, sumTotal, numberEnd);
-    printf("%s%.1f%s free, ",    numberStart, sumFree, numberEnd);
-    printf("%s%.1f%s used, ",    numberStart, sumTotal - (sumFree + sumBuffers + sumCached), numberEnd);
-    printf("%s%.1f%s buffers, ", numberStart, sumBuffers, numberEnd);
-    printf("%s%.1f%s cached",    numberStart, sumCached, numberEnd);
+    S9sOutput::printf("GiB Mem : ");
+    S9sOutput::printf("%s%.1f%s total, ",   numberStart, sumTotal, numberEnd);
+    S9sOutput::printf("%s%.1f%s free, ",    numberStart, sumFree, numberEnd);
+    S9sOutput::printf("%s%.1f%s used, ",    numberStart, sumTotal - (sumFree + sumBuffers + sumCached), numberEnd);
+    S9sOutput::printf("%s%.1f%s buffers, ", numberStart, sumBuffers, numberEnd);
+    S9sOutput::printf("%s%.1f%s cached",    numberStart, sumCached, numberEnd);
 }
 
 void
@@ -10732,10 +10553,10 @@ S9sRpcReply::printMemoryStatLine2()
     sumTotal   /= 1024 * 1024 * 1024;
     sumFree    /= 1024 * 1024 * 1024;
 
-    printf("GiB Swap: ");
-    printf("%s%llu%s total, ", numberStart, sumTotal, numberEnd);
-    printf("%s%llu%s used, ",  numberStart, sumTotal - sumFree, numberEnd);
-    printf("%s%llu%s free, ",  numberStart, sumFree, numberEnd);
+    S9sOutput::printf("GiB Swap: ");
+    S9sOutput::printf("%s%llu%s total, ", numberStart, sumTotal, numberEnd);
+    S9sOutput::printf("%s%llu%s used, ",  numberStart, sumTotal - sumFree, numberEnd);
+    S9sOutput::printf("%s%llu%s free, ",  numberStart, sumFree, numberEnd);
 }
 
 /**
@@ -11320,13 +11141,13 @@ S9sRpcReply::printMetaTypeListLong()
     {
         nameFormat.widen("NAME");
             
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
          
         nameFormat.printf("NAME");
-        printf("DESCRIPTION");
+        S9sOutput::printf("DESCRIPTION");
 
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     /*
@@ -11347,12 +11168,12 @@ S9sRpcReply::printMetaTypeListLong()
         if (description.empty())
             description = "-";
 
-        printf("%s", typeColorBegin());
+        S9sOutput::printf("%s", typeColorBegin());
         nameFormat.printf(typeName);
-        printf("%s", typeColorEnd());
+        S9sOutput::printf("%s", typeColorEnd());
 
-        printf("%s", STR(description));
-        printf("\n");
+        S9sOutput::printf("%s", STR(description));
+        S9sOutput::printf("\n");
     }
 }
 
@@ -11400,21 +11221,21 @@ S9sRpcReply::printMetaTypeListBrief()
         if (!options->isStringMatchExtraArguments(typeName))
             continue;
 
-        printf("%s", typeColorBegin());
+        S9sOutput::printf("%s", typeColorBegin());
         nameFormat.printf(typeName);
-        printf("%s", typeColorEnd());
+        S9sOutput::printf("%s", typeColorEnd());
 
         currentPosition += nameFormat.realWidth();
         if (currentPosition + nameFormat.realWidth() > terminalWidth ||
                 !isTerminal)
         {
-            printf("\n");
+            S9sOutput::printf("\n");
             currentPosition = 0;
         }
     }
 
     if (currentPosition > 0)
-        printf("\n");
+        S9sOutput::printf("\n");
 }
 
 void 
@@ -11474,15 +11295,15 @@ S9sRpcReply::printMetaTypePropertyListLong()
         nameFormat.widen("NAME");
         unitFormat.widen("UNIT");
 
-        printf("%s", headerColorBegin());
+        S9sOutput::printf("%s", headerColorBegin());
          
         statFormat.printf("ST");
         nameFormat.printf("NAME");
         unitFormat.printf("UNIT");
-        printf("DESCRIPTION");
+        S9sOutput::printf("DESCRIPTION");
 
-        printf("%s", headerColorEnd());
-        printf("\n");
+        S9sOutput::printf("%s", headerColorEnd());
+        S9sOutput::printf("\n");
     }
 
     /*
@@ -11527,14 +11348,14 @@ S9sRpcReply::printMetaTypePropertyListLong()
         }
         
         statFormat.printf(stat);
-        printf("%s", propertyColorBegin());
+        S9sOutput::printf("%s", propertyColorBegin());
         nameFormat.printf(typeName);
-        printf("%s", propertyColorEnd());
+        S9sOutput::printf("%s", propertyColorEnd());
 
         unitFormat.printf(unit);
 
-        printf("%s", STR(description));
-        printf("\n");
+        S9sOutput::printf("%s", STR(description));
+        S9sOutput::printf("\n");
     }
 }
 
@@ -11574,19 +11395,19 @@ S9sRpcReply::printMetaTypePropertyListBrief()
         if (!options->isStringMatchExtraArguments(typeName))
             continue;
 
-        printf("%s", propertyColorBegin());
+        S9sOutput::printf("%s", propertyColorBegin());
         nameFormat.printf(typeName);
-        printf("%s", propertyColorEnd());
+        S9sOutput::printf("%s", propertyColorEnd());
         
         currentPosition += nameFormat.realWidth();
         if (currentPosition + nameFormat.realWidth() > terminalWidth ||
                 !isTerminal)
         {
-            printf("\n");
+            S9sOutput::printf("\n");
             currentPosition = 0;
         }
     }
     
     if (currentPosition > 0)
-        printf("\n");
+        S9sOutput::printf("\n");
 }
@@ -218,7 +218,11 @@ class S9sRpcReply : public S9sVariantMap
         void printObjectListLong();
         void printObjectListBrief();
         
-        void saveConfig(S9sString outputDir);
+        bool saveConfig(
+                const S9sString &outputDir,
+                int             &nWritten,
+                int             &nUnchanged,
+                S9sString       &errorString);
 
 
         void printScriptTreeBrief(
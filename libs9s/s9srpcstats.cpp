@@ -0,0 +1,305 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9srpcstats.h"
+
+#include "S9sMutexLocker"
+#include "S9sVariantList"
+#include "S9sOptions"
+#include "S9sDateTime"
+#include "S9sFile"
+
+#include <stdio.h>
+#include <time.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sRpcRequestStats::S9sRpcRequestStats()
+{
+    clear();
+}
+
+void
+S9sRpcRequestStats::clear()
+{
+    m_operation.clear();
+    m_uri.clear();
+    m_hostName.clear();
+    m_port          = 0;
+    m_useTls        = false;
+    m_success       = false;
+    m_started       = 0.0;
+    m_finished      = 0.0;
+    m_resolveMs     = 0.0;
+    m_connectMs     = 0.0;
+    m_tlsMs         = 0.0;
+    m_firstByteMs   = 0.0;
+    m_lastByteMs    = 0.0;
+    m_parseMs       = 0.0;
+    m_printMs       = -1.0;
+    m_bytesSent     = 0ull;
+    m_bytesReceived = 0ull;
+    m_nConnects     = 0;
+    m_nRedirects    = 0;
+}
+
+/**
+ * \returns The time from sending the request until the reply was processed.
+ */
+double
+S9sRpcRequestStats::totalMs() const
+{
+    return m_finished - m_started;
+}
+
+S9sVariantMap
+S9sRpcRequestStats::toVariantMap() const
+{
+    S9sVariantMap retval;
+
+    retval["operation"]      = m_operation;
+    retval["uri"]            = m_uri;
+    retval["hostname"]       = m_hostName;
+    retval["port"]           = m_port;
+    retval["tls"]            = m_useTls;
+    retval["success"]        = m_success;
+    retval["resolve_ms"]     = m_resolveMs;
+    retval["connect_ms"]     = m_connectMs;
+    retval["tls_ms"]         = m_tlsMs;
+    retval["first_byte_ms"]  = m_firstByteMs;
+    retval["last_byte_ms"]   = m_lastByteMs;
+    retval["parse_ms"]       = m_parseMs;
+    retval["print_ms"]       = m_printMs;
+    retval["total_ms"]       = totalMs();
+    retval["bytes_sent"]     = m_bytesSent;
+    retval["bytes_received"] = m_bytesReceived;
+    retval["connects"]       = m_nConnects;
+    retval["redirects"]      = m_nRedirects;
+
+    return retval;
+}
+
+S9sRpcStats::S9sRpcStats() :
+    m_enabled(false)
+{
+}
+
+S9sRpcStats *
+S9sRpcStats::instance()
+{
+    static S9sRpcStats *theInstance = new S9sRpcStats;
+
+    return theInstance;
+}
+
+void
+S9sRpcStats::setEnabled(
+        bool enabled)
+{
+    m_enabled = enabled;
+}
+
+/**
+ * \returns True if the clients should measure the requests.
+ */
+bool
+S9sRpcStats::isEnabled() const
+{
+    return m_enabled;
+}
+
+/**
+ * \returns The index of the request that can be used with setPrintMs().
+ */
+int
+S9sRpcStats::addRequest(
+        const S9sRpcRequestStats &request)
+{
+    S9sMutexLocker locker(m_mutex);
+
+    m_requests.push_back(request);
+    return m_requests.size() - 1;
+}
+
+/**
+ * Sets the time the client spent with the reply after the request was
+ * finished (printing it), the client calls this when it starts the next
+ * request.
+ */
+void
+S9sRpcStats::setPrintMs(
+        int    index,
+        double printMs)
+{
+    S9sMutexLocker locker(m_mutex);
+
+    if (index >= 0 && index < (int) m_requests.size())
+        m_requests[index].m_printMs = printMs;
+}
+
+/**
+ * Called when the program exits: the requests that were not followed by an
+ * other request were printed until now.
+ */
+void
+S9sRpcStats::finish()
+{
+    S9sMutexLocker locker(m_mutex);
+    double         exitTime = now();
+
+    for (uint idx = 0u; idx < m_requests.size(); ++idx)
+    {
+        if (m_requests[idx].m_printMs < 0.0)
+            m_requests[idx].m_printMs = exitTime - m_requests[idx].m_finished;
+    }
+}
+
+/**
+ * \returns The JSon document with all the requests and the totals.
+ */
+S9sVariantMap
+S9sRpcStats::toVariantMap() const
+{
+    S9sMutexLocker locker(m_mutex);
+    S9sVariantMap  retval;
+    S9sVariantMap  totals;
+    S9sVariantList requests;
+    double         totalMs = 0.0;
+    ulonglong      bytesSent = 0ull, bytesReceived = 0ull;
+    int            nConnects = 0, nRedirects = 0, nFailed = 0;
+
+    for (uint idx = 0u; idx < m_requests.size(); ++idx)
+    {
+        const S9sRpcRequestStats &request = m_requests[idx];
+
+        requests      << request.toVariantMap();
+        totalMs       += request.totalMs();
+        bytesSent     += request.m_bytesSent;
+        bytesReceived += request.m_bytesReceived;
+        nConnects     += request.m_nConnects;
+        nRedirects    += request.m_nRedirects;
+
+        if (!request.m_success)
+            ++nFailed;
+    }
+
+    totals["requests"]       = (int) m_requests.size();
+    totals["failed"]         = nFailed;
+    totals["total_ms"]       = totalMs;
+    totals["bytes_sent"]     = bytesSent;
+    totals["bytes_received"] = bytesReceived;
+    totals["connects"]       = nConnects;
+    totals["redirects"]      = nRedirects;
+
+    retval["command_line"]   = S9sOptions::instance()->commandLine();
+    retval["created"]        = S9sDateTime::currentDateTime().toString(
+            S9sDateTime::TzDateTimeFormat);
+    retval["requests"]       = requests;
+    retval["totals"]         = totals;
+
+    return retval;
+}
+
+/**
+ * \returns How many requests were collected until now.
+ */
+int
+S9sRpcStats::nRequests() const
+{
+    S9sMutexLocker locker(m_mutex);
+
+    return (int) m_requests.size();
+}
+
+/**
+ * \param first The index of the first request to print, the --shell mode uses
+ *   this to print only the requests of the last command.
+ *
+ * Prints the timings to the standard error, so they are not mixed with the
+ * output of the command.
+ */
+void
+S9sRpcStats::printTimings(
+        int first) const
+{
+    S9sMutexLocker locker(m_mutex);
+
+    if (first < 0)
+        first = 0;
+
+    if (first >= (int) m_requests.size())
+        return;
+
+    fprintf(stderr,
+            "%-26s %8s %8s %8s %8s %8s %8s %8s %8s %9s %10s %3s\n",
+            "OPERATION", "RESOLVE", "CONNECT", "TLS", "1STBYTE", "TRANSFER",
+            "PARSE", "PRINT", "TOTAL", "SENT", "RECEIVED", "RDR");
+
+    for (uint idx = first; idx < m_requests.size(); ++idx)
+    {
+        const S9sRpcRequestStats &request = m_requests[idx];
+        S9sString                 operation = request.m_operation;
+
+        if (!request.m_success)
+            operation += " (failed)";
+
+        fprintf(stderr,
+                "%-26s %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f "
+                "%9llu %10llu %3d\n",
+                STR(operation),
+                request.m_resolveMs, request.m_connectMs, request.m_tlsMs,
+                request.m_firstByteMs, request.m_lastByteMs,
+                request.m_parseMs, request.m_printMs, request.totalMs(),
+                request.m_bytesSent, request.m_bytesReceived,
+                request.m_nRedirects);
+    }
+}
+
+/**
+ * \param fileName The file where the timings are appended, one JSon document
+ *   per line so that every program run is one line.
+ */
+bool
+S9sRpcStats::saveTimings(
+        const S9sString &fileName) const
+{
+    S9sFile file(fileName);
+
+    if (!file.openForAppend())
+        return false;
+
+    file.fprintf("%s\n", STR(toVariantMap().toJsonString(S9sFormatNormal)));
+    file.close();
+
+    return true;
+}
+
+/**
+ * \returns The monotonic clock in milliseconds.
+ */
+double
+S9sRpcStats::now()
+{
+    struct timespec theTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &theTime);
+    return theTime.tv_sec * 1000.0 + theTime.tv_nsec / 1000000.0;
+}
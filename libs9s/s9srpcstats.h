@@ -0,0 +1,103 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+#include "S9sVariantMap"
+#include "S9sMutex"
+
+/**
+ * The measurements of one RPC request. The times are in milliseconds, when the
+ * request was redirected the phases of all the attempts are added up.
+ */
+class S9sRpcRequestStats
+{
+    public:
+        S9sRpcRequestStats();
+
+        void clear();
+        double totalMs() const;
+        S9sVariantMap toVariantMap() const;
+
+    public:
+        S9sString   m_operation;
+        S9sString   m_uri;
+        S9sString   m_hostName;
+        int         m_port;
+        bool        m_useTls;
+        bool        m_success;
+        /** The time the request was started (monotonic clock). */
+        double      m_started;
+        /** The time the reply was processed (monotonic clock). */
+        double      m_finished;
+        /** DNS lookup. */
+        double      m_resolveMs;
+        /** TCP connect. */
+        double      m_connectMs;
+        /** TLS handshake. */
+        double      m_tlsMs;
+        /** From sending the request until the first byte of the reply. */
+        double      m_firstByteMs;
+        /** From the first byte until the last byte of the reply. */
+        double      m_lastByteMs;
+        /** Parsing the JSon reply. */
+        double      m_parseMs;
+        /** The client's own work (printing) until the next request or exit. */
+        double      m_printMs;
+        ulonglong   m_bytesSent;
+        ulonglong   m_bytesReceived;
+        int         m_nConnects;
+        int         m_nRedirects;
+};
+
+/**
+ * Collects the S9sRpcRequestStats of all the requests the program sent (from
+ * all the S9sRpcClient objects and threads) for the --print-timings command
+ * line option and the S9S_TIMINGS_FILE environment variable. The collecting is
+ * off by default, the clients do not measure anything then.
+ */
+class S9sRpcStats
+{
+    public:
+        static S9sRpcStats *instance();
+
+        void setEnabled(bool enabled);
+        bool isEnabled() const;
+
+        int addRequest(const S9sRpcRequestStats &request);
+        void setPrintMs(int index, double printMs);
+        void finish();
+        int nRequests() const;
+
+        S9sVariantMap toVariantMap() const;
+        void printTimings(int first = 0) const;
+        bool saveTimings(const S9sString &fileName) const;
+
+        static double now();
+
+    private:
+        S9sRpcStats();
+
+    private:
+        mutable S9sMutex                m_mutex;
+        bool                            m_enabled;
+        S9sVector<S9sRpcRequestStats>   m_requests;
+};
@@ -0,0 +1,417 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sshell.h"
+
+#include "S9sOptions"
+#include "S9sRpcClient"
+#include "S9sBusinessLogic"
+#include "S9sOutput"
+#include "S9sRpcStats"
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+#define END_OF_OUTPUT_FORMAT "### S9S-END %d\n"
+
+S9sShell::S9sShell() :
+    m_client(NULL),
+    m_quit(false)
+{
+}
+
+S9sShell::~S9sShell()
+{
+    if (m_client != NULL)
+        delete m_client;
+}
+
+/**
+ * \returns True if the commands could be read, false if the socket could not
+ *   be created.
+ *
+ * Reads and executes the commands from the standard input or from the UNIX
+ * domain socket the --shell=SOCKET command line option specified.
+ */
+bool
+S9sShell::execute()
+{
+    S9sOptions *options    = S9sOptions::instance();
+    S9sString   socketPath = options->shellSocketPath();
+
+    if (!socketPath.empty())
+        return executeSocket(socketPath);
+
+    return executeStream(stdin);
+}
+
+/**
+ * \param input The stream to read the command lines from.
+ * \returns True if the stream was read until the end or a "quit" command.
+ *
+ * Reads the command lines one by one and executes them, the output and the
+ * end-of-output line goes to the standard output.
+ */
+bool
+S9sShell::executeStream(
+        FILE *input)
+{
+    char    *buffer = NULL;
+    size_t   bufferSize = 0;
+    ssize_t  nRead;
+
+    m_quit = false;
+
+    while (!m_quit && (nRead = getline(&buffer, &bufferSize, input)) >= 0)
+    {
+        S9sVector<S9sString> words;
+        S9sString            errorString;
+        int                  exitStatus;
+
+        if (!splitCommandLine(buffer, words, errorString))
+        {
+            PRINT_ERROR("%s", STR(errorString));
+            exitStatus = S9sOptions::BadOptions;
+        } else if (words.empty())
+        {
+            // Empty line or comment.
+            continue;
+        } else {
+            exitStatus = executeCommand(words);
+            if (m_quit)
+                break;
+        }
+        
+        S9sOutput::flush();
+        fflush(stderr);
+
+        S9sOutput::printf(END_OF_OUTPUT_FORMAT, exitStatus);
+        S9sOutput::flush();
+    }
+
+    free(buffer);
+    return true;
+}
+
+/**
+ * \param words The command line split into words, the program name at the
+ *   beginning is optional.
+ * \returns The exit code of the command, what the program would return if it
+ *   was started with this command line.
+ */
+int
+S9sShell::executeCommand(
+        const S9sVector<S9sString> &words)
+{
+    S9sOptions       *options  = S9sOptions::instance();
+    S9sRpcStats      *stats    = S9sRpcStats::instance();
+    bool              statsWereEnabled = stats->isEnabled();
+    int               firstRequest = stats->nRequests();
+    S9sBusinessLogic  businessLogic;
+    S9sVector<char *> arguments;
+    int               argc;
+    bool              success;
+
+    if (words[0] == "quit" || words[0] == "exit")
+    {
+        m_quit = true;
+        return EXIT_SUCCESS;
+    }
+
+    if (words[0] != "s9s")
+        arguments.push_back(strdup("s9s"));
+
+    for (uint idx = 0u; idx < words.size(); ++idx)
+        arguments.push_back(strdup(STR(words[idx])));
+
+    argc = (int) arguments.size();
+    arguments.push_back(NULL);
+
+    options->reset();
+    success = options->readOptions(&argc, &arguments[0]);
+    if (!success)
+    {
+        if (!options->errorString().empty())
+        {
+            PRINT_ERROR("%s", STR(options->errorString()));
+        } else {
+            PRINT_ERROR("Error in command line options.");
+        }
+    } else if (options->isShellRequested())
+    {
+        PRINT_ERROR("The --shell option can not be used in the shell.");
+        options->setExitStatus(S9sOptions::BadOptions);
+    } else if (!options->executeInfoRequest())
+    {
+        if (options->isPrintTimingsRequested())
+            stats->setEnabled(true);
+
+        businessLogic.execute(client());
+
+        if (options->isPrintTimingsRequested())
+        {
+            S9sOutput::flush();
+            stats->finish();
+            stats->printTimings(firstRequest);
+            stats->setEnabled(statsWereEnabled);
+        }
+    }
+
+    for (uint idx = 0u; idx < arguments.size(); ++idx)
+        free(arguments[idx]);
+
+    return options->exitStatus();
+}
+
+/**
+ * \param line The command line as the user typed it.
+ * \param words The words of the command line are placed here.
+ * \param errorString The error message is placed here if the line could not be
+ *   processed.
+ * \returns True if the line was processed.
+ *
+ * Splits a command line into words the way a shell does: the words are
+ * separated by white space, the single and double quotes and the backslash can
+ * be used to put special characters into the words and the '#' at the
+ * beginning of a word starts a comment that lasts until the end of the line.
+ */
+bool
+S9sShell::splitCommandLine(
+        const S9sString        &line,
+        S9sVector<S9sString>   &words,
+        S9sString              &errorString)
+{
+    S9sString  word;
+    bool       inWord = false;
+    char       quote  = '\0';
+
+    words.clear();
+
+    for (const char *c = STR(line); *c != '\0'; ++c)
+    {
+        if (quote == '\'')
+        {
+            // Everything is literal until the closing quote.
+            if (*c == '\'')
+                quote = '\0';
+            else
+                word += *c;
+        } else if (quote == '"')
+        {
+            if (*c == '"')
+            {
+                quote = '\0';
+            } else if (*c == '\\' && (c[1] == '"' || c[1] == '\\'))
+            {
+                ++c;
+                word += *c;
+            } else {
+                word += *c;
+            }
+        } else if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+        {
+            if (inWord)
+            {
+                words.push_back(word);
+                word.clear();
+                inWord = false;
+            }
+        } else if (*c == '#' && !inWord)
+        {
+            break;
+        } else if (*c == '\'' || *c == '"')
+        {
+            quote  = *c;
+            inWord = true;
+        } else if (*c == '\\')
+        {
+            inWord = true;
+            if (c[1] != '\0' && c[1] != '\n')
+            {
+                ++c;
+                word += *c;
+            }
+        } else {
+            word  += *c;
+            inWord = true;
+        }
+    }
+
+    if (quote != '\0')
+    {
+        errorString.sprintf("Unterminated %c in the command line.", quote);
+        words.clear();
+        return false;
+    }
+
+    if (inWord)
+        words.push_back(word);
+
+    return true;
+}
+
+/**
+ * \param path The path of the UNIX domain socket.
+ * \returns False if the socket could not be created.
+ *
+ * Accepts the connections on the socket one after the other and executes the
+ * command lines sent through them. The output of the commands (both the
+ * standard output and the standard error) is sent back through the same
+ * connection. The socket is only accessible for the user, the commands are
+ * executed with the authenticated session after all.
+ */
+bool
+S9sShell::executeSocket(
+        const S9sString &path)
+{
+    struct sockaddr_un address;
+    struct stat        fileStat;
+    int                listenFd;
+    mode_t             oldMask;
+
+    if (path.length() >= sizeof(address.sun_path))
+    {
+        PRINT_ERROR("The socket path '%s' is too long.", STR(path));
+        S9sOptions::instance()->setExitStatus(S9sOptions::BadOptions);
+        return false;
+    }
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        PRINT_ERROR("Can not create socket: %m");
+        S9sOptions::instance()->setExitStatus(S9sOptions::Failed);
+        return false;
+    }
+
+    // A socket left here by an earlier run is removed, other files are not.
+    if (stat(STR(path), &fileStat) == 0 && S_ISSOCK(fileStat.st_mode))
+        unlink(STR(path));
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, STR(path), sizeof(address.sun_path) - 1);
+
+    oldMask = umask(0177);
+    if (bind(listenFd, (struct sockaddr *) &address, sizeof(address)) != 0 ||
+            listen(listenFd, 5) != 0)
+    {
+        PRINT_ERROR("Can not listen on '%s': %m", STR(path));
+        umask(oldMask);
+        close(listenFd);
+        S9sOptions::instance()->setExitStatus(S9sOptions::Failed);
+        return false;
+    }
+
+    umask(oldMask);
+    
+    // The clients may disconnect before reading the output.
+    signal(SIGPIPE, SIG_IGN);
+
+    for (;;)
+    {
+        int   connectionFd = accept(listenFd, NULL, NULL);
+        int   savedStdout, savedStderr;
+        FILE *input;
+
+        if (connectionFd < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            PRINT_ERROR("Can not accept connection: %m");
+            break;
+        }
+
+        input = fdopen(connectionFd, "r");
+        if (input == NULL)
+        {
+            close(connectionFd);
+            continue;
+        }
+
+        S9sOutput::flush();
+        fflush(stderr);
+        savedStdout = dup(STDOUT_FILENO);
+        savedStderr = dup(STDERR_FILENO);
+        dup2(connectionFd, STDOUT_FILENO);
+        dup2(connectionFd, STDERR_FILENO);
+
+        executeStream(input);
+
+        S9sOutput::flush();
+        fflush(stderr);
+        dup2(savedStdout, STDOUT_FILENO);
+        dup2(savedStderr, STDERR_FILENO);
+        close(savedStdout);
+        close(savedStderr);
+
+        fclose(input);
+    }
+
+    close(listenFd);
+    unlink(STR(path));
+
+    return true;
+}
+
+/**
+ * \returns The RPC client for the controller the current command line
+ *   addresses. The client is kept while the commands go to the same controller
+ *   with the same credentials, so the session is authenticated only once.
+ */
+S9sRpcClient &
+S9sShell::client()
+{
+    S9sOptions *options = S9sOptions::instance();
+    S9sString   controller = options->controllerHostName();
+    int         port       = options->controllerPort();
+    S9sString   path       = options->controllerPath();
+    bool        useTls     = options->useTls();
+    S9sString   key;
+
+    key.sprintf("%s:%d%s %d %s %s %s",
+            STR(controller), port, STR(path), useTls,
+            STR(options->userName()), STR(options->password()),
+            STR(options->privateKeyPath()));
+
+    if (m_client == NULL || key != m_clientKey)
+    {
+        S9S_DEBUG("New client for %s:%d.", STR(controller), port);
+
+        if (m_client != NULL)
+            delete m_client;
+
+        m_client    = new S9sRpcClient(controller, port, path, useTls);
+        m_clientKey = key;
+    }
+
+    return *m_client;
+}
@@ -0,0 +1,64 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+
+#include <stdio.h>
+
+class S9sRpcClient;
+
+/**
+ * The --shell mode of the program: executes the s9s commands one after the
+ * other in the same process. The command lines are read from the standard
+ * input or from the connections accepted on a UNIX domain socket, one command
+ * per line written just as it would be written in a shell (the leading "s9s"
+ * is optional). The configuration files, the state and the authenticated RPC
+ * client are kept between the commands, so only the first command pays for
+ * starting the program, loading the files and authenticating.
+ *
+ * The output of every command is closed by a line "### S9S-END <exitcode>", so
+ * the caller knows where the output ends and how the command finished.
+ */
+class S9sShell
+{
+    public:
+        S9sShell();
+        virtual ~S9sShell();
+
+        bool execute();
+        bool executeStream(FILE *input);
+        int executeCommand(const S9sVector<S9sString> &words);
+
+        static bool splitCommandLine(
+                const S9sString        &line,
+                S9sVector<S9sString>   &words,
+                S9sString              &errorString);
+
+    private:
+        bool executeSocket(const S9sString &path);
+        S9sRpcClient &client();
+
+    private:
+        S9sRpcClient   *m_client;
+        S9sString       m_clientKey;
+        bool            m_quit;
+};
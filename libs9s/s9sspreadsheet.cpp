@@ -18,6 +18,7 @@
  * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9sspreadsheet.h"
+#include "S9sOutput"
 
 //#define DEBUG
 //#define WARNING
@@ -259,8 +260,8 @@ S9sSpreadsheet::print() const
     /*
      * Printing the header line.
      */
-    ::printf("     ");
-    ::printf("%s", headerColorBegin());
+    S9sOutput::printf("     ");
+    S9sOutput::printf("%s", headerColorBegin());
 
     thisColumn = 5;
     for (uint col = m_firstVisibleColumn; col < 32; ++col)
@@ -275,32 +276,32 @@ S9sSpreadsheet::print() const
         label += 'A' + col;
         
         for (uint n = 0; n < (theWidth - label.length()) / 2; ++n, ++nChars)
-            ::printf(" ");
+            S9sOutput::printf(" ");
 
-        ::printf("%s", STR(label));
+        S9sOutput::printf("%s", STR(label));
         nChars += label.length();
         
         for (; nChars < theWidth; ++nChars)
-            ::printf(" ");
+            S9sOutput::printf(" ");
 
         thisColumn += theWidth;
     }
 
     for (;thisColumn < (int)m_screenColumns;++thisColumn)
-        ::printf(" ");
+        S9sOutput::printf(" ");
 
     //::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", headerColorEnd());
-    ::printf("\r\n");
+    S9sOutput::printf("%s", headerColorEnd());
+    S9sOutput::printf("\r\n");
 
     /*
      *
      */
     for (uint row = m_firstVisibleRow; row <= (uint)lastVisibleRow(); ++row)
     {
-        ::printf("%s", headerColorBegin());
-        ::printf(" %3u ", row + 1);
-        ::printf("%s", headerColorEnd());
+        S9sOutput::printf("%s", headerColorBegin());
+        S9sOutput::printf(" %3u ", row + 1);
+        S9sOutput::printf("%s", headerColorEnd());
 
         for (uint col = m_firstVisibleColumn; col <= (uint)lastVisibleColumn(); ++col)
         {
@@ -311,33 +312,33 @@ S9sSpreadsheet::print() const
                 theValue.resize(theWidth);
 
             // 
-            ::printf("%s", cellBegin(0, col, row));
+            S9sOutput::printf("%s", cellBegin(0, col, row));
 
             //
             // Printing the cell content.
             //
             if (!isAlignRight(0, col, row))
             {
-                ::printf("%s", STR(theValue));
+                S9sOutput::printf("%s", STR(theValue));
                 if (theWidth > (int)theValue.length())
                 {
                     for (uint n = 0; n < theWidth - theValue.length(); ++n)
-                        ::printf(" ");
+                        S9sOutput::printf(" ");
                 }
             } else {
                 if (theWidth > (int)theValue.length())
                 {
                     for (uint n = 0; n < theWidth - theValue.length(); ++n)
-                        ::printf(" ");
+                        S9sOutput::printf(" ");
                 }
-                ::printf("%s", STR(theValue));
+                S9sOutput::printf("%s", STR(theValue));
             }
             
             // 
-            ::printf("%s", cellEnd(0, col, row));
+            S9sOutput::printf("%s", cellEnd(0, col, row));
         }
         
-        ::printf("\r\n");
+        S9sOutput::printf("\r\n");
     }
 }
 
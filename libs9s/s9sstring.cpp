@@ -67,6 +67,21 @@ S9sString::S9sString(
 {
 }
 
+S9sString::S9sString(
+        const S9sString &str) :
+    std::string(str)
+{
+}
+
+/**
+ * Takes over the buffer of the other string, the other string is left empty.
+ */
+S9sString::S9sString(
+        S9sString &&str) noexcept :
+    std::string(std::move(str))
+{
+}
+
 S9sString &
 S9sString::operator= (
         const S9sString &rhs)
@@ -76,6 +91,15 @@ S9sString::operator= (
     return *this;
 }
 
+S9sString &
+S9sString::operator= (
+        S9sString &&rhs) noexcept
+{
+    std::string::operator=(std::move(rhs));
+
+    return *this;
+}
+
 /**
  * This method is protected against segfaults when it received a NULL pointer
  * as argument. That's a very annoying issue with std::string, especially
@@ -235,14 +259,44 @@ S9sString::appendWord(
     return *this;
 }
 
+/**
+ * \returns The number of columns the string takes on the terminal, one column
+ *   for every UTF-8 character (e.g. "…" is one column, not three).
+ */
 int
 S9sString::terminalLength() const
 {
-    S9sString copy = *this;
+    int retval = 0;
 
-    copy.replace("…", ".");
+    for (size_t idx = 0u; idx < length(); ++idx)
+    {
+        // The continuation bytes of the multibyte characters are 10xxxxxx.
+        if ((at(idx) & 0xc0) != 0x80)
+            ++retval;
+    }
 
-    return copy.length();
+    return retval;
+}
+
+/**
+ * \param nColumns The maximum number of terminal columns.
+ * \returns The beginning of the string that fits into the given number of
+ *   terminal columns without cutting any of the multibyte UTF-8 characters in
+ *   half.
+ */
+S9sString
+S9sString::terminalLeft(
+        int nColumns) const
+{
+    size_t end = 0u;
+
+    for (; end < length(); ++end)
+    {
+        if ((at(end) & 0xc0) != 0x80 && nColumns-- <= 0)
+            break;
+    }
+
+    return substr(0, end);
 }
 
 /**
@@ -823,6 +877,48 @@ S9sString::looksLikeIpAddress() const
     return regMatch("([0-9]{1,3}\\.){3}[0-9]{1,3}");
 }
 
+/*
+ * The lookup table of the CRC-32 (IEEE 802.3) checksum, filled when the
+ * program starts.
+ */
+static uint crc32Table[256];
+
+class S9sCrc32TableInit
+{
+    public:
+        S9sCrc32TableInit()
+        {
+            for (uint n = 0u; n < 256u; ++n)
+            {
+                uint c = n;
+
+                for (int k = 0; k < 8; ++k)
+                    c = (c & 1u) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+
+                crc32Table[n] = c;
+            }
+        }
+};
+
+static S9sCrc32TableInit crc32TableInit;
+
+/**
+ * \returns The CRC-32 checksum of the string, the same value zlib's crc32()
+ *   computes.
+ */
+uint
+S9sString::crc32() const
+{
+    const unsigned char *data = (const unsigned char *) c_str();
+    size_t               len  = length();
+    uint                 crc  = 0xffffffffu;
+
+    for (size_t idx = 0u; idx < len; ++idx)
+        crc = crc32Table[(crc ^ data[idx]) & 0xffu] ^ (crc >> 8);
+
+    return crc ^ 0xffffffffu;
+}
+
 S9sString 
 S9sString::decimalSeparator()
 {
@@ -835,8 +931,287 @@ S9sString::decimalSeparator()
     return retval;
 }
 
-S9sString 
-S9sString::html2ansi(
+/*
+ * The color tags the controller uses in the job messages and the status texts
+ * with the terminal sequences they are translated into. The tags are looked
+ * up by the element name and the color in a perfect hash table, the hash
+ * function below maps each of these entries to a different slot.
+ */
+#define HTML_TAG_TABLE_SIZE 64
+
+struct S9sHtmlColorTag
+{
+    bool        strong;
+    const char *color;
+    const char *ansi;
+};
+
+static const S9sHtmlColorTag htmlColorTags[] =
+{
+    { false, "#c66211", XTERM_COLOR_3      },
+    { false, "#75599b", XTERM_COLOR_3      },
+    { true,  "#110679", XTERM_COLOR_16     },
+    { true,  "#59a449", XTERM_COLOR_9      },
+    // This is the file name color for normal files.
+    { false, "#007e18", XTERM_COLOR_17     },
+    { false, "#7415f6", XTERM_COLOR_5      },
+    { false, "#1abc9c", XTERM_COLOR_6      },
+    { false, "#d35400", XTERM_COLOR_7      },
+    { false, "#c0392b", XTERM_COLOR_8      },
+    { false, "#0b33b5", XTERM_COLOR_BLUE   },
+    { false, "#34495e", XTERM_COLOR_CYAN   },
+    { false, "#f3990b", XTERM_COLOR_7      },
+    { false, "#c49854", XTERM_COLOR_7      },
+    { false, "#877d0f", XTERM_COLOR_7      },
+    { true,  "red",     XTERM_COLOR_RED    },
+    { true,  "orange",  "\033[38;5;172m"   },
+};
+
+static const S9sHtmlColorTag *htmlColorTagTable[HTML_TAG_TABLE_SIZE];
+
+static uint
+htmlColorTagHash(
+        bool        strong,
+        const char *color,
+        size_t      length)
+{
+    uint retval = 1u;
+
+    retval = (retval * 33u) ^ (strong ? 's' : 'e');
+    for (size_t idx = 0u; idx < length; ++idx)
+        retval = (retval * 33u) ^ (unsigned char) color[idx];
+
+    return retval % HTML_TAG_TABLE_SIZE;
+}
+
+class S9sHtmlColorTagTableInit
+{
+    public:
+        S9sHtmlColorTagTableInit()
+        {
+            size_t nTags = sizeof(htmlColorTags) / sizeof(htmlColorTags[0]);
+
+            for (size_t idx = 0u; idx < nTags; ++idx)
+            {
+                const S9sHtmlColorTag *tag  = &htmlColorTags[idx];
+                uint                   slot = htmlColorTagHash(
+                        tag->strong, tag->color, strlen(tag->color));
+
+                htmlColorTagTable[slot] = tag;
+            }
+        }
+};
+
+static S9sHtmlColorTagTableInit htmlColorTagTableInit;
+
+/*
+ * \returns true if the string at 'pos' starts with 'prefix', the case of the
+ *   letters is ignored if 'ignoreCase' is true.
+ */
+static inline bool
+htmlHasPrefix(
+        const char *pos,
+        const char *end,
+        const char *prefix,
+        size_t      length,
+        bool        ignoreCase = false)
+{
+    if ((size_t) (end - pos) < length)
+        return false;
+
+    if (ignoreCase)
+        return strncasecmp(pos, prefix, length) == 0;
+
+    return memcmp(pos, prefix, length) == 0;
+}
+
+#define HTML_HAS_PREFIX(pos, end, prefix) \
+    htmlHasPrefix((pos), (end), prefix, sizeof(prefix) - 1)
+
+#define HTML_HAS_PREFIX_NOCASE(pos, end, prefix) \
+    htmlHasPrefix((pos), (end), prefix, sizeof(prefix) - 1, true)
+
+/*
+ * Matches a known color tag ("<em style='color: #c66211;'>") at 'pos', returns
+ * the length of the tag and the terminal sequence or 0 if there is no known
+ * tag there.
+ */
+static size_t
+htmlKnownTag(
+        const char  *pos,
+        const char  *end,
+        const char *&ansi)
+{
+    const char *color;
+    const char *colorEnd;
+    bool        strong;
+
+    if (HTML_HAS_PREFIX(pos, end, "<em style='color: "))
+    {
+        strong = false;
+        color  = pos + sizeof("<em style='color: ") - 1;
+    } else if (HTML_HAS_PREFIX(pos, end, "<strong style='color: "))
+    {
+        strong = true;
+        color  = pos + sizeof("<strong style='color: ") - 1;
+    } else {
+        return 0u;
+    }
+
+    for (colorEnd = color; colorEnd < end && *colorEnd != ';'; ++colorEnd)
+        if (colorEnd - color > 8)
+            return 0u;
+
+    if (!HTML_HAS_PREFIX(colorEnd, end, ";'>"))
+        return 0u;
+
+    const S9sHtmlColorTag *tag = htmlColorTagTable[
+        htmlColorTagHash(strong, color, colorEnd - color)];
+
+    if (tag == NULL || tag->strong != strong || 
+            strlen(tag->color) != (size_t) (colorEnd - color) ||
+            memcmp(tag->color, color, colorEnd - color) != 0)
+    {
+        return 0u;
+    }
+
+    ansi = tag->ansi;
+    return colorEnd + 3 - pos;
+}
+
+/*
+ * Matches the "<em style=.color:[^;]+;.>" pattern ignoring the case of the
+ * letters for any other color at 'pos' where the prefix is the given element
+ * start. Returns the length of the match or 0. The 'ambiguous' flag is set if
+ * the matched text has markup in it.
+ */
+static size_t
+htmlOtherColorTag(
+        const char *pos,
+        const char *end,
+        const char *prefix,
+        size_t      prefixLength,
+        bool       &ambiguous)
+{
+    const char *ptr = pos + prefixLength + 1;
+    const char *semicolon;
+
+    if (!htmlHasPrefix(pos, end, prefix, prefixLength, true) || 
+            ptr >= end || !HTML_HAS_PREFIX_NOCASE(ptr, end, "color:"))
+    {
+        return 0u;
+    }
+
+    ptr += sizeof("color:") - 1;
+    if (ptr >= end || *ptr == ';')
+        return 0u;
+
+    semicolon = (const char *) memchr(ptr, ';', end - ptr);
+    if (semicolon == NULL || end - semicolon < 3 || semicolon[2] != '>')
+        return 0u;
+
+    for (const char *c = pos + 1; c < semicolon + 2; ++c)
+        if (*c == '<' || *c == '&' || *c == '\0')
+            ambiguous = true;
+
+    return semicolon + 3 - pos;
+}
+
+/*
+ * Matches any of the tags html2ansi() translates at 'pos' (which points to a
+ * '<'). Returns the length of the tag and the text it should be replaced with
+ * or 0 if there is no such tag there.
+ */
+static size_t
+htmlTagLength(
+        const char  *pos,
+        const char  *end,
+        const char *&replacement,
+        bool        &ambiguous)
+{
+    const char *next;
+    size_t      length;
+
+    if ((length = htmlKnownTag(pos, end, replacement)) > 0u)
+        return length;
+
+    if (HTML_HAS_PREFIX(pos, end, "</em>"))
+    {
+        replacement = TERM_NORMAL;
+        return sizeof("</em>") - 1;
+    } else if (HTML_HAS_PREFIX(pos, end, "</strong>"))
+    {
+        replacement = TERM_NORMAL;
+        return sizeof("</strong>") - 1;
+    } else if (HTML_HAS_PREFIX(pos, end, "<br/>") || 
+            HTML_HAS_PREFIX(pos, end, "<BR/>"))
+    {
+        replacement = "\n";
+        return sizeof("<br/>") - 1;
+    } 
+    
+    length = htmlOtherColorTag(
+            pos, end, "<em style=", sizeof("<em style=") - 1, ambiguous);
+
+    if (length > 0u)
+    {
+        replacement = XTERM_COLOR_ORANGE;
+        return length;
+    }
+
+    length = htmlOtherColorTag(
+            pos, end, "<strong style=", sizeof("<strong style=") - 1, 
+            ambiguous);
+
+    if (length > 0u)
+    {
+        replacement = XTERM_COLOR_8;
+        return length;
+    }
+    
+    if (HTML_HAS_PREFIX_NOCASE(pos, end, "<a href="))
+    {
+        next = (const char *) memchr(pos, '>', end - pos);
+        if (next != NULL)
+        {
+            for (const char *c = pos + 1; c < next; ++c)
+                if (*c == '<' || *c == '&' || *c == '\0')
+                    ambiguous = true;
+
+            replacement = "";
+            return next + 1 - pos;
+        }
+    }
+
+    return 0u;
+}
+
+/*
+ * \returns true if one of the tags html2ansi() translates might start at 'pos'.
+ */
+static bool
+htmlMayStartTag(
+        const char *pos,
+        const char *end)
+{
+    return 
+        HTML_HAS_PREFIX_NOCASE(pos, end, "<em style=") ||
+        HTML_HAS_PREFIX_NOCASE(pos, end, "<strong style=") ||
+        HTML_HAS_PREFIX_NOCASE(pos, end, "<a href=") ||
+        HTML_HAS_PREFIX(pos, end, "</em>") ||
+        HTML_HAS_PREFIX(pos, end, "</strong>") ||
+        HTML_HAS_PREFIX(pos, end, "<br/>") ||
+        HTML_HAS_PREFIX(pos, end, "<BR/>");
+}
+
+/*
+ * The original, multi-pass implementation of html2ansi(). It applies every
+ * replacement on the whole string until the string no longer changes. The
+ * single pass translator falls back to this when the order of the
+ * replacements could make a difference, so the output is always the same.
+ */
+static S9sString 
+html2ansiMultiPass(
         const S9sString &input)
 {
     S9sString s           = input;
@@ -891,6 +1266,122 @@ do_again:
     return s;
 }
 
+/**
+ * \param input The text with the HTML markup the controller uses in the 
+ *   messages.
+ * \returns The same text with the color tags replaced by terminal escape
+ *   sequences, the line breaks replaced by new-line characters, the links
+ *   removed and the HTML entities unescaped.
+ *
+ * The string is processed in one pass, the known color tags are found in a
+ * hash table. If a replacement produces text that could be matched again
+ * (e.g. "&amp;lt;" or an escaped tag) the original multi-pass replacement is
+ * used, so the result is always the same as the one of that.
+ */
+S9sString 
+S9sString::html2ansi(
+        const S9sString &input)
+{
+    const char *pos       = input.c_str();
+    const char *end       = pos + input.length();
+    bool        changed   = false;
+    bool        ambiguous = false;
+    bool        hasLess   = false;
+    bool        hasAmp    = false;
+    S9sString   retval;
+
+    retval.reserve(input.length());
+
+    while (pos < end)
+    {
+        const char *replacement = NULL;
+        const char *next        = pos;
+        size_t      length;
+
+        while (next < end && *next != '<' && *next != '&')
+            ++next;
+
+        if (next > pos)
+        {
+            retval.append(pos, next - pos);
+            pos = next;
+            continue;
+        }
+
+        if (*pos == '&')
+        {
+            if (HTML_HAS_PREFIX(pos, end, "&amp;"))
+            {
+                retval += '&';
+                pos    += sizeof("&amp;") - 1;
+                hasAmp  = true;
+            } else if (HTML_HAS_PREFIX(pos, end, "&lt;"))
+            {
+                retval += '<';
+                pos    += sizeof("&lt;") - 1;
+                hasLess = true;
+            } else if (HTML_HAS_PREFIX(pos, end, "&gt;"))
+            {
+                retval += '>';
+                pos    += sizeof("&gt;") - 1;
+            } else {
+                retval += '&';
+                ++pos;
+                hasAmp  = true;
+                continue;
+            }
+
+            changed = true;
+            continue;
+        }
+
+        length = htmlTagLength(pos, end, replacement, ambiguous);
+        if (length == 0u)
+        {
+            retval += '<';
+            ++pos;
+            hasLess = true;
+        } else {
+            retval += replacement;
+            pos    += length;
+            changed = true;
+        }
+    }
+
+    /*
+     * A '<' left in the text (or coming from a "&lt;") could start a tag the
+     * multi-pass replacement matches over the text we already replaced and an
+     * "&amp;" could form a new entity. 
+     */
+    if (changed && hasLess)
+    {
+        pos = retval.c_str();
+        end = pos + retval.length();
+
+        while (!ambiguous && 
+                (pos = (const char *) memchr(pos, '<', end - pos)) != NULL)
+        {
+            ambiguous = htmlMayStartTag(pos, end);
+            ++pos;
+        }
+    }
+
+    if (changed && hasAmp && !ambiguous)
+    {
+        ambiguous = 
+            retval.find("&amp;") != std::string::npos || 
+            retval.find("&lt;")  != std::string::npos ||
+            retval.find("&gt;")  != std::string::npos;
+    }
+
+    if (changed && ambiguous)
+    {
+        return html2ansiMultiPass(input);
+    }
+
+    return retval;
+}
+
 S9sString 
 S9sString::html2text(
         const S9sString &input)
@@ -1162,6 +1653,72 @@ S9sString::writeFile(
     return true;
 }
 
+/**
+ * \param fileName The name of the file to write.
+ * \param content The content to write into the file.
+ * \param errorString The place where the error message will be placed if
+ *   something went wrong.
+ * \returns True if everything is ok.
+ *
+ * Writes the file the way nobody ever sees it half written: the content goes
+ * into a temporary file in the same directory that is then renamed to the
+ * final name. If the file already exists it is replaced in one step.
+ */
+bool
+S9sString::writeFileAtomic(
+        const S9sString     &fileName,
+        const S9sString     &content,
+        S9sString           &errorString)
+{
+    mode_t   mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH;
+    S9sString tmpName = fileName + ".XXXXXX";
+    int      fileDescriptor;
+    ssize_t  nBytes;
+
+    // mkstemp() overwrites the X characters in place.
+    fileDescriptor = mkstemp(&tmpName[0]);
+    if (fileDescriptor < 0)
+    {
+        errorString.sprintf(
+                "Error creating temporary file for '%s': %m",
+                STR(fileName));
+        return false;
+    }
+
+    nBytes = ::safeWrite(fileDescriptor, STR(content), content.size());
+    if (nBytes < (ssize_t) content.size() ||
+            fchmod(fileDescriptor, mode) != 0 ||
+            fsync(fileDescriptor) != 0)
+    {
+        errorString.sprintf(
+                "Error writing file '%s': %m", 
+                STR(tmpName));
+        ::close(fileDescriptor);
+        ::unlink(STR(tmpName));
+        return false;
+    }
+
+    if (::close(fileDescriptor) != 0)
+    {
+        errorString.sprintf(
+                "Error closing file '%s': %m", 
+                STR(tmpName));
+        ::unlink(STR(tmpName));
+        return false;
+    }
+
+    if (::rename(STR(tmpName), STR(fileName)) != 0)
+    {
+        errorString.sprintf(
+                "Error renaming '%s' to '%s': %m", 
+                STR(tmpName), STR(fileName));
+        ::unlink(STR(tmpName));
+        return false;
+    }
+
+    return true;
+}
+
 std::string
 S9sString::buildPath(
         const std::string &path1,
@@ -47,8 +47,11 @@ class S9sString : public std::string
         S9sString();
         S9sString(const char *str);
         S9sString(const std::string &str);
+        S9sString(const S9sString &str);
+        S9sString(S9sString &&str) noexcept;
 
         S9sString &operator=(const S9sString &rhs);
+        S9sString &operator=(S9sString &&rhs) noexcept;
         S9sString &operator=(const std::string &rhs);
         S9sString &operator=(const char *rhs);
         S9sString  operator*(const int rhs) const;
@@ -59,6 +62,7 @@ class S9sString : public std::string
         inline bool contains(const char *s) const;
 
         int terminalLength() const;
+        S9sString terminalLeft(int nColumns) const;
 
         void sprintf(const char *formatString, ...);
         void vsprintf(const char *formatString, va_list arguments);
@@ -111,6 +115,7 @@ class S9sString : public std::string
         bool looksULongLong() const;
         bool looksLikeIpAddress() const;
 
+        uint crc32() const;
 
         static S9sString decimalSeparator();
 
@@ -131,6 +136,11 @@ class S9sString : public std::string
                 const S9sString     &fileName,
                 S9sString           &content,
                 S9sString           &errorString);
+
+        static bool writeFileAtomic(
+                const S9sString     &fileName,
+                const S9sString     &content,
+                S9sString           &errorString);
     
         static std::string
             buildPath(
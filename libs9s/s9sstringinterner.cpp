@@ -0,0 +1,230 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sstringinterner.h"
+
+#include "S9sMutexLocker"
+
+#include <string.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The number of slots in the open addressing hash table of the pool, must be
+ * a power of two.
+ */
+#define INTERNER_SLOTS       (1 << 15)
+
+/**
+ * The pool is never filled more than half, so the probe sequences are short.
+ */
+#define INTERNER_MAX_STRINGS (INTERNER_SLOTS / 2)
+
+/**
+ * The longest string that is interned. The property names are short, the 
+ * longer strings are most probably values used as keys.
+ */
+#define INTERNER_MAX_LENGTH  64
+
+/*
+ * The variant maps are used during the static initialization, so the pool
+ * is zero initialized at load time and the mutex is created on first use.
+ */
+std::atomic<const S9sString *> S9sStringInterner::sm_slots[INTERNER_SLOTS];
+
+uint      S9sStringInterner::sm_nStrings    = 0u;
+ulonglong S9sStringInterner::sm_memoryUsage = 
+    INTERNER_SLOTS * sizeof(std::atomic<const S9sString *>);
+
+/**
+ * \returns The interned copy of the string or NULL if the string can not be
+ *   interned.
+ */
+const S9sString *
+S9sStringInterner::intern(
+        const S9sString &theString)
+{
+    return intern(theString.c_str(), theString.length());
+}
+
+/**
+ * \param theString The characters of the string, need not be terminated.
+ * \param length The length of the string.
+ * \returns The interned copy of the string or NULL if the string can not be
+ *   interned because it is too long or the pool is full.
+ */
+const S9sString *
+S9sStringInterner::intern(
+        const char *theString,
+        size_t      length)
+{
+    return intern(theString, length, hash(theString, length));
+}
+
+/**
+ * \param hashValue The hash() of the string, the callers that need the hash
+ *   value anyway calculate it only once.
+ */
+const S9sString *
+S9sStringInterner::intern(
+        const char *theString,
+        size_t      length,
+        uint        hashValue)
+{
+    const S9sString *retval;
+    uint             slot;
+
+    if (length > INTERNER_MAX_LENGTH)
+        return NULL;
+
+    retval = find(theString, length, hashValue, slot);
+    if (retval != NULL)
+        return retval;
+
+    /*
+     * Not in the pool, we need to add it. An other thread might have added it
+     * since we looked, so we look again holding the lock.
+     */
+    S9sMutexLocker locker(mutex());
+
+    retval = find(theString, length, hashValue, slot);
+    if (retval != NULL)
+        return retval;
+    
+    if (sm_nStrings >= INTERNER_MAX_STRINGS)
+    {
+        S9S_WARNING("The string interner is full.");
+        return NULL;
+    }
+
+    retval = new S9sString(std::string(theString, length));
+    sm_slots[slot].store(retval, std::memory_order_release);
+
+    ++sm_nStrings;
+    sm_memoryUsage += sizeof(S9sString) + length + 1;
+
+    return retval;
+}
+
+/**
+ * \param theString The characters of the string, need not be terminated.
+ * \param length The length of the string.
+ * \param hashValue The hash() of the string.
+ * \returns The interned copy of the string if it is already in the pool,
+ *   NULL otherwise. The string is never added to the pool.
+ */
+const S9sString *
+S9sStringInterner::lookup(
+        const char *theString,
+        size_t      length,
+        uint        hashValue)
+{
+    uint slot;
+
+    if (length > INTERNER_MAX_LENGTH)
+        return NULL;
+
+    return find(theString, length, hashValue, slot);
+}
+
+/**
+ * \returns How many strings are in the pool.
+ */
+uint
+S9sStringInterner::nStrings()
+{
+    S9sMutexLocker locker(mutex());
+
+    return sm_nStrings;
+}
+
+/**
+ * \returns Approximately how many bytes the pool uses.
+ */
+ulonglong
+S9sStringInterner::memoryUsage()
+{
+    S9sMutexLocker locker(mutex());
+
+    return sm_memoryUsage;
+}
+
+/**
+ * \param slot Returns the slot where the string is or where it should be
+ *   added.
+ * \returns The string from the pool or NULL if it is not in the pool.
+ *
+ * The slots only change from NULL to a string that is never changed or
+ * released, so this can be called without holding the lock.
+ */
+const S9sString *
+S9sStringInterner::find(
+        const char *theString,
+        size_t      length,
+        uint        hashValue,
+        uint       &slot)
+{
+    const uint mask = INTERNER_SLOTS - 1;
+
+    for (slot = hashValue & mask; ; slot = (slot + 1) & mask)
+    {
+        const S9sString *entry = 
+            sm_slots[slot].load(std::memory_order_acquire);
+
+        if (entry == NULL)
+            return NULL;
+
+        if (entry->length() == length && 
+                memcmp(entry->c_str(), theString, length) == 0)
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * The FNV-1a hash function.
+ */
+uint
+S9sStringInterner::hash(
+        const char *theString,
+        size_t      length)
+{
+    uint retval = 2166136261u;
+
+    for (size_t idx = 0; idx < length; ++idx)
+    {
+        retval ^= (unsigned char) theString[idx];
+        retval *= 16777619u;
+    }
+
+    return retval;
+}
+
+S9sMutex &
+S9sStringInterner::mutex()
+{
+    static S9sMutex retval;
+
+    return retval;
+}
@@ -0,0 +1,76 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sMutex"
+
+#include <atomic>
+
+/**
+ * A process-wide pool of strings that are stored only once. The property
+ * names in the controller replies ("hostname", "cluster_id", "class_name"...)
+ * are repeated in every object, the JSon parser interns them, so every key is
+ * a pointer to the same string and two interned keys can be compared by 
+ * comparing the pointers. The keys used to look up the elements of the maps
+ * are only searched in the pool, they are never added.
+ *
+ * The interned strings are never released. To keep the pool small long 
+ * strings are not interned and the pool has a fixed capacity, when it is 
+ * full intern() returns NULL and the caller has to store the string itself.
+ * Finding a string in the pool needs no lock, only adding a new string does.
+ */
+class S9sStringInterner
+{
+    public:
+        static const S9sString *intern(const S9sString &theString);
+        
+        static const S9sString *intern(
+                const char *theString, 
+                size_t      length);
+
+        static const S9sString *intern(
+                const char *theString, 
+                size_t      length,
+                uint        hashValue);
+
+        static const S9sString *lookup(
+                const char *theString, 
+                size_t      length,
+                uint        hashValue);
+
+        static uint nStrings();
+        static ulonglong memoryUsage();
+        
+        static uint hash(const char *theString, size_t length);
+
+    private:
+        static const S9sString *find(
+                const char *theString, 
+                size_t      length,
+                uint        hashValue,
+                uint       &slot);
+        static S9sMutex &mutex();
+
+    private:
+        static std::atomic<const S9sString *>  sm_slots[];
+        static uint                            sm_nStrings;
+        static ulonglong                       sm_memoryUsage;
+};
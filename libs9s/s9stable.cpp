@@ -0,0 +1,363 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9stable.h"
+#include "S9sOutput"
+
+#include <stdio.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+S9sTable::S9sTable() :
+    m_nRows(0),
+    m_maxWidth(0),
+    m_headerVisible(true),
+    m_headerColorBegin(""),
+    m_headerColorEnd("")
+{
+}
+
+/**
+ * \param header The text printed in the header line for this column.
+ * \param alignment How the string values are aligned in the column. Integer
+ *   values are always aligned to the right, just like S9sFormat::printf()
+ *   does. The header is always aligned to the left.
+ *
+ * Adds a new column to the table. The columns has to be added before the
+ * first row is added.
+ */
+void
+S9sTable::addColumn(
+        const S9sString      &header,
+        S9sFormat::Alignment  alignment)
+{
+    m_headers    << header;
+    m_alignments << alignment;
+    m_widths     << 0;
+}
+
+void
+S9sTable::setHeaderColor(
+        const char *colorBegin,
+        const char *colorEnd)
+{
+    m_headerColorBegin = colorBegin;
+    m_headerColorEnd   = colorEnd;
+}
+
+/**
+ * Sets if the header line should be printed. The header texts are only
+ * considered when the column widths are calculated if the header is visible.
+ */
+void
+S9sTable::setHeaderVisible(
+        bool visible)
+{
+    m_headerVisible = visible;
+}
+
+/**
+ * \param maxWidth The width of the terminal or 0 if the lines should not be
+ *   truncated.
+ *
+ * If the maximum width is set the last column will be truncated so that the
+ * lines fit into the given width.
+ */
+void
+S9sTable::setMaxWidth(
+        int maxWidth)
+{
+    m_maxWidth = maxWidth;
+}
+
+/**
+ * Starts a new row, the cells added after this call will go into this new
+ * row. If the previous row has fewer cells than columns it is completed with
+ * empty cells.
+ */
+void
+S9sTable::addRow()
+{
+    closeRow();
+    ++m_nRows;
+}
+
+void
+S9sTable::addCell(
+        const S9sString &value,
+        const char      *colorBegin,
+        const char      *colorEnd)
+{
+    int column = m_cells.size() % m_widths.size();
+
+    addCell(value, colorBegin, colorEnd, m_alignments[column]);
+}
+
+void
+S9sTable::addCell(
+        const int        value,
+        const char      *colorBegin,
+        const char      *colorEnd)
+{
+    S9sString tmp;
+
+    tmp.sprintf("%d", value);
+    addCell(tmp, colorBegin, colorEnd, S9sFormat::AlignRight);
+}
+
+/**
+ * \returns How many columns the table has.
+ */
+int
+S9sTable::nColumns() const
+{
+    return (int) m_widths.size();
+}
+
+/**
+ * \returns How many rows were added to the table.
+ */
+int
+S9sTable::nRows() const
+{
+    return m_nRows;
+}
+
+/**
+ * \returns The width of the widest cell in the given column, the header not
+ *   considered.
+ */
+int
+S9sTable::columnWidth(
+        const int column) const
+{
+    if (column < 0 || column >= (int) m_widths.size())
+        return 0;
+
+    return m_widths[column];
+}
+
+/**
+ * \returns The whole table rendered into one string, the header line first if
+ *   the header is visible, then one line for every row.
+ */
+S9sString
+S9sTable::toString() const
+{
+    S9sString        retval;
+    S9sVector<int>   widths = m_widths;
+    int              lastColumn = (int) widths.size() - 1;
+    int              fixedWidth = 0;
+    uint             nCells;
+
+    if (lastColumn < 0)
+        return retval;
+
+    nCells = m_nRows * widths.size();
+
+    if (m_headerVisible)
+    {
+        for (int column = 0; column <= lastColumn; ++column)
+        {
+            int length = m_headers[column].terminalLength();
+
+            if (length > widths[column])
+                widths[column] = length;
+        }
+    }
+
+    for (int column = 0; column < lastColumn; ++column)
+        fixedWidth += widths[column] + 1;
+
+    retval.reserve((fixedWidth + 32) * (m_nRows + 1));
+
+    /*
+     * The header line.
+     */
+    if (m_headerVisible)
+    {
+        retval += m_headerColorBegin;
+        for (int column = 0; column < lastColumn; ++column)
+        {
+            appendPadded(
+                    retval, m_headers[column], 
+                    m_headers[column].terminalLength(), widths[column],
+                    S9sFormat::AlignLeft);
+
+            retval += ' ';
+        }
+
+        retval += m_headers[lastColumn];
+        retval += m_headerColorEnd;
+        retval += '\n';
+    }
+
+    /*
+     * The rows. The cells are in one vector, the last row might be incomplete
+     * if no cells were added after the last addRow() call.
+     */
+    for (uint idx = 0u; idx < nCells; ++idx)
+    {
+        int  column = idx % widths.size();
+        bool exists = idx < m_cells.size();
+
+        if (column < lastColumn)
+        {
+            if (exists)
+            {
+                const Cell &cell = m_cells[idx];
+
+                retval += cell.colorBegin;
+                appendPadded(
+                        retval, cell.text, cell.length, widths[column], 
+                        cell.alignment);
+
+                retval += ' ';
+                retval += cell.colorEnd;
+            } else {
+                retval.append(widths[column] + 1, ' ');
+            }
+
+            continue;
+        }
+
+        if (exists)
+        {
+            const Cell &cell = m_cells[idx];
+
+            retval += cell.colorBegin;
+
+            if (m_maxWidth > 0 && fixedWidth < m_maxWidth &&
+                    m_maxWidth - fixedWidth < cell.length)
+            {
+                retval += cell.text.terminalLeft(m_maxWidth - fixedWidth - 1);
+                retval += "…";
+            } else {
+                retval += cell.text;
+            }
+
+            retval += cell.colorEnd;
+        }
+
+        retval += '\n';
+    }
+
+    return retval;
+}
+
+/**
+ * Prints the table to the standard output in one write.
+ */
+void
+S9sTable::print() const
+{
+    S9sOutput::write(toString());
+}
+
+void
+S9sTable::addCell(
+        const S9sString      &value,
+        const char           *colorBegin,
+        const char           *colorEnd,
+        S9sFormat::Alignment  alignment)
+{
+    int  column;
+    Cell cell;
+
+    if (m_widths.empty())
+    {
+        S9S_WARNING("No columns in the table.");
+        return;
+    }
+
+    if (m_nRows == 0)
+        m_nRows = 1;
+
+    column = m_cells.size() % m_widths.size();
+    if (m_cells.size() >= m_nRows * m_widths.size())
+    {
+        S9S_WARNING("Too many cells in row %d.", m_nRows - 1);
+        return;
+    }
+
+    cell.text       = value;
+    cell.length     = value.terminalLength();
+    cell.colorBegin = colorBegin != NULL ? colorBegin : "";
+    cell.colorEnd   = colorEnd != NULL ? colorEnd : "";
+    cell.alignment  = alignment;
+
+    if (cell.length > m_widths[column])
+        m_widths[column] = cell.length;
+
+    m_cells.push_back(cell);
+}
+
+/**
+ * Completes the current row with empty cells so that the next cell added goes
+ * into the first column of the next row.
+ */
+void
+S9sTable::closeRow()
+{
+    Cell empty;
+
+    empty.length     = 0;
+    empty.colorBegin = "";
+    empty.colorEnd   = "";
+    empty.alignment  = S9sFormat::AlignLeft;
+
+    while (m_cells.size() < m_nRows * m_widths.size())
+        m_cells.push_back(empty);
+}
+
+/**
+ * Appends the value to the output padded with spaces to the given width. The
+ * length is the number of characters the value occupies on the terminal.
+ */
+void
+S9sTable::appendPadded(
+        S9sString            &output,
+        const S9sString      &value,
+        const int             length,
+        const int             width,
+        S9sFormat::Alignment  alignment)
+{
+    int padding = width > length ? width - length : 0;
+
+    switch (alignment)
+    {
+        case S9sFormat::AlignRight:
+            output.append(padding, ' ');
+            output += value;
+            break;
+
+        case S9sFormat::AlignCenter:
+            output.append(padding / 2, ' ');
+            output += value;
+            output.append(padding - padding / 2, ' ');
+            break;
+
+        case S9sFormat::AlignLeft:
+            output += value;
+            output.append(padding, ' ');
+            break;
+    }
+}
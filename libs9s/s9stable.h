@@ -0,0 +1,103 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVector"
+#include "S9sFormat"
+
+/**
+ * A table of preformatted cells for the long list printers. The rows are
+ * collected in one pass, the column widths are calculated while the cells are
+ * added and the whole table is rendered into one string that is written to the
+ * standard output with a single fwrite() call.
+ *
+ * The last column is the free text column (e.g. COMMENT or TITLE), it is not
+ * padded and it is truncated if the line would be wider than the maximum
+ * width set by setMaxWidth().
+ */
+class S9sTable 
+{
+    public:
+        S9sTable();
+
+        void addColumn(
+                const S9sString      &header,
+                S9sFormat::Alignment  alignment = S9sFormat::AlignLeft);
+
+        void setHeaderColor(const char *colorBegin, const char *colorEnd);
+        void setHeaderVisible(bool visible);
+        void setMaxWidth(int maxWidth);
+
+        void addRow();
+
+        void addCell(
+                const S9sString &value,
+                const char      *colorBegin = "",
+                const char      *colorEnd   = "");
+
+        void addCell(
+                const int        value,
+                const char      *colorBegin = "",
+                const char      *colorEnd   = "");
+
+        int nColumns() const;
+        int nRows() const;
+        int columnWidth(const int column) const;
+
+        S9sString toString() const;
+        void print() const;
+
+    private:
+        void addCell(
+                const S9sString      &value,
+                const char           *colorBegin,
+                const char           *colorEnd,
+                S9sFormat::Alignment  alignment);
+
+        void closeRow();
+
+        static void appendPadded(
+                S9sString            &output,
+                const S9sString      &value,
+                const int             length,
+                const int             width,
+                S9sFormat::Alignment  alignment);
+
+    private:
+        struct Cell
+        {
+            S9sString             text;
+            int                   length;
+            const char           *colorBegin;
+            const char           *colorEnd;
+            S9sFormat::Alignment  alignment;
+        };
+
+        S9sVector<S9sString>              m_headers;
+        S9sVector<S9sFormat::Alignment>   m_alignments;
+        S9sVector<int>                    m_widths;
+        S9sVector<Cell>                   m_cells;
+        int                               m_nRows;
+        int                               m_maxWidth;
+        bool                              m_headerVisible;
+        const char                       *m_headerColorBegin;
+        const char                       *m_headerColorEnd;
+};
@@ -9,6 +9,15 @@
 //#define WARNING
 #include "s9sdebug.h"
 
+S9sThread::S9sThread() :
+    m_state(Created),
+    m_retval(0)
+{
+}
+
+S9sThread::~S9sThread()
+{
+}
 
 /**
  * \returns true if the thread was successfully started, false on an error
@@ -19,15 +28,36 @@ bool
 S9sThread::start()
 {
     S9S_DEBUG("");
+    m_state = Starting;
     if (pthread_create(&m_thread, NULL, S9sThread::threadEntryPoint, this))
     {
         S9S_WARNING("pthread_create() failed: %m");
+        m_state = Created;
         return false;
     }
 
     return true;
 }
 
+/**
+ * \returns The value returned by the exec() method of the thread.
+ *
+ * Waits until the thread finishes. Returns immediately if the thread was never
+ * started.
+ */
+int
+S9sThread::wait()
+{
+    if (m_state == Created || m_state == Stopped)
+        return m_retval;
+
+    if (pthread_join(m_thread, NULL) != 0)
+        S9S_WARNING("pthread_join() failed: %m");
+
+    m_state = Stopped;
+    return m_retval;
+}
+
 int
 S9sThread::exec()
 {
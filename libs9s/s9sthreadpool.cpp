@@ -0,0 +1,333 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "s9sthreadpool.h"
+
+#include "S9sThread"
+#include "S9sMutexLocker"
+
+#include <deque>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * One worker thread of the S9sThreadPool with its own queue of tasks. The
+ * worker takes the tasks from the back of its queue, the other workers steal
+ * from the front.
+ */
+class S9sThreadPoolWorker : public S9sThread
+{
+    public:
+        S9sThreadPoolWorker(
+                S9sThreadPool *pool,
+                uint           index) :
+            S9sThread(),
+            m_pool(pool),
+            m_index(index)
+        {
+        }
+
+        void 
+        push(
+                S9sRunnable *task)
+        {
+            S9sMutexLocker locker(m_queueMutex);
+
+            m_queue.push_back(task);
+        }
+
+        S9sRunnable *
+        popBack()
+        {
+            S9sMutexLocker locker(m_queueMutex);
+            S9sRunnable   *retval = NULL;
+
+            if (!m_queue.empty())
+            {
+                retval = m_queue.back();
+                m_queue.pop_back();
+            }
+
+            return retval;
+        }
+
+        S9sRunnable *
+        popFront()
+        {
+            S9sMutexLocker locker(m_queueMutex);
+            S9sRunnable   *retval = NULL;
+
+            if (!m_queue.empty())
+            {
+                retval = m_queue.front();
+                m_queue.pop_front();
+            }
+
+            return retval;
+        }
+
+    protected:
+        virtual int 
+        exec()
+        {
+            S9sRunnable *task;
+            int          nTasks = 0;
+
+            while ((task = m_pool->takeTask(m_index)) != NULL)
+            {
+                if (!task->isCancelled())
+                    task->run();
+
+                delete task;
+                m_pool->taskFinished();
+                ++nTasks;
+            }
+
+            return nTasks;
+        }
+
+    private:
+        S9sThreadPool              *m_pool;
+        uint                        m_index;
+        std::deque<S9sRunnable *>   m_queue;
+        S9sMutex                    m_queueMutex;
+};
+
+/*
+ * S9sRunnable
+ */
+S9sRunnable::S9sRunnable()
+{
+}
+
+/**
+ * \param token The token that may cancel the task, usually a copy of the token
+ *   the caller keeps.
+ */
+S9sRunnable::S9sRunnable(
+        const S9sCancellationToken &token) :
+    m_token(token)
+{
+}
+
+S9sRunnable::~S9sRunnable()
+{
+}
+
+bool
+S9sRunnable::isCancelled() const
+{
+    return m_token.isCancelled();
+}
+
+S9sCancellationToken
+S9sRunnable::cancellationToken() const
+{
+    return m_token;
+}
+
+/*
+ * S9sThreadPool
+ */
+
+/**
+ * \param nThreads The number of the worker threads, at least one is started.
+ */
+S9sThreadPool::S9sThreadPool(
+        int nThreads) :
+    m_nextWorker(0u),
+    m_nPending(0),
+    m_nActive(0),
+    m_stopping(false)
+{
+    int nStarted = 0;
+
+    if (nThreads < 1)
+        nThreads = 1;
+
+    /*
+     * The workers read the list of the workers while stealing, so the list is
+     * complete before the first one is started. A worker that could not be
+     * started is kept in the list, the others steal the tasks from its queue.
+     */
+    for (int idx = 0; idx < nThreads; ++idx)
+        m_workers << new S9sThreadPoolWorker(this, idx);
+
+    for (uint idx = 0u; idx < m_workers.size(); ++idx)
+    {
+        if (m_workers[idx]->start())
+            ++nStarted;
+    }
+
+    if (nStarted == 0)
+    {
+        for (uint idx = 0u; idx < m_workers.size(); ++idx)
+            delete m_workers[idx];
+
+        m_workers.clear();
+    }
+}
+
+/**
+ * The destructor waits for the tasks that are already running, the tasks that
+ * are still in the queues are deleted without running them.
+ */
+S9sThreadPool::~S9sThreadPool()
+{
+    stop();
+}
+
+/**
+ * \returns The number of the worker threads that are running.
+ */
+int
+S9sThreadPool::nThreads() const
+{
+    return (int) m_workers.size();
+}
+
+/**
+ * \param task The task to execute, the pool takes the ownership.
+ * \returns True if the task is queued, false if the pool has no threads (the
+ *   task is deleted then).
+ */
+bool
+S9sThreadPool::submit(
+        S9sRunnable *task)
+{
+    uint index;
+
+    m_mutex.lock();
+    if (m_workers.empty() || m_stopping)
+    {
+        m_mutex.unlock();
+        delete task;
+        return false;
+    }
+
+    index = m_nextWorker++ % m_workers.size();
+    m_workers[index]->push(task);
+    ++m_nPending;
+    m_mutex.notifyAll();
+    m_mutex.unlock();
+
+    return true;
+}
+
+/**
+ * Waits until all the submitted tasks are done.
+ */
+void
+S9sThreadPool::waitForDone()
+{
+    S9sMutexLocker locker(m_mutex);
+
+    while (m_nPending > 0 || m_nActive > 0)
+        m_mutex.wait();
+}
+
+/**
+ * Stops the worker threads. The running tasks are finished, the queued ones
+ * are dropped.
+ */
+void
+S9sThreadPool::stop()
+{
+    S9sRunnable *task;
+
+    m_mutex.lock();
+    m_stopping = true;
+    m_mutex.notifyAll();
+    m_mutex.unlock();
+
+    for (uint idx = 0u; idx < m_workers.size(); ++idx)
+        m_workers[idx]->wait();
+
+    for (uint idx = 0u; idx < m_workers.size(); ++idx)
+    {
+        while ((task = m_workers[idx]->popFront()) != NULL)
+            delete task;
+
+        delete m_workers[idx];
+    }
+
+    m_mutex.lock();
+    m_workers.clear();
+    m_nPending = 0;
+    m_mutex.notifyAll();
+    m_mutex.unlock();
+}
+
+/**
+ * \param workerIndex The index of the worker that asks for a task.
+ * \returns The next task for the worker or NULL if the pool is stopping.
+ *
+ * Blocks until a task is found in the queue of the worker or in the queue of
+ * any other worker.
+ */
+S9sRunnable *
+S9sThreadPool::takeTask(
+        uint workerIndex)
+{
+    S9sRunnable *retval;
+
+    for (;;)
+    {
+        retval = m_workers[workerIndex]->popBack();
+
+        for (uint idx = 1u; retval == NULL && idx < m_workers.size(); ++idx)
+        {
+            uint victim = (workerIndex + idx) % m_workers.size();
+
+            retval = m_workers[victim]->popFront();
+        }
+
+        S9sMutexLocker locker(m_mutex);
+
+        if (retval != NULL)
+            --m_nPending;
+
+        // The tasks that are still in the queues are dropped when stopping.
+        if (m_stopping)
+        {
+            delete retval;
+            return NULL;
+        }
+
+        if (retval != NULL)
+        {
+            ++m_nActive;
+            return retval;
+        }
+
+        if (m_nPending == 0)
+            m_mutex.wait();
+    }
+}
+
+void
+S9sThreadPool::taskFinished()
+{
+    S9sMutexLocker locker(m_mutex);
+
+    --m_nActive;
+    m_mutex.notifyAll();
+}
@@ -0,0 +1,81 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016  Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * S9sTools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "S9sVector"
+#include "S9sMutex"
+#include "S9sCancellationToken"
+
+class S9sThreadPoolWorker;
+
+/**
+ * One piece of work for the S9sThreadPool. The pool deletes the task when it
+ * is done. If the cancellation token of the task is cancelled before a worker
+ * takes the task the run() method is not called at all, long tasks should
+ * check isCancelled() between their steps.
+ */
+class S9sRunnable
+{
+    public:
+        S9sRunnable();
+        S9sRunnable(const S9sCancellationToken &token);
+        virtual ~S9sRunnable();
+
+        virtual void run() = 0;
+
+        bool isCancelled() const;
+        S9sCancellationToken cancellationToken() const;
+
+    private:
+        S9sCancellationToken  m_token;
+};
+
+/**
+ * A fixed size set of worker threads executing S9sRunnable tasks. Every worker
+ * has its own queue, the tasks are distributed among them and a worker that
+ * runs out of tasks steals from the queues of the others, so one slow task
+ * does not hold up the tasks queued behind it.
+ */
+class S9sThreadPool
+{
+    public:
+        S9sThreadPool(int nThreads);
+        ~S9sThreadPool();
+
+        int nThreads() const;
+
+        bool submit(S9sRunnable *task);
+        void waitForDone();
+        void stop();
+
+    private:
+        S9sRunnable *takeTask(uint workerIndex);
+        void taskFinished();
+
+    private:
+        S9sVector<S9sThreadPoolWorker *>  m_workers;
+        uint                              m_nextWorker;
+        int                               m_nPending;
+        int                               m_nActive;
+        bool                              m_stopping;
+        S9sMutex                          m_mutex;
+
+    friend class S9sThreadPoolWorker;
+};
@@ -18,12 +18,14 @@
  * along with S9sTools. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "s9stopui.h"
+#include "S9sOutput"
 
 #include "S9sRpcClient"
 #include "S9sOptions"
 #include "S9sDateTime"
 #include "S9sMutexLocker"
 #include "S9sSqlProcess"
+#include "S9sRpcFuture"
 
 #include <cstdio>
 #include <unistd.h>
@@ -36,6 +38,73 @@
         
 struct termios orig_termios;
 
+/**
+ * The number of requests the top sends to the controller in parallel.
+ */
+#define TOP_PARALLEL_REQUESTS 3
+
+/**
+ * One request of the S9sTopUi executed by the thread pool through its own copy
+ * of the session. The reply is received through the future of the task.
+ */
+class S9sTopUiRequest : public S9sRunnable
+{
+    public:
+        enum Request
+        {
+            CpuStats,
+            MemoryStats,
+            RunningProcesses
+        };
+
+        S9sTopUiRequest(
+                Request                     request,
+                const S9sRpcClient         &client,
+                int                         clusterId,
+                const S9sCancellationToken &token) :
+            S9sRunnable(token),
+            m_request(request),
+            m_client(client.sessionCopy()),
+            m_clusterId(clusterId)
+        {
+        }
+
+        S9sRpcFuture 
+        future() const
+        {
+            return m_promise.future();
+        }
+
+        virtual void
+        run()
+        {
+            bool success = false;
+
+            switch (m_request)
+            {
+                case CpuStats:
+                    success = m_client.getCpuStats(m_clusterId);
+                    break;
+
+                case MemoryStats:
+                    success = m_client.getMemoryStats(m_clusterId);
+                    break;
+
+                case RunningProcesses:
+                    success = m_client.getRunningProcesses();
+                    break;
+            }
+
+            m_promise.setValue(success, m_client);
+        }
+
+    private:
+        Request         m_request;
+        S9sRpcClient    m_client;
+        int             m_clusterId;
+        S9sRpcPromise   m_promise;
+};
+
 S9sTopUi::S9sTopUi(
         S9sRpcClient       &client,
         S9sTopUi::ViewMode  viewMode) :
@@ -46,6 +115,7 @@ S9sTopUi::S9sTopUi(
     m_clustersReplyReceived(0),
     m_clusterId(0),
     m_sortOrder(CpuUsage),
+    m_threadPool(TOP_PARALLEL_REQUESTS),
     m_communicating(false),
     m_viewDebug(false),
     m_reloadRequested(false)
@@ -118,7 +188,7 @@ S9sTopUi::processButton(
             // The reload/abort button.
             if (m_communicating)
             {
-                m_communicating = false;
+                m_cancellation.cancel();
             } else {
                 m_reloadRequested = true;
             }
@@ -166,36 +236,36 @@ S9sTopUi::printHeader()
     if (!m_clusterName.empty())
     {
         title.sprintf("%s (s9s top)", STR(m_clusterName));
-        printf("%s%s%s", "\033]0;", STR(title), "\007");
+        S9sOutput::printf("%s%s%s", "\033]0;", STR(title), "\007");
     }
 
     title = "S9S TOP";
-    ::printf("%s%s%s ", TERM_SCREEN_TITLE_BOLD, STR(title), TERM_SCREEN_TITLE);
-    ::printf("%c ", rotatingCharacter());
-    ::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
+    S9sOutput::printf("%s%s%s ", TERM_SCREEN_TITLE_BOLD, STR(title), TERM_SCREEN_TITLE);
+    S9sOutput::printf("%c ", rotatingCharacter());
+    S9sOutput::printf("%s ", STR(dt.toString(S9sDateTime::LongTimeFormat)));
 
     // Printing the network activity character.
     if (m_communicating || m_reloadRequested)
-        ::printf("❌ ");
+        S9sOutput::printf("❌ ");
     else
-        ::printf("⟳ ");
+        S9sOutput::printf("⟳ ");
 
     if (m_nReplies > 0)
     {
-        ::printf("%s - ", STR(m_clusterName));
-        ::printf("%s ", STR(m_clustersReply.clusterStatusText(m_clusterId)));
+        S9sOutput::printf("%s - ", STR(m_clusterName));
+        S9sOutput::printf("%s ", STR(m_clustersReply.clusterStatusText(m_clusterId)));
 
     } else {
-        ::printf("            ");
+        S9sOutput::printf("            ");
     }
    
     // If we are in debug mode we print a few internals that help us in
     // development.
     if (m_viewDebug)
     {
-        ::printf("0x%02x ",      lastKeyCode());
-        ::printf("%02dx%02d ",   width(), height());
-        ::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
+        S9sOutput::printf("0x%02x ",      lastKeyCode());
+        S9sOutput::printf("%02dx%02d ",   width(), height());
+        S9sOutput::printf("%02d:%03d,%03d ", m_lastButton, m_lastX, m_lastY);
     }
         
     printNewLine();
@@ -315,24 +385,24 @@ S9sTopUi::printSqlProcesses(
         commandFormat.printf(command);
         timeFormat.printf(time);
 
-        ::printf("%s", XTERM_COLOR_ORANGE);
+        S9sOutput::printf("%s", XTERM_COLOR_ORANGE);
         userFormat.printf(user);
-        ::printf("%s", TERM_NORMAL);
+        S9sOutput::printf("%s", TERM_NORMAL);
 
 
-        ::printf("%s", XTERM_COLOR_GREEN);
+        S9sOutput::printf("%s", XTERM_COLOR_GREEN);
         hostNameFormat.printf(hostName);
-        ::printf("%s", TERM_NORMAL);
+        S9sOutput::printf("%s", TERM_NORMAL);
 
         instanceFormat.printf(instance);
 
         if (!query.empty())
         {
-            ::printf("%s",  XTERM_COLOR_SQL);
-            ::printf("%s ", STR(query));
-            ::printf("%s",  TERM_NORMAL);
+            S9sOutput::printf("%s",  XTERM_COLOR_SQL);
+            S9sOutput::printf("%s ", STR(query));
+            S9sOutput::printf("%s",  TERM_NORMAL);
         } else {
-            ::printf("- ");
+            S9sOutput::printf("- ");
         }
 
         printNewLine();
@@ -348,36 +418,6 @@ S9sTopUi::printSqlProcesses(
 
 }
 
-static bool 
-compareProcessPid(
-        const S9sProcess &a,
-        const S9sProcess &b)
-{
-    return a.pid() < b.pid();
-}
-
-static bool 
-compareProcessCpu(
-        const S9sProcess &a,
-        const S9sProcess &b)
-{
-    if (a.cpuUsage() == b.cpuUsage())
-        return a.pid() > b.pid();
-
-    return a.cpuUsage() > b.cpuUsage();
-}
-
-static bool 
-compareProcessMem(
-        const S9sProcess &a,
-        const S9sProcess &b)
-{
-    if (a.memUsage() == b.memUsage())
-        return a.pid() > b.pid();
-
-    return a.memUsage() > b.memUsage();
-}
-
 /**
  * \param maxLines The number of lines we have on the screen for the printout.
  *
@@ -388,7 +428,6 @@ void
 S9sTopUi::printProcesses(
         int maxLines)
 {
-    S9sOptions     *options = S9sOptions::instance();
     S9sFormat       pidFormat;
     S9sFormat       userFormat(userColorBegin(), userColorEnd());
     S9sFormat       hostFormat(XTERM_COLOR_GREEN, TERM_NORMAL);
@@ -399,57 +438,64 @@ S9sTopUi::printProcesses(
     S9sFormat       cpuFormat;
     S9sFormat       memFormat;
     S9sFormat       commandFormat("\033[1;2m\033[38;5;46m", TERM_NORMAL);
-    int             nLines;
+    S9sProcessTable::SortOrder      order = S9sProcessTable::CpuUsage;
+    S9sVector<const S9sProcessTable::Row *> rows;
+    S9sVector<S9sString>            cpuUsages;
+    S9sVector<S9sString>            memUsages;
+    S9sVector<S9sString>            virtMems;
+    S9sVector<S9sString>            resMems;
+    uint                            maxRows;
 
     switch (m_sortOrder)
     {
         case PidOrder:
-            sort(m_processes.begin(), m_processes.end(), compareProcessPid);
+            order = S9sProcessTable::PidOrder;
             break;
 
         case CpuUsage:
-            sort(m_processes.begin(), m_processes.end(), compareProcessCpu);
+            order = S9sProcessTable::CpuUsage;
             break;
 
         case MemUsage:
-            sort(m_processes.begin(), m_processes.end(), compareProcessMem);
+            order = S9sProcessTable::MemUsage;
             break;
     }
+
+    /*
+     * Only the processes that fit on the screen are sorted and printed.
+     */
+    maxRows = maxLines > 0 ? maxLines : m_processTable.size();
+    m_processTable.selectRows(order, maxRows, rows);
     
     /*
      * Collecting data.
      */
-    nLines = 0;
-    for (uint idx = 0u; idx < m_processes.size(); ++idx)
+    for (uint idx = 0u; idx < rows.size(); ++idx)
     {
-        const S9sProcess  &process = m_processes[idx];
-        int           pid        = process.pid();
-        S9sString     user       = process.userName();
-        S9sString     hostName   = process.hostName();
-        int           priority   = process.priority();
-        S9sString     rss        = process.resMem("");
-        S9sString     virtMem    = process.virtMem("");
-        S9sString     cpuUsage   = process.cpuUsage("");
-        S9sString     memUsage   = process.memUsage("");
-        S9sString     executable = process.executable();
-
-        if (!options->isStringMatchExtraArguments(executable))
-            continue;
-
-        pidFormat.widen(pid);
-        userFormat.widen(user);
-        hostFormat.widen(hostName);
-        priorityFormat.widen(priority);
-        virtFormat.widen(virtMem);
-        resFormat.widen(rss);
-        cpuFormat.widen(cpuUsage);
-        memFormat.widen(memUsage);
-        commandFormat.widen(executable);
-
-        if (maxLines > 0 && nLines + 1 >= maxLines)
-            break;
-
-        ++nLines;
+        const S9sProcessTable::Row &row = *rows[idx];
+        S9sString                   value;
+
+        value.sprintf("%6.2f", row.m_cpuUsage);
+        cpuUsages << value;
+
+        value.sprintf("%6.2f", row.m_memUsage);
+        memUsages << value;
+
+        value.sprintf("%llu", row.m_virtMem / 1024);
+        virtMems << value;
+
+        value.sprintf("%llu", row.m_resMem / 1024);
+        resMems << value;
+
+        pidFormat.widen(row.m_pid);
+        userFormat.widen(row.m_userName);
+        hostFormat.widen(m_processTable.hostName(row));
+        priorityFormat.widen(row.m_priority);
+        virtFormat.widen(virtMems[idx]);
+        resFormat.widen(resMems[idx]);
+        cpuFormat.widen(cpuUsages[idx]);
+        memFormat.widen(memUsages[idx]);
+        commandFormat.widen(row.m_executable);
     }
 
     // Flickering of the widths is a bit annyoying, so we introduce some minimal
@@ -461,7 +507,7 @@ S9sTopUi::printProcesses(
     cpuFormat.setRightJustify();
     memFormat.setRightJustify();
     
-    if (!m_processes.empty())
+    if (!m_processTable.empty())
     {
         pidFormat.widen("PID");
         userFormat.widen("USER");
@@ -474,7 +520,7 @@ S9sTopUi::printProcesses(
         memFormat.widen("%MEM");
         commandFormat.widen("COMMAND");
 
-        printf("%s", TERM_SCREEN_HEADER);
+        S9sOutput::printf("%s", TERM_SCREEN_HEADER);
         pidFormat.printf("PID", false);
         userFormat.printf("USER", false);
         hostFormat.printf("HOST", false);
@@ -488,44 +534,24 @@ S9sTopUi::printProcesses(
         printNewLine();
     }
     
-    nLines = 0;
-    for (uint idx = 0u; idx < m_processes.size(); ++idx)
+    for (uint idx = 0u; idx < rows.size(); ++idx)
     {
-        const S9sProcess  &process = m_processes[idx];
-        int           pid        = process.pid();
-        S9sString     user       = process.userName();
-        S9sString     hostName   = process.hostName();
-        int           priority   = process.priority();
-
-        S9sString     cpuUsage   = process.cpuUsage("");
-        S9sString     memUsage   = process.memUsage("");
-        S9sString     state      = process.state();
-
-        S9sString     rss        = process.resMem("");
-        S9sString     virtMem    = process.virtMem("");
-        S9sString     executable = process.executable();
-        
-        if (!options->isStringMatchExtraArguments(executable))
-            continue;
+        const S9sProcessTable::Row &row = *rows[idx];
 
-        pidFormat.printf(pid);
-        userFormat.printf(user);
-        hostFormat.printf(hostName);
-        priorityFormat.printf(priority);
+        pidFormat.printf(row.m_pid);
+        userFormat.printf(row.m_userName);
+        hostFormat.printf(m_processTable.hostName(row));
+        priorityFormat.printf(row.m_priority);
 
-        virtFormat.printf(virtMem);
-        resFormat.printf(rss);
+        virtFormat.printf(virtMems[idx]);
+        resFormat.printf(resMems[idx]);
 
-        printf("%1s ", STR(state));
-        cpuFormat.printf(cpuUsage);
-        memFormat.printf(memUsage);
-        commandFormat.printf(executable);
+        S9sOutput::printf("%1s ", STR(row.m_state));
+        cpuFormat.printf(cpuUsages[idx]);
+        memFormat.printf(memUsages[idx]);
+        commandFormat.printf(row.m_executable);
 
         printNewLine();
-        if (maxLines > 0 && nLines + 1 >= maxLines)
-            break;
-
-        ++nLines;
     }
 }
 
@@ -538,19 +564,19 @@ S9sTopUi::printFooter()
     // Goint to the last line.
     for (;m_lineCounter < height() - 1; ++m_lineCounter)
     {
-        ::printf("\n\r");
-        ::printf("%s", TERM_ERASE_EOL);
+        S9sOutput::printf("\n\r");
+        S9sOutput::printf("%s", TERM_ERASE_EOL);
     } 
 
-    ::printf("%s ", normal);
-    ::printf("%sC%s-CPU Order ", bold, normal);
-    ::printf("%sM%s-Memory Order ", bold, normal);
-    ::printf("%sQ%s-Quit ", bold, normal);
+    S9sOutput::printf("%s ", normal);
+    S9sOutput::printf("%sC%s-CPU Order ", bold, normal);
+    S9sOutput::printf("%sM%s-Memory Order ", bold, normal);
+    S9sOutput::printf("%sQ%s-Quit ", bold, normal);
 
     // No new-line at the end, this is the last line.
-    ::printf("%s", TERM_ERASE_EOL);
-    ::printf("%s", TERM_NORMAL);
-    fflush(stdout);
+    S9sOutput::printf("%s", TERM_ERASE_EOL);
+    S9sOutput::printf("%s", TERM_NORMAL);
+    S9sOutput::flush();
 }
 
 void
@@ -604,7 +630,6 @@ S9sTopUi::getProcesses()
 {
     S9sMutexLocker         locker(m_networkMutex);
     S9sOptions            *options     = S9sOptions::instance();
-    S9sVariantList         hostList;
     S9sString              clusterStatusText;
     S9sRpcReply            reply;
     S9sRpcReply            clustersReply;
@@ -612,13 +637,19 @@ S9sTopUi::getProcesses()
     S9sRpcReply            cpuStatsReply;
     S9sRpcReply            memoryStatsReply;
     S9sRpcReply            processReply;
-    S9sVector<S9sProcess>  processes;
+    struct timespec        replyReceived;
     int                    clusterId;
     S9sString              clusterName;
     bool                   success = true;
 
+    S9sTopUiRequest       *request;
+    S9sRpcFuture           cpuStatsFuture;
+    S9sRpcFuture           memoryStatsFuture;
+    S9sRpcFuture           processFuture;
+
     m_communicating   = true;
     m_reloadRequested = false;
+    m_cancellation.reset();
 
     /*
      * The cluster information.
@@ -632,12 +663,18 @@ S9sTopUi::getProcesses()
         success = m_client.getCluster(clusterName, clusterId);
 
         // If the user aborted download.
-        if (!m_communicating)
+        if (m_cancellation.isCancelled())
+        {
+            m_communicating = false;
             return true;
+        }
 
         clustersReply = m_client.reply();
         if (!success)
+        {
+            m_communicating = false;
             return success;
+        }
 
         clustersReplyReceived = time(NULL);
     } else {
@@ -645,70 +682,54 @@ S9sTopUi::getProcesses()
     }
 
     /*
-     * The CPU statistics.
+     * The CPU statistics, the memory statistics and the list of the running
+     * processes do not depend on each other, they are requested in parallel.
      */
-    m_client.getCpuStats(clusterId);
-    
-    // If the user aborted download.
-    if (!m_communicating)
-        return true;
-
-    cpuStatsReply = m_client.reply();
+    request = new S9sTopUiRequest(
+            S9sTopUiRequest::CpuStats, m_client, clusterId, m_cancellation);
+    cpuStatsFuture = request->future();
+    m_threadPool.submit(request);
+
+    request = new S9sTopUiRequest(
+            S9sTopUiRequest::MemoryStats, m_client, clusterId, m_cancellation);
+    memoryStatsFuture = request->future();
+    m_threadPool.submit(request);
     
-    /*
-     * The memory statistics.
-     */
-    m_client.getMemoryStats(clusterId);
+    request = new S9sTopUiRequest(
+            S9sTopUiRequest::RunningProcesses, m_client, clusterId, 
+            m_cancellation);
+    processFuture = request->future();
+    m_threadPool.submit(request);
 
     // If the user aborted download.
-    if (!m_communicating)
-        return true;
-
-    memoryStatsReply = m_client.reply();
-    
-    /*
-     * Getting the list of the running processes.
-     */
-    m_client.getRunningProcesses();
-    
-    // If the user aborted download.
-    if (!m_communicating)
-        return true;
-
-    processReply = m_client.reply();
-    hostList = processReply["data"].toVariantList();
-    for (uint idx = 0u; idx < hostList.size(); ++idx)
+    if (!cpuStatsFuture.wait(m_cancellation) ||
+            !memoryStatsFuture.wait(m_cancellation) ||
+            !processFuture.wait(m_cancellation))
     {
-        S9sString hostName = hostList[idx]["hostname"].toString();
-        S9sVariantList processList = hostList[idx]["processes"].toVariantList();
-    
-        for (uint idx1 = 0u; idx1 < processList.size(); ++idx1)
-        {
-            S9sVariantMap processMap = processList[idx1].toVariantMap();
-            S9sProcess    process;
-
-            processMap["hostname"] = hostName;
-            process = processMap;
-            processes << process;
-        }
-
-        // If the user aborted download.
-        if (!m_communicating)
-            return true;
+        m_communicating = false;
+        return true;
     }
 
+    cpuStatsReply    = cpuStatsFuture.reply();
+    memoryStatsReply = memoryStatsFuture.reply();
+    processReply     = processFuture.reply();
+
     /*
      * Pushing the received data into the object so that the screen refresh can
-     * print them.
+     * print them. The process table is updated in place.
      */
     m_mutex.lock(); 
 
+    clock_gettime(CLOCK_MONOTONIC, &replyReceived);
+    m_processTable.update(
+            processReply["data"].toVariantList(), 
+            replyReceived.tv_sec + replyReceived.tv_nsec / 1000000000.0);
+
     m_clustersReply         = clustersReply;
     m_clustersReplyReceived = clustersReplyReceived;
     m_cpuStatsReply         = cpuStatsReply;
     m_memoryStatsReply      = memoryStatsReply;
     m_processReply          = processReply;
-    m_processes             = processes;
     m_clusterId             = clusterId;
     m_clusterName           = m_clustersReply.clusterName(m_clusterId);
 
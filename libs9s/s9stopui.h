@@ -24,9 +24,11 @@
 #include "S9sDisplay"
 #include "S9sFormatter"
 #include "S9sRpcReply"
-#include "S9sProcess"
+#include "S9sProcessTable"
 #include "S9sSqlProcess"
 #include "S9sVector"
+#include "S9sThreadPool"
+#include "S9sCancellationToken"
 
 class S9sRpcClient;
 
@@ -85,12 +87,14 @@ class S9sTopUi :
         S9sRpcReply            m_cpuStatsReply;
         S9sRpcReply            m_memoryStatsReply;
         S9sRpcReply            m_processReply;
-        S9sVector<S9sProcess>     m_processes;
+        S9sProcessTable           m_processTable;
         S9sVector<S9sSqlProcess>  m_sqlProcesses;
         int                       m_clusterId;
         S9sString                 m_clusterName;
 
         SortOrder              m_sortOrder;
+        S9sThreadPool          m_threadPool;
+        S9sCancellationToken   m_cancellation;
         bool                   m_communicating;
         bool                   m_viewDebug;
         bool                   m_reloadRequested;
@@ -84,13 +84,19 @@ S9sTreeNode::property(
  * \param properties The properties to be set as a name -> value mapping.
  *
  * Sets all the properties in one step. All the existing properties will be
- * deleted, then the new properties set.
+ * deleted, then the new properties set. The child nodes, the child index and
+ * the path cache built from the old properties are dropped too.
  */
 void
 S9sTreeNode::setProperties(
         const S9sVariantMap &properties)
 {
     m_properties = properties;
+
+    m_childNodes.clear();
+    m_childNodesParsed = false;
+    m_childIndex.clear();
+    m_pathCache.clear();
 }
 
 S9sString
@@ -298,19 +304,18 @@ S9sTreeNode::isDatabase() const
 
 bool
 S9sTreeNode::hasChild(
-        const S9sString &name)
+        const S9sString &name) const
 {
-    S9sVector<S9sTreeNode> nodes = childNodes();
-
-    for (uint idx = 0u; idx < nodes.size(); ++idx)
-    {
-        if (nodes[idx].name() == name)
-            return true;
-    }
-
-    return false;
+    return childIndex(name) >= 0;
 }
 
+/**
+ * \returns The child nodes parsed from the "sub_items" property.
+ *
+ * The child nodes are parsed only once, when this method is first called and
+ * the name -> index mapping is also created here so that the children can be
+ * found by name without walking the list.
+ */
 const S9sVector<S9sTreeNode> &
 S9sTreeNode::childNodes() const
 {
@@ -318,15 +323,42 @@ S9sTreeNode::childNodes() const
     {
         S9sVariantList  variantList = property("sub_items").toVariantList();
         
+        m_childNodes.reserve(variantList.size());
+
         for (uint idx = 0; idx < variantList.size(); ++idx)
+        {
             m_childNodes << S9sTreeNode(variantList[idx].toVariantMap());
 
+            // If the name is not unique the first one is found.
+            m_childIndex.insert(
+                    ChildIndex::value_type(m_childNodes.back().name(), idx));
+        }
+
         m_childNodesParsed = true;
     }
 
     return m_childNodes;
 }
 
+/**
+ * \returns The index of the child node with the given name or -1 if there is
+ *   no such child.
+ */
+int
+S9sTreeNode::childIndex(
+        const S9sString &name) const
+{
+    ChildIndex::const_iterator it;
+    
+    childNodes();
+
+    it = m_childIndex.find(name);
+    if (it == m_childIndex.end())
+        return -1;
+
+    return it->second;
+}
+
 int
 S9sTreeNode::nChildren() const
 {
@@ -350,11 +382,9 @@ S9sTreeNode::childNode(
  */
 bool
 S9sTreeNode::pathExists(
-        const S9sString   &path)
+        const S9sString   &path) const
 {
-    S9sTreeNode  tmp;
-
-    return subTree(path, tmp);
+    return findNode(path) != NULL;
 }
 
 /**
@@ -367,60 +397,104 @@ S9sTreeNode::subTree(
         const S9sString   &path,
         S9sTreeNode       &retval) const
 {
-    S9sVariantList pathList = path.split("/");
+    const S9sTreeNode *node = findNode(path);
 
-    if (pathList.size() > 0u)
+    if (node == NULL)
+        return false;
+
+    retval = *node;
+    return true;
+}
+
+/**
+ * \param path The path to find, relative to this node.
+ * \returns The node found on the path or NULL if the path does not exist.
+ *
+ * The path is walked one element at a time, the elements are looked up in the
+ * name index of the child nodes. The index chain of the paths found is stored
+ * in a cache, so the next lookup of the same path does not have to compare
+ * names at all. The cache holds the indexes and not the pointers, so it remains
+ * valid when the tree is copied.
+ */
+const S9sTreeNode *
+S9sTreeNode::findNode(
+        const S9sString &path) const
+{
+    static const uint          maxCacheSize = 4096u;
+    const S9sTreeNode         *node = this;
+    PathCache::const_iterator  cached = m_pathCache.find(path);
+    S9sVector<int>             indexes;
+    size_t                     start = 0;
+    
+    if (cached != m_pathCache.end())
     {
-        if (pathList[0u].toString() == "/")
-            pathList.takeFirst();
+        const S9sVector<int> &cachedIndexes = cached->second;
+
+        for (uint idx = 0u; idx < cachedIndexes.size(); ++idx)
+            node = &node->m_childNodes[cachedIndexes[idx]];
+
+        return node;
     }
 
-    if (pathList.size() == 0u)
+    while (start < path.length())
     {
-        retval = *this;
-        return true;
+        size_t end = path.find('/', start);
+        int    index;
+
+        if (end == S9sString::npos)
+            end = path.length();
+
+        if (end > start)
+        {
+            index = node->childIndex(path.substr(start, end - start));
+            if (index < 0)
+                return NULL;
+
+            indexes << index;
+            node = &node->m_childNodes[index];
+        }
+
+        start = end + 1;
     }
 
-    return subTree(pathList, retval);
+    if (m_pathCache.size() >= maxCacheSize)
+        m_pathCache.clear();
+
+    m_pathCache[path] = indexes;
+    return node;
 }
 
 /**
- * Overloaded private method for the recursive call.
+ * \param path The path of the sub-tree to replace.
+ * \param node The new sub-tree that will be put into the tree at the given
+ *   path.
+ * \returns True if the path was found and the sub-tree was replaced.
+ *
+ * This method can be used to update one branch of the tree when only that
+ * branch was downloaded from the controller. Please note that the "sub_items"
+ * property of the nodes above the changed branch are not updated, only the
+ * child nodes are.
  */
 bool
-S9sTreeNode::subTree(
-        const S9sVariantList  &pathList,
-        S9sTreeNode           &retval) const 
+S9sTreeNode::replaceSubTree(
+        const S9sString   &path,
+        const S9sTreeNode &node)
 {
-    // This can never happen, this is just a check against takeFirst() crash.
-    if (pathList.empty())
-        return false;
+    S9sVariantList  pathList = path.split("/");
+    S9sTreeNode    *current  = this;
 
-    /*
-     * We take the first element on the path.
-     */
-    S9sVariantList reducedList = pathList;
-    S9sString      nextName    = reducedList.takeFirst().toString();
-    const S9sVector<S9sTreeNode> &children = childNodes();
-       
-    for (uint idx = 0u; idx < children.size(); ++idx)
+    for (uint idx = 0u; idx < pathList.size(); ++idx)
     {
-        const S9sTreeNode &child = children[idx];
+        int index = current->childIndex(pathList[idx].toString());
 
-        if (child.name() == nextName)
-        {
-            // We found the next level belonging to the next element in the 
-            // path.
-            if (reducedList.empty())
-            {
-                retval = child;
-                return true;
-            }
-            
-            return child.subTree(reducedList, retval);
-        }
+        if (index < 0)
+            return false;
+
+        // The cached index chains going through this branch might be invalid.
+        current->m_pathCache.clear();
+        current = &current->m_childNodes[index];
     }
 
-    // The next item was not found.
-    return false;
+    *current = node;
+    return true;
 }
@@ -21,6 +21,8 @@
 
 #include "S9sVariantMap"
 
+#include <unordered_map>
+
 /**
  * A class that represents a node in the CDT as they are returned by the tree
  * RPC. 
@@ -69,24 +71,31 @@ class S9sTreeNode
         bool isDatabase() const;
 
         int nChildren() const;
-        bool hasChild(const S9sString &name);
+        bool hasChild(const S9sString &name) const;
 
 
         S9sTreeNode childNode(int idx) const;
 
         const S9sVector<S9sTreeNode> &childNodes() const;
 
-        bool pathExists(const S9sString &path);
+        bool pathExists(const S9sString &path) const;
         bool subTree(const S9sString &path, S9sTreeNode &retval) const;
+        bool replaceSubTree(const S9sString &path, const S9sTreeNode &node);
 
     private:
-        bool subTree(
-                const S9sVariantList  &pathList,
-                S9sTreeNode           &retval) const;
+        int childIndex(const S9sString &name) const;
+        const S9sTreeNode *findNode(const S9sString &path) const;
 
     private:
+        /** The name -> index mapping for the child nodes. */
+        typedef std::unordered_map<std::string, int> ChildIndex;
+        /** The full path -> child index chain mapping for the lookup cache. */
+        typedef std::unordered_map<std::string, S9sVector<int> > PathCache;
+
         S9sVariantMap                    m_properties;
         mutable S9sVector<S9sTreeNode>   m_childNodes;
         mutable bool                     m_childNodesParsed;
+        mutable ChildIndex               m_childIndex;
+        mutable PathCache                m_pathCache;
 };
 
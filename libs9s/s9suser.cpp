@@ -20,6 +20,7 @@
 #include "s9suser.h"
 
 #include "S9sFormatter"
+#include "S9sFormatTemplate"
 
 //#define DEBUG
 //#define WARNING
@@ -432,197 +433,138 @@ S9sString
 S9sUser::toString(
         const bool       syntaxHighlight,
         const S9sString &formatString) const
+{
+    return toString(
+            syntaxHighlight, S9sFormatTemplate::compiled(formatString, ""));
+}
+
+/**
+ * Converts the object to a string using a format template that is already
+ * compiled, see the other toString() for the format string itself.
+ */
+S9sString
+S9sUser::toString(
+        const bool               syntaxHighlight,
+        const S9sFormatTemplate &format) const
 {
     S9sFormatter formatter;
     S9sString    retval;
     S9sString    tmp;
-    char         c;
     S9sString    partFormat;
-    bool         percent      = false;
-    bool         escaped      = false;
 
-    for (uint n = 0; n < formatString.size(); ++n)
+    for (uint idx = 0; idx < format.size(); ++idx)
     {
-        c = formatString[n];
-       
-        if (c == '%' && !percent)
-        {
-            percent    = true;
-            partFormat = "%";
-            continue;
-        } else if (c == '\\' && !escaped)
+        const S9sFormatTemplate::Part &part = format.part(idx);
+
+        if (part.isLiteral())
         {
-            escaped = true;
+            retval += part.literal;
             continue;
         }
 
-        if (escaped)
-        {
-            switch (c)
-            {
-                case '\"':
-                    retval += '\"';
-                    break;
-
-                case '\\':
-                    retval += '\\';
-                    break;
-       
-                case 'a':
-                    retval += '\a';
-                    break;
-
-                case 'b':
-                    retval += '\b';
-                    break;
-
-                case 'e':
-                    retval += '\027';
-                    break;
-
-                case 'n':
-                    retval += '\n';
-                    break;
-
-                case 'r':
-                    retval += '\r';
-                    break;
-
-                case 't':
-                    retval += '\t';
-                    break;
-            }
-        } else if (percent)
+        partFormat = part.prefix;
+
+        switch (part.directive)
         {
-            switch (c)
-            {
-                case 'd':
-                    // The distinguished name of the user. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(distinguishedName("-")));
-                    retval += tmp;
-                    break;
-
-                case 'F':
-                    // The full name of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(fullName()));
-                    retval += tmp;
-                    break;
-                
-                case 'f':
-                    // The first name of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(firstName()));
-                    retval += tmp;
-                    break;
-                
-                case 'G':
-                    // The group names of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(groupNames()));
-                    retval += tmp;
-                    break;
-
-                case 'I':
-                    // The user ID.
-                    partFormat += 'd';
-                    tmp.sprintf(STR(partFormat), userId());
-                    retval += tmp;
-                    break;
-                
-                case 'j':
-                    // The job title of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(jobTitle()));
-                    retval += tmp;
-                    break;
-                
-                case 'l':
-                    // The last name of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(lastName()));
-                    retval += tmp;
-                    break;
-
-                case 'M':
-                    // The email address. 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(emailAddress("-")));
-                    retval += tmp;
-                    break;
-                
-                case 'm':
-                    // The middle name of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(middleName()));
-                    retval += tmp;
-                    break;
-                
-                case 'N':
-                    // The username of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(userName()));
-                    retval += tmp;
-                    break;
-                
-                case 'o':
-                    // The origin.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(origin("-")));
-                    retval += tmp;
-                    break;
-
-                case 'P':
-                    // The CDT path 
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(cdtPath()));
-
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorBegin();
-
-                    retval += tmp;
-
-                    if (syntaxHighlight)
-                        retval += formatter.folderColorEnd();
-
-                    break;
-
-                case 't':
-                    // The title of the user.
-                    partFormat += 's';
-                    tmp.sprintf(STR(partFormat), STR(title()));
-                    retval += tmp;
-                    break;
-
-                
-                case '%':
-                    retval += '%';
-                    break;
-
-                case '0':
-                case '1':
-                case '2':
-                case '3':
-                case '4':
-                case '5':
-                case '6':
-                case '7':
-                case '8':
-                case '9':
-                case '-':
-                case '+':
-                case '.':
-                case '\'':
-                    partFormat += c;
-                    continue;
-            }
-        } else {
-            retval += c;
+            case 'd':
+                // The distinguished name of the user. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(distinguishedName("-")));
+                retval += tmp;
+                break;
+
+            case 'F':
+                // The full name of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(fullName()));
+                retval += tmp;
+                break;
+            
+            case 'f':
+                // The first name of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(firstName()));
+                retval += tmp;
+                break;
+            
+            case 'G':
+                // The group names of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(groupNames()));
+                retval += tmp;
+                break;
+
+            case 'I':
+                // The user ID.
+                partFormat += 'd';
+                tmp.sprintf(STR(partFormat), userId());
+                retval += tmp;
+                break;
+            
+            case 'j':
+                // The job title of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(jobTitle()));
+                retval += tmp;
+                break;
+            
+            case 'l':
+                // The last name of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(lastName()));
+                retval += tmp;
+                break;
+
+            case 'M':
+                // The email address. 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(emailAddress("-")));
+                retval += tmp;
+                break;
+            
+            case 'm':
+                // The middle name of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(middleName()));
+                retval += tmp;
+                break;
+            
+            case 'N':
+                // The username of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(userName()));
+                retval += tmp;
+                break;
+            
+            case 'o':
+                // The origin.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(origin("-")));
+                retval += tmp;
+                break;
+
+            case 'P':
+                // The CDT path 
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(cdtPath()));
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorBegin();
+
+                retval += tmp;
+
+                if (syntaxHighlight)
+                    retval += formatter.folderColorEnd();
+
+                break;
+
+            case 't':
+                // The title of the user.
+                partFormat += 's';
+                tmp.sprintf(STR(partFormat), STR(title()));
+                retval += tmp;
+                break;
         }
-
-        percent      = false;
-        escaped      = false;
     }
 
     return retval;
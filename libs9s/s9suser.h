@@ -21,6 +21,8 @@
 
 #include "S9sObject"
 
+class S9sFormatTemplate;
+
 /**
  * A class that represents a user on the controller. 
  */
@@ -68,4 +70,8 @@ class S9sUser : public S9sObject
         S9sString toString(
                 const bool       syntaxHighlight,
                 const S9sString &formatString) const;
+
+        S9sString toString(
+                const bool               syntaxHighlight,
+                const S9sFormatTemplate &format) const;
 };
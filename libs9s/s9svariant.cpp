@@ -32,6 +32,7 @@
 #include "S9sContainer"
 #include "S9sAccount"
 #include "S9sDateTime"
+#include "S9sJsonWriter"
 
 //#define DEBUG
 //#define WARNING
@@ -99,6 +100,19 @@ S9sVariant::S9sVariant(
     }
 }
 
+/**
+ * The move constructor takes over the value of the original, which becomes
+ * invalid. The maps and lists move their elements when they grow, this way
+ * the values are not copied.
+ */
+S9sVariant::S9sVariant(
+        S9sVariant &&orig) noexcept :
+    m_type(orig.m_type),
+    m_union(orig.m_union)
+{
+    orig.m_type = Invalid;
+}
+
 /**
  * A constructor to create a variant that holds a node. Makes a copy of the node
  * object.
@@ -142,6 +156,35 @@ S9sVariant::S9sVariant(
     m_union.listValue = new S9sVariantList(listValue);
 }
 
+/**
+ * Creates a variant that takes over the buffer of the string, the string is
+ * left empty.
+ */
+S9sVariant::S9sVariant(
+        S9sString &&stringValue) :
+    m_type(String)
+{
+    m_union.stringValue = new S9sString(std::move(stringValue));
+}
+
+/**
+ * Creates a variant that takes over the elements of the map, the map is left
+ * empty.
+ */
+S9sVariant::S9sVariant(
+        S9sVariantMap &&mapValue) :
+    m_type(Map)
+{
+    m_union.mapValue = new S9sVariantMap(std::move(mapValue));
+}
+
+S9sVariant::S9sVariant(
+        S9sVariantList &&listValue) :
+    m_type(List)
+{
+    m_union.listValue = new S9sVariantList(std::move(listValue));
+}
+
 S9sVariant::~S9sVariant()
 {
     clear();
@@ -205,6 +248,25 @@ S9sVariant::operator=(
     return *this;
 }
 
+/**
+ * The move assignment, takes over the value of the right-hand-side.
+ */
+S9sVariant &
+S9sVariant::operator= (
+        S9sVariant &&rhs) noexcept
+{
+    if (this == &rhs)
+        return *this;
+
+    clear();
+
+    m_type      = rhs.m_type;
+    m_union     = rhs.m_union;
+    rhs.m_type  = Invalid;
+
+    return *this;
+}
+
 /**
  * \param rhs The right-hand-side of the operator.
  * \returns True if the two variants are holding equal values.
@@ -471,8 +533,7 @@ S9sVariant::operator[] (
         return this->operator[](index);
     } else if (m_type == Map)
     {
-        return m_union.mapValue->S9sMap<
-                S9sString, S9sVariant>::operator[](index);
+        return m_union.mapValue->S9sVariantMapBase::operator[](index);
     } 
    
     S9S_WARNING("Unhandled type %s", STR(typeName()));
@@ -1454,51 +1515,10 @@ S9sVariant::toJsonString(
         int                   depth,
         const S9sFormatFlags &formatFlags) const
 {
-    S9sString retval;
+    S9sString     retval;
+    S9sJsonWriter writer(retval);
    
-    if (formatFlags & S9sFormatColor)
-        retval += ansiColor();
-
-    switch (m_type)
-    {
-        case Invalid:
-            retval += "null";
-            break;
-
-        case Bool:
-            retval += toString();
-            break;
-
-        case Int:
-        case Double:
-        case Ulonglong:
-            retval += toString();
-            break;
-
-        case String:
-            retval += quote(toString(), formatFlags);
-            break;
-
-        case List:
-            retval += toVariantList().toJsonString(depth, formatFlags);
-            break;
-        
-        case Map:
-            retval += toVariantMap().toJsonString(depth, formatFlags);
-            break;
-
-        case Node:
-        case Container:
-        case Account:
-            retval += toVariantMap().toJsonString(depth, formatFlags);
-            break;
-    }
-           
-    if (formatFlags & S9sFormatColor)
-        retval += TERM_NORMAL;
-
-    //retval += typeName();
-
+    writer.writeJson(*this, depth, formatFlags);
     return retval;
 }
 
@@ -1529,51 +1549,10 @@ S9sVariant::quote(
         const S9sString &s,
         const S9sFormatFlags &formatFlags)
 {
-    S9sString   retval;
-    const char *colorBegin  = "";
-    const char *colorEnd    = "";
-
-    if (formatFlags & S9sFormatColor)
-    {
-        colorBegin = "\033[35m";
-        colorEnd   = "\033[38;5;40m";
-    }
-
-    retval += '"';
-
-    for (uint idx = 0; idx < s.length(); ++idx)
-    {
-        if (s[idx] == '"') 
-        {
-            retval += '\\';
-            retval += '"';
-        } else if (s[idx] == '\n') 
-        {
-            retval += colorBegin;
-            retval += "\\n";
-            retval += colorEnd;
-        } else if (s[idx] == '\r') 
-        {
-            retval += colorBegin;
-            retval += "\\r";
-            retval += colorEnd;
-        } else if (s[idx] == '\t') 
-        {
-            retval += colorBegin;
-            retval += "\\t";
-            retval += colorEnd;
-        } else if (s[idx] == '\\') 
-        {
-            retval += colorBegin;
-            retval += "\\\\";
-            retval += colorEnd;
-        } else 
-        {
-            retval += s[idx];
-        }
-    }
+    S9sString     retval;
+    S9sJsonWriter writer(retval);
 
-    retval += '"';
+    writer.writeQuoted(s, formatFlags);
     return retval;
 }
 
@@ -64,6 +64,7 @@ class S9sVariant
 
         inline S9sVariant();
         S9sVariant(const S9sVariant &orig);
+        S9sVariant(S9sVariant &&orig) noexcept;
         inline S9sVariant(const int integerValue);
         inline S9sVariant(const ulonglong ullValue);
         inline S9sVariant(const double doubleValue);
@@ -71,16 +72,20 @@ class S9sVariant
         inline S9sVariant(const char *stringValue);
         inline S9sVariant(const std::string &stringValue);
         inline S9sVariant(const S9sString &stringValue);
+        S9sVariant(S9sString &&stringValue);
         S9sVariant(const S9sNode &nodeValue);
         S9sVariant(const S9sContainer &containerValue);
         S9sVariant(const S9sAccount &accountValue);
         
         S9sVariant(const S9sVariantMap &mapValue);
         S9sVariant(const S9sVariantList &listValue);
+        S9sVariant(S9sVariantMap &&mapValue);
+        S9sVariant(S9sVariantList &&listValue);
 
         virtual ~S9sVariant();
 
         S9sVariant &operator=(const S9sVariant &rhs);
+        S9sVariant &operator=(S9sVariant &&rhs) noexcept;
         bool operator==(const S9sVariant &rhs) const;
         bool operator!=(const S9sVariant &rhs) const;
         S9sVariant &operator+=(const S9sVariant &rhs);
@@ -158,6 +163,8 @@ class S9sVariant
     private:
         S9sBasicType    m_type;
         S9sUnion        m_union;
+
+    friend class S9sJsonWriter;
 };
 
 inline 
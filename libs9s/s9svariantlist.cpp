@@ -3,6 +3,8 @@
  */
 #include "s9svariantlist.h"
 
+#include "S9sJsonWriter"
+
 #define DEBUG
 #define WARNING
 #include "s9sdebug.h"
@@ -71,39 +73,9 @@ S9sVariantList::toJsonString(
         int                   depth,
         const S9sFormatFlags &formatFlags) const
 {
-    S9sString retval;
-    bool      singleLine = size() <= 1u;
-
-    if (formatFlags & S9sFormatIndent && !singleLine)
-        retval += "[\n";
-    else
-        retval += "[ ";
-
-    for (size_t idx = 0u; idx < size(); ++idx)
-    {
-        const S9sVariant &value = at(idx);
-
-        if (formatFlags & S9sFormatIndent && !singleLine)
-            retval += S9sVariant::indent(depth + 1, formatFlags);
-
-        retval += value.toJsonString(depth + 1, formatFlags);
-
-        if (idx + 1 < size())
-            retval += ',';
-
-        if (formatFlags & S9sFormatIndent && !singleLine)
-            retval += "\n";
-        else
-            retval += " ";
-    }
-
-    if (formatFlags & S9sFormatIndent && !singleLine)
-    {
-        retval += S9sVariant::indent(depth, formatFlags);
-        retval += "]";
-    } else {
-        retval += " ]";
-    }
+    S9sString     retval;
+    S9sJsonWriter writer(retval);
 
+    writer.writeJson(*this, depth, formatFlags);
     return retval;
 }
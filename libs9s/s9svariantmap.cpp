@@ -3,11 +3,9 @@
  */
 #include "S9sVariantMap"
 
-#include <cmath>
-
 #include "S9sVariantList"
 #include "S9sJsonParseContext"
-#include "S9sObject"
+#include "S9sJsonWriter"
 
 #define YY_EXTRA_TYPE S9sJsonParseContext *
 #include "json_parser.h"
@@ -17,22 +15,54 @@
 //#define WARNING
 #include "s9sdebug.h"
 
-static const char dblQuot = '"';
 const S9sVariant S9sVariantMap::sm_invalid;
 
+S9sVariantMap &
+S9sVariantMap::operator=(
+        const S9sVariantMap &rhs)
+{
+    S9sVariantMapBase::operator=(rhs);
+    return *this;
+}
+
+/**
+ * The move assignment takes over the elements of the right-hand-side.
+ */
+S9sVariantMap &
+S9sVariantMap::operator=(
+        S9sVariantMap &&rhs) noexcept
+{
+    S9sVariantMapBase::operator=(std::move(rhs));
+    return *this;
+}
+
 S9sVector<S9sString> 
 S9sVariantMap::keys() const
 {
     S9sVector<S9sString> retval;
 
-    for (std::map<S9sString,S9sVariant>::const_iterator it = this->begin(); it != this->end(); ++it) 
+    for (const_iterator it = this->begin(); it != this->end(); ++it) 
     {
-        retval.push_back(it->first);
+        retval.push_back(it->first.toString());
     }
 
     return retval;
 }
 
+/**
+ * \returns The value for the given key or an invalid variant if the map has
+ *   no such key. Unlike valueByPath() this does not split the key, so it
+ *   allocates nothing.
+ */
+const S9sVariant &
+S9sVariantMap::value(
+        const S9sInternedString &key) const
+{
+    const_iterator it = find(key);
+
+    return it != end() ? it->second : sm_invalid;
+}
+
 const S9sVariant &
 S9sVariantMap::valueByPath(
         const S9sString &path) const
@@ -90,11 +120,8 @@ S9sVariantMap::parse(
 
     if (success)
     {
-        clear();
-
-        std::vector<S9sString> newKeys = context.keys();
-        for (uint idx = 0; idx < newKeys.size(); ++idx)
-            (*this)[newKeys[idx]] = context[newKeys[idx]];
+        // Taking over the parsed values, the old ones go with the context.
+        S9sVariantMapBase::swap(context);
     }
 
     return success;
@@ -106,7 +133,11 @@ S9sVariantMap::parse(
 S9sString
 S9sVariantMap::toString() const
 {
-    return toString(0, *this);
+    S9sString     retval;
+    S9sJsonWriter writer(retval);
+
+    writer.writeToString(*this);
+    return retval;
 }
 
 S9sString
@@ -154,38 +185,6 @@ S9sVariantMap::toString(
     return retval;
 }
 
-/**
- * Private function, part of the S9sVariantMap::toString() implemtation.
- */
-S9sString
-S9sVariantMap::toString(
-        int                  depth, 
-        const S9sVariantMap &variantMap) const
-{
-    S9sVector<S9sString> theKeys = variantMap.keys();
-    S9sString            retval;
-
-    retval = indent(depth) + "{\n";
-    for (uint idx = 0; idx < theKeys.size(); ++idx)
-    {
-        retval += indent(depth + 1);
-        retval += quote(theKeys[idx]);
-        retval += ": ";
-       
-        S9sVariant value = variantMap.at(theKeys[idx]);
-        retval += toString(depth, value);
-
-        if (idx + 1 < theKeys.size())
-            retval += ',';
-
-        retval += "\n";
-    }
-
-    retval += indent(depth) + "}";
-
-    return retval;
-}
-
 S9sString
 S9sVariantMap::toJsonString(
         const S9sFormatFlags &formatFlags) const
@@ -193,127 +192,19 @@ S9sVariantMap::toJsonString(
     return toJsonString(0, formatFlags);
 }
 
+/**
+ * \returns The Json string representing the map, the well known object
+ *   properties first, then the scalar values and then the maps and lists.
+ */
 S9sString
 S9sVariantMap::toJsonString(
         int                   depth,
         const S9sFormatFlags &formatFlags) const
 {
-    S9sVector<S9sString> theKeys = keys();
-    S9sVector<S9sString> sortedKeys;
-    S9sString            retval;
-
-    if (contains(S9sObject::propClassName))
-        sortedKeys << S9sObject::propClassName;
-    
-    if (contains(S9sObject::propName))
-        sortedKeys << S9sObject::propName;
-    
-    if (contains(S9sObject::propPath))
-        sortedKeys << S9sObject::propPath;
-    
-    if (contains(S9sObject::propOwnerId))
-        sortedKeys << S9sObject::propOwnerId;
-    
-    if (contains(S9sObject::propOwnerName))
-        sortedKeys << S9sObject::propOwnerName;
-    
-    if (contains(S9sObject::propGroupId))
-        sortedKeys << S9sObject::propGroupId;
-    
-    if (contains(S9sObject::propGroupName))
-        sortedKeys << S9sObject::propGroupName;
-    
-    if (contains(S9sObject::propAcl))
-        sortedKeys << S9sObject::propAcl;
-    
-    if (contains(S9sObject::propTags))
-        sortedKeys << S9sObject::propTags;
-    for (size_t idx = 0u; idx < theKeys.size(); ++idx)
-    {
-        const S9sString &key = theKeys[idx];
-
-        if (key == S9sObject::propClassName ||
-                key == S9sObject::propName ||
-                key == S9sObject::propPath ||
-                key == S9sObject::propOwnerId ||
-                key == S9sObject::propOwnerName ||
-                key == S9sObject::propGroupId ||
-                key == S9sObject::propGroupName ||
-                key == S9sObject::propAcl ||
-                key == S9sObject::propTags)
-        {
-            continue;
-        }
-
-        if (at(key).isVariantMap() || at(key).isVariantList())
-            continue;
-
-        sortedKeys << key;
-    }
-    
-    for (size_t idx = 0u; idx < theKeys.size(); ++idx)
-    {
-        const S9sString &key = theKeys[idx];
-
-        if (key == S9sObject::propClassName ||
-                key == S9sObject::propName ||
-                key == S9sObject::propPath ||
-                key == S9sObject::propOwnerId ||
-                key == S9sObject::propOwnerName ||
-                key == S9sObject::propGroupId ||
-                key == S9sObject::propGroupName ||
-                key == S9sObject::propAcl ||
-                key == S9sObject::propTags)
-        {
-            continue;
-        }
-
-        if (!at(key).isVariantMap() && !at(key).isVariantList())
-            continue;
-
-        sortedKeys << key;
-    }
-
-    /*
-     *
-     */
-    //if (formatFlags & S9sFormatColor)
-    //    retval += TERM_NORMAL;
-
-    if (formatFlags & S9sFormatIndent)
-        retval += "{\n";
-    else
-        retval += "{ ";
-
-    for (uint idx = 0; idx < sortedKeys.size(); ++idx)
-    {
-        retval += S9sVariant::indent(depth + 1, formatFlags);
-        
-        if (formatFlags & S9sFormatColor)
-            retval += "\033[38;5;63m";
-
-        retval += S9sVariant::quote(sortedKeys[idx], S9sFormatNormal);
-
-        if (formatFlags & S9sFormatColor)
-            retval += TERM_NORMAL;
-
-        retval += ": ";
-       
-        const S9sVariant &value = at(sortedKeys[idx]);
-        
-        retval += value.toJsonString(depth + 1, formatFlags);
-        
-        if (idx + 1 < sortedKeys.size())
-            retval += ',';
-
-        if (formatFlags & S9sFormatIndent)
-            retval += "\n";
-        else
-            retval += " ";
-    }
-
-    retval += S9sVariant::indent(depth, formatFlags) + "}";
+    S9sString     retval;
+    S9sJsonWriter writer(retval);
 
+    writer.writeJson(*this, depth, formatFlags);
     return retval;
 }
 
@@ -503,150 +394,3 @@ S9sVariantMap::isSubSet(
     return true;
 }
 
-/**
- * Private function, part of the S9sVariantMap::toString() implemtation.
- */
-S9sString
-S9sVariantMap::toString (
-        int                   depth,
-        const S9sVariantList &theList) const
-{
-    S9sString retval;
-
-    retval += "[ ";
-    
-    for (uint idx = 0; idx < theList.size(); ++idx)
-    {
-        if (idx > 0)
-            retval += ", ";
-
-        retval += toString(depth, theList[idx]);
-    }
-
-    retval += " ]";
-
-    return retval;
-}
-
-/**
- * Private function, part of the S9sVariantMap::toString() implemtation.
- */
-S9sString
-S9sVariantMap::toString (
-        int               depth,
-        const S9sVariant &value) const
-{
-    S9sString retval;
-
-    switch (value.type())
-    {
-        case Invalid:
-            retval += "null";
-            break;
-
-        case String:
-            retval += quote(value.toString());
-            break;
-
-        case Int:
-        case Bool:
-        case Ulonglong:
-            retval += value.toString();
-            break;
-
-        case Double: 
-            {
-                // FIXME: maybe this classification shouldn't be here, but here
-                // we return 'JSon' compatible strings, so might be this is the
-                // correct place
-                double dblval = value.toDouble();
-                bool   m_enableSpecialNums = true;
-                
-                if (std::isnan (dblval)) 
-                {
-                    retval += m_enableSpecialNums ? "NaN" : "0.0";
-                } else if (std::isinf (dblval))
-                {
-                    retval += m_enableSpecialNums ? "Infinity" : "0.0";
-                } else {
-                    retval += value.toString();
-                }
-            break;
-        }
-
-        case Map:
-        case Node:
-        case Account:
-            retval += "\n";
-            retval += toString(depth + 1, value.toVariantMap());
-            break;
-
-        case List:
-            retval += toString(depth, value.toVariantList());
-            break;
-        
-        default:
-            // Let's use 'null' for invalid/null data (http://www.json.org/)
-            retval.sprintf ("null");
-            break;
-    }
-
-    return retval;
-}
-
-/**
- * Private function, part of the S9sVariantMap::toString() implemtation.
- */
-S9sString
-S9sVariantMap::indent(
-        int depth) const
-{
-    S9sString retval;
-    
-    for (int n = 0; n < depth; ++n)
-        retval += "    ";
-
-    return retval;
-}
-
-/**
- * Private function, part of the S9sVariantMap::toString() implemtation.
- */
-S9sString
-S9sVariantMap::quote(
-        const S9sString &s) const
-{
-    S9sString retval;
-
-    retval += dblQuot;
-
-    // lets encode the double quote, and some
-    // other special chars in the returned JSon
-    for (uint idx = 0; idx < s.length(); ++idx)
-    {
-        if (s[idx] == dblQuot) 
-        {
-            retval += '\\';
-            retval += dblQuot;
-        } else if (s[idx] == '\n') 
-        {
-            retval += "\\n";
-        } else if (s[idx] == '\r') 
-        {
-            retval += "\\r";
-        } else if (s[idx] == '\t') 
-        {
-            retval += "\\t";
-        } else if (s[idx] == '\\') 
-        {
-            retval += "\\\\";
-        } else 
-        {
-            retval += s[idx];
-        }
-    }
-
-    retval += dblQuot;
-    return retval;
-}
-
@@ -3,22 +3,47 @@
  */
 #pragma once
 
+#include "s9sconfig.h"
 #include "S9sVariant"
 #include "S9sMap"
+#include "S9sFlatMap"
 #include "S9sVector"
 #include "S9sString"
+#include "S9sInternedString"
 #include "S9sParseContext"
 
 class S9sVariantList;
 
-class S9sVariantMap : public S9sMap<S9sString, S9sVariant>
+/*
+ * The container the variant map is built on, the flat map by default, the 
+ * std::map if the package is configured with --enable-std-variant-map.
+ */
+#ifdef S9S_STD_VARIANT_MAP
+typedef S9sMap<S9sInternedString, S9sVariant> S9sVariantMapBase;
+#else
+typedef S9sFlatMap<
+    S9sInternedString, S9sVariant, S9sInternedStringHash> S9sVariantMapBase;
+#endif
+
+/**
+ * The keys are interned (see S9sStringInterner), the property names repeated
+ * in every object of a reply are stored only once.
+ */
+class S9sVariantMap : public S9sVariantMapBase
 {
     public:
-        S9sVariantMap() : S9sMap<S9sString, S9sVariant>() {};
+        S9sVariantMap() : S9sVariantMapBase() {};
+        S9sVariantMap(const S9sVariantMap &orig) : S9sVariantMapBase(orig) {};
+        S9sVariantMap(S9sVariantMap &&orig) noexcept : 
+            S9sVariantMapBase(std::move(orig)) {};
         virtual ~S9sVariantMap() {};
 
+        S9sVariantMap &operator=(const S9sVariantMap &rhs);
+        S9sVariantMap &operator=(S9sVariantMap &&rhs) noexcept;
+
         S9sVector<S9sString> keys() const;
 
+        const S9sVariant &value(const S9sInternedString &key) const;
         const S9sVariant &valueByPath(const S9sString &path) const;
         const S9sVariant &valueByPath(S9sVariantList path) const;
 
@@ -45,22 +70,6 @@ class S9sVariantMap : public S9sMap<S9sString, S9sVariant>
 
     protected:
         static const S9sVariant sm_invalid;
-
-    private:
-        S9sString toString(
-                int                  depth, 
-                const S9sVariantMap &variantMap) const;
-
-        S9sString toString (
-                int                   depth,
-                const S9sVariantList &theList) const;
-
-        S9sString toString (
-                int               depth,
-                const S9sVariant &value) const;
-
-        S9sString indent(int depth) const;
-        S9sString quote(const S9sString &s) const;
 };
 
 
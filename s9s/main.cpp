@@ -21,9 +21,15 @@
 #include "S9sOptions"
 #include "S9sRpcClient"
 #include "S9sBusinessLogic"
+#include "S9sOutput"
+#include "S9sLogger"
+#include "S9sRpcStats"
+#include "S9sShell"
+#include "S9sCompletionCache"
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <signal.h>
 
 #include <unistd.h>
@@ -35,14 +41,14 @@
 
 void enable_cursor()
 {
-    printf("\033[?25h");
-    fflush(stdout);
+    S9sOutput::printf("\033[?25h");
+    S9sOutput::flush();
 }
 
 void intHandler(int dummy) 
 {
     enable_cursor();
-    printf("\nAborted...\n");
+    S9sOutput::printf("\nAborted...\n");
     exit(128);
 }
 
@@ -63,7 +69,7 @@ main(int argc, char **argv)
     for (;;)
     {
         S9sString progress = S9sRpcReply::progressBar(true);
-        printf("-> %s\n", STR(progress));
+        S9sOutput::printf("-> %s\n", STR(progress));
 
         sleep(1);
     }
@@ -71,6 +77,24 @@ main(int argc, char **argv)
 
     signal(SIGINT, intHandler);
 
+    /*
+     * The hidden entry point of the bash completion, it has to be fast, so the
+     * command line is not processed the usual way.
+     */
+    if (argc == 3 && strcmp(argv[1], "__complete") == 0)
+    {
+        if (getenv("S9S_IGNORE_CONFIG") == NULL)
+        {
+            options->createConfigFiles();
+            options->loadConfigFiles();
+        }
+
+        exitStatus = S9sCompletionCache::complete(argv[2]);
+        S9sOptions::uninit();
+
+        return exitStatus;
+    }
+
     success = options->readOptions(&argc, argv);
     if (!success)
     {
@@ -94,9 +118,42 @@ main(int argc, char **argv)
 
     // We can create log files after the command line options are processed and
     // the configuration file is loaded. Both can define the log file.
+    if (!options->logFile().empty())
+    {
+        S9sLogger      *logger = S9sLogger::instance();
+        S9sLogSeverity  threshold;
+
+        logger->setMaxFileSize(options->logFileMaxSize());
+
+        // Everything is logged if the log level is not set.
+        if (!options->logLevel().empty())
+        {
+            if (S9sLogger::severityFromName(options->logLevel(), threshold))
+            {
+                logger->setThreshold(threshold);
+            } else {
+                PRINT_VERBOSE("Invalid log_level '%s'.", 
+                        STR(options->logLevel()));
+            }
+        }
+
+        if (!logger->open(options->logFile()))
+        {
+            PRINT_VERBOSE("Can not open log file '%s': %m", 
+                    STR(options->logFile()));
+        }
+    }
+
     PRINT_LOG("+++ Program started +++++++++");
     PRINT_LOG("Command line: %s", STR(options->commandLine()));
     PRINT_VERBOSE("Command line options processed.");
+
+    // Measuring the RPC requests for --print-timings and S9S_TIMINGS_FILE.
+    if (options->isPrintTimingsRequested() || 
+            getenv("S9S_TIMINGS_FILE") != NULL)
+    {
+        S9sRpcStats::instance()->setEnabled(true);
+    }
     
     if (options->useSyntaxHighlight())
         atexit(enable_cursor);
@@ -107,6 +164,20 @@ main(int argc, char **argv)
     if (finished)
         goto finalize;
 
+    if (options->isShellRequested())
+    {
+        S9sShell shell;
+
+        success = shell.execute();
+
+        // The options of the last command are not the options of the program.
+        options->reset();
+        if (!success)
+            options->setExitStatus(S9sOptions::Failed);
+
+        goto finalize;
+    }
+
     //perform_task();
     businessLogic.execute();
 
@@ -116,6 +187,20 @@ finalize:
     S9S_DEBUG("Exiting with exitcode %d.", exitStatus);
     PRINT_LOG("+++ Exiting with %d +++++++++", exitStatus);
 
+    if (S9sRpcStats::instance()->isEnabled())
+    {
+        S9sRpcStats *stats    = S9sRpcStats::instance();
+        const char  *fileName = getenv("S9S_TIMINGS_FILE");
+
+        stats->finish();
+
+        if (options->isPrintTimingsRequested())
+            stats->printTimings();
+
+        if (fileName != NULL && !stats->saveTimings(fileName))
+            PRINT_VERBOSE("Can not write timings file '%s': %m", fileName);
+    }
+
     S9sOptions::uninit();
 
     return exitStatus;
@@ -0,0 +1,681 @@
+/*
+ * Copyright (C) 2011-2026 severalnines.com
+ */
+#include "s9smockcontroller.h"
+
+#include "S9sThread"
+#include "S9sMutexLocker"
+#include "S9sFile"
+#include "S9sDateTime"
+
+#include <openssl/evp.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+#include <openssl/err.h>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * The number of worker threads serving the requests when setWorkers() is not
+ * called.
+ */
+#define DEFAULT_MOCK_WORKERS 8
+
+/**
+ * How often (in milliseconds) the idle workers check if the server is
+ * stopping.
+ */
+#define MOCK_POLL_TIMEOUT 100
+
+#define MOCK_READ_SIZE 4096
+
+/**
+ * The worker thread of the S9sMockController, accepts the connections on the
+ * listening socket and serves them one by one.
+ */
+class S9sMockControllerWorker : public S9sThread
+{
+    public:
+        S9sMockControllerWorker(
+                S9sMockController *controller) :
+            S9sThread(),
+            m_controller(controller)
+        {
+        }
+
+    protected:
+        virtual int
+        exec()
+        {
+            int socketFd;
+            int nServed = 0;
+
+            while (m_controller->takeConnection(socketFd))
+            {
+                m_controller->serve(socketFd);
+                ++nServed;
+            }
+
+            return nServed;
+        }
+
+    private:
+        S9sMockController *m_controller;
+};
+
+S9sMockController::S9sMockController() :
+    m_redirectPort(0),
+    m_latency(0),
+    m_chunkSize(0),
+    m_chunkDelay(0),
+    m_nWorkers(DEFAULT_MOCK_WORKERS),
+    m_listenFd(-1),
+    m_port(0),
+    m_nRequests(0),
+    m_stopping(false),
+    m_sslContext(NULL)
+{
+}
+
+S9sMockController::~S9sMockController()
+{
+    stop();
+
+    if (m_sslContext != NULL)
+    {
+        SSL_CTX_free(m_sslContext);
+        m_sslContext = NULL;
+    }
+}
+
+/**
+ * \param directory The directory where the "*-rep.json" files are.
+ * \returns How many replies were loaded.
+ *
+ * Loads the reply examples from the directory, the file names are in the
+ * format the S9S_DEBUG_SAVE_REQUEST_EXAMPLES environment variable produces:
+ * "<request_status>-<operation>-rep.json". If there are more replies for the
+ * same operation the "Ok" is used.
+ */
+int
+S9sMockController::loadReplies(
+        const S9sString &directory)
+{
+    S9sVariantList fileNames;
+    int            retval = 0;
+
+    S9sFile::listFiles(directory, fileNames);
+    for (uint idx = 0u; idx < fileNames.size(); ++idx)
+    {
+        S9sString     fileName = fileNames[idx].toString();
+        S9sString     operation, status, content;
+        S9sVariantMap reply;
+        S9sFile       file(S9sFile::buildPath(directory, fileName));
+        int           dash;
+
+        if (!fileName.endsWith("-rep.json"))
+            continue;
+
+        dash = fileName.find('-');
+        if (dash == (int) std::string::npos)
+            continue;
+
+        status    = fileName.substr(0, dash);
+        operation = fileName.substr(
+                dash + 1, fileName.length() - dash - 1 - strlen("-rep.json"));
+
+        if (m_replies.contains(operation) && status != "Ok")
+            continue;
+
+        if (!file.readTxtFile(content) || !reply.parse(STR(content)))
+        {
+            S9S_WARNING("Could not load '%s'.", STR(fileName));
+            continue;
+        }
+
+        m_replies[operation] = reply;
+        ++retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Sets the reply sent for every request with the given operation.
+ */
+void
+S9sMockController::setReply(
+        const S9sString     &operation,
+        const S9sVariantMap &reply)
+{
+    m_replies[operation] = reply;
+}
+
+/**
+ * The requests with the given operation are going to be answered with a JSon
+ * stream (records starting with a '\036' and ending with an empty line) the way
+ * the controller sends the events.
+ */
+void
+S9sMockController::setStream(
+        const S9sString      &operation,
+        const S9sVariantList &records)
+{
+    m_streams[operation] = records;
+}
+
+/**
+ * Sets how long the server waits before sending the reply.
+ */
+void
+S9sMockController::setLatency(
+        int milliseconds)
+{
+    m_latency = milliseconds;
+}
+
+/**
+ * \param chunkSize The replies are written in pieces of this size, 0 means
+ *   the whole reply is written at once.
+ * \param chunkDelayMs The time the server waits between the chunks.
+ */
+void
+S9sMockController::setChunking(
+        int chunkSize,
+        int chunkDelayMs)
+{
+    m_chunkSize  = chunkSize;
+    m_chunkDelay = chunkDelayMs;
+}
+
+/**
+ * Every request will be answered with a redirect notification that names the
+ * given controller as the leader.
+ */
+void
+S9sMockController::setRedirect(
+        const S9sString &hostName,
+        int              port)
+{
+    m_redirectHost = hostName;
+    m_redirectPort = port;
+}
+
+void
+S9sMockController::setWorkers(
+        int nWorkers)
+{
+    m_nWorkers = nWorkers > 0 ? nWorkers : 1;
+}
+
+/**
+ * \returns True if the TLS could be set up.
+ *
+ * With TLS the server uses a self signed certificate that is generated here,
+ * the client does not verify the certificate of the controller anyway.
+ */
+bool
+S9sMockController::setTls(
+        bool useTls)
+{
+    if (!useTls)
+    {
+        if (m_sslContext != NULL)
+            SSL_CTX_free(m_sslContext);
+
+        m_sslContext = NULL;
+        return true;
+    }
+
+    if (m_sslContext != NULL)
+        return true;
+
+    return createTlsContext();
+}
+
+/**
+ * \param port The port to listen on, 0 means the system picks a free port
+ *   that is then returned by port().
+ * \returns True if the server is listening and the workers are started.
+ */
+bool
+S9sMockController::start(
+        int port)
+{
+    struct sockaddr_in address;
+    socklen_t          addressLength = sizeof(address);
+    int                one = 1;
+
+    // The clients may close the connection while we are writing.
+    signal(SIGPIPE, SIG_IGN);
+
+    m_listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenFd < 0)
+    {
+        m_errorString.sprintf("Error creating socket: %m");
+        return false;
+    }
+
+    setsockopt(m_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = htons(port);
+
+    if (bind(m_listenFd, (struct sockaddr *) &address, sizeof(address)) != 0 ||
+            listen(m_listenFd, 128) != 0 ||
+            getsockname(
+                m_listenFd, (struct sockaddr *) &address,
+                &addressLength) != 0)
+    {
+        m_errorString.sprintf("Error listening on port %d: %m", port);
+        ::close(m_listenFd);
+        m_listenFd = -1;
+        return false;
+    }
+
+    // The workers are polling the same socket, accept() must not block.
+    fcntl(m_listenFd, F_SETFL, fcntl(m_listenFd, F_GETFL) | O_NONBLOCK);
+
+    m_port     = ntohs(address.sin_port);
+    m_stopping = false;
+
+    for (int idx = 0; idx < m_nWorkers; ++idx)
+    {
+        S9sMockControllerWorker *worker = new S9sMockControllerWorker(this);
+
+        m_workers << worker;
+        worker->start();
+    }
+
+    return true;
+}
+
+/**
+ * Stops the workers (the requests that are being served are finished) and
+ * closes the listening socket.
+ */
+void
+S9sMockController::stop()
+{
+    m_stopping = true;
+
+    for (uint idx = 0u; idx < m_workers.size(); ++idx)
+    {
+        m_workers[idx]->wait();
+        delete m_workers[idx];
+    }
+
+    m_workers.clear();
+
+    if (m_listenFd >= 0)
+    {
+        ::close(m_listenFd);
+        m_listenFd = -1;
+    }
+}
+
+int
+S9sMockController::port() const
+{
+    return m_port;
+}
+
+bool
+S9sMockController::useTls() const
+{
+    return m_sslContext != NULL;
+}
+
+/**
+ * \returns How many requests were received since the server started.
+ */
+int
+S9sMockController::nRequests() const
+{
+    S9sMutexLocker locker(m_mutex);
+
+    return m_nRequests;
+}
+
+S9sString
+S9sMockController::errorString() const
+{
+    return m_errorString;
+}
+
+bool
+S9sMockController::createTlsContext()
+{
+    EVP_PKEY     *key = NULL;
+    EVP_PKEY_CTX *keyContext;
+    X509         *certificate;
+    X509_NAME    *name;
+    bool          success = false;
+
+    keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_RSA, NULL);
+    if (keyContext == NULL ||
+            EVP_PKEY_keygen_init(keyContext) <= 0 ||
+            EVP_PKEY_CTX_set_rsa_keygen_bits(keyContext, 2048) <= 0 ||
+            EVP_PKEY_keygen(keyContext, &key) <= 0)
+    {
+        m_errorString = "Could not generate the RSA key.";
+        EVP_PKEY_CTX_free(keyContext);
+        return false;
+    }
+
+    EVP_PKEY_CTX_free(keyContext);
+
+    certificate = X509_new();
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+    X509_gmtime_adj(X509_get_notBefore(certificate), 0);
+    X509_gmtime_adj(X509_get_notAfter(certificate), 24 * 3600);
+    X509_set_pubkey(certificate, key);
+
+    name = X509_get_subject_name(certificate);
+    X509_NAME_add_entry_by_txt(
+            name, "CN", MBSTRING_ASC, (const unsigned char *) "localhost",
+            -1, -1, 0);
+    X509_set_issuer_name(certificate, name);
+
+    #if (OPENSSL_VERSION_NUMBER >= 0x10100000L)
+    m_sslContext = SSL_CTX_new(TLS_server_method());
+    #else
+    m_sslContext = SSL_CTX_new(SSLv23_server_method());
+    #endif
+
+    if (m_sslContext == NULL ||
+            X509_sign(certificate, key, EVP_sha256()) <= 0 ||
+            SSL_CTX_use_certificate(m_sslContext, certificate) <= 0 ||
+            SSL_CTX_use_PrivateKey(m_sslContext, key) <= 0)
+    {
+        m_errorString = "Could not set up the TLS context.";
+        if (m_sslContext != NULL)
+            SSL_CTX_free(m_sslContext);
+
+        m_sslContext = NULL;
+    } else {
+        success = true;
+    }
+
+    X509_free(certificate);
+    EVP_PKEY_free(key);
+
+    return success;
+}
+
+/**
+ * \param socketFd The accepted connection is returned here.
+ * \returns False if the server is stopping and the worker should exit.
+ */
+bool
+S9sMockController::takeConnection(
+        int &socketFd)
+{
+    struct pollfd pollFd;
+
+    while (!m_stopping)
+    {
+        pollFd.fd      = m_listenFd;
+        pollFd.events  = POLLIN;
+        pollFd.revents = 0;
+
+        if (poll(&pollFd, 1, MOCK_POLL_TIMEOUT) <= 0)
+            continue;
+
+        // An other worker might have taken it already.
+        socketFd = accept(m_listenFd, NULL, NULL);
+        if (socketFd >= 0)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Reads one request from the connection, sends the reply and closes the
+ * connection the way the controller does it with the HTTP/1.0 requests.
+ */
+void
+S9sMockController::serve(
+        int socketFd)
+{
+    SSL           *ssl = NULL;
+    S9sString      body;
+    S9sString      reply;
+    S9sVariantMap  request;
+    S9sString      operation;
+
+    if (m_sslContext != NULL)
+    {
+        ssl = SSL_new(m_sslContext);
+        SSL_set_fd(ssl, socketFd);
+
+        if (SSL_accept(ssl) <= 0)
+        {
+            S9S_WARNING("SSL_accept() failed.");
+            SSL_free(ssl);
+            ::close(socketFd);
+            return;
+        }
+    }
+
+    if (readRequest(socketFd, ssl, body) && request.parse(STR(body)))
+    {
+        m_mutex.lock();
+        ++m_nRequests;
+        m_mutex.unlock();
+
+        operation = request["operation"].toString();
+
+        if (m_latency > 0)
+            usleep(m_latency * 1000);
+
+        if (m_streams.contains(operation))
+        {
+            reply = composeStream(operation);
+        } else {
+            S9sString content = composeReply(request);
+
+            reply.sprintf(
+                    "HTTP/1.0 200 OK\r\n"
+                    "Server: s9s-mock-controller\r\n"
+                    "Content-Type: application/json\r\n"
+                    "Content-Length: %u\r\n"
+                    "Connection: close\r\n"
+                    "\r\n",
+                    (uint) content.length());
+
+            reply += content;
+        }
+
+        writeData(socketFd, ssl, reply);
+    }
+
+    if (ssl != NULL)
+    {
+        SSL_shutdown(ssl);
+        SSL_free(ssl);
+    }
+
+    ::close(socketFd);
+}
+
+/**
+ * Reads the HTTP header and the body (as long as the Content-Length says) of
+ * one request.
+ */
+bool
+S9sMockController::readRequest(
+        int         socketFd,
+        SSL        *ssl,
+        S9sString  &body)
+{
+    S9sString data;
+    char      buffer[MOCK_READ_SIZE];
+    size_t    headerEnd = std::string::npos;
+    size_t    contentLength = 0;
+
+    for (;;)
+    {
+        ssize_t readLength;
+
+        if (ssl != NULL)
+            readLength = SSL_read(ssl, buffer, sizeof(buffer));
+        else
+            readLength = ::read(socketFd, buffer, sizeof(buffer));
+
+        if (readLength <= 0)
+            return false;
+
+        data.append(buffer, readLength);
+
+        if (headerEnd == std::string::npos)
+        {
+            const char *lengthHeader;
+
+            headerEnd = data.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+                continue;
+
+            headerEnd += 4;
+            lengthHeader = strcasestr(STR(data), "\r\nContent-Length:");
+            if (lengthHeader != NULL &&
+                    (size_t) (lengthHeader - STR(data)) < headerEnd)
+            {
+                contentLength = strtoul(
+                        lengthHeader + strlen("\r\nContent-Length:"),
+                        NULL, 10);
+            }
+        }
+
+        if (data.length() >= headerEnd + contentLength)
+        {
+            body = data.substr(headerEnd, contentLength);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Writes the data in chunks as it is set by setChunking().
+ */
+bool
+S9sMockController::writeData(
+        int              socketFd,
+        SSL             *ssl,
+        const S9sString &data)
+{
+    size_t chunkSize = m_chunkSize > 0 ? m_chunkSize : data.length();
+    size_t written = 0u;
+
+    while (written < data.length())
+    {
+        size_t  toWrite = std::min(chunkSize, data.length() - written);
+        ssize_t result;
+
+        if (written > 0u && m_chunkDelay > 0)
+            usleep(m_chunkDelay * 1000);
+
+        if (ssl != NULL)
+            result = SSL_write(ssl, data.c_str() + written, toWrite);
+        else
+            result = ::write(socketFd, data.c_str() + written, toWrite);
+
+        if (result <= 0)
+            return false;
+
+        written += result;
+    }
+
+    return true;
+}
+
+/**
+ * \returns The JSon string of the reply for the request: either a redirect
+ *   notification, the reply that is set for the operation or an error if the
+ *   operation is unknown.
+ */
+S9sString
+S9sMockController::composeReply(
+        const S9sVariantMap &request) const
+{
+    S9sString     operation = request.valueByPath("operation").toString();
+    S9sString     now;
+    S9sVariantMap reply;
+
+    now = S9sDateTime::currentDateTime().toString(
+            S9sDateTime::TzDateTimeFormat);
+
+    if (!m_redirectHost.empty())
+    {
+        S9sVariantMap controller, controllers;
+        S9sString     key;
+
+        key.sprintf("%s:%d", STR(m_redirectHost), m_redirectPort);
+        controller["class_name"] = "CmonController";
+        controller["hostname"]   = m_redirectHost;
+        controller["port"]       = m_redirectPort;
+        controller["role"]       = "leader";
+        controllers[key]         = controller;
+
+        reply["controllers"]     = controllers;
+        reply["error_string"]    = "Redirect notification.";
+        reply["request_status"]  = "Redirect";
+    } else if (m_replies.contains(operation))
+    {
+        reply = m_replies.at(operation);
+    } else {
+        S9sString errorString;
+
+        errorString.sprintf(
+                "The mock controller has no reply for '%s'.",
+                STR(operation));
+
+        reply["error_string"]    = errorString;
+        reply["request_status"]  = "InvalidRequest";
+    }
+
+    reply["request_id"]        = request.valueByPath("request_id");
+    reply["request_created"]   = request.valueByPath("request_created");
+    reply["request_processed"] = now;
+
+    return reply.toString();
+}
+
+/**
+ * \returns The JSon stream records set for the operation, every record starts
+ *   with a '\036' and ends with an empty line.
+ */
+S9sString
+S9sMockController::composeStream(
+        const S9sString &operation) const
+{
+    const S9sVariantList &records = m_streams.at(operation);
+    S9sString             retval;
+
+    for (uint idx = 0u; idx < records.size(); ++idx)
+    {
+        retval += "\036";
+        retval += records[idx].toVariantMap().toJsonString(S9sFormatNormal);
+        retval += "\n\n";
+    }
+
+    return retval;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2011-2026 severalnines.com
+ */
+#pragma once
+
+#include "S9sString"
+#include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sVector"
+#include "S9sMap"
+#include "S9sMutex"
+
+#include <openssl/ssl.h>
+
+class S9sMockControllerWorker;
+
+/**
+ * A small HTTP(S) server that answers the RPC requests of the S9sRpcClient
+ * the way a Cmon controller would, but with replies that are loaded from files
+ * (e.g. the ones saved with the S9S_DEBUG_SAVE_REQUEST_EXAMPLES environment
+ * variable) or set by the test program. The latency of the replies, the size
+ * of the chunks the replies are sent in and the redirects are configurable, so
+ * the socket, TLS, redirect and JSon stream handling of the client can be
+ * tested and measured without a real controller.
+ *
+ * The server runs in the process of the test program, on the loopback
+ * interface, the requests are served by a number of worker threads.
+ */
+class S9sMockController
+{
+    public:
+        S9sMockController();
+        virtual ~S9sMockController();
+
+        int loadReplies(const S9sString &directory);
+
+        void setReply(
+                const S9sString     &operation,
+                const S9sVariantMap &reply);
+
+        void setStream(
+                const S9sString      &operation,
+                const S9sVariantList &records);
+
+        void setLatency(int milliseconds);
+        void setChunking(int chunkSize, int chunkDelayMs = 0);
+        void setRedirect(const S9sString &hostName, int port);
+        void setWorkers(int nWorkers);
+        bool setTls(bool useTls);
+
+        bool start(int port = 0);
+        void stop();
+
+        int port() const;
+        bool useTls() const;
+        int nRequests() const;
+        S9sString errorString() const;
+
+    private:
+        bool createTlsContext();
+        bool takeConnection(int &socketFd);
+        void serve(int socketFd);
+
+        bool readRequest(
+                int         socketFd,
+                SSL        *ssl,
+                S9sString  &body);
+
+        bool writeData(
+                int              socketFd,
+                SSL             *ssl,
+                const S9sString &data);
+
+        S9sString composeReply(const S9sVariantMap &request) const;
+        S9sString composeStream(const S9sString &operation) const;
+
+    private:
+        S9sMap<S9sString, S9sVariantMap>  m_replies;
+        S9sMap<S9sString, S9sVariantList> m_streams;
+        S9sVector<S9sMockControllerWorker *> m_workers;
+        mutable S9sMutex  m_mutex;
+        S9sString         m_errorString;
+        S9sString         m_redirectHost;
+        int               m_redirectPort;
+        int               m_latency;
+        int               m_chunkSize;
+        int               m_chunkDelay;
+        int               m_nWorkers;
+        int               m_listenFd;
+        int               m_port;
+        int               m_nRequests;
+        volatile bool     m_stopping;
+        SSL_CTX          *m_sslContext;
+
+    friend class S9sMockControllerWorker;
+};
@@ -0,0 +1,128 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9scompletioncache.h"
+
+#include "S9sCompletionCache"
+#include "S9sRpcReply"
+#include "S9sFile"
+#include "S9sDir"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+#define TEST_HOME "/tmp/ut_s9scompletioncache"
+
+UtS9sCompletionCache::UtS9sCompletionCache()
+{
+}
+
+UtS9sCompletionCache::~UtS9sCompletionCache()
+{
+}
+
+bool
+UtS9sCompletionCache::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testContexts,  retval);
+    PERFORM_TEST(testStore,     retval);
+
+    return retval;
+}
+
+bool
+UtS9sCompletionCache::testContexts()
+{
+    S9S_VERIFY(S9sCompletionCache::isValidContext("cluster-ids"));
+    S9S_VERIFY(S9sCompletionCache::isValidContext("cluster-names"));
+    S9S_VERIFY(S9sCompletionCache::isValidContext("users"));
+    S9S_VERIFY(S9sCompletionCache::isValidContext("tree"));
+    S9S_VERIFY(S9sCompletionCache::isValidContext("tree-paths"));
+    S9S_VERIFY(S9sCompletionCache::isValidContext("report-templates"));
+    S9S_VERIFY(!S9sCompletionCache::isValidContext("clusters"));
+    S9S_VERIFY(!S9sCompletionCache::isValidContext(""));
+
+    return true;
+}
+
+/**
+ * The replies go into the cache only if the cache file exists, the users who do
+ * not use the completion should not get the file.
+ */
+bool
+UtS9sCompletionCache::testStore()
+{
+    S9sDir         dir(TEST_HOME "/.s9s");
+    S9sFile        cacheFile(TEST_HOME "/.s9s/completion.cache");
+    S9sRpcReply    reply;
+    S9sVariantList clusters;
+    S9sVariantMap  cluster, cache, entries;
+    S9sString      content;
+
+    setenv("HOME", TEST_HOME, 1);
+    dir.mkdir();
+    unlink(STR(cacheFile.path()));
+
+    cluster["cluster_id"]   = 1;
+    cluster["cluster_name"] = "ft_galera";
+    clusters << cluster;
+    cluster["cluster_id"]   = 2;
+    cluster["cluster_name"] = "pg";
+    clusters << cluster;
+
+    reply["request_status"] = "Ok";
+    reply["clusters"]       = clusters;
+
+    S9sCompletionCache::clustersReceived(reply);
+    S9S_VERIFY(!cacheFile.exists());
+
+    S9S_VERIFY(cacheFile.writeTxtFile("{}"));
+    S9sCompletionCache::clustersReceived(reply);
+    S9S_VERIFY(cacheFile.readTxtFile(content));
+    S9S_VERIFY(cache.parse(STR(content)));
+    S9S_VERIFY(cache.size() == 1u);
+
+    entries = cache[cache.keys()[0]].toVariantMap();
+    S9S_VERIFY(entries["cluster-ids"]["items"].toVariantList().size() == 2u);
+    S9S_COMPARE(
+            entries["cluster-names"]["items"].toVariantList()[1].toString(), 
+            "pg");
+    S9S_VERIFY(!entries.contains("users"));
+
+    // Failed replies do not touch the cache.
+    reply["request_status"] = "AccessDenied";
+    reply["clusters"]       = S9sVariantList();
+    S9sCompletionCache::clustersReceived(reply);
+
+    S9S_VERIFY(cacheFile.readTxtFile(content));
+    S9S_VERIFY(cache.parse(STR(content)));
+    entries = cache[cache.keys()[0]].toVariantMap();
+    S9S_VERIFY(entries["cluster-ids"]["items"].toVariantList().size() == 2u);
+
+    unlink(STR(cacheFile.path()));
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sCompletionCache)
@@ -41,6 +41,8 @@ UtS9sConfigFile::runTest(const char *testName)
     bool retval = true;
 
     PERFORM_TEST(testParse,        retval);
+    PERFORM_TEST(testVariables,    retval);
+    PERFORM_TEST(testChange,       retval);
 
     return retval;
 }
@@ -84,4 +86,108 @@ UtS9sConfigFile::testParse()
     return true;
 }
 
+/**
+ * Looking up variables in the global section, in given sections and through
+ * the search groups.
+ */
+bool
+UtS9sConfigFile::testVariables()
+{
+    S9sConfigFile config;
+    S9sString     content = 
+        "controller = \"https://localhost:9501\"\n"
+        "cmon_user = pipas\n"
+        "\n"
+        "[global]\n"
+        "cluster_id = 1\n"
+        "#commented = 10\n"
+        "\n"
+        "[local]\n"
+        "cluster_id = 2\n"
+        "log_file = /tmp/s9s.log\n";
+
+    S9S_VERIFY(config.parse(STR(content)));
+    
+    S9S_COMPARE(config.variableValue("controller"), "https://localhost:9501");
+    S9S_COMPARE(config.variableValue("cmon_user"),  "pipas");
+    S9S_COMPARE(config.variableValue("cluster_id"), "1");
+    S9S_COMPARE(config.variableValue("log_file"),   "/tmp/s9s.log");
+    S9S_COMPARE(config.variableValue("commented"),  "");
+    S9S_COMPARE(config.variableValue("nosuchvar"),  "");
+
+    S9S_COMPARE(config.variableValue("local", "cluster_id"),  "2");
+    S9S_COMPARE(config.variableValue("global", "cluster_id"), "1");
+    S9S_COMPARE(config.variableValue("global", "log_file"),   "");
+    S9S_COMPARE(config.variableValue("", "cmon_user"),        "pipas");
+    S9S_COMPARE(config.variableValue("local", "log_file", "x"), "/tmp/s9s.log");
+    S9S_COMPARE(config.variableValue("global", "nosuchvar", "x"), "x");
+
+    S9S_VERIFY(config.hasVariable("global", "cluster_id"));
+    S9S_VERIFY(!config.hasVariable("global", "commented", true));
+    S9S_VERIFY(!config.hasVariable("", "cluster_id"));
+    
+    S9S_COMPARE((int) config.collectVariables("cluster_id").size(), 2);
+    S9S_COMPARE((int) config.collectVariables("").size(), 5);
+
+    config.appendSearchGroup("local");
+    config.appendSearchGroup("global");
+    S9S_COMPARE(config.variableValue("cluster_id"), "2");
+    S9S_COMPARE(config.variableValue("cmon_user"),  "");
+
+    return true;
+}
+
+/**
+ * The lookups should follow the changes made in the parsed file.
+ */
+bool
+UtS9sConfigFile::testChange()
+{
+    S9sConfigFile config;
+    S9sString     content = 
+        "cmon_user = pipas\n"
+        "\n"
+        "[global]\n"
+        "cluster_id = 1\n"
+        "#commented = 10\n";
+
+    S9S_VERIFY(config.parse(STR(content)));
+    S9S_COMPARE(config.variableValue("cluster_id"), "1");
+    
+    S9S_VERIFY(config.changeVariable("global", "cluster_id", "3"));
+    S9S_COMPARE(config.variableValue("cluster_id"), "3");
+    
+    S9S_VERIFY(config.disableVariable("cluster_id"));
+    S9S_COMPARE(config.variableValue("cluster_id"), "");
+    S9S_VERIFY(!config.hasVariable("global", "cluster_id"));
+    S9S_VERIFY(config.hasVariable("global", "cluster_id", true));
+    
+    S9S_VERIFY(config.changeVariable("global", "cluster_id", "4"));
+    S9S_COMPARE(config.variableValue("cluster_id"), "4");
+
+    S9S_VERIFY(config.addVariable("global", "new_var", "new"));
+    S9S_COMPARE(config.variableValue("global", "new_var"), "new");
+    
+    S9S_VERIFY(config.addVariable("other", "new_var", "other"));
+    S9S_COMPARE(config.variableValue("other", "new_var"), "other");
+    S9S_COMPARE(config.variableValue("new_var"), "new");
+
+    S9S_VERIFY(config.removeVariable("global", "new_var"));
+    S9S_COMPARE(config.variableValue("global", "new_var"), "");
+    S9S_COMPARE(config.variableValue("new_var"), "other");
+    
+    S9S_VERIFY(config.removeSection("other"));
+    S9S_COMPARE(config.variableValue("new_var"), "");
+    S9S_VERIFY(!config.hasSection("other"));
+
+    S9S_VERIFY(config.setVariable("", "cmon_user", "admin"));
+    S9S_COMPARE(config.variableValue("cmon_user"), "admin");
+    
+    S9S_VERIFY(config.parse("cmon_user = other\n"));
+    S9S_COMPARE(config.variableValue("cmon_user"), "other");
+    S9S_COMPARE(config.variableValue("cluster_id"), "");
+
+    return true;
+}
+
 S9S_UNIT_TEST_MAIN(UtS9sConfigFile)
@@ -28,5 +28,7 @@ class UtS9sConfigFile : public S9sUnitTest
     
     protected:
         bool testParse();
+        bool testVariables();
+        bool testChange();
 };
 
@@ -39,6 +39,8 @@ UtS9sDateTime::runTest(const char *testName)
     bool retval = true;
 
     PERFORM_TEST(testCreate,          retval);
+    PERFORM_TEST(testParse,           retval);
+    PERFORM_TEST(testTzFormat,        retval);
 
     return retval;
 }
@@ -78,5 +80,110 @@ UtS9sDateTime::testCreate()
     return true;
 }
 
+/**
+ * The parse() method detects the format from the first characters of the
+ * string.
+ */
+bool
+UtS9sDateTime::testParse()
+{
+    S9sDateTime dateTime;
+    int         length;
+
+    S9S_VERIFY(dateTime.parse("2014-03-17 10:15:12", &length));
+    S9S_COMPARE(length, 19);
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2014-03-17 10:15:12");
+    
+    S9S_VERIFY(dateTime.parse("2014/03/17 10:15:12"));
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2014-03-17 10:15:12");
+
+    S9S_VERIFY(dateTime.parse("140415  0:44:42", &length));
+    S9S_COMPARE(length, 15);
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2014-04-15 00:44:42");
+
+    S9S_VERIFY(dateTime.parse("130516 9:36:25", &length));
+    S9S_COMPARE(length, 14);
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2013-05-16 09:36:25");
+
+    S9S_VERIFY(dateTime.parse("may  4 14:59:21", &length));
+    S9S_COMPARE(length, 15);
+    S9S_COMPARE(dateTime.toString(S9sDateTime::LogFileFormat), 
+            "May 04 14:59:21");
+    S9S_COMPARE(dateTime.year(), S9sDateTime::currentDateTime().year());
+
+    // Every local hour is converted once, the rest comes from the cache.
+    S9S_VERIFY(dateTime.parse("2014-03-17 10:59:59"));
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2014-03-17 10:59:59");
+
+    S9S_VERIFY(dateTime.parse("2014-03-17 11:00:00"));
+    S9S_COMPARE(dateTime.toString(S9sDateTime::MySqlLogFileFormat), 
+            "2014-03-17 11:00:00");
+
+    S9S_VERIFY(!dateTime.parse(""));
+    S9S_VERIFY(!dateTime.parse("hello world"));
+    S9S_VERIFY(!dateTime.parse("2014-03-17"));
+    S9S_VERIFY(!dateTime.parse("2014-03-17 10:15"));
+    S9S_VERIFY(!dateTime.parse("2014-03-17T10:15:12"));
+    S9S_VERIFY(!dateTime.parse("2014-03-17T10:15:12.Z"));
+
+    return true;
+}
+
+/**
+ * The "2016-06-06T11:47:39.500Z" format is in UTC, the time zone offsets and
+ * the fractions of the seconds are also parsed.
+ */
+bool
+UtS9sDateTime::testTzFormat()
+{
+    S9sDateTime dateTime;
+    int         length;
+
+    S9S_VERIFY(dateTime.parse("2016-06-06T11:47:39.500Z", &length));
+    S9S_COMPARE(length, 24);
+    S9S_VERIFY(dateTime.toTimeT() == 1465213659);
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.500Z");
+
+    S9S_VERIFY(dateTime.parse("2016-06-06T11:47:39.5Z"));
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.500Z");
+    
+    S9S_VERIFY(dateTime.parse("2016-06-06T11:47:39.123456789Z"));
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.123Z");
+
+    S9S_VERIFY(dateTime.parse("2016-06-06T11:47:39Z", &length));
+    S9S_COMPARE(length, 20);
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.000Z");
+
+    S9S_VERIFY(dateTime.parse("2016-06-06T13:47:39.000+02:00", &length));
+    S9S_COMPARE(length, 29);
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.000Z");
+
+    S9S_VERIFY(dateTime.parse("2016-06-06T06:17:39-0530"));
+    S9S_COMPARE(dateTime.toString(), "2016-06-06T11:47:39.000Z");
+
+    // Leap years and the end of the year.
+    S9S_VERIFY(dateTime.parse("2024-02-29T23:59:59.999Z"));
+    S9S_VERIFY(dateTime.toTimeT() == 1709251199);
+    S9S_COMPARE(dateTime.toString(), "2024-02-29T23:59:59.999Z");
+
+    S9S_VERIFY(dateTime.parse("1999-12-31T23:59:59Z"));
+    S9S_VERIFY(dateTime.toTimeT() == 946684799);
+
+    // The same second with different milliseconds.
+    S9sDateTime first(1465213659), second(1465213659);
+
+    second.parse("2016-06-06T11:47:39.042Z");
+    S9S_COMPARE(first.toString(), "2016-06-06T11:47:39.000Z");
+    S9S_COMPARE(second.toString(), "2016-06-06T11:47:39.042Z");
+    S9S_COMPARE(first.toString(), "2016-06-06T11:47:39.000Z");
+
+    return true;
+}
+
 S9S_UNIT_TEST_MAIN(UtS9sDateTime)
 
@@ -28,6 +28,8 @@ class UtS9sDateTime : public S9sUnitTest
     
     protected:
         bool testCreate();
+        bool testParse();
+        bool testTzFormat();
 };
 
 
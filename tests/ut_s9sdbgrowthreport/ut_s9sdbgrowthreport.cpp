@@ -0,0 +1,353 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9sdbgrowthreport.h"
+
+#include "S9sOptions"
+#include "S9sRpcReply"
+#include "S9sOutput"
+
+#include <time.h>
+#include <unistd.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+UtS9sDbGrowthReport::UtS9sDbGrowthReport()
+{
+}
+
+UtS9sDbGrowthReport::~UtS9sDbGrowthReport()
+{
+}
+
+bool
+UtS9sDbGrowthReport::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testByDate,   retval);
+    PERFORM_TEST(testByDb,     retval);
+    PERFORM_TEST(testByTable,  retval);
+    PERFORM_TEST(testLimit,    retval);
+
+    return retval;
+}
+
+/**
+ * \returns The date the given number of days ago at 10:20:30 formatted with
+ *   the given strftime() format string.
+ */
+static S9sString
+dateOf(
+        int         daysAgo,
+        const char *format)
+{
+    time_t    when = time(NULL) - daysAgo * 24 * 3600;
+    struct tm tm;
+    char      buffer[64];
+
+    gmtime_r(&when, &tm);
+    tm.tm_hour = 10;
+    tm.tm_min  = 20;
+    tm.tm_sec  = 30;
+
+    strftime(buffer, sizeof(buffer), format, &tm);
+    return buffer;
+}
+
+/**
+ * \returns The "created" string the controller sends in the db growth records
+ *   and that the report prints in the DATE column.
+ */
+static S9sString
+createdOf(
+        int daysAgo)
+{
+    return dateOf(daysAgo, "%b %e %H:%M:%S");
+}
+
+static S9sVariantMap
+tableOf(
+        const char *name,
+        ulonglong   rows,
+        ulonglong   dataSize,
+        ulonglong   indexSize)
+{
+    S9sVariantMap retval;
+
+    retval["table_name"] = name;
+    retval["row_count"]  = rows;
+    retval["data_size"]  = dataSize;
+    retval["index_size"] = indexSize;
+
+    return retval;
+}
+
+/**
+ * \returns A database entry with the sums of the given tables as the
+ *   database totals.
+ */
+static S9sVariantMap
+databaseOf(
+        const char           *name,
+        const S9sVariantList &tables)
+{
+    S9sVariantMap retval;
+    ulonglong     rows      = 0ull;
+    ulonglong     dataSize  = 0ull;
+    ulonglong     indexSize = 0ull;
+
+    for (uint idx = 0u; idx < tables.size(); ++idx)
+    {
+        S9sVariantMap table = tables[idx].toVariantMap();
+
+        rows      += table["row_count"].toULongLong();
+        dataSize  += table["data_size"].toULongLong();
+        indexSize += table["index_size"].toULongLong();
+    }
+
+    retval["db_name"]    = name;
+    retval["row_count"]  = rows;
+    retval["data_size"]  = dataSize;
+    retval["index_size"] = indexSize;
+    retval["tables"]     = tables;
+
+    return retval;
+}
+
+static S9sVariantMap
+recordOf(
+        int                   daysAgo,
+        const S9sVariantList &dbs)
+{
+    S9sVariantMap retval;
+
+    retval["class_name"] = "CmonDbStats";
+    retval["created"]    = createdOf(daysAgo);
+    retval["year"]       = dateOf(daysAgo, "%Y").toInt();
+    retval["dbs"]        = dbs;
+
+    return retval;
+}
+
+/**
+ * \returns A dbgrowth reply with records from yesterday, from two days ago, 
+ *   an empty record from three days ago and one that is too old to be 
+ *   reported.
+ */
+static S9sVariantMap
+dbGrowthReply()
+{
+    S9sVariantMap  reply;
+    S9sVariantList data, dbs, tables;
+
+    tables << tableOf("orders", 1000ull, 98304ull, 16384ull);
+    tables << tableOf("items", 500ull, 32768ull, 16384ull);
+    dbs    << databaseOf("shop", tables);
+    tables.clear();
+
+    tables << tableOf("contacts", 20ull, 16384ull, 0ull);
+    dbs    << databaseOf("crm", tables);
+    tables.clear();
+
+    dbs    << databaseOf("empty", tables);
+    data   << recordOf(1, dbs);
+    dbs.clear();
+
+    tables << tableOf("orders", 900ull, 81920ull, 16384ull);
+    tables << tableOf("items", 500ull, 32768ull, 16384ull);
+    dbs    << databaseOf("shop", tables);
+    tables.clear();
+
+    tables << tableOf("contacts", 20ull, 16384ull, 0ull);
+    dbs    << databaseOf("crm", tables);
+    data   << recordOf(2, dbs);
+    data   << recordOf(40, dbs);
+    dbs.clear();
+
+    data   << recordOf(3, dbs);
+
+    reply["request_status"] = "Ok";
+    reply["data"]           = data;
+
+    return reply;
+}
+
+/**
+ * Reads the given extra command line options for "s9s dbschema --dbgrowth",
+ * prints the db growth report of the test reply and returns what was printed
+ * on the standard output.
+ */
+static S9sString
+reportOf(
+        const char *option1 = NULL,
+        const char *option2 = NULL)
+{
+    const char *argv[] = 
+    { 
+        "/bin/s9s", "dbschema", "--dbgrowth", "--cluster-id=1",
+        "--color=never", option1, option2, NULL 
+    };
+    int         argc       = option1 == NULL ? 5 : option2 == NULL ? 6 : 7;
+    char        fileName[] = "/tmp/ut_s9sdbgrowthreport_XXXXXX";
+    int         fileFd;
+    int         savedFd;
+    S9sRpcReply reply;
+    S9sString   retval;
+    S9sString   errorString;
+
+    S9sOptions::uninit();
+    if (!S9sOptions::instance()->readOptions(&argc, (char **) argv))
+        return retval;
+
+    fileFd = mkstemp(fileName);
+    if (fileFd < 0)
+        return retval;
+
+    reply = dbGrowthReply();
+
+    S9sOutput::flush();
+    fflush(stdout);
+    savedFd = dup(STDOUT_FILENO);
+    dup2(fileFd, STDOUT_FILENO);
+
+    reply.printDbGrowthList();
+    S9sOutput::flush();
+
+    dup2(savedFd, STDOUT_FILENO);
+    close(savedFd);
+    close(fileFd);
+
+    S9sString::readFile(fileName, retval, errorString);
+    unlink(fileName);
+    S9sOptions::uninit();
+
+    return retval;
+}
+
+/**
+ * Without --date and --name the report has one line per day, the database
+ * totals summed up, the newest first and the records older than a month left
+ * out.
+ */
+bool
+UtS9sDbGrowthReport::testByDate()
+{
+    S9sString expected;
+
+    expected = 
+        "DATE            DATA_SIZE INDEX_SIZE TOTAL_SIZE \n" +
+        createdOf(1) + "    147456      32768     180224 \n" +
+        createdOf(2) + "    131072      32768     163840 \n" +
+        createdOf(3) + "         0          0          0 \n";
+
+    S9S_COMPARE(reportOf(), expected);
+    return true;
+}
+
+/**
+ * With --date the report has one line per database for the given day, the
+ * largest first. Nothing is printed for a day without records.
+ */
+bool
+UtS9sDbGrowthReport::testByDb()
+{
+    S9sString date = "--date=" + dateOf(1, "%Y-%m-%d");
+    S9sString expected;
+
+    expected = 
+        "DATE            DB_NAME TABLES_ROWS DATA_SIZE INDEX_SIZE "
+        "TOTAL_SIZE \n" +
+        createdOf(1) + " shop           1500    131072      32768     "
+        "163840 \n" +
+        createdOf(1) + " crm              20     16384          0      "
+        "16384 \n" +
+        createdOf(1) + " empty             0         0          0          "
+        "0 \n";
+
+    S9S_COMPARE(reportOf(STR(date)), expected);
+
+    date = "--date=" + dateOf(5, "%Y-%m-%d");
+    S9S_COMPARE(reportOf(STR(date)), "");
+
+    return true;
+}
+
+/**
+ * With --name the report has one line per table and day for the databases
+ * with the given name prefix, the largest first.
+ */
+bool
+UtS9sDbGrowthReport::testByTable()
+{
+    S9sString expected;
+
+    expected = 
+        "DATE            DB_NAME TABLE_NAME TABLES_ROWS DATA_SIZE "
+        "INDEX_SIZE TOTAL_SIZE \n" +
+        createdOf(1) + " shop    orders            1000     98304      "
+        "16384     114688 \n" +
+        createdOf(2) + " shop    orders             900     81920      "
+        "16384      98304 \n" +
+        createdOf(1) + " shop    items              500     32768      "
+        "16384      49152 \n" +
+        createdOf(2) + " shop    items              500     32768      "
+        "16384      49152 \n";
+
+    S9S_COMPARE(reportOf("--name=SH"), expected);
+    return true;
+}
+
+/**
+ * The --limit option prints only the first lines of the report.
+ */
+bool
+UtS9sDbGrowthReport::testLimit()
+{
+    S9sString date = "--date=" + dateOf(1, "%Y-%m-%d");
+    S9sString expected;
+
+    expected = 
+        "DATE            DATA_SIZE INDEX_SIZE TOTAL_SIZE \n" +
+        createdOf(1) + "    147456      32768     180224 \n" +
+        createdOf(2) + "    131072      32768     163840 \n";
+
+    S9S_COMPARE(reportOf("--limit=2"), expected);
+
+    expected = 
+        "DATE            DB_NAME TABLES_ROWS DATA_SIZE INDEX_SIZE "
+        "TOTAL_SIZE \n" +
+        createdOf(1) + " shop           1500    131072      32768     "
+        "163840 \n";
+
+    S9S_COMPARE(reportOf(STR(date), "--limit=1"), expected);
+
+    expected = 
+        "DATE            DB_NAME TABLE_NAME TABLES_ROWS DATA_SIZE "
+        "INDEX_SIZE TOTAL_SIZE \n" +
+        createdOf(1) + " shop    orders            1000     98304      "
+        "16384     114688 \n";
+
+    S9S_COMPARE(reportOf("--name=shop", "--limit=1"), expected);
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sDbGrowthReport)
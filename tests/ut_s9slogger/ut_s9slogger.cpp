@@ -0,0 +1,182 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9slogger.h"
+
+#include "S9sLogger"
+#include "S9sFile"
+
+#include <unistd.h>
+
+//#define DEBUG
+#include "s9sdebug.h"
+
+#define LOG_FILE_NAME "/tmp/ut_s9slogger.log"
+
+static int nEvaluated = 0;
+
+static const char *
+evaluated()
+{
+    ++nEvaluated;
+    return "evaluated";
+}
+
+UtS9sLogger::UtS9sLogger()
+{
+}
+
+UtS9sLogger::~UtS9sLogger()
+{
+    unlink(LOG_FILE_NAME);
+    unlink(LOG_FILE_NAME ".1");
+}
+
+bool
+UtS9sLogger::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testLog,           retval);
+    PERFORM_TEST(testThreshold,     retval);
+    PERFORM_TEST(testRotate,        retval);
+
+    return retval;
+}
+
+/**
+ * Checking that the lines are written into the log file and nothing is logged
+ * while the log file is not open.
+ */
+bool
+UtS9sLogger::testLog()
+{
+    S9sLogger *logger = S9sLogger::instance();
+    S9sFile    file(LOG_FILE_NAME);
+    S9sString  content;
+
+    unlink(LOG_FILE_NAME);
+    nEvaluated = 0;
+
+    PRINT_LOG("Not logged: %s", evaluated());
+    S9S_COMPARE(nEvaluated, 0);
+
+    S9S_VERIFY(logger->open(LOG_FILE_NAME));
+    S9S_COMPARE(logger->fileName(), LOG_FILE_NAME);
+
+    PRINT_LOG("The first line: %d", 42);
+    S9S_LOG(LogError, "The second line: %s", evaluated());
+    S9S_COMPARE(nEvaluated, 1);
+
+    logger->close();
+    S9S_COMPARE(logger->fileName(), "");
+
+    S9S_VERIFY(file.readTxtFile(content));
+    S9S_VERIFY(content.contains("DEBUG The first line: 42\n"));
+    S9S_VERIFY(content.contains("ERROR The second line: evaluated\n"));
+    S9S_VERIFY(!content.contains("Not logged"));
+
+    return true;
+}
+
+/**
+ * The messages under the threshold are dropped before the arguments are
+ * evaluated.
+ */
+bool
+UtS9sLogger::testThreshold()
+{
+    S9sLogger *logger = S9sLogger::instance();
+    S9sFile    file(LOG_FILE_NAME);
+    S9sString  content;
+
+    unlink(LOG_FILE_NAME);
+    nEvaluated = 0;
+
+    logger->setThreshold(LogWarning);
+    S9S_VERIFY(logger->open(LOG_FILE_NAME));
+
+    PRINT_LOG("Debug: %s", evaluated());
+    S9S_LOG(LogInfo, "Info: %s", evaluated());
+    S9S_LOG(LogWarning, "Warning: %s", evaluated());
+    S9S_COMPARE(nEvaluated, 1);
+
+    logger->close();
+    logger->setThreshold(LogDebug);
+
+    S9S_VERIFY(file.readTxtFile(content));
+    S9S_VERIFY(!content.contains("Debug:"));
+    S9S_VERIFY(!content.contains("Info:"));
+    S9S_VERIFY(content.contains("WARNING Warning: evaluated\n"));
+
+    // The names in the "log_level" config variable.
+    S9sLogSeverity severity = LogDebug;
+
+    S9S_VERIFY(S9sLogger::severityFromName("warning", severity));
+    S9S_COMPARE(severity, LogWarning);
+    S9S_VERIFY(S9sLogger::severityFromName(" Error", severity));
+    S9S_COMPARE(severity, LogError);
+    S9S_VERIFY(S9sLogger::severityFromName("OFF", severity));
+    S9S_COMPARE(severity, LogOff);
+    S9S_VERIFY(S9sLogger::severityFromName("debug", severity));
+    S9S_COMPARE(severity, LogDebug);
+    S9S_VERIFY(!S9sLogger::severityFromName("verbose", severity));
+    S9S_COMPARE(severity, LogDebug);
+
+    return true;
+}
+
+/**
+ * Checking that the log file is renamed and a new one is started when the file
+ * grows too big.
+ */
+bool
+UtS9sLogger::testRotate()
+{
+    S9sLogger *logger = S9sLogger::instance();
+    S9sFile    file(LOG_FILE_NAME);
+    S9sFile    oldFile(LOG_FILE_NAME ".1");
+    S9sString  content;
+
+    unlink(LOG_FILE_NAME);
+    unlink(LOG_FILE_NAME ".1");
+
+    logger->setMaxFileSize(100);
+    S9S_VERIFY(logger->open(LOG_FILE_NAME));
+    
+    PRINT_LOG("The first line that fills the log file.");
+    logger->flush();
+    S9S_VERIFY(oldFile.exists());
+    
+    PRINT_LOG("The second line.");
+    logger->close();
+    logger->setMaxFileSize(0);
+
+    S9S_VERIFY(oldFile.readTxtFile(content));
+    S9S_VERIFY(content.contains("The first line"));
+    S9S_VERIFY(!content.contains("The second line"));
+
+    S9S_VERIFY(file.readTxtFile(content));
+    S9S_VERIFY(!content.contains("The first line"));
+    S9S_VERIFY(content.contains("The second line"));
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sLogger)
@@ -0,0 +1,137 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9smulticontroller.h"
+
+#include "S9sMultiController"
+#include "S9sOptions"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+UtS9sMultiController::UtS9sMultiController()
+{
+}
+
+UtS9sMultiController::~UtS9sMultiController()
+{
+}
+
+bool
+UtS9sMultiController::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testParseUrl,    retval);
+    PERFORM_TEST(testFailures,    retval);
+
+    return retval;
+}
+
+/**
+ * The controller URLs are parsed the same way the --controller is parsed.
+ */
+bool
+UtS9sMultiController::testParseUrl()
+{
+    S9sString hostName;
+    S9sString path;
+    int       port;
+    bool      useTls;
+
+    S9S_VERIFY(S9sMultiController::parseUrl(
+                "https://10.0.0.1:9555/v2", hostName, port, path, useTls));
+    S9S_COMPARE(hostName, "10.0.0.1");
+    S9S_COMPARE(port,     9555);
+    S9S_COMPARE(path,     "/v2");
+    S9S_VERIFY(useTls);
+    
+    S9S_VERIFY(S9sMultiController::parseUrl(
+                "http://ctl2", hostName, port, path, useTls));
+    S9S_COMPARE(hostName, "ctl2");
+    S9S_COMPARE(port,     9501);
+    S9S_COMPARE(path,     "");
+    S9S_VERIFY(!useTls);
+    
+    S9S_VERIFY(S9sMultiController::parseUrl(
+                " ctl3:9600 ", hostName, port, path, useTls));
+    S9S_COMPARE(hostName, "ctl3");
+    S9S_COMPARE(port,     9600);
+
+    S9S_VERIFY(!S9sMultiController::parseUrl(
+                "http://", hostName, port, path, useTls));
+    S9S_VERIFY(!S9sMultiController::parseUrl(
+                "ctl4/path", hostName, port, path, useTls));
+
+    return true;
+}
+
+/**
+ * The controllers that can not be reached are reported in the results, the
+ * merged reply is still a valid list.
+ */
+bool
+UtS9sMultiController::testFailures()
+{
+    S9sOptions     *options = S9sOptions::instance();
+    S9sVariantList  results;
+    S9sRpcReply     reply;
+    const char     *argv[] = 
+    { 
+        "/bin/s9s", "cluster", "--list", 
+        "--controllers=http://127.0.0.1:1;ctl4/path",
+        NULL 
+    };
+    int   argc   = sizeof(argv) / sizeof(char *) - 1;
+
+    S9S_VERIFY(options->readOptions(&argc, (char**)argv));
+    S9S_VERIFY(options->hasControllers());
+    S9S_VERIFY(options->controllers().size() == 2u);
+    S9S_VERIFY(S9sMultiController::isSupported());
+
+    S9sMultiController multi(options->controllers());
+
+    multi.setParallelism(0);
+    S9S_COMPARE(multi.parallelism(), 1);
+    multi.setParallelism(4);
+
+    S9S_VERIFY(!multi.execute());
+
+    results = multi.results();
+    S9S_VERIFY(results.size() == 2u);
+    S9S_COMPARE(
+            results[0].toVariantMap().at("controller").toString(), 
+            "http://127.0.0.1:1");
+    S9S_VERIFY(!results[0].toVariantMap().at("success").toBoolean());
+    S9S_VERIFY(!results[0].toVariantMap().at("error_string").toString().empty());
+    S9S_COMPARE(
+            results[1].toVariantMap().at("error_string").toString(), 
+            "Invalid controller URL.");
+
+    reply = multi.reply();
+    S9S_VERIFY(reply.isOk());
+    S9S_VERIFY(reply["clusters"].toVariantList().empty());
+    S9S_VERIFY(reply["controllers"].toVariantList().size() == 2u);
+    
+    S9sOptions::uninit();
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sMultiController)
@@ -23,6 +23,9 @@
 #include "S9sVariantMap"
 #include "S9sRpcClient"
 #include "S9sOptions"
+#include "S9sFormatTemplate"
+
+#include <ctime>
 
 #define DEBUG
 #define WARNING
@@ -111,6 +114,8 @@ UtS9sNode::runTest(const char *testName)
     PERFORM_TEST(testSetProperties,   retval);
     PERFORM_TEST(testAssign,          retval);
     PERFORM_TEST(testToString,        retval);
+    PERFORM_TEST(testFormatTemplate,  retval);
+    PERFORM_TEST(testFormatPerformance, retval);
     PERFORM_TEST(testVariant01,       retval);
     PERFORM_TEST(testVariant02,       retval);
     PERFORM_TEST(testParse,           retval);
@@ -268,6 +273,111 @@ UtS9sNode::testToString()
 }
 
 
+/**
+ * Checking that the format string is split into the right parts and the
+ * compiled template produces the same string as the format string itself.
+ */
+bool
+UtS9sNode::testFormatTemplate()
+{
+    S9sVariantMap     theMap;
+    S9sNode           theNode;
+    S9sString         formatString = "%-16N|%5P|%%|%fm\\t%8.2fk\\n";
+    S9sFormatTemplate format(formatString, "f");
+
+    S9S_VERIFY(theMap.parse(hostJson1));
+    theNode = theMap;
+
+    S9S_COMPARE((int) format.size(), 8);
+    S9S_VERIFY(!format.part(0).isLiteral());
+    S9S_COMPARE(format.part(0).directive, 'N');
+    S9S_COMPARE(format.part(0).prefix, "%-16");
+    S9S_COMPARE(format.part(1).literal, "|");
+    S9S_COMPARE(format.part(3).literal, "|%|");
+    S9S_COMPARE(format.part(4).directive, 'm');
+    S9S_COMPARE(format.part(4).modifier, 'f');
+    S9S_COMPARE(format.part(5).literal, "\t");
+    S9S_COMPARE(format.part(6).prefix, "%8.2");
+    S9S_COMPARE(format.part(6).modifier, 'f');
+    S9S_COMPARE(format.part(7).literal, "\n");
+    
+    S9S_COMPARE(
+            theNode.toString(false, format), 
+            theNode.toString(false, formatString));
+
+    S9S_COMPARE(
+            theNode.toString(false, "%-16N|%5P|%%\\n"),
+            "192.168.1.189   | 3306|%\n");
+
+    S9S_VERIFY(
+            &S9sFormatTemplate::compiled(formatString, "f") == 
+            &S9sFormatTemplate::compiled(formatString, "f"));
+
+    return true;
+}
+
+/**
+ * Prints a large number of nodes with a format string the way the 
+ * "node --list --node-format" does, once compiling the format string for every
+ * node and once using the compiled template. The timings are printed in 
+ * verbose mode.
+ */
+bool
+UtS9sNode::testFormatPerformance()
+{
+    S9sString         formatString = "%-20N %5P %S %-10R %V %M %a%z\\n";
+    const S9sFormatTemplate &format = 
+        S9sFormatTemplate::compiled(formatString, "f");
+    S9sVariantMap     theMap;
+    S9sVector<S9sNode> nodes;
+    struct timespec   start, end;
+    double            parsing, compiled;
+    ulonglong         length1 = 0ull, length2 = 0ull;
+    const int         nNodes = 10000;
+
+    S9S_VERIFY(theMap.parse(hostJson1));
+    for (int idx = 0; idx < nNodes; ++idx)
+    {
+        S9sString hostName;
+
+        hostName.sprintf("10.0.%d.%d", idx / 250, idx % 250);
+        theMap["hostname"] = hostName;
+        theMap["hostId"]   = idx;
+        nodes << S9sNode(theMap);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int idx = 0; idx < nNodes; ++idx)
+    {
+        S9sFormatTemplate perNode(formatString, "f");
+
+        length1 += nodes[idx].toString(false, perNode).length();
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    parsing = 
+        (end.tv_sec - start.tv_sec) * 1000.0 +
+        (end.tv_nsec - start.tv_nsec) / 1000000.0;
+    
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int idx = 0; idx < nNodes; ++idx)
+        length2 += nodes[idx].toString(false, format).length();
+    
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    compiled = 
+        (end.tv_sec - start.tv_sec) * 1000.0 +
+        (end.tv_nsec - start.tv_nsec) / 1000000.0;
+
+    if (isVerbose())
+    {
+        printf("\n  %d nodes, compiled per node: %.2f ms, compiled once: "
+                "%.2f ms\n", nNodes, parsing, compiled);
+    }
+
+    S9S_COMPARE(length1, length2);
+    return true;
+}
+
 /**
  * Here we put the node into a variant map, then we convert the variant map to a
  * JSon string to see that it is fully integrated into the map.
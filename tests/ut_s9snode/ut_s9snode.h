@@ -31,6 +31,8 @@ class UtS9sNode : public S9sUnitTest
         bool testSetProperties();
         bool testAssign();
         bool testToString();
+        bool testFormatTemplate();
+        bool testFormatPerformance();
         bool testVariant01();
         bool testVariant02();
         bool testParse();
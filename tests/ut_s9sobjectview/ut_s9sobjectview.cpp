@@ -0,0 +1,197 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9sobjectview.h"
+
+#include "S9sNodeView"
+#include "S9sClusterView"
+#include "S9sJobView"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+#define CLUSTER_SOURCE \
+"{\n" \
+"    \"class_name\": \"CmonClusterInfo\",\n" \
+"    \"cluster_id\": 1,\n" \
+"    \"cluster_name\": \"ft_galera\",\n" \
+"    \"cluster_type\": \"GALERA\",\n" \
+"    \"state\": \"STARTED\",\n" \
+"    \"hosts\": [\n" \
+"    {\n" \
+"        \"class_name\": \"CmonGaleraHost\",\n" \
+"        \"clusterid\": 1,\n" \
+"        \"hostId\": 3,\n" \
+"        \"hostname\": \"192.168.0.127\",\n" \
+"        \"hoststatus\": \"CmonHostOnline\",\n" \
+"        \"port\": 3306\n" \
+"    } ]\n" \
+"}\n"
+
+#define JOB_SOURCE \
+"{\n" \
+"    \"class_name\": \"CmonJobInstance\",\n" \
+"    \"cluster_id\": 1,\n" \
+"    \"job_id\": 42,\n" \
+"    \"status\": \"FINISHED\",\n" \
+"    \"title\": \"Create Cluster\",\n" \
+"    \"user_id\": 3\n" \
+"}\n"
+
+UtS9sObjectView::UtS9sObjectView()
+{
+}
+
+UtS9sObjectView::~UtS9sObjectView()
+{
+}
+
+bool
+UtS9sObjectView::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testInvalid,      retval);
+    PERFORM_TEST(testNodeView,     retval);
+    PERFORM_TEST(testClusterView,  retval);
+    PERFORM_TEST(testJobView,      retval);
+
+    return retval;
+}
+
+/**
+ * Views created from nothing or from variants that are not maps are still
+ * usable, they simply have no properties.
+ */
+bool
+UtS9sObjectView::testInvalid()
+{
+    S9sNodeView    nodeView;
+    S9sJobView     jobView(S9sVariant(42));
+    S9sClusterView clusterView;
+
+    S9S_VERIFY(!nodeView.isValid());
+    S9S_VERIFY(!jobView.isValid());
+    S9S_VERIFY(!nodeView.hasProperty("hostname"));
+    S9S_VERIFY(!nodeView.property("hostname").isString());
+    S9S_COMPARE(nodeView.hostName(), "");
+    S9S_COMPARE(nodeView.port(), 0);
+    S9S_COMPARE(jobView.jobId(), 0);
+    S9S_COMPARE(jobView.title(), "");
+    S9S_COMPARE(clusterView.hosts().size(), 0);
+    S9S_VERIFY(clusterView.toVariantMap().empty());
+
+    return true;
+}
+
+/**
+ * The node view reads the properties of the host in place.
+ */
+bool
+UtS9sObjectView::testNodeView()
+{
+    S9sVariantMap  cluster;
+
+    S9S_VERIFY(cluster.parse(CLUSTER_SOURCE));
+
+    const S9sVariantList &hosts = cluster["hosts"].toVariantList();
+    S9sNodeView           nodeView(hosts[0]);
+    S9sNode               node;
+
+    S9S_VERIFY(nodeView.isValid());
+    S9S_VERIFY(&nodeView.toVariantMap() == &hosts[0].toVariantMap());
+    S9S_COMPARE(nodeView.className(), "CmonGaleraHost");
+    S9S_COMPARE(nodeView.hostId(), 3);
+    S9S_COMPARE(nodeView.clusterId(), 1);
+    S9S_COMPARE(nodeView.port(), 3306);
+    S9S_COMPARE(nodeView.hostName(), "192.168.0.127");
+    S9S_COMPARE(nodeView.name(), "192.168.0.127");
+    S9S_COMPARE(nodeView.hostStatus(), "CmonHostOnline");
+
+    // The cached values are returned on the second access too.
+    S9S_COMPARE(nodeView.hostName(), "192.168.0.127");
+    S9S_COMPARE(nodeView.port(), 3306);
+    
+    node = nodeView.toNode();
+    S9S_COMPARE(node.hostName(), "192.168.0.127");
+    S9S_COMPARE(node.port(), 3306);
+
+    return true;
+}
+
+/**
+ * The cluster view and the hosts of the cluster.
+ */
+bool
+UtS9sObjectView::testClusterView()
+{
+    S9sVariantMap  theMap;
+
+    S9S_VERIFY(theMap.parse(CLUSTER_SOURCE));
+
+    S9sClusterView clusterView(theMap);
+    S9sCluster     cluster;
+
+    S9S_VERIFY(clusterView.isValid());
+    S9S_COMPARE(clusterView.clusterId(), 1);
+    S9S_COMPARE(clusterView.name(), "ft_galera");
+    S9S_COMPARE(clusterView.state(), "STARTED");
+    S9S_COMPARE(clusterView.clusterType(), "GALERA");
+    S9S_COMPARE(clusterView.hosts().size(), 1);
+    S9S_VERIFY(&clusterView.hosts() == &theMap["hosts"].toVariantList());
+
+    S9sNodeView    nodeView(clusterView.hosts()[0]);
+    S9S_COMPARE(nodeView.hostName(), "192.168.0.127");
+
+    cluster = clusterView.toCluster();
+    S9S_COMPARE(cluster.name(), "ft_galera");
+    S9S_COMPARE(cluster.clusterId(), 1);
+
+    return true;
+}
+
+/**
+ * The job view.
+ */
+bool
+UtS9sObjectView::testJobView()
+{
+    S9sVariantMap  theMap;
+
+    S9S_VERIFY(theMap.parse(JOB_SOURCE));
+
+    S9sJobView     jobView(theMap);
+    S9sJob         job;
+
+    S9S_COMPARE(jobView.jobId(), 42);
+    S9S_COMPARE(jobView.clusterId(), 1);
+    S9S_COMPARE(jobView.status(), "FINISHED");
+    S9S_COMPARE(jobView.title(), "Create Cluster");
+    S9S_COMPARE(jobView.property("user_id").toInt(), 3);
+    S9S_VERIFY(!jobView.hasProperty("user_name"));
+
+    job = jobView.toJob();
+    S9S_COMPARE(job.jobId(), 42);
+    S9S_COMPARE(job.title(), "Create Cluster");
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sObjectView)
@@ -56,6 +56,7 @@ UtS9sOptions::runTest(const char *testName)
     PERFORM_TEST(testReadOptions06, retval);
     PERFORM_TEST(testReadOptions07, retval);
     PERFORM_TEST(testSetNodes,      retval);
+    PERFORM_TEST(testResolved,      retval);
 
     return retval;
 }
@@ -452,6 +453,73 @@ UtS9sOptions::testSetNodes()
 }
 
 
-S9S_UNIT_TEST_MAIN(UtS9sOptions)
+/**
+ * Checking that the resolved (typed) options follow the command line and the
+ * changes made later.
+ */
+bool
+UtS9sOptions::testResolved()
+{
+    S9sOptions *options;
+    bool  success;
+    const char *argv1[] = 
+    { 
+        "/bin/s9s", "node", "--list", "--long", "--batch", "--color=always",
+        NULL 
+    };
+    const char *argv2[] = 
+    { 
+        "/bin/s9s", "node", "--list", "--color=always", "--cluster-id=3",
+        "10.0.*", "db1",
+        NULL 
+    };
+    int   argc1  = sizeof(argv1) / sizeof(char *) - 1;
+    int   argc2  = sizeof(argv2) / sizeof(char *) - 1;
+
+    S9sOptions::uninit();
+    options = S9sOptions::instance();
+    success = options->readOptions(&argc1, (char**)argv1);
+    S9S_VERIFY(success);
+    
+    S9S_VERIFY(options->isLongRequested());
+    S9S_VERIFY(options->isBatchRequested());
+    S9S_VERIFY(options->isNoHeaderRequested());
+    S9S_VERIFY(!options->isJsonRequested());
+    S9S_VERIFY(!options->useSyntaxHighlight());
+    S9S_VERIFY(!options->humanReadable());
+    S9S_VERIFY(!options->hasClusterIdOption());
+    S9S_VERIFY(options->isStringMatchExtraArguments("anything"));
+    
+    options->setHumanReadable();
+    S9S_VERIFY(options->humanReadable());
+    
+    S9sOptions::uninit();
+    options = S9sOptions::instance();
+    success = options->readOptions(&argc2, (char**)argv2);
+    S9S_VERIFY(success);
+    
+    S9S_VERIFY(!options->isLongRequested());
+    S9S_VERIFY(!options->isBatchRequested());
+    S9S_VERIFY(!options->isNoHeaderRequested());
+    S9S_VERIFY(options->useSyntaxHighlight());
+    S9S_VERIFY(!options->humanReadable());
+    S9S_VERIFY(options->hasClusterIdOption());
+    S9S_COMPARE(options->clusterId(), 3);
+    
+    // The extra arguments with and without wildcards.
+    S9S_VERIFY(options->isStringMatchExtraArguments("10.0.1.2"));
+    S9S_VERIFY(options->isStringMatchExtraArguments("db1"));
+    S9S_VERIFY(!options->isStringMatchExtraArguments("db10"));
+    S9S_VERIFY(!options->isStringMatchExtraArguments("10.1.1.2"));
+
+    options->addExtraArgument("db1?");
+    S9S_VERIFY(options->isStringMatchExtraArguments("db10"));
+
+    S9S_VERIFY(options->terminalWidth() > 0);
+    S9S_COMPARE(options->terminalWidth(), options->terminalWidth());
 
+    S9sOptions::uninit();
+    return true;
+}
 
+S9S_UNIT_TEST_MAIN(UtS9sOptions)
@@ -0,0 +1,217 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9sprocesstable.h"
+
+#include "S9sProcessTable"
+#include "S9sVariantMap"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * \returns A process as it is in the getRunningProcesses reply.
+ */
+static S9sVariantMap
+process(
+        int         pid,
+        const char *executable,
+        double      cpuUsage,
+        double      memUsage)
+{
+    S9sVariantMap retval;
+
+    retval["pid"]        = pid;
+    retval["user"]       = "mysql";
+    retval["priority"]   = 20;
+    retval["virt_mem"]   = 2048ull * 1024ull;
+    retval["res_mem"]    = 1024ull * 1024ull;
+    retval["cpu_usage"]  = cpuUsage;
+    retval["mem_usage"]  = memUsage;
+    retval["executable"] = executable;
+    retval["state"]      = "S";
+
+    return retval;
+}
+
+static S9sVariantMap
+host(
+        const char           *hostName,
+        const S9sVariantList &processes)
+{
+    S9sVariantMap retval;
+
+    retval["hostname"]  = hostName;
+    retval["processes"] = processes;
+
+    return retval;
+}
+
+UtS9sProcessTable::UtS9sProcessTable()
+{
+}
+
+UtS9sProcessTable::~UtS9sProcessTable()
+{
+}
+
+bool
+UtS9sProcessTable::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testUpdate,    retval);
+    PERFORM_TEST(testOrder,     retval);
+    PERFORM_TEST(testCpuTime,   retval);
+
+    return retval;
+}
+
+/**
+ * The rows are keyed by the host and the PID: the same PID on two hosts is two
+ * processes, the processes that disappear from the reply are removed.
+ */
+bool
+UtS9sProcessTable::testUpdate()
+{
+    S9sProcessTable  table;
+    S9sVariantList   processes1, processes2, hosts;
+    S9sVector<const S9sProcessTable::Row *> rows;
+
+    processes1 << process(1, "systemd", 0.0, 0.1);
+    processes1 << process(100, "mysqld", 10.0, 20.0);
+    processes2 << process(100, "mysqld", 5.0, 30.0);
+    hosts << host("10.0.0.1", processes1);
+    hosts << host("10.0.0.2", processes2);
+
+    table.update(hosts, 1.0);
+    S9S_VERIFY(table.size() == 3u);
+
+    table.selectRows(S9sProcessTable::PidOrder, 10, rows);
+    S9S_VERIFY(rows.size() == 3u);
+    S9S_COMPARE(rows[0]->m_pid, 1);
+    S9S_COMPARE(rows[1]->m_pid, 100);
+    S9S_COMPARE(table.hostName(*rows[1]), "10.0.0.1");
+    S9S_COMPARE(rows[2]->m_pid, 100);
+    S9S_COMPARE(table.hostName(*rows[2]), "10.0.0.2");
+    S9S_COMPARE(rows[2]->m_userName, "mysql");
+    S9S_VERIFY(rows[2]->m_resMem == 1024ull * 1024ull);
+
+    // The mysqld on the first host stopped, the second one changed.
+    processes1.clear();
+    processes1 << process(1, "systemd", 0.0, 0.1);
+    processes2.clear();
+    processes2 << process(100, "mysqld", 7.0, 31.0);
+    processes2 << process(200, "sshd", 1.0, 0.5);
+    hosts.clear();
+    hosts << host("10.0.0.1", processes1);
+    hosts << host("10.0.0.2", processes2);
+
+    table.update(hosts, 2.0);
+    S9S_VERIFY(table.size() == 3u);
+
+    table.selectRows(S9sProcessTable::PidOrder, 10, rows);
+    S9S_VERIFY(rows.size() == 3u);
+    S9S_COMPARE(rows[1]->m_pid, 100);
+    S9S_COMPARE(table.hostName(*rows[1]), "10.0.0.2");
+    S9S_COMPARE(rows[1]->m_memUsage, 31.0);
+    S9S_COMPARE(rows[2]->m_pid, 200);
+
+    table.update(S9sVariantList(), 3.0);
+    S9S_VERIFY(table.empty());
+
+    return true;
+}
+
+/**
+ * Only the first rows are selected, in the order of the selected column.
+ */
+bool
+UtS9sProcessTable::testOrder()
+{
+    S9sProcessTable  table;
+    S9sVariantList   processes, hosts;
+    S9sVector<const S9sProcessTable::Row *> rows;
+
+    for (int pid = 1; pid <= 1000; ++pid)
+    {
+        processes << process(
+                pid, "worker", (pid * 7919) % 1000 / 10.0, pid % 10);
+    }
+
+    hosts << host("10.0.0.1", processes);
+    table.update(hosts, 1.0);
+
+    table.selectRows(S9sProcessTable::CpuUsage, 5, rows);
+    S9S_VERIFY(rows.size() == 5u);
+    S9S_COMPARE(rows[0]->m_cpuUsage, 99.9);
+    S9S_COMPARE(rows[1]->m_cpuUsage, 99.8);
+    S9S_COMPARE(rows[4]->m_cpuUsage, 99.5);
+
+    // The same memory usage: the higher PID comes first.
+    table.selectRows(S9sProcessTable::MemUsage, 3, rows);
+    S9S_VERIFY(rows.size() == 3u);
+    S9S_COMPARE(rows[0]->m_pid, 999);
+    S9S_COMPARE(rows[1]->m_pid, 989);
+    S9S_COMPARE(rows[2]->m_pid, 979);
+    
+    table.selectRows(S9sProcessTable::PidOrder, 2000, rows);
+    S9S_VERIFY(rows.size() == 1000u);
+    S9S_COMPARE(rows[999]->m_pid, 1000);
+
+    return true;
+}
+
+/**
+ * When the controller sends the CPU time the usage is computed from the 
+ * difference between two updates.
+ */
+bool
+UtS9sProcessTable::testCpuTime()
+{
+    S9sProcessTable  table;
+    S9sVariantList   processes, hosts;
+    S9sVariantMap    theProcess = process(100, "mysqld", 3.0, 20.0);
+    S9sVector<const S9sProcessTable::Row *> rows;
+
+    theProcess["cpu_time"] = 10.0;
+    processes << theProcess;
+    hosts << host("10.0.0.1", processes);
+    table.update(hosts, 100.0);
+    
+    // The first time the usage of the controller is shown.
+    table.selectRows(S9sProcessTable::CpuUsage, 1, rows);
+    S9S_COMPARE(rows[0]->m_cpuUsage, 3.0);
+
+    // One CPU second in two seconds.
+    theProcess["cpu_time"] = 11.0;
+    processes.clear();
+    processes << theProcess;
+    hosts.clear();
+    hosts << host("10.0.0.1", processes);
+    table.update(hosts, 102.0);
+    
+    table.selectRows(S9sProcessTable::CpuUsage, 1, rows);
+    S9S_COMPARE(rows[0]->m_cpuUsage, 50.0);
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sProcessTable)
@@ -221,6 +221,7 @@ UtS9sRpcClient::testComposeRequest()
     S9sVariantMap        request;
 
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
 
     request = client.composeRequest();
     if (isVerbose())
@@ -255,6 +256,7 @@ UtS9sRpcClient::testGetNextMaintenance()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
 
     payload = client.lastPayload();
     if (isVerbose())
@@ -278,6 +280,7 @@ UtS9sRpcClient::testGetSqlProcesses()
     
     options->m_options["cluster_id"] = 42;
     options->m_options["limit"]      = 43;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getSqlProcesses());
     
     payload = client.lastPayload();
@@ -302,6 +305,7 @@ UtS9sRpcClient::testGetTopQueries()
     options->m_options["cluster_id"] = 42;
     options->m_options["limit"]      = 43;
     options->m_options["offset"]     = 44;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getTopQueries());
     
     payload = client.lastPayload();
@@ -325,6 +329,7 @@ UtS9sRpcClient::testGetDatabases()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getDatabases());
     
     payload = client.lastPayload();
@@ -349,6 +354,7 @@ UtS9sRpcClient::testGetTree()
     
     options->addExtraArgument("/myPath");
     options->m_options["refresh"] = true;
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.getTree(true));
 
@@ -373,6 +379,7 @@ UtS9sRpcClient::testGetClusterConfig()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getClusterConfig());
     
     payload = client.lastPayload();
@@ -414,6 +421,7 @@ UtS9sRpcClient::testGetCpuInfo()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getCpuInfo(42));
     
     payload = client.lastPayload();
@@ -435,6 +443,7 @@ UtS9sRpcClient::testGetCpuStats()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getCpuStats(42));
     
     payload = client.lastPayload();
@@ -458,6 +467,7 @@ UtS9sRpcClient::testGetSqlStats()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getSqlStats(42));
     
     payload = client.lastPayload();
@@ -481,6 +491,7 @@ UtS9sRpcClient::testGetMemStats()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getMemStats(42));
     
     payload = client.lastPayload();
@@ -504,6 +515,7 @@ UtS9sRpcClient::testGetMemoryStats()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getMemoryStats(42));
     
     payload = client.lastPayload();
@@ -526,6 +538,7 @@ UtS9sRpcClient::testGetRunningProcesses()
     S9sVariantMap       payload;
     
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getRunningProcesses());
     
     payload = client.lastPayload();
@@ -549,6 +562,7 @@ UtS9sRpcClient::testGetJobInstances()
     options->m_options["cluster_id"] = 42;
     options->m_options["limit"] = 10;
     options->m_options["offset"] = 100;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getJobInstances("clustername", 42));
     
     payload = client.lastPayload();
@@ -619,6 +633,7 @@ UtS9sRpcClient::testGetDbGrowth()
     S9sVariantMap       payload;
 
     options->m_options["cluster_id"] = 42;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.getDbGrowth());
 
     payload = client.lastPayload();
@@ -654,6 +669,7 @@ UtS9sRpcClient::testCreateContainer()
     options->m_options["cloud"] = "cloudname";
     options->m_options["subnet_id"] = "subnetname";
     options->m_options["vpc_id"] = "vpcname";
+    options->invalidateResolvedOptions();
 
     /*
      * Calling the test function to emit a request.
@@ -844,6 +860,7 @@ UtS9sRpcClient::testCreateCluster01()
     options->m_options["cluster_type"]      = "galera";
     options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -896,6 +913,7 @@ UtS9sRpcClient::testCreateCluster02()
     options->m_options["cluster_type"]      = "mysqlreplication";
     options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -948,6 +966,7 @@ UtS9sRpcClient::testCreateCluster03()
     options->m_options["cluster_type"]      = "groupreplication";
     options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -998,8 +1017,10 @@ UtS9sRpcClient::testCreateCluster04()
     S9sVariantMap       payload;
     
     options->m_options["cluster_type"]      = "postgresql";
+    options->invalidateResolvedOptions();
     //options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -1052,6 +1073,7 @@ UtS9sRpcClient::testCreateCluster05()
     options->m_options["cluster_type"]      = "mongodb";
     options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -1105,6 +1127,7 @@ UtS9sRpcClient::testCreateCluster06()
     options->m_options["cluster_type"]      = "ndbcluster";
     options->m_options["vendor"]            = "myvendor";
     options->m_options["provider_version"]  = "myversion";
+    options->invalidateResolvedOptions();
 
     options->setNodes("NODE1:42;NODE2:42;NODE3:42");
     options->setContainers("NODE1;NODE2;NODE3");
@@ -1330,6 +1353,7 @@ UtS9sRpcClient::testCreateFailJob()
     options->m_options.clear();
     options->m_options["timeout"] = 100;
     options->m_options["cluster_id"]     = 42;
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.createFailJob());
     S9S_COMPARE(client.uri(0u), "/v2/jobs/");
@@ -1357,6 +1381,7 @@ UtS9sRpcClient::testCreateSuccessJob()
     options->m_options.clear();
     options->m_options["timeout"] = 100;
     options->m_options["cluster_id"]     = 42;
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.createSuccessJob());
     S9S_COMPARE(client.uri(0u), "/v2/jobs/");
@@ -1383,6 +1408,7 @@ UtS9sRpcClient::testRollingRestart()
 
     options->m_options.clear();
     options->m_options["cluster_id"]     = 42;
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.rollingRestart());
     S9S_COMPARE(client.uri(0u), "/v2/jobs/");
@@ -1657,6 +1683,7 @@ UtS9sRpcClient::testAddNode()
 
     hosts << S9sNode("192.168.1.191");
     options->m_options["cluster_id"] = clusterId;
+    options->invalidateResolvedOptions();
     S9S_VERIFY(client.addNode(hosts));
 
     uri     = client.uri(0u);
@@ -1712,6 +1739,7 @@ UtS9sRpcClient::testComposeBackupJob()
     options->m_options["backup_retention"]    = 8;
     options->m_options["to_individual_files"] = true;
     options->m_options["test_server"]         = "testserver1.com";
+    options->invalidateResolvedOptions();
 
     // Composing the backup job.
     job = client.composeBackupJob();
@@ -1839,6 +1867,7 @@ UtS9sRpcClient::testBackup()
     options->m_options["backup_retention"]    = 8;
     options->m_options["to_individual_files"] = true;
     options->m_options["test_server"]         = "testserver1.com";
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.createBackup());
     payload = client.lastPayload();
@@ -2047,6 +2076,7 @@ UtS9sRpcClient::testBackupSchedule()
     options->m_options["to_individual_files"] = true;
     options->m_options["test_server"]         = "testserver1.com";
     options->m_options["recurrence"]          = "0 12 * * 5";
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.createBackupSchedule());
     payload = client.lastPayload();
@@ -2068,6 +2098,7 @@ UtS9sRpcClient::testSetUserPreferences()
     options->m_options["cmon_user"]           = "s9s";
     options->m_options["preferences_to_set"]  = "key1=value1;key2=value2;key3=value3;key4=value4;";
     options->m_options["preferences"]  = true;
+    options->invalidateResolvedOptions();
 
     //====================================================
 
@@ -2090,6 +2121,7 @@ UtS9sRpcClient::testSetUserPreferences()
     //====================================================
 
     options->m_options["preferences_to_set"]  = "key1=BIGVALUE1;key3=BIGVALUE3;";
+    options->invalidateResolvedOptions();
 
     S9S_VERIFY(client.setUserPreferences());
     payload = client.lastPayload();
@@ -2120,6 +2152,7 @@ UtS9sRpcClient::testGetUserPreferences()
     options->setNodes("node1:43");
     options->m_options["cmon_user"]           = "s9s";
     options->m_options["get_preferences"]     = true;
+    options->invalidateResolvedOptions();
 
     //====================================================
 
@@ -2151,6 +2184,7 @@ UtS9sRpcClient::testDeleteUserPreferences()
     options->m_options["cmon_user"]             = "s9s";
     options->m_options["preferences_to_delete"] = "key1;key3;key4;";
     options->m_options["preferences"]           = true;
+    options->invalidateResolvedOptions();
 
     //====================================================
 
@@ -0,0 +1,679 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9srpcload.h"
+
+#include "s9smockcontroller.h"
+
+#include "S9sRpcClient"
+#include "S9sRpcReply"
+#include "S9sThread"
+#include "S9sFile"
+#include "S9sRpcStats"
+#include "S9sConfigPuller"
+#include "S9sOutput"
+
+#include <algorithm>
+#include <new>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+//#define DEBUG
+#define WARNING
+#include "s9sdebug.h"
+
+/*
+ * The size of the load test, can be changed by the environment variables
+ * S9S_LOAD_CLIENTS, S9S_LOAD_REQUESTS and S9S_LOAD_LATENCY.
+ */
+#define DEFAULT_LOAD_CLIENTS   8
+#define DEFAULT_LOAD_REQUESTS 50
+#define DEFAULT_LOAD_LATENCY   0
+
+/*
+ * Every memory allocation of the process is counted, so the load test can
+ * report how many allocations a request needs.
+ */
+static volatile ulonglong nAllocations = 0ull;
+
+void *operator new(size_t size) __attribute__((noinline));
+void operator delete(void *pointer) noexcept __attribute__((noinline));
+void operator delete(void *pointer, size_t) noexcept __attribute__((noinline));
+
+void *
+operator new(size_t size)
+{
+    void *retval;
+
+    __sync_fetch_and_add(&nAllocations, 1ull);
+
+    retval = malloc(size > 0 ? size : 1);
+    if (retval == NULL)
+        throw std::bad_alloc();
+
+    return retval;
+}
+
+void 
+operator delete(void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void 
+operator delete(void *pointer, size_t) noexcept
+{
+    free(pointer);
+}
+
+static int
+envValue(
+        const char *name,
+        int         defaultValue)
+{
+    const char *value = getenv(name);
+
+    return value != NULL && atoi(value) > 0 ? atoi(value) : defaultValue;
+}
+
+static double
+monotonicMs()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
+
+static void
+countRecords(
+        const S9sVariantMap &jsonMessage,
+        void                *userData)
+{
+    if (jsonMessage.contains("event_class"))
+        ++(*(int *) userData);
+}
+
+/**
+ * One client of the load test, sends the requests one after the other and
+ * measures how long each takes.
+ */
+class UtS9sRpcLoadThread : public S9sThread
+{
+    public:
+        UtS9sRpcLoadThread(
+                int  port,
+                bool useTls,
+                int  nRequests) :
+            S9sThread(),
+            m_client("127.0.0.1", port, "", useTls),
+            m_nRequests(nRequests),
+            m_nFailed(0)
+        {
+        }
+
+        const S9sVector<double> &latencies() const { return m_latencies; };
+        int nFailed() const { return m_nFailed; };
+
+    protected:
+        virtual int
+        exec()
+        {
+            for (int idx = 0; idx < m_nRequests; ++idx)
+            {
+                double start = monotonicMs();
+
+                if (!m_client.getTree(false) || !m_client.reply().isOk())
+                    ++m_nFailed;
+
+                m_latencies << monotonicMs() - start;
+            }
+
+            return 0;
+        }
+
+    private:
+        S9sRpcClient      m_client;
+        int               m_nRequests;
+        int               m_nFailed;
+        S9sVector<double> m_latencies;
+};
+
+/**
+ * \returns The directory of the captured replies, the test might be started
+ *   from the "tests" or from the test's own directory.
+ */
+static S9sString
+examplesDirectory()
+{
+    if (S9sFile::fileExists("request-examples/Ok-getTree-rep.json"))
+        return "request-examples";
+    else if (S9sFile::fileExists("tests/request-examples/Ok-getTree-rep.json"))
+        return "tests/request-examples";
+
+    return "../request-examples";
+}
+
+/**
+ * \returns The summary the config puller prints on the standard output.
+ */
+static S9sString
+summaryOf(
+        const S9sConfigPuller &puller)
+{
+    char      fileName[] = "/tmp/ut_s9srpcload_summary_XXXXXX";
+    int       fileFd     = mkstemp(fileName);
+    int       savedFd;
+    S9sString retval;
+    S9sString errorString;
+
+    if (fileFd < 0)
+        return retval;
+
+    S9sOutput::flush();
+    fflush(stdout);
+    savedFd = dup(STDOUT_FILENO);
+    dup2(fileFd, STDOUT_FILENO);
+
+    puller.printSummary();
+    S9sOutput::flush();
+
+    dup2(savedFd, STDOUT_FILENO);
+    close(savedFd);
+    close(fileFd);
+
+    S9sString::readFile(fileName, retval, errorString);
+    unlink(fileName);
+
+    return retval;
+}
+
+/**
+ * Removes the files the config puller saved in the test.
+ */
+static void
+removeConfigFiles(
+        const S9sString &directory)
+{
+    unlink(STR(directory + "/my.cnf"));
+    unlink(STR(directory + "/extra.cnf"));
+    rmdir(STR(directory));
+}
+
+UtS9sRpcLoad::UtS9sRpcLoad()
+{
+    S9S_DEBUG("");
+}
+
+UtS9sRpcLoad::~UtS9sRpcLoad()
+{
+}
+
+bool
+UtS9sRpcLoad::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testRequest,      retval);
+    PERFORM_TEST(testChunked,      retval);
+    PERFORM_TEST(testTls,          retval);
+    PERFORM_TEST(testRedirect,     retval);
+    PERFORM_TEST(testJsonStream,   retval);
+    PERFORM_TEST(testTimings,      retval);
+    PERFORM_TEST(testLoad,         retval);
+    PERFORM_TEST(testConfigPuller, retval);
+
+    return retval;
+}
+
+/**
+ * Sending one request to the mock controller and checking the reply that was
+ * loaded from the captured examples.
+ */
+bool
+UtS9sRpcLoad::testRequest()
+{
+    S9sMockController controller;
+
+    S9S_VERIFY(controller.loadReplies(examplesDirectory()) > 10);
+    S9S_VERIFY(controller.start());
+
+    S9sRpcClient client("127.0.0.1", controller.port(), "", false);
+
+    S9S_VERIFY(client.getTree(false));
+    S9S_VERIFY(client.reply().isOk());
+    S9S_VERIFY(client.reply().contains("cdt"));
+    S9S_COMPARE(client.reply().at("request_id").toInt(), 1);
+
+    // A request the mock has no reply for.
+    S9S_VERIFY(client.getInfo());
+    S9S_VERIFY(!client.reply().isOk());
+    S9S_COMPARE(client.reply().at("request_id").toInt(), 2);
+    S9S_COMPARE(controller.nRequests(), 2);
+
+    controller.stop();
+    return true;
+}
+
+/**
+ * The reply arrives in many small pieces, the client has to put them
+ * together.
+ */
+bool
+UtS9sRpcLoad::testChunked()
+{
+    S9sMockController controller;
+    S9sFile           file(S9sFile::buildPath(
+                examplesDirectory(), "Ok-getTree-rep.json"));
+    S9sString         content;
+    S9sVariantMap     original;
+    
+    S9S_VERIFY(file.readTxtFile(content));
+    S9S_VERIFY(original.parse(STR(content)));
+
+    S9S_VERIFY(controller.loadReplies(examplesDirectory()) > 10);
+    controller.setChunking(97, 1);
+    S9S_VERIFY(controller.start());
+
+    S9sRpcClient client("127.0.0.1", controller.port(), "", false);
+
+    S9S_VERIFY(client.getTree(false));
+    S9S_VERIFY(client.reply().isOk());
+    S9S_COMPARE(
+            client.reply().at("cdt").toVariantMap().toString(),
+            original["cdt"].toVariantMap().toString());
+
+    controller.stop();
+    return true;
+}
+
+/**
+ * The same request through TLS.
+ */
+bool
+UtS9sRpcLoad::testTls()
+{
+    S9sMockController controller;
+    
+    S9S_VERIFY(controller.loadReplies(examplesDirectory()) > 10);
+    S9S_VERIFY(controller.setTls(true));
+    controller.setChunking(1000);
+    S9S_VERIFY(controller.start());
+
+    S9sRpcClient client("127.0.0.1", controller.port(), "", true);
+
+    S9S_VERIFY(client.getTree(false));
+    S9S_VERIFY(client.reply().isOk());
+    S9S_VERIFY(client.reply().contains("cdt"));
+
+    controller.stop();
+    return true;
+}
+
+/**
+ * One controller redirects the client to the other, the client should send
+ * the request again to the leader.
+ */
+bool
+UtS9sRpcLoad::testRedirect()
+{
+    S9sMockController follower;
+    S9sMockController leader;
+    char              homeTemplate[] = "/tmp/ut_s9srpcload_XXXXXX";
+    
+    // The client remembers the redirects in the state file.
+    S9S_VERIFY(mkdtemp(homeTemplate) != NULL);
+    setenv("HOME", homeTemplate, 1);
+
+    S9S_VERIFY(leader.loadReplies(examplesDirectory()) > 10);
+    S9S_VERIFY(leader.start());
+
+    follower.setRedirect("127.0.0.1", leader.port());
+    S9S_VERIFY(follower.start());
+
+    S9sRpcClient client("127.0.0.1", follower.port(), "", false);
+
+    S9S_VERIFY(client.getTree(false));
+    S9S_VERIFY(client.reply().isOk());
+    S9S_COMPARE(client.port(), leader.port());
+    S9S_COMPARE(follower.nRequests(), 1);
+    S9S_COMPARE(leader.nRequests(), 1);
+
+    follower.stop();
+    leader.stop();
+
+    unlink(STR(S9sString(homeTemplate) + "/.s9s/s9s.state"));
+    rmdir(STR(S9sString(homeTemplate) + "/.s9s"));
+    rmdir(homeTemplate);
+    return true;
+}
+
+/**
+ * The events are sent as a JSon stream.
+ */
+bool
+UtS9sRpcLoad::testJsonStream()
+{
+    S9sMockController controller;
+    S9sVariantList    records;
+    int               nRecords = 0;
+
+    for (int idx = 0; idx < 20; ++idx)
+    {
+        S9sVariantMap record;
+
+        record["class_name"]  = "CmonEvent";
+        record["event_class"] = "EventHost";
+        record["event_name"]  = "Changed";
+        record["sequence"]    = idx;
+        records << record;
+    }
+
+    controller.setStream("subscribe", records);
+    S9S_VERIFY(controller.start());
+
+    S9sRpcClient client("127.0.0.1", controller.port(), "", false);
+
+    S9S_VERIFY(client.subscribeEvents(countRecords, &nRecords));
+    S9S_COMPARE(nRecords, 20);
+
+    controller.stop();
+    return true;
+}
+
+/**
+ * The phases of the requests are measured when the S9sRpcStats is enabled:
+ * here both controllers use TLS and one redirects to the other, so the request
+ * needs two connections.
+ */
+bool
+UtS9sRpcLoad::testTimings()
+{
+    S9sRpcStats      *stats = S9sRpcStats::instance();
+    S9sMockController follower;
+    S9sMockController leader;
+    S9sVariantList    requests;
+    S9sVariantMap     request;
+    char              homeTemplate[] = "/tmp/ut_s9srpcload_XXXXXX";
+    
+    S9S_VERIFY(mkdtemp(homeTemplate) != NULL);
+    setenv("HOME", homeTemplate, 1);
+
+    S9S_VERIFY(leader.loadReplies(examplesDirectory()) > 10);
+    S9S_VERIFY(leader.setTls(true));
+    S9S_VERIFY(leader.start());
+
+    follower.setRedirect("127.0.0.1", leader.port());
+    S9S_VERIFY(follower.setTls(true));
+    S9S_VERIFY(follower.start());
+
+    stats->setEnabled(true);
+
+    S9sRpcClient client("127.0.0.1", follower.port(), "", true);
+
+    S9S_VERIFY(client.getTree(false));
+    S9S_VERIFY(client.getTree(false));
+    stats->finish();
+    stats->setEnabled(false);
+
+    requests = stats->toVariantMap()["requests"].toVariantList();
+    S9S_VERIFY(requests.size() == 2u);
+
+    // The first request was redirected, the second went to the leader.
+    request = requests[0].toVariantMap();
+    S9S_COMPARE(request["operation"].toString(), "getTree");
+    S9S_VERIFY(request["success"].toBoolean());
+    S9S_COMPARE(request["redirects"].toInt(), 1);
+    S9S_COMPARE(request["connects"].toInt(), 2);
+    S9S_VERIFY(request["tls_ms"].toDouble() > 0.0);
+    S9S_VERIFY(request["bytes_sent"].toULongLong() > 0ull);
+    S9S_VERIFY(request["bytes_received"].toULongLong() > 1000ull);
+    S9S_VERIFY(request["print_ms"].toDouble() >= 0.0);
+    S9S_VERIFY(request["total_ms"].toDouble() >= 
+            request["first_byte_ms"].toDouble());
+
+    request = requests[1].toVariantMap();
+    S9S_COMPARE(request["redirects"].toInt(), 0);
+    S9S_COMPARE(request["connects"].toInt(), 1);
+    S9S_COMPARE(request["port"].toInt(), leader.port());
+
+    follower.stop();
+    leader.stop();
+
+    unlink(STR(S9sString(homeTemplate) + "/.s9s/s9s.state"));
+    rmdir(STR(S9sString(homeTemplate) + "/.s9s"));
+    rmdir(homeTemplate);
+    return true;
+}
+
+/**
+ * Many clients are sending requests in parallel, the latency, the throughput
+ * and the number of memory allocations are printed.
+ */
+bool
+UtS9sRpcLoad::testLoad()
+{
+    S9sMockController controller;
+    S9sVector<UtS9sRpcLoadThread *> threads;
+    S9sVector<double> latencies;
+    int               nClients  = envValue("S9S_LOAD_CLIENTS", DEFAULT_LOAD_CLIENTS);
+    int               nRequests = envValue("S9S_LOAD_REQUESTS", DEFAULT_LOAD_REQUESTS);
+    int               latency   = envValue("S9S_LOAD_LATENCY", DEFAULT_LOAD_LATENCY);
+    int               nFailed = 0;
+    ulonglong         allocationsBefore;
+    ulonglong         allocations;
+    double            start, elapsed;
+
+    S9S_VERIFY(controller.loadReplies(examplesDirectory()) > 10);
+    controller.setLatency(latency);
+    controller.setWorkers(nClients);
+    S9S_VERIFY(controller.start());
+
+    for (int idx = 0; idx < nClients; ++idx)
+    {
+        threads << new UtS9sRpcLoadThread(
+                controller.port(), false, nRequests);
+    }
+
+    allocationsBefore = nAllocations;
+    start = monotonicMs();
+
+    for (uint idx = 0u; idx < threads.size(); ++idx)
+        threads[idx]->start();
+
+    for (uint idx = 0u; idx < threads.size(); ++idx)
+    {
+        threads[idx]->wait();
+
+        nFailed += threads[idx]->nFailed();
+        latencies.insert(
+                latencies.end(), 
+                threads[idx]->latencies().begin(),
+                threads[idx]->latencies().end());
+
+        delete threads[idx];
+    }
+
+    elapsed     = monotonicMs() - start;
+    allocations = nAllocations - allocationsBefore;
+
+    controller.stop();
+
+    S9S_COMPARE(nFailed, 0);
+    S9S_COMPARE((int) latencies.size(), nClients * nRequests);
+    S9S_COMPARE(controller.nRequests(), nClients * nRequests);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("\n");
+    printf("      clients: %d\n", nClients);
+    printf("     requests: %u\n", (uint) latencies.size());
+    printf("          p50: %.3f ms\n", latencies[latencies.size() / 2]);
+    printf("          p99: %.3f ms\n", 
+            latencies[latencies.size() * 99 / 100]);
+    printf("   throughput: %.1f requests/s\n", 
+            latencies.size() / (elapsed / 1000.0));
+    printf("  allocations: %.1f per request (client and server)\n",
+            (double) allocations / latencies.size());
+
+    return true;
+}
+
+/**
+ * Pulling the configuration of more hosts in parallel: the files are written
+ * into a subdirectory for every host, the second pull finds them unchanged and
+ * writes only the one that was changed on the disk. A host the controller 
+ * fails to serve is reported with the error and the reply.
+ */
+bool
+UtS9sRpcLoad::testConfigPuller()
+{
+    S9sMockController controller;
+    S9sVariantMap     reply, file;
+    S9sVariantList    files, hosts, results;
+    S9sVariantMap     result;
+    S9sString         content, errorString, summary;
+    char              dirTemplate[] = "/tmp/ut_s9srpcload_XXXXXX";
+    S9sString         outputDir;
+
+    S9S_VERIFY(mkdtemp(dirTemplate) != NULL);
+    outputDir = dirTemplate;
+
+    file["filename"]         = "my.cnf";
+    file["content"]          = "[mysqld]\nserver_id=1\n";
+    files << file;
+    file["filename"]         = "extra.cnf";
+    file["content"]          = "[client]\n";
+    files << file;
+
+    reply["request_status"]  = "Ok";
+    reply["files"]           = files;
+
+    controller.setReply("getConfig", reply);
+    controller.setWorkers(4);
+    S9S_VERIFY(controller.start());
+
+    S9sRpcClient client("127.0.0.1", controller.port(), "", false);
+    S9sConfigPuller puller(client, outputDir);
+
+    hosts << S9sNode("10.0.0.1");
+    hosts << S9sNode("10.0.0.2");
+    hosts << S9sNode("10.0.0.3:3306");
+    puller.setParallelism(2);
+    S9S_COMPARE(puller.parallelism(), 2);
+
+    /*
+     * The first pull writes all the files.
+     */
+    S9S_VERIFY(puller.pull(hosts));
+    results = puller.results();
+    S9S_COMPARE(results.size(), 3);
+
+    for (uint idx = 0u; idx < results.size(); ++idx)
+    {
+        result = results[idx].toVariantMap();
+        S9S_VERIFY(result["success"].toBoolean());
+        S9S_COMPARE(result["n_files"].toInt(), 2);
+        S9S_COMPARE(result["n_written"].toInt(), 2);
+        S9S_COMPARE(result["n_unchanged"].toInt(), 0);
+    }
+
+    result = results[2].toVariantMap();
+    S9S_COMPARE(result["hostname"].toString(), "10.0.0.3");
+    S9S_VERIFY(S9sString::readFile(
+                outputDir + "/10.0.0.3_3306/my.cnf", content, errorString));
+    S9S_COMPARE(content, "[mysqld]\nserver_id=1\n");
+
+    /*
+     * The second pull finds the files unchanged, except the one we modify.
+     */
+    content = "changed\n";
+    S9S_VERIFY(S9sString::writeFile(
+                outputDir + "/10.0.0.2/extra.cnf", content, errorString));
+    S9S_VERIFY(puller.pull(hosts));
+    results = puller.results();
+
+    result = results[0].toVariantMap();
+    S9S_COMPARE(result["n_written"].toInt(), 0);
+    S9S_COMPARE(result["n_unchanged"].toInt(), 2);
+
+    result = results[1].toVariantMap();
+    S9S_COMPARE(result["n_written"].toInt(), 1);
+    S9S_COMPARE(result["n_unchanged"].toInt(), 1);
+    S9S_VERIFY(S9sString::readFile(
+                outputDir + "/10.0.0.2/extra.cnf", content, errorString));
+    S9S_COMPARE(content, "[client]\n");
+
+    summary = summaryOf(puller);
+    S9S_VERIFY(summary.contains("HOST"));
+    S9S_VERIFY(summary.contains("UNCHANGED"));
+    S9S_VERIFY(summary.contains("10.0.0.3"));
+    S9S_VERIFY(summary.contains("Total: 3 hosts, 0 failed."));
+
+    /*
+     * A single host goes into the output directory itself.
+     */
+    hosts.clear();
+    hosts << S9sNode("10.0.0.1");
+    S9S_VERIFY(puller.pull(hosts));
+    result = puller.results()[0].toVariantMap();
+    S9S_COMPARE(result["n_written"].toInt(), 2);
+    S9S_VERIFY(S9sFile::fileExists(outputDir + "/my.cnf"));
+
+    controller.stop();
+
+    /*
+     * The controller has no reply, the hosts fail and the reply is kept.
+     */
+    S9sMockController failing;
+
+    S9S_VERIFY(failing.start());
+
+    S9sRpcClient failingClient("127.0.0.1", failing.port(), "", false);
+    S9sConfigPuller failingPuller(failingClient, outputDir);
+
+    hosts << S9sNode("10.0.0.2");
+    S9S_VERIFY(!failingPuller.pull(hosts));
+    results = failingPuller.results();
+    S9S_COMPARE(results.size(), 2);
+
+    result = results[0].toVariantMap();
+    S9S_VERIFY(!result["success"].toBoolean());
+    S9S_VERIFY(result["error_string"].toString().contains("no reply"));
+    reply = result["reply"].toVariantMap();
+    S9S_COMPARE(reply["request_status"].toString(), "InvalidRequest");
+    
+    summary = summaryOf(failingPuller);
+    S9S_VERIFY(summary.contains("FAILED"));
+    S9S_VERIFY(summary.contains("Total: 2 hosts, 2 failed."));
+
+    failing.stop();
+
+    removeConfigFiles(outputDir + "/10.0.0.1");
+    removeConfigFiles(outputDir + "/10.0.0.2");
+    removeConfigFiles(outputDir + "/10.0.0.3_3306");
+    removeConfigFiles(outputDir);
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sRpcLoad)
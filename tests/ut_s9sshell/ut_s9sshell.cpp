@@ -0,0 +1,129 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9sshell.h"
+
+#include "S9sShell"
+#include "S9sOptions"
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+UtS9sShell::UtS9sShell()
+{
+}
+
+UtS9sShell::~UtS9sShell()
+{
+}
+
+bool
+UtS9sShell::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testSplit,     retval);
+    PERFORM_TEST(testExecute,   retval);
+
+    return retval;
+}
+
+/**
+ * The command lines are split into words the way the shell does it.
+ */
+bool
+UtS9sShell::testSplit()
+{
+    S9sVector<S9sString> words;
+    S9sString            errorString;
+
+    S9S_VERIFY(S9sShell::splitCommandLine(
+                "s9s  cluster\t--list --long\n", words, errorString));
+    S9S_VERIFY(words.size() == 4u);
+    S9S_COMPARE(words[0], "s9s");
+    S9S_COMPARE(words[1], "cluster");
+    S9S_COMPARE(words[2], "--list");
+    S9S_COMPARE(words[3], "--long");
+
+    S9S_VERIFY(S9sShell::splitCommandLine(
+                "node --name='a b' --x=\"c \\\"d\\\"\" e\\ f ''", 
+                words, errorString));
+    S9S_VERIFY(words.size() == 5u);
+    S9S_COMPARE(words[1], "--name=a b");
+    S9S_COMPARE(words[2], "--x=c \"d\"");
+    S9S_COMPARE(words[3], "e f");
+    S9S_COMPARE(words[4], "");
+
+    // Comments and empty lines.
+    S9S_VERIFY(S9sShell::splitCommandLine(
+                "job --list # --long", words, errorString));
+    S9S_VERIFY(words.size() == 2u);
+    S9S_COMPARE(words[1], "--list");
+    
+    S9S_VERIFY(S9sShell::splitCommandLine(
+                "job --name=a#b", words, errorString));
+    S9S_VERIFY(words.size() == 2u);
+    S9S_COMPARE(words[1], "--name=a#b");
+
+    S9S_VERIFY(S9sShell::splitCommandLine("  # nothing", words, errorString));
+    S9S_VERIFY(words.empty());
+    
+    S9S_VERIFY(S9sShell::splitCommandLine("\n", words, errorString));
+    S9S_VERIFY(words.empty());
+
+    // Errors.
+    S9S_VERIFY(!S9sShell::splitCommandLine(
+                "node --name='a b", words, errorString));
+    S9S_VERIFY(words.empty());
+    S9S_COMPARE(errorString, "Unterminated ' in the command line.");
+
+    return true;
+}
+
+/**
+ * Executing commands that do not need a controller, the options of one command
+ * should not leak into the next one.
+ */
+bool
+UtS9sShell::testExecute()
+{
+    S9sOptions           *options = S9sOptions::instance();
+    S9sShell              shell;
+    S9sVector<S9sString>  words;
+    S9sString             errorString;
+
+    S9sShell::splitCommandLine("nosuchmode --list", words, errorString);
+    S9S_VERIFY(shell.executeCommand(words) == S9sOptions::BadOptions);
+    
+    S9sShell::splitCommandLine("--shell", words, errorString);
+    S9S_VERIFY(shell.executeCommand(words) == S9sOptions::BadOptions);
+    S9S_VERIFY(options->isShellRequested());
+
+    S9sShell::splitCommandLine("s9s --version", words, errorString);
+    S9S_VERIFY(shell.executeCommand(words) == S9sOptions::ExitOk);
+    S9S_VERIFY(!options->isShellRequested());
+
+    S9sShell::splitCommandLine("quit", words, errorString);
+    S9S_VERIFY(shell.executeCommand(words) == S9sOptions::ExitOk);
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sShell)
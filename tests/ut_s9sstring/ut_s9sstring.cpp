@@ -22,10 +22,12 @@
 #include <libs9s/library.h>
 #include <cstdio>
 #include <cstring>
+#include <unistd.h>
 
 #include "S9sVariantList"
 #include "S9sFormat"
 #include "S9sOptions"
+#include "S9sFile"
 
 //#define DEBUG
 #include "s9sdebug.h"
@@ -58,6 +60,9 @@ UtS9sString::runTest(const char *testName)
     PERFORM_TEST(testSplit,         retval);
     PERFORM_TEST(testSizeString,    retval);
     PERFORM_TEST(testMilliseconds,  retval);
+    PERFORM_TEST(testCrc32,         retval);
+    PERFORM_TEST(testWriteFile,     retval);
+    PERFORM_TEST(testHtml2Ansi,     retval);
 
     return retval;
 }
@@ -426,5 +431,100 @@ UtS9sString::testMilliseconds()
     return true;
 }
 
+bool
+UtS9sString::testCrc32()
+{
+    // The check values of the CRC-32 (the ones zlib gives).
+    S9S_VERIFY(S9sString().crc32()            == 0u);
+    S9S_VERIFY(S9sString("123456789").crc32() == 0xcbf43926u);
+    S9S_VERIFY(S9sString("a").crc32()         == 0xe8b7be43u);
+
+    S9S_VERIFY(S9sString("[mysqld]\nport=3306\n").crc32() !=
+            S9sString("[mysqld]\nport=3307\n").crc32());
+
+    return true;
+}
+
+/**
+ * Writing a file atomically, overwriting it and reading it back.
+ */
+bool
+UtS9sString::testWriteFile()
+{
+    S9sString fileName;
+    S9sString content;
+    S9sString errorString;
+
+    fileName.sprintf("/tmp/ut_s9sstring_%d.txt", getpid());
+
+    S9S_VERIFY(S9sString::writeFileAtomic(fileName, "first\n", errorString));
+    S9S_VERIFY(S9sString::readFile(fileName, content, errorString));
+    S9S_COMPARE(content, "first\n");
+    
+    S9S_VERIFY(S9sString::writeFileAtomic(fileName, "second\n", errorString));
+    S9S_VERIFY(S9sString::readFile(fileName, content, errorString));
+    S9S_COMPARE(content, "second\n");
+
+    unlink(STR(fileName));
+
+    // The directory does not exist, this should fail.
+    S9S_VERIFY(!S9sString::writeFileAtomic(
+                "/nonexistent_dir/file.txt", "x", errorString));
+    S9S_VERIFY(!errorString.empty());
+
+    return true;
+}
+
+/**
+ * Translating the HTML markup of the job messages, including the escaped tags
+ * and entities that need more than one round of replacements.
+ */
+bool
+UtS9sString::testHtml2Ansi()
+{
+    S9S_COMPARE(S9sString::html2ansi(""), "");
+    S9S_COMPARE(S9sString::html2ansi("No markup."), "No markup.");
+
+    S9S_COMPARE(
+            S9sString::html2ansi(
+                "<em style='color: #c66211;'>10.0.1.12</em>: Checking the "
+                "<strong style='color: #59a449;'>mysqld</strong> process."),
+            XTERM_COLOR_3 "10.0.1.12" TERM_NORMAL ": Checking the "
+            XTERM_COLOR_9 "mysqld" TERM_NORMAL " process.");
+
+    S9S_COMPARE(
+            S9sString::html2ansi(
+                "<strong style='color: red;'>Failed</strong><br/>"
+                "<strong style='color: orange;'>Retry</strong><BR/>"),
+            XTERM_COLOR_RED "Failed" TERM_NORMAL "\n"
+            "\033[38;5;172mRetry" TERM_NORMAL "\n");
+
+    // The colors that are not in the table.
+    S9S_COMPARE(
+            S9sString::html2ansi(
+                "<em style='color: #123456;'>a</em>"
+                "<STRONG STYLE=\"COLOR:blue;\">b</strong>"),
+            XTERM_COLOR_ORANGE "a" TERM_NORMAL XTERM_COLOR_8 "b" TERM_NORMAL);
+
+    // Links are removed, entities unescaped.
+    S9S_COMPARE(
+            S9sString::html2ansi(
+                "<a href='/jobs/21'>Tom &amp; Jerry</a> &lt;none&gt; a < b"),
+            "Tom & Jerry</a> <none> a < b");
+
+    // Escaped markup is translated too.
+    S9S_COMPARE(S9sString::html2ansi("&amp;lt;br/&amp;gt;"), "\n");
+    S9S_COMPARE(
+            S9sString::html2ansi("&lt;em style='color: #c66211;'&gt;x"),
+            XTERM_COLOR_ORANGE "x");
+
+    S9S_COMPARE(
+            S9sString::html2ansi(
+                "<em style=&lt;COLOR: x<strong style='color: #c66211;'>"),
+            XTERM_COLOR_ORANGE);
+
+    return true;
+}
+
 S9S_UNIT_TEST_MAIN(UtS9sString)
 
@@ -41,5 +41,8 @@ class UtS9sString : public S9sUnitTest
         bool testSplit();
         bool testSizeString();
         bool testMilliseconds();
+        bool testCrc32();
+        bool testWriteFile();
+        bool testHtml2Ansi();
 };
 
@@ -0,0 +1,205 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9stable.h"
+
+#include "S9sTable"
+
+//#define DEBUG
+#include "s9sdebug.h"
+
+UtS9sTable::UtS9sTable()
+{
+}
+
+UtS9sTable::~UtS9sTable()
+{
+}
+
+bool
+UtS9sTable::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testCreate,          retval);
+    PERFORM_TEST(testToString,        retval);
+    PERFORM_TEST(testColors,          retval);
+    PERFORM_TEST(testMaxWidth,        retval);
+
+    return retval;
+}
+
+/**
+ * Checking that the column widths are calculated while the cells are added.
+ */
+bool
+UtS9sTable::testCreate()
+{
+    S9sTable table;
+
+    table.addColumn("ID");
+    table.addColumn("NAME");
+    table.addColumn("COMMENT");
+
+    S9S_COMPARE(table.nColumns(), 3);
+    S9S_COMPARE(table.nRows(),    0);
+
+    table.addRow();
+    table.addCell(1);
+    table.addCell("first");
+    table.addCell("The first row.");
+
+    table.addRow();
+    table.addCell(100);
+    table.addCell("second…");
+
+    S9S_COMPARE(table.nRows(),        2);
+    S9S_COMPARE(table.columnWidth(0), 3);
+    S9S_COMPARE(table.columnWidth(1), 7);
+    S9S_COMPARE(table.columnWidth(2), 14);
+    S9S_COMPARE(table.columnWidth(3), 0);
+
+    return true;
+}
+
+/**
+ * Checking the rendered table: the integers are aligned to the right, the
+ * header is considered only if it is visible and the missing cells are filled
+ * with spaces.
+ */
+bool
+UtS9sTable::testToString()
+{
+    S9sTable  table;
+    S9sString expected;
+
+    table.addColumn("ID");
+    table.addColumn("SIZE", S9sFormat::AlignRight);
+    table.addColumn("NAME");
+    table.addColumn("COMMENT");
+
+    table.addRow();
+    table.addCell(1);
+    table.addCell("10K");
+    table.addCell("first");
+    table.addCell("The first row.");
+
+    table.addRow();
+    table.addCell(12);
+    table.addCell("1M");
+
+    expected = 
+        "ID SIZE NAME  COMMENT\n"
+        " 1  10K first The first row.\n"
+        "12   1M       \n";
+    
+    S9S_COMPARE(table.toString(), expected);
+
+    table.setHeaderVisible(false);
+    expected = 
+        " 1 10K first The first row.\n"
+        "12  1M       \n";
+    
+    S9S_COMPARE(table.toString(), expected);
+
+    return true;
+}
+
+/**
+ * The colors are wrapped around the padded cell and the field separator, the
+ * header color around the whole header line.
+ */
+bool
+UtS9sTable::testColors()
+{
+    S9sTable  table;
+    S9sString expected;
+
+    table.addColumn("NAME");
+    table.addColumn("COMMENT");
+    table.setHeaderColor("<h>", "</h>");
+
+    table.addRow();
+    table.addCell("a", "<c>", "</c>");
+    table.addCell("-");
+
+    expected = 
+        "<h>NAME COMMENT</h>\n"
+        "<c>a    </c>-\n";
+
+    S9S_COMPARE(table.toString(), expected);
+    return true;
+}
+
+/**
+ * The last column is truncated so that the lines fit into the maximum width.
+ */
+bool
+UtS9sTable::testMaxWidth()
+{
+    S9sTable  table;
+    S9sString expected;
+
+    table.addColumn("ID");
+    table.addColumn("COMMENT");
+    table.setHeaderVisible(false);
+    table.setMaxWidth(10);
+
+    table.addRow();
+    table.addCell(1);
+    table.addCell("This is a long comment.");
+    
+    table.addRow();
+    table.addCell(2);
+    table.addCell("Short.");
+
+    expected = 
+        "1 This is…\n"
+        "2 Short.\n";
+
+    S9S_COMPARE(table.toString(), expected);
+    
+    table.setMaxWidth(0);
+    expected = 
+        "1 This is a long comment.\n"
+        "2 Short.\n";
+
+    S9S_COMPARE(table.toString(), expected);
+
+    /*
+     * The multibyte characters are measured and cut by terminal columns, not
+     * by bytes.
+     */
+    table.addRow();
+    table.addCell("ÁÉ");
+    table.addCell("Árvíztűrő tükörfúrógép");
+    table.setMaxWidth(12);
+
+    S9S_COMPARE(table.columnWidth(0), 2);
+
+    expected = 
+        " 1 This is …\n"
+        " 2 Short.\n"
+        "ÁÉ Árvíztűr…\n";
+
+    S9S_COMPARE(table.toString(), expected);
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sTable)
@@ -0,0 +1,222 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9sthreadpool.h"
+
+#include "S9sThreadPool"
+#include "S9sRpcFuture"
+#include "S9sMutexLocker"
+
+#include <unistd.h>
+
+//#define DEBUG
+//#define WARNING
+#include "s9sdebug.h"
+
+/**
+ * A task that counts how many times it was executed.
+ */
+class UtCounterTask : public S9sRunnable
+{
+    public:
+        UtCounterTask(
+                int                        *counter,
+                S9sMutex                   *mutex,
+                const S9sCancellationToken &token = S9sCancellationToken()) :
+            S9sRunnable(token),
+            m_counter(counter),
+            m_mutex(mutex)
+        {
+        }
+
+        virtual void 
+        run()
+        {
+            usleep(1000);
+
+            S9sMutexLocker locker(*m_mutex);
+            ++*m_counter;
+        }
+
+    private:
+        int      *m_counter;
+        S9sMutex *m_mutex;
+};
+
+/**
+ * A task that sets the value of a promise after a short while.
+ */
+class UtPromiseTask : public S9sRunnable
+{
+    public:
+        UtPromiseTask(
+                const S9sRpcPromise &promise) :
+            S9sRunnable(),
+            m_promise(promise)
+        {
+        }
+
+        virtual void 
+        run()
+        {
+            S9sRpcReply reply;
+
+            usleep(50000);
+            reply["request_status"] = "Ok";
+            reply["total"]          = 42;
+            m_promise.setValue(true, reply);
+        }
+
+    private:
+        S9sRpcPromise m_promise;
+};
+
+UtS9sThreadPool::UtS9sThreadPool()
+{
+}
+
+UtS9sThreadPool::~UtS9sThreadPool()
+{
+}
+
+bool
+UtS9sThreadPool::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testExecute,   retval);
+    PERFORM_TEST(testCancel,    retval);
+    PERFORM_TEST(testFuture,    retval);
+
+    return retval;
+}
+
+/**
+ * All the submitted tasks are executed once.
+ */
+bool
+UtS9sThreadPool::testExecute()
+{
+    S9sMutex       mutex;
+    int            counter = 0;
+    S9sThreadPool  pool(4);
+
+    S9S_COMPARE(pool.nThreads(), 4);
+
+    for (int idx = 0; idx < 200; ++idx)
+        S9S_VERIFY(pool.submit(new UtCounterTask(&counter, &mutex)));
+
+    pool.waitForDone();
+    S9S_COMPARE(counter, 200);
+
+    // The pool can be reused.
+    for (int idx = 0; idx < 10; ++idx)
+        S9S_VERIFY(pool.submit(new UtCounterTask(&counter, &mutex)));
+
+    pool.waitForDone();
+    S9S_COMPARE(counter, 210);
+    
+    // After stopping the tasks are not accepted.
+    pool.stop();
+    S9S_COMPARE(pool.nThreads(), 0);
+    S9S_VERIFY(!pool.submit(new UtCounterTask(&counter, &mutex)));
+
+    return true;
+}
+
+/**
+ * The tasks that are cancelled before they are taken are not executed.
+ */
+bool
+UtS9sThreadPool::testCancel()
+{
+    S9sMutex              mutex;
+    int                   counter = 0;
+    S9sCancellationToken  token;
+    S9sCancellationToken  copy = token;
+    S9sThreadPool         pool(2);
+
+    S9S_VERIFY(!copy.isCancelled());
+    token.cancel();
+    S9S_VERIFY(copy.isCancelled());
+
+    for (int idx = 0; idx < 20; ++idx)
+        pool.submit(new UtCounterTask(&counter, &mutex, token));
+
+    pool.waitForDone();
+    S9S_COMPARE(counter, 0);
+
+    copy.reset();
+    S9S_VERIFY(!token.isCancelled());
+
+    for (int idx = 0; idx < 20; ++idx)
+        pool.submit(new UtCounterTask(&counter, &mutex, token));
+
+    pool.waitForDone();
+    S9S_COMPARE(counter, 20);
+
+    return true;
+}
+
+/**
+ * The futures receive the value set by an other thread, the abandoned promises
+ * make the futures fail instead of blocking forever.
+ */
+bool
+UtS9sThreadPool::testFuture()
+{
+    S9sThreadPool         pool(2);
+    S9sCancellationToken  token;
+    S9sRpcFuture          future;
+
+    {
+        S9sRpcPromise promise;
+
+        future = promise.future();
+        S9S_VERIFY(pool.submit(new UtPromiseTask(promise)));
+    }
+
+    S9S_VERIFY(!future.isReady());
+    S9S_VERIFY(future.wait(token));
+    S9S_VERIFY(future.isReady());
+    S9S_VERIFY(future.success());
+    S9S_COMPARE(future.reply()["total"].toInt(), 42);
+    S9S_COMPARE(future.errorString(), "");
+
+    // Waiting with a timeout.
+    {
+        S9sRpcPromise promise;
+
+        future = promise.future();
+        S9S_VERIFY(!future.wait(10));
+
+        // Waiting is aborted by the token.
+        token.cancel();
+        S9S_VERIFY(!future.wait(token));
+    }
+
+    // The promise is gone, the future is ready with an error.
+    S9S_VERIFY(future.isReady());
+    S9S_VERIFY(!future.success());
+    S9S_COMPARE(future.errorString(), "The request was cancelled.");
+
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sThreadPool)
@@ -0,0 +1,301 @@
+/*
+ * Severalnines Tools
+ * Copyright (C) 2016-2018 Severalnines AB
+ *
+ * This file is part of s9s-tools.
+ *
+ * s9s-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * s9s-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with s9s-tools. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "ut_s9streenode.h"
+
+#include "S9sTreeNode"
+#include "S9sVariantMap"
+
+#include <ctime>
+
+//#define DEBUG
+#include "s9sdebug.h"
+
+static const char *treeJson =
+"{\n"
+"    'item_name': '',\n"
+"    'item_path': '/',\n"
+"    'item_type': 'Folder',\n"
+"    'sub_items': [ \n"
+"    {\n"
+"        'item_name': 'groups',\n"
+"        'item_path': '/',\n"
+"        'item_type': 'Folder',\n"
+"        'sub_items': [ \n"
+"        {\n"
+"            'item_name': 'admins',\n"
+"            'item_path': '/groups',\n"
+"            'item_type': 'Group'\n"
+"        } ]\n"
+"    }, \n"
+"    {\n"
+"        'item_name': 'home',\n"
+"        'item_path': '/',\n"
+"        'item_type': 'Folder',\n"
+"        'sub_items': [ \n"
+"        {\n"
+"            'item_name': 'pipas',\n"
+"            'item_path': '/home',\n"
+"            'item_type': 'Folder',\n"
+"            'sub_items': [ \n"
+"            {\n"
+"                'item_name': 'notes.txt',\n"
+"                'item_path': '/home/pipas',\n"
+"                'item_type': 'File'\n"
+"            } ]\n"
+"        } ]\n"
+"    } ]\n"
+"}\n"
+;
+
+UtS9sTreeNode::UtS9sTreeNode()
+{
+}
+
+UtS9sTreeNode::~UtS9sTreeNode()
+{
+}
+
+bool
+UtS9sTreeNode::runTest(const char *testName)
+{
+    bool retval = true;
+
+    PERFORM_TEST(testCreate,          retval);
+    PERFORM_TEST(testSubTree,         retval);
+    PERFORM_TEST(testReplaceSubTree,  retval);
+    PERFORM_TEST(testReassign,        retval);
+    PERFORM_TEST(testPerformance,     retval);
+
+    return retval;
+}
+
+/**
+ * Creating a tree from its JSON representation and checking the child nodes.
+ */
+bool
+UtS9sTreeNode::testCreate()
+{
+    S9sVariantMap theMap;
+    S9sTreeNode   node;
+
+    S9S_VERIFY(theMap.parse(treeJson));
+    node = theMap;
+
+    S9S_COMPARE(node.nChildren(), 2);
+    S9S_COMPARE(node.childNode(0).name(), "groups");
+    S9S_COMPARE(node.childNode(1).name(), "home");
+    S9S_VERIFY(node.hasChild("home"));
+    S9S_VERIFY(!node.hasChild("pipas"));
+
+    return true;
+}
+
+/**
+ * Finding sub-trees by path.
+ */
+bool
+UtS9sTreeNode::testSubTree()
+{
+    S9sVariantMap theMap;
+    S9sTreeNode   node;
+    S9sTreeNode   subTree;
+
+    S9S_VERIFY(theMap.parse(treeJson));
+    node = theMap;
+
+    S9S_VERIFY(node.pathExists("/"));
+    S9S_VERIFY(node.pathExists("/home/pipas"));
+    S9S_VERIFY(node.pathExists("home/pipas/notes.txt"));
+    S9S_VERIFY(node.pathExists("/home//pipas/"));
+    S9S_VERIFY(!node.pathExists("/home/admins"));
+    S9S_VERIFY(!node.pathExists("/nothing"));
+
+    S9S_VERIFY(node.subTree("/home/pipas", subTree));
+    S9S_COMPARE(subTree.name(), "pipas");
+    S9S_COMPARE(subTree.fullPath(), "/home/pipas");
+    S9S_COMPARE(subTree.nChildren(), 1);
+
+    // The second time the path comes from the cache.
+    S9S_VERIFY(node.subTree("/home/pipas", subTree));
+    S9S_COMPARE(subTree.name(), "pipas");
+
+    // The cache remains valid in the copies.
+    S9sTreeNode copy = node;
+    S9S_VERIFY(copy.subTree("/groups/admins", subTree));
+    S9S_COMPARE(subTree.name(), "admins");
+
+    return true;
+}
+
+/**
+ * Replacing one branch of the tree.
+ */
+bool
+UtS9sTreeNode::testReplaceSubTree()
+{
+    S9sVariantMap theMap;
+    S9sTreeNode   node;
+    S9sTreeNode   branch;
+    S9sTreeNode   subTree;
+
+    S9S_VERIFY(theMap.parse(treeJson));
+    node = theMap;
+
+    // Filling the cache, then replacing the branch.
+    S9S_VERIFY(node.pathExists("/home/pipas/notes.txt"));
+    
+    theMap.clear();
+    theMap["item_name"] = "pipas";
+    theMap["item_path"] = "/home";
+    theMap["item_type"] = "Folder";
+    branch = theMap;
+
+    S9S_VERIFY(node.replaceSubTree("/home/pipas", branch));
+    S9S_VERIFY(!node.pathExists("/home/pipas/notes.txt"));
+    S9S_VERIFY(node.subTree("/home/pipas", subTree));
+    S9S_COMPARE(subTree.nChildren(), 0);
+
+    S9S_VERIFY(!node.replaceSubTree("/home/nobody", branch));
+
+    return true;
+}
+
+/**
+ * Replacing the properties of a node that was already searched must drop the
+ * child nodes and the cached paths of the old tree.
+ */
+bool
+UtS9sTreeNode::testReassign()
+{
+    S9sVariantMap  theMap;
+    S9sVariantMap  folder;
+    S9sVariantList subItems;
+    S9sTreeNode    node;
+
+    S9S_VERIFY(theMap.parse(treeJson));
+    node = theMap;
+
+    S9S_VERIFY(node.pathExists("/home/pipas/notes.txt"));
+    S9S_COMPARE(node.nChildren(), 2);
+
+    folder["item_name"]  = "etc";
+    folder["item_path"]  = "/";
+    folder["item_type"]  = "Folder";
+    subItems << folder;
+
+    theMap.clear();
+    theMap["item_name"]  = "";
+    theMap["item_path"]  = "/";
+    theMap["item_type"]  = "Folder";
+    theMap["sub_items"]  = subItems;
+    node = theMap;
+
+    S9S_VERIFY(!node.pathExists("/home/pipas/notes.txt"));
+    S9S_VERIFY(!node.pathExists("/home"));
+    S9S_VERIFY(node.pathExists("/etc"));
+    S9S_COMPARE(node.nChildren(), 1);
+
+    theMap.clear();
+    S9S_VERIFY(theMap.parse(treeJson));
+    node.setProperties(theMap);
+
+    S9S_VERIFY(!node.pathExists("/etc"));
+    S9S_VERIFY(node.pathExists("/home/pipas/notes.txt"));
+    S9S_COMPARE(node.nChildren(), 2);
+
+    return true;
+}
+
+/**
+ * Looking up paths in a tree with 100 thousand entries. 
+ */
+bool
+UtS9sTreeNode::testPerformance()
+{
+    const int       nFolders = 100;
+    const int       nFiles   = 1000;
+    const int       nLookups = 100000;
+    S9sVariantList  folders;
+    S9sVariantMap   rootMap;
+    S9sTreeNode     root;
+    struct timespec start, end;
+    double          elapsed;
+
+    for (int folderIdx = 0; folderIdx < nFolders; ++folderIdx)
+    {
+        S9sVariantMap  folder;
+        S9sVariantList files;
+        S9sString      folderName;
+
+        folderName.sprintf("folder_%03d", folderIdx);
+
+        for (int fileIdx = 0; fileIdx < nFiles; ++fileIdx)
+        {
+            S9sVariantMap file;
+            S9sString     fileName;
+
+            fileName.sprintf("file_%04d", fileIdx);
+            file["item_name"] = fileName;
+            file["item_path"] = "/" + folderName;
+            file["item_type"] = "File";
+            files << file;
+        }
+
+        folder["item_name"] = folderName;
+        folder["item_path"] = "/";
+        folder["item_type"] = "Folder";
+        folder["sub_items"] = files;
+        folders << folder;
+    }
+
+    rootMap["item_path"] = "/";
+    rootMap["item_type"] = "Folder";
+    rootMap["sub_items"] = folders;
+    root = rootMap;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int idx = 0; idx < nLookups; ++idx)
+    {
+        S9sString path;
+
+        path.sprintf("/folder_%03d/file_%04d", 
+                idx % nFolders, (idx * 7) % nFiles);
+
+        S9S_VERIFY(root.pathExists(path));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    
+    elapsed = 
+        (end.tv_sec - start.tv_sec) * 1000000.0 +
+        (end.tv_nsec - start.tv_nsec) / 1000.0;
+
+    if (isVerbose())
+    {
+        printf("\n  %d lookups in %d entries: %.3f us/lookup\n", 
+                nLookups, nFolders * nFiles, elapsed / nLookups);
+    }
+
+    S9S_VERIFY(!root.pathExists("/folder_000/file_9999"));
+    return true;
+}
+
+S9S_UNIT_TEST_MAIN(UtS9sTreeNode)
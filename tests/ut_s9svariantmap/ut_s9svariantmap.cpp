@@ -20,6 +20,15 @@
 #include "ut_s9svariantmap.h"
 
 #include "S9sVariantMap"
+#include "S9sVariantList"
+#include "S9sJsonWriter"
+#include "S9sStringInterner"
+#include "S9sArena"
+
+#include <cstdio>
+#include <map>
+#include <fcntl.h>
+#include <unistd.h>
 
 //#define DEBUG
 #define WARNING
@@ -50,6 +59,12 @@ UtS9sVariantMap::runTest(
     PERFORM_TEST(testParser04,      retval);
     PERFORM_TEST(testParser05,      retval);
     PERFORM_TEST(testAssignments01, retval);
+    PERFORM_TEST(testJsonWriter,    retval);
+    PERFORM_TEST(testInternedKeys,  retval);
+    PERFORM_TEST(testBigMap,        retval);
+    PERFORM_TEST(testRandomChanges, retval);
+    PERFORM_TEST(testParserErrors,  retval);
+    PERFORM_TEST(testArena,         retval);
 
     return retval;
 }
@@ -73,6 +88,10 @@ UtS9sVariantMap::testCreate()
     S9S_COMPARE(theKeys[0], "a one");
     S9S_COMPARE(theKeys[1], "b two");
 
+    S9S_COMPARE(theMap.value("a one"), 1);
+    S9S_VERIFY(theMap.value("c three").isInvalid());
+    S9S_COMPARE(theMap.size(), 2);
+
     return true;
 }
 
@@ -310,6 +329,372 @@ UtS9sVariantMap::testAssignments01()
     return true;
 }
 
+/**
+ * The S9sJsonWriter appending into a string and streaming into a file
+ * descriptor.
+ */
+bool
+UtS9sVariantMap::testJsonWriter()
+{
+    S9sVariantMap  theMap;
+    S9sVariantList theList;
+    S9sString      buffer;
+    S9sString      fileName;
+    S9sString      content;
+    S9sString      errorString;
+    int            fd;
+
+    theList << 1 << "two";
+    theMap["zeta"]       = theList;
+    theMap["alpha"]      = "a \"quoted\"\tvalue\\\n";
+    theMap["class_name"] = "CmonHost";
+    theMap["port"]       = 3306;
+
+    // The object properties first, then the scalars, then the lists.
+    S9sJsonWriter(buffer).writeJson(theMap, 0, S9sFormatNormal);
+    S9S_COMPARE(buffer, 
+            "{ \"class_name\": \"CmonHost\", "
+            "\"alpha\": \"a \\\"quoted\\\"\\tvalue\\\\\\n\", "
+            "\"port\": 3306, \"zeta\": [ 1, \"two\"  ] }");
+    S9S_COMPARE(buffer, theMap.toJsonString(S9sFormatNormal));
+
+    // Appending to what is already in the buffer.
+    S9sJsonWriter(buffer).writeQuoted("x", S9sFormatNormal);
+    S9S_VERIFY(buffer.endsWith("}\"x\""));
+
+    buffer.clear();
+    S9sJsonWriter(buffer).writeToString(theMap);
+    S9S_COMPARE(buffer, theMap.toString());
+    S9S_VERIFY(buffer.startsWith("{\n    \"alpha\": "));
+
+    // Streaming a document bigger than the buffer into a file.
+    for (int idx = 0; idx < 10000; ++idx)
+    {
+        S9sString key;
+
+        key.sprintf("key%05d", idx);
+        theMap[key] = key;
+    }
+
+    fileName.sprintf("/tmp/ut_s9svariantmap_%d.json", getpid());
+    fd = ::open(STR(fileName), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    S9S_VERIFY(fd >= 0);
+
+    {
+        S9sJsonWriter writer(fd);
+
+        writer.writeJson(theMap, 0, S9sFormatIndent);
+        S9S_VERIFY(writer.flush());
+        S9S_VERIFY(!writer.hasError());
+    }
+
+    ::close(fd);
+    S9S_VERIFY(S9sString::readFile(fileName, content, errorString));
+    S9S_COMPARE(content, theMap.toJsonString(S9sFormatIndent));
+    unlink(STR(fileName));
+
+    return true;
+}
+
+/**
+ * The keys of the maps are interned, the same key in two different maps is
+ * the same string.
+ */
+bool
+UtS9sVariantMap::testInternedKeys()
+{
+    S9sVariantMap        map1, map2;
+    S9sString            longKey = S9sString("x") * 100;
+    S9sInternedString    key1, key2;
+    S9sVector<S9sString> keys;
+
+    S9S_VERIFY(map1.parse("{ \"hostname\": \"a\", \"port\": 1 }"));
+    S9S_VERIFY(map2.parse("{ \"port\": 2, \"hostname\": \"b\" }"));
+
+    S9S_VERIFY(
+            &map1.begin()->first.toString() == 
+            &map2.begin()->first.toString());
+
+    S9S_VERIFY(S9sStringInterner::intern("hostname") == 
+            &map1.begin()->first.toString());
+    S9S_VERIFY(S9sStringInterner::intern("hostname") != 
+            S9sStringInterner::intern("port"));
+    S9S_VERIFY(S9sStringInterner::nStrings() > 0u);
+
+    // The order is the order of the strings.
+    keys = map2.keys();
+    S9S_COMPARE(keys.size(), 2);
+    S9S_COMPARE(keys[0], "hostname");
+    S9S_COMPARE(keys[1], "port");
+
+    // Long keys are not interned, but they work the same way.
+    S9S_VERIFY(S9sStringInterner::intern(longKey) == NULL);
+    key1 = longKey;
+    key2 = key1;
+    S9S_VERIFY(!key1.isInterned());
+    S9S_VERIFY(key1 == key2);
+    S9S_VERIFY(key1.c_str() != key2.c_str());
+    S9S_VERIFY(key1 != S9sInternedString("hostname"));
+    S9S_VERIFY(S9sInternedString("hostname").isInterned());
+    S9S_VERIFY(S9sInternedString("hostname") < key1);
+    S9S_VERIFY(S9sInternedString("port") < key1);
+
+    map1[longKey] = 42;
+    S9S_VERIFY(map1.contains(longKey));
+    S9S_COMPARE(map1[longKey].toInt(), 42);
+    S9S_COMPARE(map1.keys().size(), 3);
+    S9S_COMPARE(map1.keys()[2], longKey);
+
+    /*
+     * Only the parser interns the keys, looking up or adding an element
+     * does not put the key into the pool.
+     */
+    int nStrings = S9sStringInterner::nStrings();
+
+    S9S_VERIFY(!map1.contains("ut_lookup_only_key"));
+    map1["ut_added_only_key"] = 1;
+    S9S_COMPARE((int) S9sStringInterner::nStrings(), nStrings);
+    S9S_VERIFY(!S9sInternedString("ut_added_only_key").isInterned());
+    S9S_VERIFY(S9sInternedString::intern("ut_interned_key").isInterned());
+    S9S_COMPARE((int) S9sStringInterner::nStrings(), nStrings + 1);
+
+    /*
+     * A big map (with hash index) built with keys that are interned later by
+     * the parser. The keys are hashed by the characters, so the elements are
+     * still found.
+     */
+    S9sVariantMap bigMap;
+    S9sString     json = "{ ";
+    S9sString     key;
+
+    for (int idx = 0; idx < 40; ++idx)
+    {
+        key.sprintf("ut_late_key_%02d", idx);
+        bigMap[key] = idx;
+
+        json += idx == 0 ? "" : ", ";
+        json += "\"" + key + "\": 1";
+    }
+
+    json += " }";
+    S9S_VERIFY(map2.parse(STR(json)));
+    S9S_VERIFY(S9sInternedString("ut_late_key_07").isInterned());
+
+    for (int idx = 0; idx < 40; ++idx)
+    {
+        key.sprintf("ut_late_key_%02d", idx);
+        S9S_VERIFY(bigMap.contains(key));
+        S9S_COMPARE(bigMap.at(key).toInt(), idx);
+    }
+
+    // The NULL pointer is the empty string.
+    const char *nullKey = NULL;
+
+    S9S_VERIFY(S9sInternedString(nullKey) == S9sInternedString(""));
+    S9S_VERIFY(!map1.contains(nullKey));
+    map1[nullKey] = 43;
+    S9S_COMPARE(map1[""].toInt(), 43);
+
+    return true;
+}
+
+/**
+ * A map that is big enough to have a hash index (when it is built on the 
+ * flat map), the elements are added and removed in mixed order.
+ */
+bool
+UtS9sVariantMap::testBigMap()
+{
+    S9sVariantMap        theMap, copy;
+    S9sVector<S9sString> keys;
+    S9sString            key;
+
+    for (int idx = 0; idx < 1000; ++idx)
+    {
+        key.sprintf("key%04d", idx * 7 % 1000);
+        theMap[key] = idx * 7 % 1000;
+    }
+
+    S9S_COMPARE(theMap.size(), 1000);
+
+    keys = theMap.keys();
+    for (uint idx = 1u; idx < keys.size(); ++idx)
+        S9S_VERIFY(keys[idx - 1] < keys[idx]);
+
+    for (int idx = 0; idx < 1000; ++idx)
+    {
+        key.sprintf("key%04d", idx);
+        S9S_VERIFY(theMap.contains(key));
+        S9S_COMPARE(theMap.at(key).toInt(), idx);
+    }
+
+    S9S_VERIFY(!theMap.contains("key1000"));
+    S9S_VERIFY(theMap.find("key1000") == theMap.end());
+
+    // Removing every second element.
+    for (int idx = 0; idx < 1000; idx += 2)
+    {
+        key.sprintf("key%04d", idx);
+        S9S_COMPARE(theMap.erase(key), 1);
+    }
+
+    S9S_COMPARE(theMap.size(), 500);
+    S9S_VERIFY(!theMap.contains("key0000"));
+    S9S_COMPARE(theMap["key0001"].toInt(), 1);
+    S9S_COMPARE(theMap["key0999"].toInt(), 999);
+    S9S_COMPARE(theMap.begin()->first.toString(), "key0001");
+
+    // Copies are equal until they are changed.
+    copy = theMap;
+    S9S_VERIFY(copy == theMap);
+    copy["key0001"] = 2;
+    S9S_VERIFY(!(copy == theMap));
+
+    // Shrinking back to a small map.
+    while (theMap.size() > 3u)
+        theMap.erase(theMap.begin());
+
+    S9S_COMPARE(theMap.size(), 3);
+    S9S_COMPARE(theMap["key0999"].toInt(), 999);
+    S9S_COMPARE(theMap.keys()[0], "key0995");
+
+    return true;
+}
+
+/**
+ * Inserting and erasing random keys and checking the map against an
+ * std::map after every step, so both the ordered and the unordered big maps
+ * and the transitions between the small and the big maps are tested.
+ */
+bool
+UtS9sVariantMap::testRandomChanges()
+{
+    S9sVariantMap                      theMap;
+    std::map<S9sString, int>           expected;
+    std::map<S9sString, int>::iterator expIt;
+    S9sVariantMap::const_iterator      it;
+    S9sString                          key;
+    uint                               random = 12345u;
+
+    for (int step = 0; step < 20000; ++step)
+    {
+        random = random * 1103515245u + 12345u;
+        key.sprintf("key%03u", (random >> 8) % (step < 10000 ? 400u : 40u));
+
+        if ((random >> 20) % 3 == 0)
+        {
+            S9S_COMPARE(
+                    (int) theMap.erase(key), (int) expected.erase(key));
+        } else {
+            theMap[key]   = step;
+            expected[key] = step;
+        }
+
+        // Erasing with the iterator now and then.
+        if (step % 97 == 0 && !theMap.empty())
+        {
+            S9sVariantMap::iterator next = theMap.erase(theMap.begin());
+
+            expected.erase(expected.begin());
+            if (expected.empty())
+            {
+                S9S_VERIFY(next == theMap.end());
+            } else {
+                S9S_COMPARE(next->first.toString(), expected.begin()->first);
+            }
+        }
+
+        S9S_COMPARE((int) theMap.size(), (int) expected.size());
+        if (step % 50 != 0)
+            continue;
+
+        it = theMap.begin();
+        for (expIt = expected.begin(); expIt != expected.end(); ++expIt, ++it)
+        {
+            S9S_VERIFY(it != theMap.end());
+            S9S_COMPARE(it->first.toString(), expIt->first);
+            S9S_COMPARE(it->second.toInt(), expIt->second);
+            S9S_COMPARE(theMap.at(expIt->first).toInt(), expIt->second);
+        }
+
+        S9S_VERIFY(it == theMap.end());
+    }
+
+    return true;
+}
+
+/**
+ * The parser builds the tree from objects allocated in its arena, here we
+ * check the escaped strings, the nested containers and the syntax errors 
+ * that leave half built subtrees behind.
+ */
+bool
+UtS9sVariantMap::testParserErrors()
+{
+    S9sVariantMap   theMap;
+    S9sVariantList  listValue;
+    bool            success;
+
+    success = theMap.parse(
+            "{ 'name': 'tab\\there', \"path\": \"a\\\"b\", bare: "
+            "[ { \"x\": [ 1, 2.5, true, null ] }, [], \"last\" ] }");
+    S9S_VERIFY(success);
+    S9S_COMPARE(theMap.size(), 3);
+    S9S_COMPARE(theMap["name"].toString(), "tab\there");
+    S9S_COMPARE(theMap["path"].toString(), "a\"b");
+
+    listValue = theMap["bare"].toVariantList();
+    S9S_COMPARE(listValue.size(), 3);
+    S9S_COMPARE(listValue[0].toVariantMap().at("x").size(), 4);
+    S9S_COMPARE(listValue[1].typeName(), "list");
+    S9S_COMPARE(listValue[2].toString(), "last");
+
+    S9S_VERIFY(!theMap.parse("{ \"a\": { \"b\": [ 1, 2, { \"c\": "));
+    S9S_VERIFY(!theMap.parse("{ \"a\": [ \"x\", \"y\" } }"));
+    S9S_VERIFY(!theMap.parse("{ \"a\" 1 }"));
+    S9S_VERIFY(!theMap.parse("[ 1, 2 ]"));
+    
+    success = theMap.parse("{ \"after\": \"error\" }");
+    S9S_VERIFY(success);
+    S9S_COMPARE(theMap.size(), 1);
+    S9S_COMPARE(theMap["after"].toString(), "error");
+
+    return true;
+}
+
+/**
+ * The arena reuses the released chunks of the same size.
+ */
+bool
+UtS9sVariantMap::testArena()
+{
+    S9sArena  arena;
+    void     *chunk1, *chunk2, *chunk3;
+
+    chunk1 = arena.allocate(24);
+    chunk2 = arena.allocate(24);
+    S9S_VERIFY(chunk1 != chunk2);
+    S9S_COMPARE((ulong) chunk1 % 16, 0);
+    S9S_COMPARE((ulong) chunk2 % 16, 0);
+    S9S_COMPARE(arena.nBlocks(), 1);
+
+    arena.release(chunk1, 24);
+    chunk3 = arena.allocate(32);
+    S9S_VERIFY(chunk3 == chunk1);
+
+    // A chunk bigger than a block gets its own block.
+    arena.allocate(1024 * 1024);
+    S9S_COMPARE(arena.nBlocks(), 2);
+    S9S_VERIFY(arena.memoryUsage() >= 1024 * 1024);
+
+    for (int idx = 0; idx < 10000; ++idx)
+        arena.allocate(48);
+
+    S9S_VERIFY(arena.nBlocks() < 10);
+
+    return true;
+}
+
 S9S_UNIT_TEST_MAIN(UtS9sVariantMap)
 
 
@@ -37,5 +37,11 @@ class UtS9sVariantMap : public S9sUnitTest
         bool testParser04();
         bool testParser05();
         bool testAssignments01();
+        bool testJsonWriter();
+        bool testInternedKeys();
+        bool testBigMap();
+        bool testRandomChanges();
+        bool testParserErrors();
+        bool testArena();
 };
 